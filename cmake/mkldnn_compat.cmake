@@ -34,7 +34,6 @@ endmacro()
 
 set(COMPAT_CACHE_BOOL_VARS
     "VERBOSE"
-    "ENABLE_CONCURRENT_EXEC"
     "BUILD_EXAMPLES"
     "BUILD_TESTS"
     "BUILD_FOR_CI"
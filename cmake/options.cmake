@@ -30,13 +30,6 @@ option(DNNL_VERBOSE
     "allows DNNL be verbose whenever DNNL_VERBOSE
     environment variable set to 1" ON) # enabled by default
 
-option(DNNL_ENABLE_CONCURRENT_EXEC
-    "disables sharing a common scratchpad between primitives.
-    This option must be turned on if there is a possibility of concurrent
-    execution of primitives that were created in the same thread.
-    CAUTION: enabling this option increases memory consumption"
-    OFF) # disabled by default
-
 # =============================
 # Building properties and scope
 # =============================
@@ -208,6 +208,19 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the implementation selection @p mode set in the attribute @p attr
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_impl_selection_mode(
+        const_dnnl_primitive_attr_t attr, dnnl_impl_selection_mode_t *mode);
+
+/// Sets implementation selection @p mode.
+///
+/// The possible values are: #dnnl_impl_selection_mode_first (default) and
+/// #dnnl_impl_selection_mode_fastest. With the latter, the first creation of
+/// a primitive descriptor for a problem runs every implementation that
+/// supports it and the later creations use the fastest one.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_impl_selection_mode(
+        dnnl_primitive_attr_t attr, dnnl_impl_selection_mode_t mode);
+
 /// Returns @p count, correspondence scale @p mask, and a pointer to a constant
 /// floating point array of output @p scales for given @p attr, previously set
 /// by dnnl_primitive_attr_set_output_scales.
@@ -261,6 +274,13 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_output_scales(
 ///      responsibility to set proper values. The following formula must hold:
 ///
 ///      \f[count = \prod\limits_{d \in mask} output.dims[d]\f]
+///
+/// If the scales are not known at the primitive creation, set @p count to 1
+/// and @p scales[0] to #DNNL_RUNTIME_F32_VAL. The scales are then passed at
+/// each execution as the #DNNL_ARG_ATTR_OUTPUT_SCALES argument, and one
+/// primitive serves any values. Only some implementations support the
+/// runtime scales, e.g. the int8 convolutions and inner products and the
+/// reorders on the CPU.
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_output_scales(
         dnnl_primitive_attr_t attr, dnnl_dim_t count, int mask,
         const float *scales);
@@ -355,6 +375,59 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_eltwise(
         const_dnnl_post_ops_t post_ops, int index, float *scale,
         dnnl_alg_kind_t *alg, float *alpha, float *beta);
 
+/// Appends a depthwise convolution post operation to the @p post_ops. The
+/// depthwise convolution has a square @p kernel of the given size, the
+/// @p stride and the @p padding applied to every side of the spatial
+/// dimensions, and takes the destination of the base convolution as its
+/// source.
+///
+/// The kind of this post operation is #dnnl_convolution.
+///
+/// The weights and the bias of the depthwise convolution are passed at
+/// execution time as #DNNL_ARG_ATTR_POST_OP_DW | #DNNL_ARG_WEIGHTS and
+/// #DNNL_ARG_ATTR_POST_OP_DW | #DNNL_ARG_BIAS, in the formats returned by
+/// querying #dnnl_query_weights_md with indices 2 and 3 respectively. The
+/// destination of the primitive becomes the destination of the depthwise
+/// convolution.
+///
+/// @note
+///      Only a single depthwise convolution post operation is allowed, and it
+///      is supported by forward convolutions only.
+dnnl_status_t DNNL_API dnnl_post_ops_append_dw_conv(dnnl_post_ops_t post_ops,
+        dnnl_dim_t kernel, dnnl_dim_t stride, dnnl_dim_t padding);
+
+/// Gets the depthwise convolution parameters of the post operation with index
+/// @p index in the sequence of @p post_ops.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_dw_conv(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_dim_t *kernel,
+        dnnl_dim_t *stride, dnnl_dim_t *padding);
+
+/// Appends a binary post operation to the @p post_ops. The binary operation
+/// @p alg (#dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max or
+/// #dnnl_binary_min) takes the result of the previous operations as its
+/// first source, and the tensor described by @p src1_desc as its second one.
+///
+/// The kind of this post operation is #dnnl_binary.
+///
+/// The computations would be:
+/// dst[] <- binary_op ( op(...), src1[] ) // instead of dst[] <- op(...)
+///
+/// The dimensions of @p src1_desc follow the broadcasting rules of the
+/// binary primitive with respect to the destination. The second source is
+/// passed at execution time as #DNNL_ARG_ATTR_POST_OP_BINARY |
+/// #DNNL_ARG_SRC_1.
+///
+/// @note
+///      Only a single binary post operation is allowed.
+dnnl_status_t DNNL_API dnnl_post_ops_append_binary(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg, const dnnl_memory_desc_t *src1_desc);
+
+/// Gets the binary parameters of the post operation with index @p index in
+/// the sequence of @p post_ops.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_binary(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg,
+        const dnnl_memory_desc_t **src1_desc);
+
 /// @}
 
 /// @}
@@ -483,6 +556,13 @@ size_t DNNL_API dnnl_memory_desc_get_size(
 ///   library doesn't own allocated memory.
 /// - DNNL_MEMORY_ALLOCATE to ask the library to allocate and
 ///   attach memory. In this case the library owns allocated memory.
+/// - DNNL_MEMORY_ALLOCATE_REPLICATED to ask the library to allocate a copy
+///   of the memory on each NUMA node. The primitives that support it read
+///   the copy on the node of the thread, which avoids the remote accesses to
+///   constant data, e.g. weights, on the multi-socket systems. The data
+///   handle is the one of the first copy. The other copies are updated when
+///   the memory is written by a primitive (e.g. a reorder) or unmapped. Same
+///   as DNNL_MEMORY_ALLOCATE on a single node and for the GPU engines.
 /// - DNNL_MEMORY_NONE to create dnnl_memory w/o attached memory.
 dnnl_status_t DNNL_API dnnl_memory_create(dnnl_memory_t *memory,
         const dnnl_memory_desc_t *memory_desc, dnnl_engine_t engine,
@@ -1191,6 +1271,8 @@ dnnl_status_t DNNL_API dnnl_lrn_backward_desc_init(dnnl_lrn_desc_t *lrn_desc,
 ///      if #dnnl_use_global_stats bit-flags is set in @p flags
 ///  - scale_and_shift (#dnnl_query_weights_md, 0),
 ///      if #dnnl_use_scaleshift bit-flags is set in @p flags
+///  - src_1 (#dnnl_query_src_md, 0),
+///      if #dnnl_fuse_norm_add_relu bit-flags is set in @p flags
 ///
 /// Outputs:
 ///  - dst (#dnnl_query_dst_md, 0)
@@ -1201,8 +1283,8 @@ dnnl_status_t DNNL_API dnnl_lrn_backward_desc_init(dnnl_lrn_desc_t *lrn_desc,
 ///      if #dnnl_use_global_stats bit-flags is not set in @p flags
 ///      and @p prop_kind = #dnnl_forward_training
 ///  - workspace (#dnnl_query_workspace_md, 0),
-///      if #dnnl_fuse_norm_relu bit-flags is set in @p flags
-///      and @p prop_kind = #dnnl_forward_training
+///      if #dnnl_fuse_norm_relu or #dnnl_fuse_norm_add_relu bit-flags is set
+///      in @p flags and @p prop_kind = #dnnl_forward_training
 ///
 /// @note In-place operation is supported; that is, dst points to the same memory
 ///       as src.
@@ -1226,10 +1308,13 @@ dnnl_status_t DNNL_API dnnl_batch_normalization_forward_desc_init(
 ///  - scale_and_shift (#dnnl_query_weights_md, 0),
 ///      if #dnnl_use_scaleshift bit-flags is set in @p flags
 ///  - workspace (#dnnl_query_workspace_md, 0),
-///      if #dnnl_fuse_norm_relu bit-flags is set in @p flags
+///      if #dnnl_fuse_norm_relu or #dnnl_fuse_norm_add_relu bit-flags is set
+///      in @p flags
 ///
 /// Outputs:
 ///  - diff_src (#dnnl_query_diff_src_md, 0)
+///  - diff_src_1 (#dnnl_query_diff_src_md, 0),
+///      if #dnnl_fuse_norm_add_relu bit-flags is set in @p flags
 ///  - diff_scale_and_shift (#dnnl_query_diff_weights_md, 0),
 ///      if #dnnl_use_scaleshift bit-flags is set in @p flags
 ///      and @p prop_kind = #dnnl_backward
@@ -1855,6 +1940,157 @@ dnnl_status_t DNNL_API dnnl_lbr_gru_backward_desc_init(
 
 /// @}
 
+/// @addtogroup c_api_matmul Matrix Multiplication
+/// A primitive to perform matrix-matrix multiplication. The batched mode
+/// is supported with 3D or higher-dimensional tensors; batch dimensions of
+/// size 1 in the source or weights tensors are broadcast.
+///
+/// @sa @ref dev_guide_matmul in developer guide
+/// @sa @ref cpp_api_matmul in @ref cpp_api
+/// @{
+
+/// Initializes a matrix multiplication descriptor @p matmul_desc using
+/// memory descriptors. In order to create a matmul without bias, @p bias_desc
+/// should be either @c NULL or a pointer to a descriptor with memory format
+/// kind equal to #dnnl_format_kind_undef.
+///
+/// Any of the dimensions (and strides) of the memory descriptors may be set
+/// to #DNNL_RUNTIME_DIM_VAL. In this case the actual values are taken from
+/// the memory objects passed at the primitive execution time.
+///
+/// @note Memory descriptors are allowed to be initialized with
+///       #dnnl_format_kind_any value of @p format_kind.
+///
+/// Inputs:
+///  - src (#dnnl_query_src_md, 0)
+///  - weights (#dnnl_query_weights_md, 0)
+///  - bias (#dnnl_query_weights_md, 1), if created with bias
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_matmul_desc_init(dnnl_matmul_desc_t *matmul_desc,
+        const dnnl_memory_desc_t *src_desc,
+        const dnnl_memory_desc_t *weights_desc,
+        const dnnl_memory_desc_t *bias_desc,
+        const dnnl_memory_desc_t *dst_desc);
+
+/// @}
+
+/// @addtogroup c_api_binary Binary
+/// A primitive to perform tensor operations over two tensors.
+///
+/// @sa @ref dev_guide_binary in developer guide
+/// @sa @ref cpp_api_binary in @ref cpp_api
+/// @{
+
+/// Initializes a binary descriptor @p binary_desc with the algorithm
+/// @p alg_kind (#dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max or
+/// #dnnl_binary_min) and the memory descriptors @p src0_desc, @p src1_desc
+/// and @p dst_desc.
+///
+/// The dimensions of @p src1_desc are either equal to the ones of
+/// @p src0_desc or 1, in which case the second source is broadcast. The
+/// destination has the dimensions of the first source.
+///
+/// @note Memory descriptor @p dst_desc is allowed to be initialized with
+///       #dnnl_format_kind_any value of @p format_kind.
+///
+/// Inputs:
+///  - src0 (#dnnl_query_src_md, 0)
+///  - src1 (#dnnl_query_src_md, 1)
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_binary_desc_init(dnnl_binary_desc_t *binary_desc,
+        dnnl_alg_kind_t alg_kind, const dnnl_memory_desc_t *src0_desc,
+        const dnnl_memory_desc_t *src1_desc,
+        const dnnl_memory_desc_t *dst_desc);
+
+/// @}
+
+/// @addtogroup c_api_reduction Reduction
+/// A primitive to reduce a tensor along a set of its dimensions.
+///
+/// @sa @ref dev_guide_reduction in developer guide
+/// @sa @ref cpp_api_reduction in @ref cpp_api
+/// @{
+
+/// Initializes a reduction descriptor @p reduction_desc with the algorithm
+/// @p alg_kind and the memory descriptors @p src_desc and @p dst_desc.
+///
+/// The source is reduced along the dimensions that are 1 in @p dst_desc and
+/// are not 1 in @p src_desc; the other dimensions must be equal. The
+/// parameters @p p and @p eps are used by the lp norm algorithms only.
+///
+/// @note Memory descriptor @p dst_desc is allowed to be initialized with
+///       #dnnl_format_kind_any value of @p format_kind.
+///
+/// Inputs:
+///  - src (#dnnl_query_src_md, 0)
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_reduction_desc_init(
+        dnnl_reduction_desc_t *reduction_desc, dnnl_alg_kind_t alg_kind,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc,
+        float p, float eps);
+
+/// @}
+
+/// @addtogroup c_api_resampling Resampling
+/// A primitive to compute resampling operation on 1D, 2D or 3D data tensor
+/// using Nearest Neighbor or Linear (Bilinear, Trilinear) interpolation
+/// method.
+///
+/// @sa @ref dev_guide_resampling in developer guide
+/// @sa @ref cpp_api_resampling in @ref cpp_api
+/// @{
+
+/// Initializes a resampling descriptor @p resampling_desc for forward
+/// propagation using @p prop_kind, @p alg_kind, the scaling @p factors of the
+/// spatial dimensions, and the memory descriptors.
+///
+/// Either @p factors or @p dst_desc may be @c NULL. The factors are the
+/// ratios of the spatial dimensions of @p dst_desc to the ones of
+/// @p src_desc when @p factors is @c NULL, and the destination is of the
+/// spatial dimensions of the source scaled by the factors (and rounded down)
+/// in #dnnl_format_kind_any when @p dst_desc is @c NULL.
+///
+/// @note Memory descriptor @p dst_desc is allowed to be initialized with
+///       #dnnl_format_kind_any value of @p format_kind.
+///
+/// Inputs:
+///  - src (#dnnl_query_src_md, 0)
+///
+/// Outputs:
+///  - dst (#dnnl_query_dst_md, 0)
+dnnl_status_t DNNL_API dnnl_resampling_forward_desc_init(
+        dnnl_resampling_desc_t *resampling_desc, dnnl_prop_kind_t prop_kind,
+        dnnl_alg_kind_t alg_kind, const float *factors,
+        const dnnl_memory_desc_t *src_desc, const dnnl_memory_desc_t *dst_desc);
+
+/// Initializes a resampling descriptor @p resampling_desc for backward
+/// propagation using @p alg_kind, the scaling @p factors of the spatial
+/// dimensions, and the memory descriptors.
+///
+/// The factors are the ratios of the spatial dimensions of @p diff_dst_desc
+/// to the ones of @p diff_src_desc when @p factors is @c NULL.
+///
+/// @note Memory descriptor @p diff_src_desc is allowed to be initialized with
+///       #dnnl_format_kind_any value of @p format_kind.
+///
+/// Inputs:
+///  - diff_dst (#dnnl_query_diff_dst_md, 0)
+///
+/// Outputs:
+///  - diff_src (#dnnl_query_diff_src_md, 0)
+dnnl_status_t DNNL_API dnnl_resampling_backward_desc_init(
+        dnnl_resampling_desc_t *resampling_desc, dnnl_alg_kind_t alg_kind,
+        const float *factors, const dnnl_memory_desc_t *diff_src_desc,
+        const dnnl_memory_desc_t *diff_dst_desc);
+
+/// @}
+
 /// @}
 
 /// @addtogroup c_api_engine Engine operations
@@ -1932,6 +2168,7 @@ dnnl_status_t DNNL_API dnnl_stream_destroy(dnnl_stream_t stream);
 ///  - 0 -- no verbose output (default)
 ///  - 1 -- primitive information at execution
 ///  - 2 -- primitive information at creation and execution
+///  - 3 -- as 2, with the achieved GFLOPS and GB/s of the executions
 ///
 /// @note
 ///     Dumping information might affect performance.
@@ -1947,6 +2184,40 @@ dnnl_status_t DNNL_API dnnl_set_verbose(int level);
 ///     This setting overrides the DNNL_JIT_DUMP environment variable.
 dnnl_status_t DNNL_API dnnl_set_jit_dump(int enable);
 
+/// Sets the placement on the NUMA nodes of the memory allocated by the CPU
+/// engine for the memory objects created afterwards.
+///
+/// @note
+///     This setting overrides the DNNL_NUMA_POLICY environment variable,
+///     which can be `first_touch`, `interleave` or `local`.
+dnnl_status_t DNNL_API dnnl_set_numa_policy(dnnl_numa_policy_t policy);
+
+/// Enables or disables the collection of trace events.
+/// The enable parameter can be:
+///  - 0 -- disable (default)
+///  - any other value -- enable
+///
+/// Each thread creating or executing primitives records the events in its own
+/// ring buffer of the last DNNL_TRACE_CAPACITY (4096 by default) events.
+/// Unlike the verbose mode, recording neither prints nor takes locks.
+dnnl_status_t DNNL_API dnnl_set_trace(int enable);
+
+/// Calls @p callback with @p user_data for each recorded trace event, thread
+/// by thread, in the order the events were recorded. The event pointers are
+/// only valid during the call.
+///
+/// @note
+///     The events recorded concurrently with the call may be missed.
+dnnl_status_t DNNL_API dnnl_trace_visit(
+        dnnl_trace_callback_t callback, void *user_data);
+
+/// Writes the recorded trace events to the file @p path in the Chrome trace
+/// event format, which chrome://tracing and Perfetto can display.
+dnnl_status_t DNNL_API dnnl_trace_dump(const char *path);
+
+/// Discards the recorded trace events.
+dnnl_status_t DNNL_API dnnl_trace_clear();
+
 /// Gets library version information.
 /// Version information includes:
 ///  - major -- major version number
@@ -2041,6 +2312,17 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const int8_t *A,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
+
+/// Sets the GEMM tuning profile: the file with the threading and blocking
+/// parameters to use for particular matrix-matrix multiplications, as
+/// written by the gemm_tune driver of benchdnn. Passing NULL or an empty
+/// string clears the profile.
+///
+/// @note
+///     This setting overrides the DNNL_GEMM_PROFILE environment variable.
+///     The profile is cleared if the file cannot be read or is malformed,
+///     and #dnnl_invalid_arguments is returned in this case.
+dnnl_status_t DNNL_API dnnl_set_gemm_profile(const char *path);
 /// @}
 
 /// @}
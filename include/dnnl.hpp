@@ -216,6 +216,14 @@ public:
         inner_product = dnnl_inner_product,
         /// A rnn primitive.
         rnn = dnnl_rnn,
+        /// A matrix multiplication primitive.
+        matmul = dnnl_matmul,
+        /// A binary primitive.
+        binary = dnnl_binary,
+        /// A reduction primitive.
+        reduction = dnnl_reduction,
+        /// A resampling primitive.
+        resampling = dnnl_resampling,
     };
 
     primitive(const_dnnl_primitive_desc_t c_pd);
@@ -258,6 +266,19 @@ inline dnnl_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
     return static_cast<dnnl_scratchpad_mode_t>(mode);
 }
 
+/// Implementation selection mode
+enum class impl_selection_mode {
+    /// The first implementation that supports the problem is used (default)
+    first = dnnl_impl_selection_mode_first,
+    /// The fastest implementation that supports the problem is used, as
+    /// measured the first time a primitive descriptor is created for it
+    fastest = dnnl_impl_selection_mode_fastest,
+};
+
+inline dnnl_impl_selection_mode_t convert_to_c(impl_selection_mode mode) {
+    return static_cast<dnnl_impl_selection_mode_t>(mode);
+}
+
 /// Propagation kind
 enum class prop_kind {
     /// Forward data propagation (training mode). In this mode primitives
@@ -290,12 +311,15 @@ inline dnnl_prop_kind_t convert_to_c(prop_kind kind) {
 /// Kinds of algorithms.
 enum class algorithm {
     undef = dnnl_alg_kind_undef,
-    /// Convolution algorithm(either direct or Winograd) is chosen just in time
+    /// Convolution algorithm(either direct, Winograd or FFT) is chosen just in
+    /// time
     convolution_auto = dnnl_convolution_auto,
     /// Direct convolution
     convolution_direct = dnnl_convolution_direct,
     /// Winograd convolution
     convolution_winograd = dnnl_convolution_winograd,
+    /// FFT convolution
+    convolution_fft = dnnl_convolution_fft,
     /// Direct deconvolution
     deconvolution_direct = dnnl_deconvolution_direct,
     /// Winograd deconvolution
@@ -353,6 +377,36 @@ enum class algorithm {
     /// Primitive expects 4 biases on input:
     /// \f$[b_{u}, b_{r}, b_{c_x}, b_{c_h}]\f$
     lbr_gru = dnnl_lbr_gru,
+    /// Binary add
+    binary_add = dnnl_binary_add,
+    /// Binary mul
+    binary_mul = dnnl_binary_mul,
+    /// Binary max
+    binary_max = dnnl_binary_max,
+    /// Binary min
+    binary_min = dnnl_binary_min,
+    /// Reduction using max
+    reduction_max = dnnl_reduction_max,
+    /// Reduction using min
+    reduction_min = dnnl_reduction_min,
+    /// Reduction using sum
+    reduction_sum = dnnl_reduction_sum,
+    /// Reduction using mul
+    reduction_mul = dnnl_reduction_mul,
+    /// Reduction using mean
+    reduction_mean = dnnl_reduction_mean,
+    /// Reduction using lp norm: (max(sum |x|^p, eps))^(1/p)
+    reduction_norm_lp_max = dnnl_reduction_norm_lp_max,
+    /// Reduction using lp norm: (sum |x|^p + eps)^(1/p)
+    reduction_norm_lp_sum = dnnl_reduction_norm_lp_sum,
+    /// Reduction using lp norm without the final root: max(sum |x|^p, eps)
+    reduction_norm_lp_power_p_max = dnnl_reduction_norm_lp_power_p_max,
+    /// Reduction using lp norm without the final root: sum |x|^p + eps
+    reduction_norm_lp_power_p_sum = dnnl_reduction_norm_lp_power_p_sum,
+    /// Nearest neighbor resampling
+    resampling_nearest = dnnl_resampling_nearest,
+    /// Linear (bilinear, trilinear) resampling
+    resampling_linear = dnnl_resampling_linear,
 };
 
 inline dnnl_alg_kind_t convert_to_c(algorithm aalgorithm) {
@@ -396,14 +450,33 @@ enum class normalization_flags : unsigned {
     ///    fused with ReLU via post ops API
     ///  - on training primitive requires workspace (required to be able to
     ///    perform backward pass)
-    fuse_norm_relu = dnnl_fuse_norm_relu
+    fuse_norm_relu = dnnl_fuse_norm_relu,
+
+    /// Fuse with an addition and ReLU: dst = ReLU(BN(src) + src_1)
+    ///
+    /// If specified:
+    ///  - on forward propagation the addend (usually a residual) is taken
+    ///    as #DNNL_ARG_SRC_1 with the same memory descriptor as src
+    ///  - on training primitive requires workspace, as with
+    ///    #dnnl::normalization_flags::fuse_norm_relu
+    ///  - on backward propagation the gradient of the addend, that is the
+    ///    diff_dst masked by the ReLU, is stored to #DNNL_ARG_DIFF_SRC_1
+    ///
+    /// Cannot be combined with #dnnl::normalization_flags::fuse_norm_relu.
+    fuse_norm_add_relu = dnnl_fuse_norm_add_relu
 };
 
 inline dnnl_normalization_flags_t convert_to_c(normalization_flags aflag) {
     return static_cast<dnnl_normalization_flags_t>(aflag);
 }
 
-enum class rnn_flags : unsigned { undef = dnnl_rnn_flags_undef };
+/// RNN cell flags.
+enum class rnn_flags : unsigned {
+    /// Undefined RNN flags
+    undef = dnnl_rnn_flags_undef,
+    /// Use per-sample sequence lengths passed as #DNNL_ARG_SEQ_LENGTHS
+    use_seq_lengths = dnnl_rnn_flags_use_seq_lengths,
+};
 
 inline dnnl_rnn_flags_t convert_to_c(rnn_flags aflag) {
     return static_cast<dnnl_rnn_flags_t>(aflag);
@@ -502,6 +575,19 @@ enum class query {
     /// implementation name
     impl_info_str = dnnl_query_impl_info_str,
 
+    /// arithmetic operations of an execution, estimated
+    ///
+    /// a multiply-add counts as two operations, 0 if unknown
+    flops_s64 = dnnl_query_flops_s64,
+    /// memory read by an execution (bytes), estimated
+    ///
+    /// the arguments and the scratchpad, 0 if unknown
+    bytes_read_s64 = dnnl_query_bytes_read_s64,
+    /// memory written by an execution (bytes), estimated
+    ///
+    /// the arguments and the scratchpad, 0 if unknown
+    bytes_written_s64 = dnnl_query_bytes_written_s64,
+
     /// op descriptor
     op_d = dnnl_query_op_d,
     /// convolution descriptor
@@ -526,6 +612,14 @@ enum class query {
     inner_product_d = dnnl_query_inner_product_d,
     /// rnn descriptor
     rnn_d = dnnl_query_rnn_d,
+    /// matmul descriptor
+    matmul_d = dnnl_query_matmul_d,
+    /// binary descriptor
+    binary_d = dnnl_query_binary_d,
+    /// reduction descriptor
+    reduction_d = dnnl_query_reduction_d,
+    /// resampling descriptor
+    resampling_d = dnnl_query_resampling_d,
 
     /// source memory desc
     src_md = dnnl_query_src_md,
@@ -551,233 +645,6 @@ inline dnnl_query_t convert_to_c(query aquery) {
 
 /// @}
 
-/// @addtogroup cpp_api_attr Attributes
-/// An extension for controlling primitive behavior.
-///
-/// @sa @ref c_api_attributes in @ref c_api
-/// @{
-
-/// @cond DO_NOT_DOCUMENT_THIS
-template <>
-struct handle_traits<dnnl_post_ops_t> {
-    static constexpr auto destructor = &dnnl_post_ops_destroy;
-};
-/// @endcond
-
-/// Post operations
-///
-/// @sa @ref dev_guide_attributes_post_ops
-struct post_ops : public handle<dnnl_post_ops_t> {
-    /// Creates an empty sequence of post operations.
-    post_ops() {
-        dnnl_post_ops_t result;
-        error::wrap_c_api(dnnl_post_ops_create(&result),
-                "could not create post operation sequence");
-        reset(result);
-    }
-
-    /// Returns the length of post operations
-    int len() const { return dnnl_post_ops_len(get()); }
-
-    /// Returns the kind of post operation with index @p index.
-    primitive::kind kind(int index) const {
-        error::wrap_c_api(index < len() ? dnnl_success : dnnl_invalid_arguments,
-                "post_ops index is out of range");
-        return static_cast<primitive::kind>(
-                dnnl_post_ops_get_kind(get(), index));
-    }
-
-    /// Appends accumulation (sum) post operation. Prior to accumulating the
-    /// result, the previous value would be multiplied by @p scale.
-    ///
-    /// The kind of this post operation is #dnnl_sum.
-    ///
-    /// This feature might improve performance for cases like residual learning
-    /// blocks, where the result of convolution is accumulated to the previously
-    /// computed activations. The parameter @p scale might be extreme for the
-    /// integer-based computations when the result and previous activations have
-    /// different logical scaling factors.
-    ///
-    /// In the simplest case when the accumulation is the only post operation,
-    /// the computations would be:
-    /// dst[] <- scale * dst[] + op(...) // instead of dst[] <- op(...)
-    ///
-    /// @note
-    ///     This post operation (as well as all the others) disregards the
-    ///     original layout of the destination; that is, the layout of the
-    ///     original destination is expected to be the same as the layout of the
-    ///     stored destination.
-    void append_sum(float scale = 1.) {
-        error::wrap_c_api(
-                dnnl_post_ops_append_sum(get(), scale), "could not append sum");
-    }
-
-    /// Gets the parameters of the accumulation (sum) post operation with index
-    /// @p index.
-    void get_params_sum(int index, float &scale) const {
-        error::wrap_c_api(dnnl_post_ops_get_params_sum(get(), index, &scale),
-                "could not get sum params");
-    }
-
-    /// Appends eltwise post operation.
-    ///
-    /// The kind of this post operation is #dnnl_eltwise.
-    ///
-    /// In the simplest case when the eltwise is the only post operation, the
-    /// computations would be:
-    /// dst[] <- scale * eltwise_op ( op(...) ) // instead of dst[] <- op(...)
-    /// where eltwise_op is configured with the given parameters.
-    void append_eltwise(float scale, algorithm alg, float alpha, float beta) {
-        error::wrap_c_api(dnnl_post_ops_append_eltwise(
-                                  get(), scale, convert_to_c(alg), alpha, beta),
-                "could not append eltwise");
-    }
-
-    /// Gets the eltwise parameters of the post operation with index @p index.
-    void get_params_eltwise(int index, float &scale, algorithm &alg,
-            float &alpha, float &beta) const {
-        dnnl_alg_kind_t c_alg;
-        error::wrap_c_api(dnnl_post_ops_get_params_eltwise(
-                                  get(), index, &scale, &c_alg, &alpha, &beta),
-                "could not get eltwise params");
-        alg = static_cast<algorithm>(c_alg);
-    }
-};
-
-/// @cond DO_NOT_DOCUMENT_THIS
-template <>
-struct handle_traits<dnnl_primitive_attr_t> {
-    static constexpr auto destructor = &dnnl_primitive_attr_destroy;
-};
-/// @endcond
-
-/// Primitive attributes
-///
-/// @sa @ref dev_guide_attributes
-struct primitive_attr : public handle<dnnl_primitive_attr_t> {
-    /// Creates a default primitive attribute.
-    primitive_attr() {
-        dnnl_primitive_attr_t result;
-        error::wrap_c_api(dnnl_primitive_attr_create(&result),
-                "could not create a primitive attr");
-        reset(result);
-    }
-
-    /// Returns the scratchpad mode.
-    scratchpad_mode get_scratchpad_mode() const {
-        dnnl_scratchpad_mode_t result;
-        error::wrap_c_api(
-                dnnl_primitive_attr_get_scratchpad_mode(get(), &result),
-                "could not get scratchpad mode");
-        return scratchpad_mode(result);
-    }
-
-    /// Sets scratchpad mode.
-    void set_scratchpad_mode(scratchpad_mode mode) {
-        error::wrap_c_api(dnnl_primitive_attr_set_scratchpad_mode(
-                                  get(), dnnl::convert_to_c(mode)),
-                "could not set scratchpad mode");
-    }
-
-    /// Gets correspondence scale @p mask and a constant floating point vector
-    /// of output @p scales previously set by set_output_scales.
-    void get_output_scales(int &mask, std::vector<float> &scales) const {
-        dnnl_dim_t count;
-        int c_mask;
-        const float *c_scales;
-        error::wrap_c_api(dnnl_primitive_attr_get_output_scales(
-                                  get(), &count, &c_mask, &c_scales),
-                "could not get int output scales");
-        scales.resize(count);
-
-        mask = c_mask;
-        for (dnnl_dim_t c = 0; c < count; ++c)
-            scales[c] = c_scales[c];
-    }
-
-    /// Sets output scales for primitive operations. The correspondence scale
-    /// @p mask is stored for future use.
-    ///
-    /// The @p mask argument defines the correspondence between the output
-    /// tensor dimensions and the @p scales vector. Set the i-th bit of @p mask
-    /// to 1 to use a dedicated scaling factor for each slice of the output
-    /// tensor over the i-th dimension. Set @p mask to 0 to use a common
-    /// scaling factor for the whole output tensor.
-    ///
-    /// @note
-    ///      The dimension order is always native and does not depend on the
-    ///      actual layout used. Examples:
-    ///       - 2D dimensional data the order of dimensions is always: (n, c)
-    ///       - 4D dimensional data the order is always: (n, c, h, w)
-    ///       - 5D dimensional weights the order is always: (g, oc, ic, kh, kw)
-    void set_output_scales(int mask, const std::vector<float> &scales) {
-        error::wrap_c_api(dnnl_primitive_attr_set_output_scales(get(),
-                                  (dnnl_dim_t)scales.size(), mask, &scales[0]),
-                "could not set int output scales");
-    }
-
-    /// Returns @p post_ops previously set by set_post_ops.
-    const post_ops get_post_ops() const {
-        post_ops result;
-        const_dnnl_post_ops_t c_result;
-        error::wrap_c_api(dnnl_primitive_attr_get_post_ops(get(), &c_result),
-                "could not get post operation sequence");
-        result.reset(const_cast<dnnl_post_ops_t>(c_result), true);
-        return result;
-    }
-
-    /// Sets @p post_ops for future use.
-    void set_post_ops(post_ops ops) {
-        error::wrap_c_api(dnnl_primitive_attr_set_post_ops(get(), ops.get()),
-                "could not set post operation sequence");
-    }
-
-    /// Sets quantization @p scale and @p shift for RNN data tensors.  For
-    /// performance reasons, the low-precision configuration of the RNN
-    /// primitive expects input activations to have the unsigned int8 data type.
-    /// Scale and shift used to quantize floating-point data to unsigned integer
-    /// must be passed to the RNN primitive using attributes.
-    /// @note
-    ///     Quantization scale and shift are common for src_layer, src_iter,
-    ///     dst_iter, and dst_layer.
-    void set_rnn_data_qparams(float scale, float shift) {
-        error::wrap_c_api(
-                dnnl_primitive_attr_set_rnn_data_qparams(get(), scale, shift),
-                "could not set rnn data int scale/shift");
-    }
-
-    /// Sets quantization scales @p weights_scales for RNN weights tensors.  The
-    /// low-precision configuration of the RNN primitive expects input weights
-    /// to have the signed int8 data type. Scales used to quantize
-    /// floating-point data to signed integer must be passed to the RNN
-    /// primitive using attributes.  The @p mask argument defines correspondence
-    /// between output tensor dimensions and the @p weights_scales array. Set
-    /// the i-th bit of @p mask to 1 to use a dedicated scaling factor for each
-    /// slice of the output tensor over the i-th dimension. Set @p mask to 0 to
-    /// use a common scaling factor for the whole output tensor.
-    /// @note
-    ///      The dimension order is always native and does not depend on the
-    ///      actual layout used. For example, five-dimensional weights always
-    ///      have (l, d, i, g, o) logical dimension ordering.
-    /// @note
-    ///     Quantization scales are common for weights_layer and
-    ///     weights_iteration
-    /// @note
-    ///     There is no way to check whether @p count corresponds to @p mask
-    ///     until an actual primitive descriptor is created, so it is the user's
-    ///     responsibility to set proper values. The following formula must
-    ///     hold:
-    ///
-    ///      \f[count = \prod\limits_{d \in mask} output.dims[d]\f]
-    void set_rnn_weights_qparams(int mask, const std::vector<float> &scales) {
-        error::wrap_c_api(dnnl_primitive_attr_set_rnn_weights_qparams(
-                                  get(), (int)scales.size(), mask, &scales[0]),
-                "could not set rnn weights int scales");
-    }
-};
-
-/// @}
-
 /// @addtogroup cpp_api_engine Engine
 /// Engine operations.
 ///
@@ -1413,7 +1280,9 @@ struct memory : public handle<dnnl_memory_t> {
     ///
     /// @param md Memory descriptor.
     /// @param aengine Engine.
-    /// @param ahandle handle.
+    /// @param ahandle handle: a user pointer, #DNNL_MEMORY_ALLOCATE,
+    ///     #DNNL_MEMORY_ALLOCATE_REPLICATED or #DNNL_MEMORY_NONE, see
+    ///     dnnl_memory_create().
     memory(const desc &md, const engine &aengine, void *ahandle) {
         dnnl_memory_t result;
         error::wrap_c_api(
@@ -1516,39 +1385,343 @@ struct memory : public handle<dnnl_memory_t> {
     static dnnl_data_type_t convert_to_c(data_type adata_type) {
         return static_cast<dnnl_data_type_t>(adata_type);
     }
-    static dnnl_format_tag_t convert_to_c(format_tag aformat) {
-        return static_cast<dnnl_format_tag_t>(aformat);
+    static dnnl_format_tag_t convert_to_c(format_tag aformat) {
+        return static_cast<dnnl_format_tag_t>(aformat);
+    }
+};
+
+inline bool operator==(dnnl_data_type_t a, memory::data_type b) {
+    return a == memory::convert_to_c(b);
+}
+inline bool operator!=(dnnl_data_type_t a, memory::data_type b) {
+    return !(a == b);
+}
+inline bool operator==(memory::data_type a, dnnl_data_type_t b) {
+    return b == a;
+}
+inline bool operator!=(memory::data_type a, dnnl_data_type_t b) {
+    return !(a == b);
+}
+
+inline bool operator==(dnnl_format_tag_t a, memory::format_tag b) {
+    return a == memory::convert_to_c(b);
+}
+inline bool operator!=(dnnl_format_tag_t a, memory::format_tag b) {
+    return !(a == b);
+}
+inline bool operator==(memory::format_tag a, dnnl_format_tag_t b) {
+    return b == a;
+}
+inline bool operator!=(memory::format_tag a, dnnl_format_tag_t b) {
+    return !(a == b);
+}
+
+/// @}
+
+/// @}
+
+/// @addtogroup cpp_api_attr Attributes
+/// An extension for controlling primitive behavior.
+///
+/// @sa @ref c_api_attributes in @ref c_api
+/// @{
+
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_post_ops_t> {
+    static constexpr auto destructor = &dnnl_post_ops_destroy;
+};
+/// @endcond
+
+/// Post operations
+///
+/// @sa @ref dev_guide_attributes_post_ops
+struct post_ops : public handle<dnnl_post_ops_t> {
+    /// Creates an empty sequence of post operations.
+    post_ops() {
+        dnnl_post_ops_t result;
+        error::wrap_c_api(dnnl_post_ops_create(&result),
+                "could not create post operation sequence");
+        reset(result);
+    }
+
+    /// Returns the length of post operations
+    int len() const { return dnnl_post_ops_len(get()); }
+
+    /// Returns the kind of post operation with index @p index.
+    primitive::kind kind(int index) const {
+        error::wrap_c_api(index < len() ? dnnl_success : dnnl_invalid_arguments,
+                "post_ops index is out of range");
+        return static_cast<primitive::kind>(
+                dnnl_post_ops_get_kind(get(), index));
+    }
+
+    /// Appends accumulation (sum) post operation. Prior to accumulating the
+    /// result, the previous value would be multiplied by @p scale.
+    ///
+    /// The kind of this post operation is #dnnl_sum.
+    ///
+    /// This feature might improve performance for cases like residual learning
+    /// blocks, where the result of convolution is accumulated to the previously
+    /// computed activations. The parameter @p scale might be extreme for the
+    /// integer-based computations when the result and previous activations have
+    /// different logical scaling factors.
+    ///
+    /// In the simplest case when the accumulation is the only post operation,
+    /// the computations would be:
+    /// dst[] <- scale * dst[] + op(...) // instead of dst[] <- op(...)
+    ///
+    /// @note
+    ///     This post operation (as well as all the others) disregards the
+    ///     original layout of the destination; that is, the layout of the
+    ///     original destination is expected to be the same as the layout of the
+    ///     stored destination.
+    void append_sum(float scale = 1.) {
+        error::wrap_c_api(
+                dnnl_post_ops_append_sum(get(), scale), "could not append sum");
+    }
+
+    /// Gets the parameters of the accumulation (sum) post operation with index
+    /// @p index.
+    void get_params_sum(int index, float &scale) const {
+        error::wrap_c_api(dnnl_post_ops_get_params_sum(get(), index, &scale),
+                "could not get sum params");
+    }
+
+    /// Appends eltwise post operation.
+    ///
+    /// The kind of this post operation is #dnnl_eltwise.
+    ///
+    /// In the simplest case when the eltwise is the only post operation, the
+    /// computations would be:
+    /// dst[] <- scale * eltwise_op ( op(...) ) // instead of dst[] <- op(...)
+    /// where eltwise_op is configured with the given parameters.
+    void append_eltwise(float scale, algorithm alg, float alpha, float beta) {
+        error::wrap_c_api(dnnl_post_ops_append_eltwise(
+                                  get(), scale, convert_to_c(alg), alpha, beta),
+                "could not append eltwise");
+    }
+
+    /// Gets the eltwise parameters of the post operation with index @p index.
+    void get_params_eltwise(int index, float &scale, algorithm &alg,
+            float &alpha, float &beta) const {
+        dnnl_alg_kind_t c_alg;
+        error::wrap_c_api(dnnl_post_ops_get_params_eltwise(
+                                  get(), index, &scale, &c_alg, &alpha, &beta),
+                "could not get eltwise params");
+        alg = static_cast<algorithm>(c_alg);
+    }
+
+    /// Appends a depthwise convolution post operation with a square
+    /// @p kernel, the @p stride and the @p padding of every side of the
+    /// spatial dimensions.
+    ///
+    /// The kind of this post operation is #dnnl_convolution.
+    ///
+    /// The weights and the bias of the depthwise convolution are passed as
+    /// #DNNL_ARG_ATTR_POST_OP_DW | #DNNL_ARG_WEIGHTS and
+    /// #DNNL_ARG_ATTR_POST_OP_DW | #DNNL_ARG_BIAS, in the formats returned by
+    /// query_md(query::weights_md, 2) and query_md(query::weights_md, 3) of
+    /// the primitive descriptor.
+    void append_dw_conv(
+            dnnl_dim_t kernel, dnnl_dim_t stride, dnnl_dim_t padding) {
+        error::wrap_c_api(
+                dnnl_post_ops_append_dw_conv(get(), kernel, stride, padding),
+                "could not append depthwise convolution");
+    }
+
+    /// Gets the depthwise convolution parameters of the post operation with
+    /// index @p index.
+    void get_params_dw_conv(int index, dnnl_dim_t &kernel, dnnl_dim_t &stride,
+            dnnl_dim_t &padding) const {
+        error::wrap_c_api(dnnl_post_ops_get_params_dw_conv(
+                                  get(), index, &kernel, &stride, &padding),
+                "could not get depthwise convolution params");
+    }
+
+    /// Appends a binary post operation with the algorithm @p alg and the
+    /// second source described by @p src1_desc.
+    ///
+    /// The kind of this post operation is #dnnl_binary.
+    ///
+    /// The second source is passed at execution time as
+    /// #DNNL_ARG_ATTR_POST_OP_BINARY | #DNNL_ARG_SRC_1.
+    void append_binary(algorithm alg, const memory::desc &src1_desc) {
+        error::wrap_c_api(dnnl_post_ops_append_binary(
+                                  get(), convert_to_c(alg), &src1_desc.data),
+                "could not append binary");
+    }
+
+    /// Gets the binary parameters of the post operation with index
+    /// @p index.
+    void get_params_binary(
+            int index, algorithm &alg, memory::desc &src1_desc) const {
+        dnnl_alg_kind_t c_alg;
+        const dnnl_memory_desc_t *data;
+        error::wrap_c_api(
+                dnnl_post_ops_get_params_binary(get(), index, &c_alg, &data),
+                "could not get binary params");
+        alg = static_cast<algorithm>(c_alg);
+        src1_desc.data = *data;
+    }
+};
+
+/// @cond DO_NOT_DOCUMENT_THIS
+template <>
+struct handle_traits<dnnl_primitive_attr_t> {
+    static constexpr auto destructor = &dnnl_primitive_attr_destroy;
+};
+/// @endcond
+
+/// Primitive attributes
+///
+/// @sa @ref dev_guide_attributes
+struct primitive_attr : public handle<dnnl_primitive_attr_t> {
+    /// Creates a default primitive attribute.
+    primitive_attr() {
+        dnnl_primitive_attr_t result;
+        error::wrap_c_api(dnnl_primitive_attr_create(&result),
+                "could not create a primitive attr");
+        reset(result);
+    }
+
+    /// Returns the scratchpad mode.
+    scratchpad_mode get_scratchpad_mode() const {
+        dnnl_scratchpad_mode_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_scratchpad_mode(get(), &result),
+                "could not get scratchpad mode");
+        return scratchpad_mode(result);
+    }
+
+    /// Sets scratchpad mode.
+    void set_scratchpad_mode(scratchpad_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_scratchpad_mode(
+                                  get(), dnnl::convert_to_c(mode)),
+                "could not set scratchpad mode");
+    }
+
+    /// Returns the implementation selection mode.
+    impl_selection_mode get_impl_selection_mode() const {
+        dnnl_impl_selection_mode_t result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_impl_selection_mode(get(), &result),
+                "could not get implementation selection mode");
+        return impl_selection_mode(result);
+    }
+
+    /// Sets implementation selection mode.
+    void set_impl_selection_mode(impl_selection_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_impl_selection_mode(
+                                  get(), dnnl::convert_to_c(mode)),
+                "could not set implementation selection mode");
+    }
+
+    /// Gets correspondence scale @p mask and a constant floating point vector
+    /// of output @p scales previously set by set_output_scales.
+    void get_output_scales(int &mask, std::vector<float> &scales) const {
+        dnnl_dim_t count;
+        int c_mask;
+        const float *c_scales;
+        error::wrap_c_api(dnnl_primitive_attr_get_output_scales(
+                                  get(), &count, &c_mask, &c_scales),
+                "could not get int output scales");
+        scales.resize(count);
+
+        mask = c_mask;
+        for (dnnl_dim_t c = 0; c < count; ++c)
+            scales[c] = c_scales[c];
+    }
+
+    /// Sets output scales for primitive operations. The correspondence scale
+    /// @p mask is stored for future use.
+    ///
+    /// The @p mask argument defines the correspondence between the output
+    /// tensor dimensions and the @p scales vector. Set the i-th bit of @p mask
+    /// to 1 to use a dedicated scaling factor for each slice of the output
+    /// tensor over the i-th dimension. Set @p mask to 0 to use a common
+    /// scaling factor for the whole output tensor.
+    ///
+    /// @note
+    ///      The dimension order is always native and does not depend on the
+    ///      actual layout used. Examples:
+    ///       - 2D dimensional data the order of dimensions is always: (n, c)
+    ///       - 4D dimensional data the order is always: (n, c, h, w)
+    ///       - 5D dimensional weights the order is always: (g, oc, ic, kh, kw)
+    ///
+    /// Set @p scales to {#DNNL_RUNTIME_F32_VAL} to pass the scales at the
+    /// execution as the #DNNL_ARG_ATTR_OUTPUT_SCALES argument.
+    void set_output_scales(int mask, const std::vector<float> &scales) {
+        error::wrap_c_api(dnnl_primitive_attr_set_output_scales(get(),
+                                  (dnnl_dim_t)scales.size(), mask, &scales[0]),
+                "could not set int output scales");
+    }
+
+    /// Returns @p post_ops previously set by set_post_ops.
+    const post_ops get_post_ops() const {
+        post_ops result;
+        const_dnnl_post_ops_t c_result;
+        error::wrap_c_api(dnnl_primitive_attr_get_post_ops(get(), &c_result),
+                "could not get post operation sequence");
+        result.reset(const_cast<dnnl_post_ops_t>(c_result), true);
+        return result;
+    }
+
+    /// Sets @p post_ops for future use.
+    void set_post_ops(post_ops ops) {
+        error::wrap_c_api(dnnl_primitive_attr_set_post_ops(get(), ops.get()),
+                "could not set post operation sequence");
+    }
+
+    /// Sets quantization @p scale and @p shift for RNN data tensors.  For
+    /// performance reasons, the low-precision configuration of the RNN
+    /// primitive expects input activations to have the unsigned int8 data type.
+    /// Scale and shift used to quantize floating-point data to unsigned integer
+    /// must be passed to the RNN primitive using attributes.
+    /// @note
+    ///     Quantization scale and shift are common for src_layer, src_iter,
+    ///     dst_iter, and dst_layer.
+    void set_rnn_data_qparams(float scale, float shift) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_rnn_data_qparams(get(), scale, shift),
+                "could not set rnn data int scale/shift");
+    }
+
+    /// Sets quantization scales @p weights_scales for RNN weights tensors.  The
+    /// low-precision configuration of the RNN primitive expects input weights
+    /// to have the signed int8 data type. Scales used to quantize
+    /// floating-point data to signed integer must be passed to the RNN
+    /// primitive using attributes.  The @p mask argument defines correspondence
+    /// between output tensor dimensions and the @p weights_scales array. Set
+    /// the i-th bit of @p mask to 1 to use a dedicated scaling factor for each
+    /// slice of the output tensor over the i-th dimension. Set @p mask to 0 to
+    /// use a common scaling factor for the whole output tensor.
+    /// @note
+    ///      The dimension order is always native and does not depend on the
+    ///      actual layout used. For example, five-dimensional weights always
+    ///      have (l, d, i, g, o) logical dimension ordering.
+    /// @note
+    ///     Quantization scales are common for weights_layer and
+    ///     weights_iteration
+    /// @note
+    ///     There is no way to check whether @p count corresponds to @p mask
+    ///     until an actual primitive descriptor is created, so it is the user's
+    ///     responsibility to set proper values. The following formula must
+    ///     hold:
+    ///
+    ///      \f[count = \prod\limits_{d \in mask} output.dims[d]\f]
+    void set_rnn_weights_qparams(int mask, const std::vector<float> &scales) {
+        error::wrap_c_api(dnnl_primitive_attr_set_rnn_weights_qparams(
+                                  get(), (int)scales.size(), mask, &scales[0]),
+                "could not set rnn weights int scales");
     }
 };
 
-inline bool operator==(dnnl_data_type_t a, memory::data_type b) {
-    return a == memory::convert_to_c(b);
-}
-inline bool operator!=(dnnl_data_type_t a, memory::data_type b) {
-    return !(a == b);
-}
-inline bool operator==(memory::data_type a, dnnl_data_type_t b) {
-    return b == a;
-}
-inline bool operator!=(memory::data_type a, dnnl_data_type_t b) {
-    return !(a == b);
-}
-
-inline bool operator==(dnnl_format_tag_t a, memory::format_tag b) {
-    return a == memory::convert_to_c(b);
-}
-inline bool operator!=(dnnl_format_tag_t a, memory::format_tag b) {
-    return !(a == b);
-}
-inline bool operator==(memory::format_tag a, dnnl_format_tag_t b) {
-    return b == a;
-}
-inline bool operator!=(memory::format_tag a, dnnl_format_tag_t b) {
-    return !(a == b);
-}
-
 /// @}
 
+/// @addtogroup cpp_api_memory_related
+/// @{
+
 /// @addtogroup cpp_api_reorder Reorder
 /// A primitive to copy data between memory formats.
 ///
@@ -5130,6 +5303,351 @@ struct shuffle_backward : public primitive {
 
 /// @}
 
+/// @addtogroup cpp_api_matmul Matrix Multiplication
+/// A primitive to perform matrix-matrix multiplication.
+///
+/// @sa @ref dev_guide_matmul in developer guide
+/// @sa @ref c_api_matmul in @ref c_api
+/// @{
+
+/// Matrix multiplication (matmul). Implements descriptor, primitive
+/// descriptor, and primitive.
+struct matmul : public primitive {
+
+    /// Descriptor for matmul.
+    struct desc {
+        dnnl_matmul_desc_t data;
+
+        /// Initializes a matmul descriptor without bias using memory
+        /// descriptors @p src_desc, @p weights_desc, and @p dst_desc.
+        ///
+        /// @note Any dimension of the memory descriptors may be set to
+        ///       #DNNL_RUNTIME_DIM_VAL. The actual value is then taken from
+        ///       the memory passed at the execution time.
+        desc(const memory::desc &src_desc, const memory::desc &weights_desc,
+                const memory::desc &dst_desc) {
+            error::wrap_c_api(
+                    dnnl_matmul_desc_init(&data, &src_desc.data,
+                            &weights_desc.data, nullptr, &dst_desc.data),
+                    "could not create a matmul descriptor");
+        }
+
+        /// Initializes a matmul descriptor with bias using memory
+        /// descriptors @p src_desc, @p weights_desc, @p bias_desc, and
+        /// @p dst_desc.
+        desc(const memory::desc &src_desc, const memory::desc &weights_desc,
+                const memory::desc &bias_desc, const memory::desc &dst_desc) {
+            error::wrap_c_api(dnnl_matmul_desc_init(&data, &src_desc.data,
+                                      &weights_desc.data, &bias_desc.data,
+                                      &dst_desc.data),
+                    "could not create a matmul descriptor");
+        }
+    };
+
+    /// Primitive descriptor for matmul.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e)
+            : dnnl::primitive_desc(&desc.data, nullptr, e, nullptr) {}
+
+        primitive_desc(
+                const desc &desc, const primitive_attr &attr, const engine &e)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// Queries weights memory descriptor.
+        memory::desc weights_desc() const {
+            return query_md(query::weights_md, 0);
+        }
+
+        /// Queries bias memory descriptor.
+        ///
+        /// Returns a zero_md if no bias was specified at op_desc
+        /// creation time.
+        memory::desc bias_desc() const {
+            return query_md(query::weights_md, 1);
+        }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    matmul() = default;
+
+    matmul(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
+/// @addtogroup cpp_api_binary Binary
+/// A primitive to perform tensor operations over two tensors.
+///
+/// @sa @ref dev_guide_binary in developer guide
+/// @sa @ref c_api_binary in @ref c_api
+/// @{
+
+/// Implements descriptor, primitive descriptor, and primitive for the
+/// binary operations.
+struct binary : public primitive {
+
+    /// Descriptor for binary.
+    struct desc {
+        dnnl_binary_desc_t data;
+
+        /// Initializes a binary descriptor using @p algorithm and memory
+        /// descriptors @p src0_desc, @p src1_desc, and @p dst_desc.
+        ///
+        /// The dimensions of @p src1_desc are either equal to the ones of
+        /// @p src0_desc or 1 (broadcast).
+        desc(algorithm aalgorithm, const memory::desc &src0_desc,
+                const memory::desc &src1_desc, const memory::desc &dst_desc) {
+            error::wrap_c_api(
+                    dnnl_binary_desc_init(&data, convert_to_c(aalgorithm),
+                            &src0_desc.data, &src1_desc.data, &dst_desc.data),
+                    "could not create a binary descriptor");
+        }
+    };
+
+    /// Primitive descriptor for binary.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e)
+            : dnnl::primitive_desc(&desc.data, nullptr, e, nullptr) {}
+
+        primitive_desc(
+                const desc &desc, const primitive_attr &attr, const engine &e)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr) {}
+
+        /// Queries source memory descriptor with index @p idx (0 or 1).
+        memory::desc src_desc(int idx = 0) const {
+            return query_md(query::src_md, idx);
+        }
+
+        /// Queries the first source memory descriptor.
+        memory::desc src0_desc() const { return src_desc(0); }
+
+        /// Queries the second source memory descriptor.
+        memory::desc src1_desc() const { return src_desc(1); }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    binary() = default;
+
+    binary(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
+/// @addtogroup cpp_api_reduction Reduction
+/// A primitive to reduce a tensor along a set of its dimensions.
+///
+/// @sa @ref dev_guide_reduction in developer guide
+/// @sa @ref c_api_reduction in @ref c_api
+/// @{
+
+/// Implements descriptor, primitive descriptor, and primitive for the
+/// reduction.
+struct reduction : public primitive {
+
+    /// Descriptor for reduction.
+    struct desc {
+        dnnl_reduction_desc_t data;
+
+        /// Initializes a reduction descriptor using @p algorithm and memory
+        /// descriptors @p src_desc and @p dst_desc.
+        ///
+        /// The source is reduced along the dimensions that are 1 in
+        /// @p dst_desc. The parameters @p p and @p eps are used by the lp
+        /// norm algorithms only.
+        desc(algorithm aalgorithm, const memory::desc &src_desc,
+                const memory::desc &dst_desc, float p = 0.f,
+                float eps = 0.f) {
+            error::wrap_c_api(dnnl_reduction_desc_init(&data,
+                                      convert_to_c(aalgorithm),
+                                      &src_desc.data, &dst_desc.data, p, eps),
+                    "could not create a reduction descriptor");
+        }
+    };
+
+    /// Primitive descriptor for reduction.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e)
+            : dnnl::primitive_desc(&desc.data, nullptr, e, nullptr) {}
+
+        primitive_desc(
+                const desc &desc, const primitive_attr &attr, const engine &e)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    reduction() = default;
+
+    reduction(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
+/// @addtogroup cpp_api_resampling Resampling
+/// A primitive to compute resampling operation on 1D, 2D or 3D data tensor
+/// using Nearest Neighbor or Linear (Bilinear, Trilinear) interpolation
+/// method.
+///
+/// @sa @ref dev_guide_resampling in developer guide
+/// @sa @ref c_api_resampling in @ref c_api
+/// @{
+
+/// Resampling forward propagation.
+struct resampling_forward : public primitive {
+
+    /// Descriptor for resampling forward propagation.
+    struct desc {
+        dnnl_resampling_desc_t data;
+
+        /// Initializes a resampling descriptor for forward propagation using
+        /// @p aprop_kind, @p aalgorithm, and the memory descriptors. The
+        /// scaling factors are the ratios of the spatial dimensions of
+        /// @p dst_desc to the ones of @p src_desc.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc) {
+            error::wrap_c_api(dnnl_resampling_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      convert_to_c(aalgorithm), nullptr,
+                                      &src_desc.data, &dst_desc.data),
+                    "could not create a resampling forward descriptor");
+        }
+
+        /// Initializes a resampling descriptor for forward propagation using
+        /// @p aprop_kind, @p aalgorithm, the scaling @p factors of the
+        /// spatial dimensions, and @p src_desc. The destination is of the
+        /// spatial dimensions of the source scaled by the factors and of
+        /// #dnnl::memory::format_tag::any.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const std::vector<float> &factors,
+                const memory::desc &src_desc) {
+            memory::validate_dims(factors);
+            error::wrap_c_api(dnnl_resampling_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      convert_to_c(aalgorithm), &factors[0],
+                                      &src_desc.data, nullptr),
+                    "could not create a resampling forward descriptor");
+        }
+
+        /// Initializes a resampling descriptor for forward propagation using
+        /// @p aprop_kind, @p aalgorithm, the scaling @p factors of the
+        /// spatial dimensions, and the memory descriptors.
+        desc(prop_kind aprop_kind, algorithm aalgorithm,
+                const std::vector<float> &factors,
+                const memory::desc &src_desc, const memory::desc &dst_desc) {
+            if (!factors.empty()) memory::validate_dims(factors);
+            error::wrap_c_api(dnnl_resampling_forward_desc_init(&data,
+                                      dnnl::convert_to_c(aprop_kind),
+                                      convert_to_c(aalgorithm),
+                                      factors.empty() ? nullptr : &factors[0],
+                                      &src_desc.data, &dst_desc.data),
+                    "could not create a resampling forward descriptor");
+        }
+    };
+
+    /// Primitive descriptor for resampling forward propagation.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e)
+            : dnnl::primitive_desc(&desc.data, nullptr, e, nullptr) {}
+
+        primitive_desc(
+                const desc &desc, const primitive_attr &attr, const engine &e)
+            : dnnl::primitive_desc(&desc.data, &attr, e, nullptr) {}
+
+        /// Queries source memory descriptor.
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// Queries destination memory descriptor.
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+    };
+
+    resampling_forward() = default;
+
+    resampling_forward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// Resampling backward propagation.
+struct resampling_backward : public primitive {
+
+    /// Descriptor for resampling backward propagation.
+    struct desc {
+        dnnl_resampling_desc_t data;
+
+        /// Initializes a resampling descriptor for backward propagation using
+        /// @p aalgorithm and the memory descriptors. The scaling factors are
+        /// the ratios of the spatial dimensions of @p diff_dst_desc to the
+        /// ones of @p diff_src_desc.
+        desc(algorithm aalgorithm, const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc) {
+            error::wrap_c_api(dnnl_resampling_backward_desc_init(&data,
+                                      convert_to_c(aalgorithm), nullptr,
+                                      &diff_src_desc.data, &diff_dst_desc.data),
+                    "could not create a resampling backward descriptor");
+        }
+
+        /// Initializes a resampling descriptor for backward propagation using
+        /// @p aalgorithm, the scaling @p factors of the spatial dimensions,
+        /// and the memory descriptors.
+        desc(algorithm aalgorithm, const std::vector<float> &factors,
+                const memory::desc &diff_src_desc,
+                const memory::desc &diff_dst_desc) {
+            memory::validate_dims(factors);
+            error::wrap_c_api(dnnl_resampling_backward_desc_init(&data,
+                                      convert_to_c(aalgorithm), &factors[0],
+                                      &diff_src_desc.data, &diff_dst_desc.data),
+                    "could not create a resampling backward descriptor");
+        }
+    };
+
+    /// Primitive descriptor for resampling backward propagation.
+    struct primitive_desc : public dnnl::primitive_desc {
+        primitive_desc() = default;
+
+        primitive_desc(const desc &desc, const engine &e,
+                const resampling_forward::primitive_desc &hint_fwd_pd)
+            : dnnl::primitive_desc(&desc.data, nullptr, e, hint_fwd_pd.get()) {}
+
+        primitive_desc(const desc &desc, const primitive_attr &attr,
+                const engine &e,
+                const resampling_forward::primitive_desc &hint_fwd_pd)
+            : dnnl::primitive_desc(&desc.data, &attr, e, hint_fwd_pd.get()) {}
+
+        /// Queries diff source memory descriptor.
+        memory::desc diff_src_desc() const {
+            return query_md(query::diff_src_md, 0);
+        }
+
+        /// Queries diff destination memory descriptor.
+        memory::desc diff_dst_desc() const {
+            return query_md(query::diff_dst_md, 0);
+        }
+    };
+
+    resampling_backward() = default;
+
+    resampling_backward(const primitive_desc &pd) : primitive(pd) {}
+};
+
+/// @}
+
 /// @} Primitives
 
 /// @} C++ API
@@ -643,8 +643,16 @@ typedef enum {
     dnnl_inner_product,
     /// A rnn primitive.
     dnnl_rnn,
-    /// A matrix multiplication primitive.
+    /// A matrix multiplication primitive (internal).
     dnnl_gemm,
+    /// A matrix multiplication primitive.
+    dnnl_matmul,
+    /// A binary primitive.
+    dnnl_binary,
+    /// A reduction primitive.
+    dnnl_reduction,
+    /// A resampling primitive.
+    dnnl_resampling,
 } dnnl_primitive_kind_t;
 
 /// Kinds of algorithms.
@@ -654,8 +662,11 @@ typedef enum {
     dnnl_convolution_direct = 0x1,
     /// Winograd convolution
     dnnl_convolution_winograd = 0x2,
-    /// Convolution algorithm(either direct or Winograd) is chosen just in time
+    /// Convolution algorithm(either direct, Winograd or FFT) is chosen just in
+    /// time
     dnnl_convolution_auto = 0x3,
+    /// FFT convolution
+    dnnl_convolution_fft = 0x4,
     /// Direct deconvolution
     dnnl_deconvolution_direct = 0xa,
     /// Winograd deconvolution
@@ -714,6 +725,36 @@ typedef enum {
     /// Primitive expects 4 biases on input:
     /// \f$[b_{u}, b_{r}, b_{c_x}, b_{c_h}]\f$
     dnnl_lbr_gru = 0x4fff,
+    /// Binary add
+    dnnl_binary_add = 0x1fff0,
+    /// Binary mul
+    dnnl_binary_mul = 0x1fff1,
+    /// Binary max
+    dnnl_binary_max = 0x1fff2,
+    /// Binary min
+    dnnl_binary_min = 0x1fff3,
+    /// Reduction using max
+    dnnl_reduction_max = 0x2fff0,
+    /// Reduction using min
+    dnnl_reduction_min = 0x2fff1,
+    /// Reduction using sum
+    dnnl_reduction_sum = 0x2fff2,
+    /// Reduction using mul
+    dnnl_reduction_mul = 0x2fff3,
+    /// Reduction using mean
+    dnnl_reduction_mean = 0x2fff4,
+    /// Reduction using lp norm: (max(sum |x|^p, eps))^(1/p)
+    dnnl_reduction_norm_lp_max = 0x2fff5,
+    /// Reduction using lp norm: (sum |x|^p + eps)^(1/p)
+    dnnl_reduction_norm_lp_sum = 0x2fff6,
+    /// Reduction using lp norm without the final root: max(sum |x|^p, eps)
+    dnnl_reduction_norm_lp_power_p_max = 0x2fff7,
+    /// Reduction using lp norm without the final root: sum |x|^p + eps
+    dnnl_reduction_norm_lp_power_p_sum = 0x2fff8,
+    /// Nearest neighbor resampling
+    dnnl_resampling_nearest = 0x3fff0,
+    /// Linear (bilinear, trilinear) resampling
+    dnnl_resampling_linear = 0x3fff1,
 } dnnl_alg_kind_t;
 
 /// Flags for batch normalization primitive.
@@ -752,6 +793,19 @@ typedef enum {
     ///  - on training primitive requires workspace (required to be able to
     ///    perform backward pass)
     dnnl_fuse_norm_relu = 0x4U,
+
+    /// Fuse with an addition and ReLU: dst = ReLU(BN(src) + src_1)
+    ///
+    /// If specified:
+    ///  - on forward propagation the addend (usually a residual) is taken
+    ///    as #DNNL_ARG_SRC_1 with the same memory descriptor as src
+    ///  - on training primitive requires workspace, as with
+    ///    #dnnl_fuse_norm_relu
+    ///  - on backward propagation the gradient of the addend, that is the
+    ///    diff_dst masked by the ReLU, is stored to #DNNL_ARG_DIFF_SRC_1
+    ///
+    /// Cannot be combined with #dnnl_fuse_norm_relu.
+    dnnl_fuse_norm_add_relu = 0x8U,
 } dnnl_normalization_flags_t;
 
 /// @}
@@ -770,6 +824,30 @@ typedef int64_t dnnl_dim_t;
 /// A type to describe tensor dimensions.
 typedef dnnl_dim_t dnnl_dims_t[DNNL_MAX_NDIMS];
 
+/// A wildcard value for dimensions and strides that are unknown at a
+/// primitive creation time. The actual values are taken from the memory
+/// objects passed at the primitive execution time.
+///
+/// @note Memory objects cannot be created with memory descriptors that have
+///       runtime dimensions or strides.
+#define DNNL_RUNTIME_DIM_VAL INT64_MIN
+
+/// A size_t counterpart of #DNNL_RUNTIME_DIM_VAL, returned as a memory
+/// descriptor size if the latter has runtime dimensions or strides.
+#define DNNL_RUNTIME_SIZE_VAL ((size_t)DNNL_RUNTIME_DIM_VAL)
+
+/// A wildcard value for floating point values that are unknown at a
+/// primitive creation time, e.g. the output scales. The actual values are
+/// passed at the primitive execution time, see #DNNL_ARG_ATTR_OUTPUT_SCALES.
+#define DNNL_RUNTIME_F32_VAL (DNNL_RUNTIME_F32_VAL_REP.f)
+
+/// @cond DO_NOT_DOCUMENT_THIS
+static const union {
+    unsigned u;
+    float f;
+} DNNL_RUNTIME_F32_VAL_REP = {0x7fc000d0};
+/// @endcond
+
 /// Generic description of blocked data layout for most memory formats.
 ///
 /// @sa @ref dev_guide_understanding_memory_formats
@@ -931,6 +1009,9 @@ typedef const struct dnnl_memory *const_dnnl_memory_t;
 
 #define DNNL_MEMORY_NONE (NULL)
 #define DNNL_MEMORY_ALLOCATE ((void *)(size_t)-1)
+/// Asks the library to allocate a copy of the memory on each NUMA node, see
+/// dnnl_memory_create()
+#define DNNL_MEMORY_ALLOCATE_REPLICATED ((void *)(size_t)-2)
 
 /// @}
 
@@ -1203,7 +1284,20 @@ typedef struct {
 } dnnl_inner_product_desc_t;
 
 /// Flags for RNN cell.
-typedef enum { dnnl_rnn_flags_undef = 0x0 } dnnl_rnn_flags_t;
+typedef enum {
+    /// Undefined RNN flags
+    dnnl_rnn_flags_undef = 0x0,
+    /// Use per-sample sequence lengths
+    ///
+    /// If specified, the lengths of the sequences of the minibatch samples
+    /// are passed at execution time as a one-dimensional #dnnl_s32 memory
+    /// of the minibatch size with the #DNNL_ARG_SEQ_LENGTHS argument.
+    /// The iterations past the length of a sample are not computed: the
+    /// corresponding destination layer vectors are set to zero and the
+    /// destination iteration states hold the state of the last valid
+    /// iteration of the sample.
+    dnnl_rnn_flags_use_seq_lengths = 0x1U,
+} dnnl_rnn_flags_t;
 
 /// A direction of RNN primitive execution.
 typedef enum {
@@ -1287,6 +1381,110 @@ typedef struct {
 
 } dnnl_rnn_desc_t;
 
+/// A descriptor of a matrix multiplication operation.
+///
+/// 2D case:
+///     dst[m, n] = src[m, k] * weights[k, n] + bias[m, n]
+///
+/// ND case (batch dimensions are all dimensions but the last two; a batch
+/// dimension of size 1 in src or weights is broadcast):
+///     dst[..., m, n] = src[..., m, k] * weights[..., k, n] + bias[..., m, n]
+///
+/// Each dimension of bias is either 1 (broadcast) or equal to the
+/// corresponding dimension of dst.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_matmul.
+    dnnl_primitive_kind_t primitive_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Weights memory descriptor.
+    dnnl_memory_desc_t weights_desc;
+    /// Bias memory descriptor.
+    dnnl_memory_desc_t bias_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// The accumulator data type. Initialized automatically.
+    dnnl_data_type_t accum_data_type;
+} dnnl_matmul_desc_t;
+
+/// A descriptor of a binary operation.
+///
+///     dst[i] = alg(src0[i], src1[i'])
+///
+/// The destination has the shape of src0. Each dimension of src1 is either
+/// equal to the corresponding dimension of src0 or 1, in which case src1 is
+/// broadcast along it (i' is i with the broadcast indices set to 0).
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_binary.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of the binary algorithm. Possible values:
+    /// #dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max and
+    /// #dnnl_binary_min.
+    dnnl_alg_kind_t alg_kind;
+    /// Source memory descriptors.
+    dnnl_memory_desc_t src_desc[2];
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+} dnnl_binary_desc_t;
+
+/// A descriptor of a reduction operation.
+///
+/// The destination is of the dimensions of the source, except that each
+/// dimension the source is reduced along is 1.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_reduction.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of the reduction algorithm. Possible values:
+    /// #dnnl_reduction_max, #dnnl_reduction_min, #dnnl_reduction_sum,
+    /// #dnnl_reduction_mul, #dnnl_reduction_mean, #dnnl_reduction_norm_lp_max,
+    /// #dnnl_reduction_norm_lp_sum, #dnnl_reduction_norm_lp_power_p_max and
+    /// #dnnl_reduction_norm_lp_power_p_sum.
+    dnnl_alg_kind_t alg_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// The power of the lp norm algorithms.
+    float p;
+    /// The epsilon of the lp norm algorithms.
+    float eps;
+} dnnl_reduction_desc_t;
+
+/// A descriptor of a resampling operation.
+///
+/// The spatial dimensions of the destination are the ones of the source
+/// scaled by the factors. Along a spatial dimension of the source of I
+/// points and of the destination of O points, the point o of the destination
+/// is mapped to the point (o + 0.5) * I / O - 0.5 of the source, whose value
+/// is either taken from the nearest source point or linearly interpolated
+/// from the neighboring ones, the source being extended by its border
+/// values.
+typedef struct {
+    /// The kind of primitive. Used for self-identifying the primitive
+    /// descriptor. Must be #dnnl_resampling.
+    dnnl_primitive_kind_t primitive_kind;
+    /// The kind of propagation. Possible values: #dnnl_forward_training,
+    /// #dnnl_forward_inference, and #dnnl_backward_data.
+    dnnl_prop_kind_t prop_kind;
+    /// The kind of the resampling algorithm. Possible values:
+    /// #dnnl_resampling_nearest and #dnnl_resampling_linear.
+    dnnl_alg_kind_t alg_kind;
+    /// Source memory descriptor.
+    dnnl_memory_desc_t src_desc;
+    /// Source gradient memory descriptor.
+    dnnl_memory_desc_t diff_src_desc;
+    /// Destination memory descriptor.
+    dnnl_memory_desc_t dst_desc;
+    /// Destination gradient memory descriptor.
+    dnnl_memory_desc_t diff_dst_desc;
+    /// The scaling factors of the spatial dimensions: the ratios of the
+    /// destination dimensions to the source ones.
+    float factors[DNNL_MAX_NDIMS];
+} dnnl_resampling_desc_t;
+
 /// @}
 
 /// @addtogroup c_api_engine_types Engine
@@ -1357,6 +1555,15 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// Implementation selection mode
+typedef enum {
+    /// The first implementation that supports the problem is used (default)
+    dnnl_impl_selection_mode_first,
+    /// The fastest implementation that supports the problem is used, as
+    /// measured the first time a primitive descriptor is created for it
+    dnnl_impl_selection_mode_fastest,
+} dnnl_impl_selection_mode_t;
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
@@ -1448,6 +1655,8 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 #define DNNL_ARG_MEAN 49
 #define DNNL_ARG_VARIANCE 50
 
+#define DNNL_ARG_SEQ_LENGTHS 56
+
 #define DNNL_ARG_WORKSPACE 64
 #define DNNL_ARG_SCRATCHPAD 80
 
@@ -1484,6 +1693,18 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 #define DNNL_ARG_MULTIPLE_SRC 1024
 #define DNNL_ARG_MULTIPLE_DST 2048
 
+/// The output scales set to #DNNL_RUNTIME_F32_VAL at the primitive creation,
+/// as a 1D f32 memory of the count of scales the mask defines.
+#define DNNL_ARG_ATTR_OUTPUT_SCALES 513
+
+/// Arguments of the fused depthwise convolution post operation, combined
+/// with #DNNL_ARG_WEIGHTS and #DNNL_ARG_BIAS.
+#define DNNL_ARG_ATTR_POST_OP_DW 8192
+
+/// The second source of the binary post operation, combined with
+/// #DNNL_ARG_SRC_1.
+#define DNNL_ARG_ATTR_POST_OP_BINARY 16384
+
 /// @}
 
 /// An auxiliary structure to specify primitive's inputs/outputs at execution
@@ -1550,6 +1771,10 @@ typedef enum {
 
     dnnl_query_impl_info_str, ///< implementation name
 
+    dnnl_query_flops_s64, ///< arithmetic operations of an execution
+    dnnl_query_bytes_read_s64, ///< memory read by an execution (bytes)
+    dnnl_query_bytes_written_s64, ///< memory written by an execution (bytes)
+
     // memory and op descriptor section
     dnnl_query_some_d = 64, ///< stub
     dnnl_query_op_d, ///< op descriptor
@@ -1564,7 +1789,11 @@ typedef enum {
     dnnl_query_layer_normalization_d, ///< layer normalization descriptor
     dnnl_query_inner_product_d, ///< inner product descriptor
     dnnl_query_rnn_d, ///< rnn descriptor
-    dnnl_query_gemm_d, ///< GEMM descriptor
+    dnnl_query_gemm_d, ///< GEMM descriptor (internal)
+    dnnl_query_matmul_d, ///< matrix multiplication (matmul) descriptor
+    dnnl_query_binary_d, ///< binary descriptor
+    dnnl_query_reduction_d, ///< reduction descriptor
+    dnnl_query_resampling_d, ///< resampling descriptor
 
     // memory descriptor section
     dnnl_query_some_md = 128, ///< stub
@@ -1604,6 +1833,66 @@ typedef struct dnnl_stream *dnnl_stream_t;
 /// A constant execution stream handle.
 typedef const struct dnnl_stream *const_dnnl_stream_t;
 
+/// @}
+
+/// @addtogroup c_api_types_numa NUMA placement
+/// @{
+
+/// Placement of the memory allocated by the CPU engine on the NUMA nodes
+typedef enum {
+    /// A page is placed on the node of the thread that touches it first
+    /// (default)
+    dnnl_numa_first_touch,
+    /// The pages are interleaved across all the nodes
+    dnnl_numa_interleave,
+    /// The pages are placed on the node of the thread creating the memory
+    dnnl_numa_local,
+} dnnl_numa_policy_t;
+
+/// @}
+
+/// @addtogroup c_api_types_trace Execution tracing
+/// @{
+
+/// Kinds of trace events
+typedef enum {
+    /// Primitive creation, the primitive cache hit or miss is reported
+    dnnl_trace_event_create,
+    /// Primitive execution
+    dnnl_trace_event_exec,
+} dnnl_trace_event_kind_t;
+
+/// A trace event: a primitive creation or execution
+typedef struct {
+    /// The kind of the event
+    dnnl_trace_event_kind_t kind;
+    /// The primitive information, as printed by the verbose mode
+    const char *info;
+    /// The implementation name
+    const char *impl_name;
+    /// The kind of the engine of the primitive
+    dnnl_engine_kind_t engine_kind;
+    /// The identifier of the thread that recorded the event, the threads are
+    /// numbered from 1 in the order they record their first event
+    int thread_id;
+    /// The start and the end of the event, in microseconds since an
+    /// arbitrary point in time
+    double start_us, end_us;
+    /// The scratchpad size of the primitive, in bytes
+    dnnl_dim_t scratchpad_size;
+    /// The estimated arithmetic operations and memory traffic (bytes) of an
+    /// execution, see #dnnl_query_flops_s64, #dnnl_query_bytes_read_s64 and
+    /// #dnnl_query_bytes_written_s64
+    dnnl_dim_t flops, bytes;
+    /// For the creation events, 1 if the primitive cache had the primitive
+    int cache_hit;
+} dnnl_trace_event_t;
+
+/// A function called for each trace event, with the @p user_data passed
+/// along with it
+typedef void (*dnnl_trace_callback_t)(
+        const dnnl_trace_event_t *event, void *user_data);
+
 /// @}
 /// @}
 /// @}
@@ -18,6 +18,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -38,6 +39,13 @@ status_t bnrm_desc_init(batch_normalization_desc_t *bnrm_desc,
             && IMPLICATION(prop_kind & backward, diff_data_desc != nullptr);
     if (!args_ok) return invalid_arguments;
 
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides()
+            || (diff_data_desc
+                    && memory_desc_wrapper(diff_data_desc)
+                               .has_runtime_dims_or_strides());
+    if (runtime_dims_or_strides) return unimplemented;
+
     auto bd = batch_normalization_desc_t();
     bd.primitive_kind = primitive_kind::batch_normalization;
     bd.prop_kind = prop_kind;
@@ -60,9 +68,11 @@ status_t bnrm_desc_init(batch_normalization_desc_t *bnrm_desc,
             &bd.stat_desc, 1, stats_dims, data_type::f32, dnnl_x);
     bd.batch_norm_epsilon = epsilon;
 
-    unsigned bnorm_flags
-            = dnnl_use_global_stats | dnnl_use_scaleshift | dnnl_fuse_norm_relu;
+    unsigned bnorm_flags = dnnl_use_global_stats | dnnl_use_scaleshift
+            | dnnl_fuse_norm_relu | dnnl_fuse_norm_add_relu;
     if ((~bnorm_flags & flags) != 0) return invalid_arguments;
+    if ((flags & dnnl_fuse_norm_relu) && (flags & dnnl_fuse_norm_add_relu))
+        return invalid_arguments;
 
     bd.flags = flags;
 
@@ -75,6 +75,9 @@ struct batch_normalization_pd_t : public primitive_desc_t {
         return desc_.flags & dnnl_use_global_stats;
     }
     bool fuse_norm_relu() const { return desc_.flags & dnnl_fuse_norm_relu; }
+    bool fuse_norm_add_relu() const {
+        return desc_.flags & dnnl_fuse_norm_add_relu;
+    }
     bool with_relu_post_op() const {
         const auto &p = this->attr()->post_ops_;
         return p.len_ == 1 && p.entry_[0].is_relu(true, true);
@@ -132,6 +135,9 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_SRC_1 && fuse_norm_add_relu())
+            return arg_usage_t::input;
+
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_is_src()) return arg_usage_t::input;
             if (!stats_is_src() && is_training()) return arg_usage_t::output;
@@ -141,12 +147,25 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
         if (arg == DNNL_ARG_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::input;
 
-        if (arg == DNNL_ARG_WORKSPACE && is_training() && fuse_norm_relu())
+        if (arg == DNNL_ARG_WORKSPACE && is_training()
+                && (fuse_norm_relu() || fuse_norm_add_relu()))
             return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
     }
 
+    virtual const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_MEAN:
+                return stats_is_src() ? src_md(1) : dst_md(1);
+            case DNNL_ARG_VARIANCE:
+                return stats_is_src() ? src_md(2) : dst_md(2);
+            case DNNL_ARG_SRC_1:
+                return fuse_norm_add_relu() ? &data_md_ : &glob_zero_md;
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
     virtual const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &data_md_;
         if (stats_is_src() && (index == 1 || index == 2)) return &stat_md_;
@@ -165,8 +184,10 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     }
 
     virtual const memory_desc_t *workspace_md(int index = 0) const override {
-        return index == 0 && is_training() && fuse_norm_relu() ? &ws_md_
-                                                               : &glob_zero_md;
+        return index == 0 && is_training()
+                        && (fuse_norm_relu() || fuse_norm_add_relu())
+                ? &ws_md_
+                : &glob_zero_md;
     }
 
     const memory_desc_t *stat_md() const {
@@ -174,10 +195,14 @@ struct batch_normalization_fwd_pd_t : public batch_normalization_pd_t {
     }
 
     virtual int n_inputs() const override {
-        return 1 + 2 * stats_is_src() + use_scaleshift();
+        return 1 + 2 * stats_is_src() + use_scaleshift()
+                + fuse_norm_add_relu();
     }
     virtual int n_outputs() const override {
-        return 1 + (fuse_norm_relu() + 2 * (!stats_is_src())) * is_training();
+        return 1
+                + (fuse_norm_relu() + fuse_norm_add_relu()
+                          + 2 * (!stats_is_src()))
+                * is_training();
     }
 };
 
@@ -201,17 +226,31 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
         if (arg == DNNL_ARG_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::input;
 
-        if (arg == DNNL_ARG_WORKSPACE && fuse_norm_relu())
+        if (arg == DNNL_ARG_WORKSPACE
+                && (fuse_norm_relu() || fuse_norm_add_relu()))
             return arg_usage_t::input;
 
         if (arg == DNNL_ARG_DIFF_SRC) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_DIFF_SRC_1 && fuse_norm_add_relu())
+            return arg_usage_t::output;
+
         if (arg == DNNL_ARG_DIFF_SCALE_SHIFT && use_scaleshift())
             return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
     }
 
+    virtual const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_MEAN: return src_md(1);
+            case DNNL_ARG_VARIANCE: return src_md(2);
+            case DNNL_ARG_DIFF_SRC_1:
+                return fuse_norm_add_relu() ? &diff_data_md_ : &glob_zero_md;
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
     virtual const memory_desc_t *src_md(int index = 0) const override {
         return index == 0 ? &data_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
     }
@@ -230,16 +269,19 @@ struct batch_normalization_bwd_pd_t : public batch_normalization_pd_t {
     }
 
     virtual const memory_desc_t *workspace_md(int index = 0) const override {
-        return index == 0 && fuse_norm_relu() ? &ws_md_ : &glob_zero_md;
+        return index == 0 && (fuse_norm_relu() || fuse_norm_add_relu())
+                ? &ws_md_
+                : &glob_zero_md;
     }
 
     const memory_desc_t *stat_md() const { return src_md(1); }
 
     virtual int n_inputs() const override {
-        return 4 + use_scaleshift() + fuse_norm_relu();
+        return 4 + use_scaleshift() + fuse_norm_relu() + fuse_norm_add_relu();
     }
     virtual int n_outputs() const override {
-        return 1 + (desc_.prop_kind == prop_kind::backward);
+        return 1 + (desc_.prop_kind == prop_kind::backward)
+                + fuse_norm_add_relu();
     }
 
 protected:
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::alg_kind;
+
+namespace {
+status_t binary_desc_init(binary_desc_t *binary_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src0_desc, const memory_desc_t *src1_desc,
+        const memory_desc_t *dst_desc) {
+    bool args_ok = true
+            && !any_null(binary_desc, src0_desc, src1_desc, dst_desc)
+            && one_of(alg_kind, binary_add, binary_mul, binary_max, binary_min);
+    if (!args_ok) return invalid_arguments;
+
+    const int ndims = src0_desc->ndims;
+    args_ok = 0 < ndims && ndims <= DNNL_MAX_NDIMS
+            && everyone_is(ndims, src1_desc->ndims, dst_desc->ndims)
+            && src0_desc->format_kind != format_kind::any
+            && src1_desc->format_kind != format_kind::any;
+    if (!args_ok) return invalid_arguments;
+
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(src0_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(src1_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides();
+    if (runtime_dims_or_strides) return unimplemented;
+
+    // src1 is broadcast along its dimensions of size 1, dst has the shape of
+    // src0
+    for (int d = 0; d < ndims; ++d) {
+        const dim_t s0_dim = src0_desc->dims[d];
+        const bool ok = one_of(src1_desc->dims[d], 1, s0_dim)
+                && dst_desc->dims[d] == s0_dim;
+        if (!ok) return invalid_arguments;
+    }
+
+    auto bd = binary_desc_t();
+    bd.primitive_kind = primitive_kind::binary;
+    bd.alg_kind = alg_kind;
+    bd.src_desc[0] = *src0_desc;
+    bd.src_desc[1] = *src1_desc;
+    bd.dst_desc = *dst_desc;
+
+    *binary_desc = bd;
+    return success;
+}
+} // namespace
+
+status_t dnnl_binary_desc_init(binary_desc_t *binary_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src0_desc, const memory_desc_t *src1_desc,
+        const memory_desc_t *dst_desc) {
+    return binary_desc_init(
+            binary_desc, alg_kind, src0_desc, src1_desc, dst_desc);
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -61,6 +61,7 @@ const alg_kind_t undef = dnnl_alg_kind_undef;
 const alg_kind_t convolution_auto = dnnl_convolution_auto;
 const alg_kind_t convolution_direct = dnnl_convolution_direct;
 const alg_kind_t convolution_winograd = dnnl_convolution_winograd;
+const alg_kind_t convolution_fft = dnnl_convolution_fft;
 const alg_kind_t deconvolution_direct = dnnl_deconvolution_direct;
 const alg_kind_t deconvolution_winograd = dnnl_deconvolution_winograd;
 const alg_kind_t eltwise_relu = dnnl_eltwise_relu;
@@ -86,6 +87,23 @@ const alg_kind_t vanilla_rnn = dnnl_vanilla_rnn;
 const alg_kind_t vanilla_lstm = dnnl_vanilla_lstm;
 const alg_kind_t vanilla_gru = dnnl_vanilla_gru;
 const alg_kind_t lbr_gru = dnnl_lbr_gru;
+const alg_kind_t binary_add = dnnl_binary_add;
+const alg_kind_t binary_mul = dnnl_binary_mul;
+const alg_kind_t binary_max = dnnl_binary_max;
+const alg_kind_t binary_min = dnnl_binary_min;
+const alg_kind_t reduction_max = dnnl_reduction_max;
+const alg_kind_t reduction_min = dnnl_reduction_min;
+const alg_kind_t reduction_sum = dnnl_reduction_sum;
+const alg_kind_t reduction_mul = dnnl_reduction_mul;
+const alg_kind_t reduction_mean = dnnl_reduction_mean;
+const alg_kind_t reduction_norm_lp_max = dnnl_reduction_norm_lp_max;
+const alg_kind_t reduction_norm_lp_sum = dnnl_reduction_norm_lp_sum;
+const alg_kind_t reduction_norm_lp_power_p_max
+        = dnnl_reduction_norm_lp_power_p_max;
+const alg_kind_t reduction_norm_lp_power_p_sum
+        = dnnl_reduction_norm_lp_power_p_sum;
+const alg_kind_t resampling_nearest = dnnl_resampling_nearest;
+const alg_kind_t resampling_linear = dnnl_resampling_linear;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -105,6 +123,19 @@ const scratchpad_mode_t library = dnnl_scratchpad_mode_library;
 const scratchpad_mode_t user = dnnl_scratchpad_mode_user;
 } // namespace scratchpad_mode
 
+using impl_selection_mode_t = dnnl_impl_selection_mode_t;
+namespace impl_selection_mode {
+const impl_selection_mode_t first = dnnl_impl_selection_mode_first;
+const impl_selection_mode_t fastest = dnnl_impl_selection_mode_fastest;
+} // namespace impl_selection_mode
+
+using numa_policy_t = dnnl_numa_policy_t;
+namespace numa_policy {
+const numa_policy_t first_touch = dnnl_numa_first_touch;
+const numa_policy_t interleave = dnnl_numa_interleave;
+const numa_policy_t local = dnnl_numa_local;
+} // namespace numa_policy
+
 using rnn_packed_format_t = dnnl_rnn_packed_memory_format_t;
 namespace rnn_packed_format {
 const rnn_packed_format_t undef = dnnl_packed_format_undef;
@@ -454,6 +485,10 @@ const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t inner_product = dnnl_inner_product;
 const primitive_kind_t rnn = dnnl_rnn;
 const primitive_kind_t gemm = dnnl_gemm;
+const primitive_kind_t matmul = dnnl_matmul;
+const primitive_kind_t binary = dnnl_binary;
+const primitive_kind_t reduction = dnnl_reduction;
+const primitive_kind_t resampling = dnnl_resampling;
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -473,6 +508,10 @@ const query_t scratchpad_engine = dnnl_query_scratchpad_engine;
 
 const query_t impl_info_str = dnnl_query_impl_info_str;
 
+const query_t flops_s64 = dnnl_query_flops_s64;
+const query_t bytes_read_s64 = dnnl_query_bytes_read_s64;
+const query_t bytes_written_s64 = dnnl_query_bytes_written_s64;
+
 const query_t some_d = dnnl_query_some_d;
 const query_t op_d = dnnl_query_op_d;
 const query_t convolution_d = dnnl_query_convolution_d;
@@ -487,6 +526,10 @@ const query_t layer_normalization_d = dnnl_query_layer_normalization_d;
 const query_t inner_product_d = dnnl_query_inner_product_d;
 const query_t rnn_d = dnnl_query_rnn_d;
 const query_t gemm_d = dnnl_query_gemm_d;
+const query_t matmul_d = dnnl_query_matmul_d;
+const query_t binary_d = dnnl_query_binary_d;
+const query_t reduction_d = dnnl_query_reduction_d;
+const query_t resampling_d = dnnl_query_resampling_d;
 
 const query_t some_md = dnnl_query_some_md;
 const query_t src_md = dnnl_query_src_md;
@@ -519,6 +562,13 @@ using inner_product_desc_t = dnnl_inner_product_desc_t;
 using rnn_direction_t = dnnl_rnn_direction_t;
 using rnn_desc_t = dnnl_rnn_desc_t;
 
+using matmul_desc_t = dnnl_matmul_desc_t;
+
+using binary_desc_t = dnnl_binary_desc_t;
+
+using reduction_desc_t = dnnl_reduction_desc_t;
+using resampling_desc_t = dnnl_resampling_desc_t;
+
 /* Internal type, declared in gemm_types.hpp */
 using gemm_desc_t = dnnl_gemm_desc_t;
 
@@ -546,6 +596,10 @@ struct op_desc_t {
         inner_product_desc_t inner_product;
         rnn_desc_t rnn;
         gemm_desc_t gemm;
+        matmul_desc_t matmul;
+        binary_desc_t binary;
+        reduction_desc_t reduction;
+        resampling_desc_t resampling;
         concat_desc_t concat;
         reorder_desc_t reorder;
         sum_desc_t sum;
@@ -571,6 +625,10 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(inner_product_desc_t, inner_product);
     DECL_CTOR_AND_CONVERTERS(rnn_desc_t, rnn);
     DECL_CTOR_AND_CONVERTERS(gemm_desc_t, gemm);
+    DECL_CTOR_AND_CONVERTERS(matmul_desc_t, matmul);
+    DECL_CTOR_AND_CONVERTERS(binary_desc_t, binary);
+    DECL_CTOR_AND_CONVERTERS(reduction_desc_t, reduction);
+    DECL_CTOR_AND_CONVERTERS(resampling_desc_t, resampling);
     DECL_CTOR_AND_CONVERTERS(concat_desc_t, concat);
     DECL_CTOR_AND_CONVERTERS(reorder_desc_t, reorder);
     DECL_CTOR_AND_CONVERTERS(sum_desc_t, sum);
@@ -605,6 +663,7 @@ using stream_t = dnnl_stream;
 struct batch_normalization_bwd_pd_t;
 struct batch_normalization_fwd_pd_t;
 struct batch_normalization_pd_t;
+struct binary_pd_t;
 struct layer_normalization_bwd_pd_t;
 struct layer_normalization_fwd_pd_t;
 struct layer_normalization_pd_t;
@@ -628,9 +687,14 @@ struct inner_product_pd_t;
 struct lrn_bwd_pd_t;
 struct lrn_fwd_pd_t;
 struct lrn_pd_t;
+struct matmul_pd_t;
 struct pooling_bwd_pd_t;
 struct pooling_fwd_pd_t;
 struct pooling_pd_t;
+struct reduction_pd_t;
+struct resampling_bwd_pd_t;
+struct resampling_fwd_pd_t;
+struct resampling_pd_t;
 struct reorder_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
@@ -20,6 +20,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -44,6 +45,10 @@ status_t dnnl_concat_primitive_desc_create(primitive_desc_t **concat_pd,
     const data_type_t dt = src_mds[0].data_type;
 
     int concat_dim_sz = dims[concat_dim];
+    for (int i = 0; i < n; ++i)
+        if (memory_desc_wrapper(src_mds[i]).has_runtime_dims_or_strides())
+            return unimplemented;
+
     for (int i = 1; i < n; ++i) {
         if (src_mds[i].ndims != ndims) return invalid_arguments;
         for (int d = 0; d < ndims; ++d) {
@@ -57,6 +62,8 @@ status_t dnnl_concat_primitive_desc_create(primitive_desc_t **concat_pd,
     memory_desc_t dummy_dst_md;
     if (dst_md) {
         if (dst_md->ndims != ndims) return invalid_arguments;
+        if (memory_desc_wrapper(dst_md).has_runtime_dims_or_strides())
+            return unimplemented;
         for (int d = 0; d < ndims; ++d) {
             if (dst_md->dims[d] != (d == concat_dim ? concat_dim_sz : dims[d]))
                 return invalid_arguments;
@@ -208,8 +208,8 @@ protected:
     } \
     virtual status_t create_primitive(primitive_t **p) const override { \
         auto status = this->engine()->get_primitive( \
-                p, this, [=] { return std::make_shared<__VA_ARGS__>(this); }, \
-                false); \
+                p, this, \
+                [=] { return std::make_shared<__VA_ARGS__>(this); }); \
         return status; \
     } \
     virtual pd_t *clone() const override { return new pd_t(*this); } \
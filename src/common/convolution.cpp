@@ -18,6 +18,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -39,9 +40,18 @@ status_t conv_desc_init(convolution_desc_t *conv_desc, prop_kind_t prop_kind,
             && !any_null(conv_desc, src_desc, weights_desc, dst_desc, strides,
                     padding_l)
             && one_of(alg_kind, convolution_auto, convolution_direct,
-                    convolution_winograd);
+                    convolution_winograd, convolution_fft);
     if (!args_ok) return invalid_arguments;
 
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(weights_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides()
+            || (bias_desc
+                    && memory_desc_wrapper(bias_desc)
+                               .has_runtime_dims_or_strides());
+    if (runtime_dims_or_strides) return unimplemented;
+
     if (padding_r == nullptr) padding_r = padding_l;
 
     auto cd = convolution_desc_t();
@@ -69,6 +69,11 @@ struct convolution_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    virtual dim_t flops() const override {
+        return 2 * MB() * OC() * IC() / G() * OD() * OH() * OW() * KD() * KH()
+                * KW();
+    }
+
     /* common conv aux functions */
 
     dim_t MB() const { return _src_md()->dims[0]; }
@@ -174,7 +179,7 @@ protected:
 
     bool set_default_alg_kind(alg_kind_t alg_kind) {
         assert(utils::one_of(alg_kind, alg_kind::convolution_direct,
-                alg_kind::convolution_winograd));
+                alg_kind::convolution_winograd, alg_kind::convolution_fft));
         if (desc_.alg_kind == alg_kind::convolution_auto)
             desc_.alg_kind = alg_kind;
         return desc_.alg_kind == alg_kind;
@@ -18,6 +18,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -41,6 +42,15 @@ status_t deconv_desc_init(deconvolution_desc_t *deconv_desc,
             && one_of(alg_kind, deconvolution_direct, deconvolution_winograd);
     if (!args_ok) return invalid_arguments;
 
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(weights_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides()
+            || (bias_desc
+                    && memory_desc_wrapper(bias_desc)
+                               .has_runtime_dims_or_strides());
+    if (runtime_dims_or_strides) return unimplemented;
+
     if (padding_r == nullptr) padding_r = padding_l;
 
     auto dd = deconvolution_desc_t();
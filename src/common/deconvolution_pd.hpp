@@ -55,6 +55,11 @@ struct deconvolution_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    virtual dim_t flops() const override {
+        return 2 * MB() * OC() * IC() / G() * ID() * IH() * IW() * KD() * KH()
+                * KW();
+    }
+
     /* common deconv aux functions (note that conv_desc_t == deconv_desc_t) */
 
     dim_t MB() const { return conv_prop_invariant_src_d(&desc_)->dims[0]; }
@@ -118,9 +118,13 @@ int dnnl_md2dim_str(
 
     memory_desc_wrapper md(mdesc);
 
-    for (int d = 0; d < md.ndims() - 1; ++d)
-        DPRINT("%" PRId64 "x", md.dims()[d]);
-    DPRINT("%" PRId64, md.dims()[md.ndims() - 1]);
+    for (int d = 0; d < md.ndims(); ++d) {
+        if (d != 0) DPRINT("%s", "x");
+        if (md.dims()[d] == DNNL_RUNTIME_DIM_VAL)
+            DPRINT("%s", "*");
+        else
+            DPRINT("%" PRId64, md.dims()[d]);
+    }
 
     return written_len;
 }
@@ -380,6 +380,10 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_inner_product) return "inner_product";
     if (v == dnnl_rnn) return "rnn";
     if (v == dnnl_gemm) return "gemm";
+    if (v == dnnl_matmul) return "matmul";
+    if (v == dnnl_binary) return "binary";
+    if (v == dnnl_reduction) return "reduction";
+    if (v == dnnl_resampling) return "resampling";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
 }
@@ -389,6 +393,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_convolution_direct) return "convolution_direct";
     if (v == dnnl_convolution_winograd) return "convolution_winograd";
     if (v == dnnl_convolution_auto) return "convolution_auto";
+    if (v == dnnl_convolution_fft) return "convolution_fft";
     if (v == dnnl_deconvolution_direct) return "deconvolution_direct";
     if (v == dnnl_deconvolution_winograd) return "deconvolution_winograd";
     if (v == dnnl_eltwise_relu) return "eltwise_relu";
@@ -414,6 +419,23 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_vanilla_lstm) return "vanilla_lstm";
     if (v == dnnl_vanilla_gru) return "vanilla_gru";
     if (v == dnnl_lbr_gru) return "lbr_gru";
+    if (v == dnnl_binary_add) return "binary_add";
+    if (v == dnnl_binary_mul) return "binary_mul";
+    if (v == dnnl_binary_max) return "binary_max";
+    if (v == dnnl_binary_min) return "binary_min";
+    if (v == dnnl_reduction_max) return "reduction_max";
+    if (v == dnnl_reduction_min) return "reduction_min";
+    if (v == dnnl_reduction_sum) return "reduction_sum";
+    if (v == dnnl_reduction_mul) return "reduction_mul";
+    if (v == dnnl_reduction_mean) return "reduction_mean";
+    if (v == dnnl_reduction_norm_lp_max) return "reduction_norm_lp_max";
+    if (v == dnnl_reduction_norm_lp_sum) return "reduction_norm_lp_sum";
+    if (v == dnnl_reduction_norm_lp_power_p_max)
+        return "reduction_norm_lp_power_p_max";
+    if (v == dnnl_reduction_norm_lp_power_p_sum)
+        return "reduction_norm_lp_power_p_sum";
+    if (v == dnnl_resampling_nearest) return "resampling_nearest";
+    if (v == dnnl_resampling_linear) return "resampling_linear";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
@@ -422,12 +444,14 @@ const char *dnnl_normalization_flags2str(dnnl_normalization_flags_t v) {
     if (v == dnnl_use_global_stats) return "use_global_stats";
     if (v == dnnl_use_scaleshift) return "use_scaleshift";
     if (v == dnnl_fuse_norm_relu) return "fuse_norm_relu";
+    if (v == dnnl_fuse_norm_add_relu) return "fuse_norm_add_relu";
     assert(!"unknown normalization_flags");
     return "unknown normalization_flags";
 }
 
 const char *dnnl_rnn_flags2str(dnnl_rnn_flags_t v) {
     if (v == dnnl_rnn_flags_undef) return "undef";
+    if (v == dnnl_rnn_flags_use_seq_lengths) return "use_seq_lengths";
     assert(!"unknown rnn_flags");
     return "unknown rnn_flags";
 }
@@ -457,4 +481,12 @@ const char *dnnl_scratchpad_mode2str(dnnl_scratchpad_mode_t v) {
     return "unknown scratchpad_mode";
 }
 
+const char *dnnl_impl_selection_mode2str(dnnl_impl_selection_mode_t v) {
+    if (v == dnnl_impl_selection_mode_first) return "impl_selection_mode_first";
+    if (v == dnnl_impl_selection_mode_fastest)
+        return "impl_selection_mode_fastest";
+    assert(!"unknown impl_selection_mode");
+    return "unknown impl_selection_mode";
+}
+
 
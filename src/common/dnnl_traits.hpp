@@ -121,6 +121,10 @@ PKIND_TRAITS_INST(layer_normalization);
 PKIND_TRAITS_INST(inner_product);
 PKIND_TRAITS_INST(rnn);
 PKIND_TRAITS_INST(gemm);
+PKIND_TRAITS_INST(matmul);
+PKIND_TRAITS_INST(binary);
+PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(resampling);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
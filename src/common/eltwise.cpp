@@ -18,6 +18,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -46,6 +47,15 @@ status_t eltwise_desc_init(eltwise_desc_t *eltwise_desc, prop_kind_t prop_kind,
                     alg_kind == eltwise_relu && alpha == 0);
     if (!args_ok) return invalid_arguments;
 
+    // run-time dimensions are supported for forward propagation only
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides()
+            || (diff_data_desc
+                    && memory_desc_wrapper(diff_data_desc)
+                               .has_runtime_dims_or_strides());
+    if (runtime_dims_or_strides && prop_kind == backward_data)
+        return unimplemented;
+
     auto ed = eltwise_desc_t();
     ed.primitive_kind = primitive_kind::eltwise;
     ed.prop_kind = prop_kind;
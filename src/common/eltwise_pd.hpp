@@ -72,6 +72,11 @@ struct eltwise_pd_t : public primitive_desc_t {
         return memory_desc_wrapper(desc_.data_desc).has_zero_dim();
     }
 
+    bool has_runtime_dims_or_strides() const {
+        return memory_desc_wrapper(desc_.data_desc)
+                .has_runtime_dims_or_strides();
+    }
+
 protected:
     eltwise_desc_t desc_;
     const eltwise_fwd_pd_t *hint_fwd_pd_;
@@ -24,6 +24,7 @@
 #include "c_types_map.hpp"
 #include "primitive.hpp"
 #include "primitive_cache.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 /** \brief An abstraction of an execution unit with shared resources
@@ -123,8 +124,8 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
     template <typename F>
     dnnl::impl::status_t get_primitive(dnnl::impl::primitive_t **primitive,
             const dnnl::impl::primitive_desc_t *pd,
-            const F &create_primitive_impl, bool use_global_scratchpad) {
-        double ms = dnnl::impl::get_msec();
+            const F &create_primitive_impl) {
+        const double start_ms = dnnl::impl::get_msec();
 
         // create a key for the requested primitive
         dnnl::impl::primitive_hashing::key_t key(pd->kind(), pd->op_desc(),
@@ -139,14 +140,16 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
             // create a wrapper for primitive_impl
             auto status = dnnl::impl::safe_ptr_assign<dnnl::impl::primitive_t>(
                     *primitive,
-                    new dnnl::impl::primitive_t(
-                            primitive_impl, use_global_scratchpad));
+                    new dnnl::impl::primitive_t(primitive_impl));
             if (status != dnnl::impl::status::success) return status;
 
-            ms = dnnl::impl::get_msec() - ms;
+            const double end_ms = dnnl::impl::get_msec();
+            if (dnnl::impl::trace_enabled())
+                dnnl::impl::trace_record(dnnl_trace_event_create,
+                        *primitive, start_ms, end_ms, true);
             if (dnnl::impl::dnnl_verbose()->level >= 2) {
                 printf("dnnl_verbose,create:cache hit,%s,%g\n",
-                        (*primitive)->pd()->info(), ms);
+                        (*primitive)->pd()->info(), end_ms - start_ms);
                 fflush(0);
             }
             return status;
@@ -155,8 +158,7 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
         // cache miss - create a requested primitive_impl and a wrapper
         auto status = dnnl::impl::safe_ptr_assign<dnnl::impl::primitive_t>(
                 *primitive,
-                new dnnl::impl::primitive_t(
-                        create_primitive_impl(), use_global_scratchpad));
+                new dnnl::impl::primitive_t(create_primitive_impl()));
 
         if (status != dnnl::impl::status::success) {
             recursive_mutex_.unlock();
@@ -177,10 +179,13 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
         primitive_cache_->add(key, (*primitive)->get_primitive_impl());
         recursive_mutex_.unlock();
 
-        ms = dnnl::impl::get_msec() - ms;
+        const double end_ms = dnnl::impl::get_msec();
+        if (dnnl::impl::trace_enabled())
+            dnnl::impl::trace_record(dnnl_trace_event_create, *primitive,
+                    start_ms, end_ms, false);
         if (dnnl::impl::dnnl_verbose()->level >= 2) {
             printf("dnnl_verbose,create:cache miss,%s,%g\n",
-                    (*primitive)->pd()->info(), ms);
+                    (*primitive)->pd()->info(), end_ms - start_ms);
             fflush(0);
         }
         return status;
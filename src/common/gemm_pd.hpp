@@ -63,6 +63,10 @@ struct gemm_pd_t : public primitive_desc_t {
         return index == 0 ? &c_md_ : &glob_zero_md;
     }
 
+    virtual dim_t flops() const override {
+        return 2 * desc_.m * desc_.n * desc_.k;
+    }
+
     virtual void init_info() override { impl::init_info(this, this->info_); }
 
     virtual int n_inputs() const override { return 2; }
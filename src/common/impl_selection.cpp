@@ -0,0 +1,247 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "impl_selection.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "nstl.hpp"
+#include "primitive_desc.hpp"
+#include "primitive_hashing.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// The winner for a problem. The implementation list may differ from the one
+// the record was made with (e.g. another ISA), so the index is only a hint
+// and the name is what identifies the implementation.
+struct record_t {
+    int idx;
+    std::string name;
+};
+
+std::mutex records_mutex;
+std::unordered_map<size_t, record_t> records;
+bool records_loaded = false;
+char records_path[1024] = "";
+
+// Must be called with records_mutex held
+void load_records_locked() {
+    if (records_loaded) return;
+    records_loaded = true;
+
+    if (getenv("DNNL_IMPL_SELECTION_CACHE", records_path, sizeof(records_path))
+            <= 0) {
+        records_path[0] = '\0';
+        return;
+    }
+
+    FILE *f = impl::fopen(records_path, "r");
+    if (!f) return;
+
+    char line[512], name[256];
+    unsigned long long hash;
+    int idx;
+    while (fgets(line, sizeof(line), f))
+        if (sscanf(line, "%llx %d %255s", &hash, &idx, name) == 3)
+            records[(size_t)hash] = {idx, name};
+    fclose(f);
+}
+
+bool find_record(size_t hash, record_t &record) {
+    std::lock_guard<std::mutex> guard(records_mutex);
+    load_records_locked();
+    auto it = records.find(hash);
+    if (it == records.end()) return false;
+    record = it->second;
+    return true;
+}
+
+void store_record(size_t hash, int idx, const std::string &name) {
+    std::lock_guard<std::mutex> guard(records_mutex);
+    load_records_locked();
+    records[hash] = {idx, name};
+    if (records_path[0] == '\0') return;
+
+    FILE *f = impl::fopen(records_path, "a");
+    if (!f) return;
+    fprintf(f, "%llx %d %s\n", (unsigned long long)hash, idx, name.c_str());
+    fclose(f);
+}
+
+size_t get_problem_hash(engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd) {
+    using namespace primitive_hashing;
+    const std::type_index hint_id = hint_fwd_pd
+            ? hint_fwd_pd->impl_id()
+            : std::type_index(typeid(void));
+    primitive_hashing::key_t key(
+            op_desc->kind, op_desc, attr, hint_id, dnnl_get_max_threads());
+    const size_t seed = std::hash<primitive_hashing::key_t>()(key);
+    return hash_combine(seed, static_cast<size_t>(engine->kind()));
+}
+
+// Returns the best time of a few executions of the primitive, in ms, or a
+// negative value if the primitive cannot be run on the library-allocated
+// memory (e.g. it has runtime dimensions).
+double measure(const primitive_desc_t *pd) {
+    using namespace status;
+
+    engine_t *engine = pd->engine();
+    primitive_t *p = nullptr;
+    stream_t *stream = nullptr;
+    std::vector<memory_t *> mems;
+    std::vector<dnnl_exec_arg_t> exec_args;
+
+    bool ok = pd->create_primitive(&p) == success
+            && dnnl_stream_create(
+                       &stream, engine, stream_flags::default_flags)
+                    == success;
+    for (int arg : primitive_desc_t::exec_args()) {
+        if (!ok) break;
+        if (pd->arg_usage(arg) == primitive_desc_t::arg_usage_t::unused)
+            continue;
+
+        const memory_desc_t *md = pd->arg_md(arg);
+        memory_t *mem = nullptr;
+        ok = !types::is_zero_md(md)
+                && dnnl_memory_create(&mem, md, engine, DNNL_MEMORY_ALLOCATE)
+                        == success;
+        if (!ok) break;
+        mems.push_back(mem);
+        exec_args.push_back({arg, mem});
+
+        // Zeros keep the special values (e.g. denormals) out of the timings
+        void *ptr = nullptr;
+        ok = dnnl_memory_map_data(mem, &ptr) == success;
+        if (ok && ptr) memset(ptr, 0, memory_desc_wrapper(md).size());
+        if (ok) ok = dnnl_memory_unmap_data(mem, ptr) == success;
+    }
+
+    // The runtime output scales are passed as ones
+    const auto &oscales = pd->attr()->output_scales_;
+    if (ok && !oscales.defined()) {
+        const memory_desc_wrapper dst_d(pd->dst_md());
+        dims_t count = {1};
+        for (int d = 0; d < dst_d.ndims(); d++)
+            if (oscales.mask_ & (1 << d)) count[0] *= dst_d.dims()[d];
+
+        memory_desc_t md;
+        memory_t *mem = nullptr;
+        ok = dnnl_memory_desc_init_by_tag(
+                     &md, 1, count, data_type::f32, format_tag::x)
+                        == success
+                && dnnl_memory_create(&mem, &md, engine, DNNL_MEMORY_ALLOCATE)
+                        == success;
+        if (ok) {
+            mems.push_back(mem);
+            exec_args.push_back({DNNL_ARG_ATTR_OUTPUT_SCALES, mem});
+
+            void *ptr = nullptr;
+            ok = dnnl_memory_map_data(mem, &ptr) == success;
+            if (ok && ptr) utils::array_set((float *)ptr, 1.f, count[0]);
+            if (ok) ok = dnnl_memory_unmap_data(mem, ptr) == success;
+        }
+    }
+
+    // The first execution generates the kernels and warms up the caches
+    const int nruns = 5;
+    double best_ms = -1;
+    for (int i = 0; ok && i <= nruns; i++) {
+        double ms = get_msec();
+        ok = dnnl_primitive_execute(
+                     p, stream, (int)exec_args.size(), exec_args.data())
+                        == success
+                && dnnl_stream_wait(stream) == success;
+        ms = get_msec() - ms;
+        if (ok && i > 0) best_ms = best_ms < 0 ? ms : nstl::min(best_ms, ms);
+    }
+
+    for (auto mem : mems)
+        dnnl_memory_destroy(mem);
+    if (stream) dnnl_stream_destroy(stream);
+    if (p) dnnl_primitive_destroy(p);
+
+    return ok ? best_ms : -1;
+}
+
+} // namespace
+
+int get_fastest_impl_idx(engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd) {
+    const auto *impl_list = engine->get_implementation_list();
+    int n_impls = 0;
+    while (impl_list[n_impls] != nullptr)
+        ++n_impls;
+
+    auto create_pd = [&](int idx) -> primitive_desc_t * {
+        primitive_desc_t *pd = nullptr;
+        auto s = impl_list[idx](&pd, op_desc, attr, engine, hint_fwd_pd);
+        return s == status::success ? pd : nullptr;
+    };
+
+    const size_t hash = get_problem_hash(engine, op_desc, attr, hint_fwd_pd);
+
+    record_t record;
+    if (find_record(hash, record)) {
+        // Try the recorded index first, then look the name up
+        for (int i = -1; i < n_impls; i++) {
+            const int idx = i < 0 ? record.idx : i;
+            if (idx < 0 || idx >= n_impls) continue;
+            primitive_desc_t *pd = create_pd(idx);
+            const bool match = pd && record.name == pd->name();
+            delete pd;
+            if (match) return idx;
+        }
+    }
+
+    int best_idx = -1;
+    double best_ms = 0;
+    std::string best_name;
+    for (int idx = 0; idx < n_impls; idx++) {
+        primitive_desc_t *pd = create_pd(idx);
+        if (pd == nullptr) continue;
+
+        const double ms = measure(pd);
+        if (ms >= 0 && (best_idx < 0 || ms < best_ms)) {
+            best_idx = idx;
+            best_ms = ms;
+            best_name = pd->name();
+        }
+        delete pd;
+    }
+
+    if (best_idx >= 0) store_record(hash, best_idx, best_name);
+    return best_idx;
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef IMPL_SELECTION_HPP
+#define IMPL_SELECTION_HPP
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+/** Returns the index in the implementation list of the @p engine of the
+ * fastest implementation of the problem, or -1 if it is not known and cannot
+ * be measured (e.g. the problem has runtime dimensions).
+ *
+ * The implementations that support the problem are run once per problem and
+ * number of threads, the winner is remembered for the process lifetime and,
+ * if the DNNL_IMPL_SELECTION_CACHE environment variable names a file, in that
+ * file for the later runs on the same machine. */
+int get_fastest_impl_idx(engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
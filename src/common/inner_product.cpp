@@ -18,6 +18,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -34,6 +35,34 @@ status_t ip_desc_init(inner_product_desc_t *ip_desc, prop_kind_t prop_kind,
     bool args_ok = !any_null(ip_desc, src_desc, weights_desc, dst_desc);
     if (!args_ok) return invalid_arguments;
 
+    // only the minibatch of the forward propagation may be specified at
+    // run-time, all the other dimensions and strides must be known
+    auto runtime_mb_only = [&](const memory_desc_t *md) {
+        memory_desc_t md_copy = *md;
+        if (md_copy.ndims > 0 && md_copy.dims[0] == DNNL_RUNTIME_DIM_VAL)
+            md_copy.dims[0] = md_copy.padded_dims[0] = 1;
+        return !memory_desc_wrapper(md_copy).has_runtime_dims_or_strides();
+    };
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(weights_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides()
+            || (bias_desc
+                    && memory_desc_wrapper(bias_desc)
+                               .has_runtime_dims_or_strides());
+    if (runtime_dims_or_strides) {
+        const bool is_fwd
+                = one_of(prop_kind, forward_training, forward_inference);
+        const bool ok = is_fwd && runtime_mb_only(src_desc)
+                && runtime_mb_only(dst_desc)
+                && !memory_desc_wrapper(weights_desc)
+                            .has_runtime_dims_or_strides()
+                && IMPLICATION(bias_desc,
+                        !memory_desc_wrapper(bias_desc)
+                                 .has_runtime_dims_or_strides());
+        if (!ok) return unimplemented;
+    }
+
     auto id = inner_product_desc_t();
     id.primitive_kind = primitive_kind::inner_product;
     id.prop_kind = prop_kind;
@@ -63,6 +63,10 @@ struct inner_product_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    virtual dim_t flops() const override {
+        return 2 * MB() * OC() * IC() * ID() * IH() * IW();
+    }
+
     /* common inner_product aux functions */
 
     dim_t MB() const { return ip_prop_invariant_src_d(&desc_)->dims[0]; }
@@ -134,6 +138,12 @@ struct inner_product_pd_t : public primitive_desc_t {
         return s_d.has_zero_dim() || d_d.has_zero_dim();
     }
 
+    /** returns true if the minibatch is specified at run-time */
+    bool has_runtime_dims_or_strides() const {
+        return memory_desc_wrapper(*ip_prop_invariant_src_d(&desc_))
+                .has_runtime_dims_or_strides();
+    }
+
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
                 prop_kind::forward_inference);
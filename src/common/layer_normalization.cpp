@@ -18,6 +18,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -40,6 +41,22 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
             && IMPLICATION(flags & dnnl_use_global_stats, stat_desc != nullptr);
     if (!args_ok) return invalid_arguments;
 
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides()
+            || (stat_desc
+                    && memory_desc_wrapper(stat_desc)
+                               .has_runtime_dims_or_strides())
+            || (diff_data_desc
+                    && memory_desc_wrapper(diff_data_desc)
+                               .has_runtime_dims_or_strides());
+    // run-time dimensions are supported for forward propagation only, and
+    // the normalized (last) dimension must be known at creation
+    if (runtime_dims_or_strides
+            && (prop_kind & backward
+                    || data_desc->dims[data_desc->ndims - 1]
+                            == DNNL_RUNTIME_DIM_VAL))
+        return unimplemented;
+
     auto ld = layer_normalization_desc_t();
     ld.primitive_kind = primitive_kind::layer_normalization;
     ld.prop_kind = prop_kind;
@@ -62,8 +79,10 @@ status_t lnorm_desc_init(layer_normalization_desc_t *lnorm_desc,
                     = data_strides[i] > data_strides[data_desc->ndims - 1]
                     ? data_strides[i]
                     : data_strides[i] / data_strides[data_desc->ndims - 1];
+        // with run-time dimensions the statistics are dense row-major
         dnnl_memory_desc_init_by_strides(&ld.stat_desc, stat_ndims, stat_dims,
-                data_type::f32, stat_strides);
+                data_type::f32,
+                runtime_dims_or_strides ? nullptr : stat_strides);
     }
 
     int ndims = data_desc->ndims;
@@ -86,6 +86,11 @@ struct layer_normalization_pd_t : public primitive_desc_t {
         return memory_desc_wrapper(desc_.data_desc).has_zero_dim();
     }
 
+    bool has_runtime_dims_or_strides() const {
+        return memory_desc_wrapper(desc_.data_desc)
+                .has_runtime_dims_or_strides();
+    }
+
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
 protected:
@@ -126,6 +131,16 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         return primitive_desc_t::arg_usage(arg);
     }
 
+    virtual const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_MEAN:
+                return stats_are_src() ? src_md(1) : dst_md(1);
+            case DNNL_ARG_VARIANCE:
+                return stats_are_src() ? src_md(2) : dst_md(2);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
     virtual const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &data_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
@@ -179,6 +194,14 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return primitive_desc_t::arg_usage(arg);
     }
 
+    virtual const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_MEAN: return src_md(1);
+            case DNNL_ARG_VARIANCE: return src_md(2);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
     virtual const memory_desc_t *src_md(int index = 0) const override {
         return index == 0 ? &data_md_ : index <= 2 ? &stat_md_ : &glob_zero_md;
     }
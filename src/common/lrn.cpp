@@ -18,6 +18,7 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -41,6 +42,13 @@ status_t lrn_desc_init(lrn_desc_t *lrn_desc, prop_kind_t prop_kind,
                     prop_kind == backward_data, diff_data_desc != nullptr);
     if (!args_ok) return invalid_arguments;
 
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides()
+            || (diff_data_desc
+                    && memory_desc_wrapper(diff_data_desc)
+                               .has_runtime_dims_or_strides());
+    if (runtime_dims_or_strides) return unimplemented;
+
     auto ld = lrn_desc_t();
     ld.primitive_kind = primitive_kind::lrn;
     ld.prop_kind = prop_kind;
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::types;
+
+namespace {
+bool is_runtime(dim_t d) {
+    return d == DNNL_RUNTIME_DIM_VAL;
+}
+
+/* Two dimensions are consistent if they are equal or both unknown */
+bool dims_consistent(dim_t d0, dim_t d1) {
+    return d0 == d1 || (is_runtime(d0) && is_runtime(d1));
+}
+
+status_t matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc) {
+    bool args_ok = !any_null(matmul_desc, src_desc, weights_desc, dst_desc);
+    if (!args_ok) return invalid_arguments;
+
+    auto op_d = matmul_desc_t();
+    op_d.primitive_kind = primitive_kind::matmul;
+
+    op_d.src_desc = *src_desc;
+    op_d.weights_desc = *weights_desc;
+    if (bias_desc) op_d.bias_desc = *bias_desc;
+    op_d.dst_desc = *dst_desc;
+
+    const bool with_bias = op_d.bias_desc.ndims != 0;
+    const int ndims = dst_desc->ndims;
+    bool ok = 2 <= ndims && ndims <= DNNL_MAX_NDIMS
+            && everyone_is(ndims, src_desc->ndims, weights_desc->ndims)
+            && IMPLICATION(with_bias, op_d.bias_desc.ndims == ndims);
+    if (!ok) return invalid_arguments;
+
+    const int m_idx = ndims - 2, k_idx_src = ndims - 1;
+    const int k_idx_wei = ndims - 2, n_idx = ndims - 1;
+
+    // check: m, n, k
+    ok = dims_consistent(src_desc->dims[m_idx], dst_desc->dims[m_idx])
+            && dims_consistent(
+                    weights_desc->dims[n_idx], dst_desc->dims[n_idx])
+            && dims_consistent(
+                    src_desc->dims[k_idx_src], weights_desc->dims[k_idx_wei]);
+    if (!ok) return invalid_arguments;
+
+    // check: batch dimensions, src and weights may broadcast along them
+    for (int d = 0; d < ndims - 2; ++d) {
+        const dim_t s_dim = src_desc->dims[d];
+        const dim_t w_dim = weights_desc->dims[d];
+        const dim_t d_dim = dst_desc->dims[d];
+
+        if (is_runtime(d_dim)) {
+            ok = one_of(s_dim, 1, DNNL_RUNTIME_DIM_VAL)
+                    && one_of(w_dim, 1, DNNL_RUNTIME_DIM_VAL);
+        } else {
+            ok = one_of(s_dim, 1, d_dim) && one_of(w_dim, 1, d_dim)
+                    && nstl::max(s_dim, w_dim) == d_dim;
+        }
+        if (!ok) return invalid_arguments;
+    }
+
+    // check: bias is either broadcast or has the same shape as dst; if
+    // either of the dimensions is a runtime one, the check is postponed
+    // until execution
+    for (int d = 0; d < ndims && with_bias; ++d) {
+        const dim_t b_dim = op_d.bias_desc.dims[d];
+        const dim_t d_dim = dst_desc->dims[d];
+        ok = b_dim == 1 || b_dim == d_dim || is_runtime(b_dim)
+                || is_runtime(d_dim);
+        if (!ok) return invalid_arguments;
+    }
+
+    op_d.accum_data_type = types::default_accum_data_type(src_desc->data_type,
+            weights_desc->data_type, dst_desc->data_type,
+            prop_kind::forward_inference);
+
+    *matmul_desc = op_d;
+    return success;
+}
+} // namespace
+
+status_t dnnl_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *dst_desc) {
+    return matmul_desc_init(
+            matmul_desc, src_desc, weights_desc, bias_desc, dst_desc);
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
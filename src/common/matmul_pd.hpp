@@ -0,0 +1,157 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef MATMUL_PD_HPP
+#define MATMUL_PD_HPP
+
+#include <assert.h>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct matmul_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::matmul;
+
+    typedef matmul_pd_t base_class;
+    typedef matmul_pd_t hint_class;
+
+    matmul_pd_t(engine_t *engine, const matmul_desc_t *adesc,
+            const primitive_attr_t *attr, const matmul_pd_t *hint_fwd_pd)
+        : primitive_desc_t(engine, attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , weights_md_(desc_.weights_desc)
+        , bias_md_(desc_.bias_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    const matmul_desc_t *desc() const { return &desc_; }
+    virtual const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+    virtual void init_info() override { impl::init_info(this, this->info_); }
+
+    virtual arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_WEIGHTS))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_BIAS && with_bias()) return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    virtual status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::matmul_d:
+                *(const matmul_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    virtual dim_t flops() const override {
+        if (has_runtime_dims_or_strides()) return 0;
+        dim_t batch = 1;
+        for (int d = 0; d < batch_ndims(); d++)
+            batch *= dst_md_.dims[d];
+        return 2 * batch * M() * N() * K();
+    }
+
+    virtual const memory_desc_t *src_md(int index = 0) const override {
+        return index == 0 ? &src_md_ : &glob_zero_md;
+    }
+    virtual const memory_desc_t *weights_md(int index = 0) const override {
+        if (index == 0) return &weights_md_;
+        if (index == 1 && with_bias()) return &bias_md_;
+        return &glob_zero_md;
+    }
+    virtual const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    virtual int n_inputs() const override { return 2 + with_bias(); }
+    virtual int n_outputs() const override { return 1; }
+
+    /* common matmul aux functions */
+
+    int ndims() const { return dst_md_.ndims; }
+    int batch_ndims() const { return ndims() - 2; }
+
+    dim_t batch() const {
+        return utils::array_product(dst_md_.dims, batch_ndims());
+    }
+    dim_t M() const { return dst_md_.dims[ndims() - 2]; }
+    dim_t N() const { return dst_md_.dims[ndims() - 1]; }
+    dim_t K() const { return src_md_.dims[ndims() - 1]; }
+
+    bool with_bias() const { return bias_md_.ndims != 0; }
+
+    /** returns true if src or weights are broadcast along batch dimensions */
+    bool batch_broadcast() const {
+        for (int d = 0; d < batch_ndims(); ++d)
+            if (src_md_.dims[d] != weights_md_.dims[d]) return true;
+        return false;
+    }
+
+    bool has_runtime_dims_or_strides() const {
+        return memory_desc_wrapper(src_md_).has_runtime_dims_or_strides()
+                || memory_desc_wrapper(weights_md_)
+                           .has_runtime_dims_or_strides()
+                || memory_desc_wrapper(dst_md_).has_runtime_dims_or_strides()
+                || memory_desc_wrapper(bias_md_).has_runtime_dims_or_strides();
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md_).has_zero_dim()
+                || memory_desc_wrapper(weights_md_).has_zero_dim()
+                || memory_desc_wrapper(dst_md_).has_zero_dim();
+    }
+
+protected:
+    matmul_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t weights_md_;
+    memory_desc_t bias_md_;
+    memory_desc_t dst_md_;
+
+    /* sets plain (row-major) layouts for the memory descriptors that have
+     * format_kind::any */
+    status_t set_default_formats() {
+        for (auto md : {&src_md_, &weights_md_, &bias_md_, &dst_md_}) {
+            if (md->ndims == 0 || md->format_kind != format_kind::any)
+                continue;
+            status_t status = memory_desc_init_by_strides(*md, nullptr);
+            if (status != status::success) return status;
+        }
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -46,7 +46,7 @@ bool memory_desc_sanity_check(int ndims, const dims_t dims,
             && format_kind != format_kind::undef;
     if (!ok) return false;
     for (int d = 0; d < ndims; ++d)
-        if (dims[d] < 0) return false;
+        if (dims[d] != DNNL_RUNTIME_DIM_VAL && dims[d] < 0) return false;
 
     return true;
 }
@@ -137,8 +137,14 @@ status_t dnnl_memory_desc_init_by_strides(memory_desc_t *memory_desc, int ndims,
     dims_t default_strides = {0};
     if (strides == nullptr) {
         default_strides[md.ndims - 1] = 1;
-        for (int d = md.ndims - 2; d >= 0; --d)
-            default_strides[d] = default_strides[d + 1] * md.padded_dims[d + 1];
+        for (int d = md.ndims - 2; d >= 0; --d) {
+            const bool is_runtime = false
+                    || default_strides[d + 1] == DNNL_RUNTIME_DIM_VAL
+                    || md.padded_dims[d + 1] == DNNL_RUNTIME_DIM_VAL;
+            default_strides[d] = is_runtime
+                    ? DNNL_RUNTIME_DIM_VAL
+                    : default_strides[d + 1] * md.padded_dims[d + 1];
+        }
         strides = default_strides;
     } else {
         /* TODO: add sanity check for the provided strides */
@@ -158,6 +164,7 @@ status_t dnnl_memory_desc_init_submemory(memory_desc_t *md,
         return invalid_arguments;
 
     const memory_desc_wrapper src_d(parent_md);
+    if (src_d.has_runtime_dims_or_strides()) return unimplemented;
 
     for (int d = 0; d < src_d.ndims(); ++d) {
         if (dims[d] < 0 || offsets[d] < 0
@@ -216,10 +223,14 @@ status_t dnnl_memory_create(memory_t **memory, const memory_desc_t *md,
     if (md == nullptr) md = &z_md;
 
     if (md->format_kind == format_kind::any) return invalid_arguments;
+    if (memory_desc_wrapper(md).has_runtime_dims_or_strides())
+        return invalid_arguments;
 
-    unsigned flags = (handle == DNNL_MEMORY_ALLOCATE)
-            ? memory_flags_t::alloc
-            : memory_flags_t::use_backend_ptr;
+    unsigned flags = memory_flags_t::use_backend_ptr;
+    if (handle == DNNL_MEMORY_ALLOCATE)
+        flags = memory_flags_t::alloc;
+    else if (handle == DNNL_MEMORY_ALLOCATE_REPLICATED)
+        flags = memory_flags_t::alloc | memory_flags_t::replicate;
     return safe_ptr_assign<memory_t>(
             *memory, new memory_t(engine, md, flags, handle));
 }
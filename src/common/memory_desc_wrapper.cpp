@@ -56,6 +56,33 @@ status_t fill_blocked(memory_desc_t &md, std::initializer_list<int> perm,
     }
 
     utils::array_set(md.padded_offsets, 0, md.ndims);
+
+    bool has_runtime_dims = false;
+    for (int d = 0; d < md.ndims; ++d)
+        has_runtime_dims
+                = has_runtime_dims || md.dims[d] == DNNL_RUNTIME_DIM_VAL;
+
+    if (has_runtime_dims) {
+        // runtime dimensions are supported for plain formats only; every
+        // stride that depends on a runtime dimension becomes runtime too
+        if (blk.inner_nblks != 0) return status::unimplemented;
+
+        utils::array_copy(md.padded_dims, md.dims, md.ndims);
+
+        dim_t stride = 1;
+        for (auto it = perm.end(); it != perm.begin();) {
+            const int d = *(--it);
+            blk.strides[d] = stride;
+            if (stride == DNNL_RUNTIME_DIM_VAL
+                    || md.dims[d] == DNNL_RUNTIME_DIM_VAL)
+                stride = DNNL_RUNTIME_DIM_VAL;
+            else
+                stride *= md.dims[d] == 0 ? 1 : md.dims[d];
+        }
+
+        return status::success;
+    }
+
     for (int d = 0; d < md.ndims; ++d)
         md.padded_dims[d] = utils::rnd_up(md.dims[d], blocks[d]);
 
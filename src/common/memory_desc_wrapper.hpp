@@ -78,6 +78,7 @@ struct memory_desc_wrapper : public c_compatible {
      * is true, and the number of data elements otherwise */
     dim_t nelems(bool with_padding = false) const {
         if (is_zero()) return 0;
+        if (has_runtime_dims()) return DNNL_RUNTIME_DIM_VAL;
         return utils::array_product(
                 with_padding ? padded_dims() : dims(), ndims());
     }
@@ -88,6 +89,25 @@ struct memory_desc_wrapper : public c_compatible {
     /** returns true if memory descriptor contains zero as one of its dim */
     bool has_zero_dim() const { return nelems() == 0; }
 
+    /** returns true if at least one dim is not known at creation time */
+    bool has_runtime_dims() const {
+        for (int d = 0; d < ndims(); ++d)
+            if (dims()[d] == DNNL_RUNTIME_DIM_VAL) return true;
+        return false;
+    }
+
+    /** returns true if at least one stride is not known at creation time */
+    bool has_runtime_strides() const {
+        if (!is_blocking_desc()) return false;
+        for (int d = 0; d < ndims(); ++d)
+            if (blocking_desc().strides[d] == DNNL_RUNTIME_DIM_VAL) return true;
+        return false;
+    }
+
+    bool has_runtime_dims_or_strides() const {
+        return has_runtime_dims() || has_runtime_strides();
+    }
+
     /** return the size of data type (a shortcut) */
     size_t data_type_size() const { return types::data_type_size(data_type()); }
 
@@ -123,6 +143,8 @@ struct memory_desc_wrapper : public c_compatible {
         if (is_zero() || has_zero_dim() || format_kind() == format_kind::any)
             return 0;
 
+        if (has_runtime_dims_or_strides()) return DNNL_RUNTIME_SIZE_VAL;
+
         if (format_kind() == format_kind::wino) {
             return wino_desc().size;
         } else if (format_kind() == format_kind::rnn_packed) {
@@ -152,6 +174,7 @@ struct memory_desc_wrapper : public c_compatible {
     bool is_dense(bool with_padding = false) const {
         if (utils::one_of(format_kind(), format_kind::undef, format_kind::any))
             return false;
+        if (has_runtime_dims_or_strides()) return false;
         return nelems(with_padding) * data_type_size() == size();
     }
 
@@ -219,6 +242,11 @@ struct memory_desc_wrapper : public c_compatible {
     /** returns true if one memory can be reordered to another */
     bool consistent_with(const memory_desc_wrapper &rhs) const;
 
+    /** returns true if the memory desc \param rhs (that must be fully
+     * defined) may be used in place of this one, i.e. they differ only in
+     * the dimensions and strides this memory desc leaves for run-time */
+    bool matches_runtime_md(const memory_desc_wrapper &rhs) const;
+
     /** returns true if the memory desc corresponds to the given format tag and
      * strides.
      * @sa memory_desc_matches_tag */
@@ -415,6 +443,26 @@ inline bool memory_desc_wrapper::consistent_with(
     }
 }
 
+inline bool memory_desc_wrapper::matches_runtime_md(
+        const memory_desc_wrapper &rhs) const {
+    using namespace utils;
+    if (!(ndims() == rhs.ndims() && data_type() == rhs.data_type()
+                && is_blocking_desc() && rhs.is_blocking_desc()
+                && !rhs.has_runtime_dims_or_strides()
+                && blocking_desc().inner_nblks == 0
+                && rhs.blocking_desc().inner_nblks == 0))
+        return false;
+
+    for (int d = 0; d < ndims(); ++d) {
+        const dim_t stride = blocking_desc().strides[d];
+        const bool ok = one_of(dims()[d], DNNL_RUNTIME_DIM_VAL, rhs.dims()[d])
+                && one_of(stride, DNNL_RUNTIME_DIM_VAL,
+                        rhs.blocking_desc().strides[d]);
+        if (!ok) return false;
+    }
+    return true;
+}
+
 } // namespace impl
 } // namespace dnnl
 
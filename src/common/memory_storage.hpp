@@ -51,6 +51,23 @@ struct memory_storage_t : public c_compatible {
     size_t get_offset() const { return offset_; }
     void set_offset(size_t offset) { offset_ = offset; }
 
+    /** returns the data handle of the copy of the data on the NUMA node of
+     * the calling thread, for the storages keeping a copy on each node */
+    virtual status_t get_local_data_handle(void **handle) const {
+        return get_data_handle(handle);
+    }
+
+    void *local_data_handle() const {
+        void *handle;
+        status_t status = get_local_data_handle(&handle);
+        assert(status == status::success);
+        MAYBE_UNUSED(status);
+        return handle;
+    }
+
+    /** copies the data to the other copies, if any, after it is written */
+    virtual status_t update_replicas() const { return status::success; }
+
     virtual status_t map_data(void **mapped_ptr) const {
         return get_data_handle(mapped_ptr);
     }
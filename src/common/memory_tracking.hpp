@@ -18,7 +18,7 @@
 #define MEMORY_TRACKING_HPP
 
 #include <assert.h>
-#include <unordered_map>
+#include <vector>
 
 #include "nstl.hpp"
 #include "utils.hpp"
@@ -144,6 +144,7 @@ namespace names {
 enum {
     key_none = 0,
     key_barrier,
+    key_binary_bcast_src1,
     key_bnorm_bf16cvt,
     key_bnorm_tmp_mean,
     key_bnorm_tmp_var,
@@ -158,6 +159,10 @@ enum {
     key_conv_bia_reduction,
     key_conv_bias_bf16_convert_wsp,
     key_conv_dst_bf16_convert_wsp,
+    key_conv_dw_row_buffer,
+    key_conv_fft_inp,
+    key_conv_fft_out,
+    key_conv_fft_work,
     key_conv_gemm_col,
     key_conv_gemm_imtr,
     key_conv_int_dat_in_acc_dt,
@@ -170,6 +175,9 @@ enum {
     key_conv_wei_reduction,
     key_conv_wei_bia_reduction,
     key_conv_wei_bia_reduction_bctx,
+    key_deconv_gemm_acc,
+    key_deconv_gemm_col,
+    key_deconv_gemm_wei,
     key_iprod_bias_bf16_convert_wsp,
     key_iprod_dst_bf16_convert_wsp,
     key_iprod_int_dat_in_acc_dt,
@@ -177,10 +185,12 @@ enum {
     key_lnorm_tmp_var,
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
+    key_matmul_dst_in_acc_dt,
     key_pool_dst_bf16cvt,
     key_pool_src_bf16cvt,
     key_reducer_space,
     key_reducer_space_bctx,
+    key_reduction_partials,
     key_reorder_space,
     key_reorder_wino_plain,
     key_reorder_wino_transform_space,
@@ -188,6 +198,7 @@ enum {
     key_reorder_rnn_weights_reduction,
     key_reorder_rnn_weights_transposition,
     key_rnn_space,
+    key_rnn_active_mb,
     key_rnn_ptrs_bia,
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
@@ -237,11 +248,11 @@ struct grantor_t;
 struct registry_t {
     void book(const key_t &key, size_t size, size_t alignment) {
         if (size == 0) return;
-        assert(offset_map_.count(key) == 0);
+        assert(find(key) == nullptr);
 
         size = utils::rnd_up(size, minimal_alignment);
         alignment = nstl::max<size_t>(alignment, minimal_alignment);
-        offset_map_[key] = entry_t {size_, size, alignment};
+        entries_.push_back({key, size_, size, alignment});
 
         size_ += size + alignment - minimal_alignment;
     }
@@ -251,12 +262,7 @@ struct registry_t {
             assert(size() == 0);
             return nullptr;
         }
-        if (offset_map_.count(key) != 1) return nullptr;
-
-        const auto &e = offset_map_.at(key);
-        base_ptr = utils::align_ptr<void>(base_ptr, minimal_alignment);
-        char *ptr = (char *)base_ptr + e.offset;
-        return utils::align_ptr<void>(ptr, e.alignment);
+        return get_aligned(key, align_base(base_ptr));
     }
 
     size_t size() const {
@@ -267,12 +273,37 @@ struct registry_t {
     grantor_t grantor(void *base_ptr) const;
 
 protected:
+    friend struct grantor_t;
+
     enum { minimal_alignment = 64 };
     struct entry_t {
+        key_t key;
         size_t offset, size, alignment;
     };
 
-    std::unordered_map<key_t, entry_t> offset_map_;
+    // A registry holds a few entries, so they are kept in a vector and
+    // looked up with a scan, which is cheaper than hashing
+    const entry_t *find(const key_t &key) const {
+        for (const auto &e : entries_)
+            if (e.key == key) return &e;
+        return nullptr;
+    }
+
+    static char *align_base(void *base_ptr) {
+        return utils::align_ptr<char>((char *)base_ptr, minimal_alignment);
+    }
+
+    // Returns the pointer to the entry in the scratchpad at the aligned base
+    void *get_aligned(const key_t &key, char *aligned_base) const {
+        const entry_t *e = find(key);
+        if (e == nullptr) return nullptr;
+        char *ptr = aligned_base + e->offset;
+        return e->alignment == minimal_alignment
+                ? ptr
+                : utils::align_ptr<void>(ptr, e->alignment);
+    }
+
+    std::vector<entry_t> entries_;
     size_t size_ = 0;
 };
 
@@ -294,9 +325,16 @@ protected:
     const key_t prefix_;
 };
 
+/** Grants the entries of a registry in a scratchpad.
+ *
+ * A grantor is created at each execution, so it is cheap to create and copy:
+ * it does no allocations and aligns the base of the scratchpad once. */
 struct grantor_t {
+    grantor_t() : registry_(nullptr), prefix_(0), base_ptr_(nullptr) {}
     grantor_t(const registry_t &registry, void *base_ptr)
-        : registry_(registry), prefix_(0), base_ptr_(base_ptr) {}
+        : registry_(&registry)
+        , prefix_(0)
+        , base_ptr_(base_ptr ? registry_t::align_base(base_ptr) : nullptr) {}
     grantor_t(const grantor_t &parent, const key_t &prefix)
         : registry_(parent.registry_)
         , prefix_(make_prefix(parent.prefix_, prefix))
@@ -304,13 +342,20 @@ struct grantor_t {
 
     template <typename T = void>
     T *get(const key_t &key) const {
-        return (T *)registry_.get(make_key(prefix_, key), base_ptr_);
+        assert(is_initialized());
+        if (base_ptr_ == nullptr) {
+            assert(registry_->size() == 0);
+            return nullptr;
+        }
+        return (T *)registry_->get_aligned(make_key(prefix_, key), base_ptr_);
     }
 
+    bool is_initialized() const { return registry_ != nullptr; }
+
 protected:
-    const registry_t &registry_;
-    const key_t prefix_;
-    void *base_ptr_;
+    const registry_t *registry_;
+    key_t prefix_;
+    char *base_ptr_;
 };
 
 inline registrar_t registry_t::registrar() {
@@ -21,6 +21,7 @@
 #include "primitive.hpp"
 #include "primitive_desc.hpp"
 #include "stream.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -69,6 +70,9 @@ status_t dnnl_primitive_execute(const primitive_t *primitive, stream_t *stream,
 
     exec_ctx_t ctx(stream, std::move(args));
 
+    const bool trace = trace_enabled();
+    const double start_ms = trace ? get_msec() : 0;
+
     const int gpu_exec_time_level = 4;
     if (dnnl_verbose()->level) {
         double ms = get_msec();
@@ -86,7 +90,19 @@ status_t dnnl_primitive_execute(const primitive_t *primitive, stream_t *stream,
         }
 
         engine_kind_t engine_kind = stream->engine()->kind();
-        if (engine_kind == engine_kind::cpu
+        const int counters_level = 3;
+        if ((engine_kind == engine_kind::cpu
+                    || (engine_kind == engine_kind::gpu
+                            && dnnl_verbose()->level >= gpu_exec_time_level))
+                && dnnl_verbose()->level >= counters_level) {
+            // The work per ms / 1e6 gives GFLOPS and GB/s
+            const auto &impl = primitive->get_primitive_impl();
+            const double gflops = ms > 0 ? impl->flops() / ms / 1e6 : 0;
+            const double gbps = ms > 0 ? impl->bytes() / ms / 1e6 : 0;
+            printf("dnnl_verbose,exec,%s,%g,%g,%g\n", primitive->pd()->info(),
+                    ms, gflops, gbps);
+            fflush(0);
+        } else if (engine_kind == engine_kind::cpu
                 || (engine_kind == engine_kind::gpu
                         && dnnl_verbose()->level >= gpu_exec_time_level)) {
             printf("dnnl_verbose,exec,%s,%g\n", primitive->pd()->info(), ms);
@@ -96,6 +112,11 @@ status_t dnnl_primitive_execute(const primitive_t *primitive, stream_t *stream,
         status = primitive->execute(ctx);
     }
 
+    // GPU executions are traced without synchronization, so the end time is
+    // when the primitive is submitted
+    if (trace && status == status::success)
+        trace_record(dnnl_trace_event_exec, primitive, start_ms, get_msec());
+
     if (msan_enabled) unpoison_outputs(ctx.args());
 
     return status;
@@ -115,25 +136,8 @@ status_t dnnl_primitive_destroy(primitive_t *primitive) {
 
 // primitive_t implementation
 dnnl_primitive::dnnl_primitive(
-        const std::shared_ptr<primitive_impl_t> &primitive_impl,
-        bool use_global_scratchpad = false)
-    : primitive_impl_(primitive_impl)
-    , scratchpad_buffer_(nullptr)
-    , global_scratchpad_(nullptr) {
-
-    // GPU doesn't support scratchpad
-    if (primitive_impl_->pd()->engine()->kind() == engine_kind::cpu) {
-        const size_t scratchpad_size = primitive_impl_->pd()->scratchpad_size(
-                scratchpad_mode::library);
-
-        if (scratchpad_size) {
-            if (use_global_scratchpad)
-                global_scratchpad_ = create_scratchpad(scratchpad_size);
-            else
-                scratchpad_buffer_ = malloc(scratchpad_size, 64);
-        }
-    }
-}
+        const std::shared_ptr<primitive_impl_t> &primitive_impl)
+    : primitive_impl_(primitive_impl) {}
 
 status_t dnnl_primitive::init() {
     return primitive_impl_->init();
@@ -154,26 +158,36 @@ dnnl_primitive::get_primitive_impl() const {
 
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     // GPU doesn't support scratchpad
-    if (primitive_impl_->pd()->engine()->kind() == engine_kind::cpu) {
-        void *ptr = nullptr;
-        if (primitive_impl_->pd()->attr()->scratchpad_mode_
-                == scratchpad_mode::user) {
-            ptr = CTX_OUT_MEM(void *, DNNL_ARG_SCRATCHPAD);
-        } else {
-            ptr = global_scratchpad_ ? global_scratchpad_->get()
-                                     : scratchpad_buffer_;
+    if (primitive_impl_->pd()->engine()->kind() != engine_kind::cpu)
+        return primitive_impl_->execute(ctx);
+
+    const auto *pd = primitive_impl_->pd();
+    void *ptr = nullptr;
+    bool uses_stream_scratchpad = false;
+    if (pd->attr()->scratchpad_mode_ == scratchpad_mode::user) {
+        ptr = CTX_OUT_MEM(void *, DNNL_ARG_SCRATCHPAD);
+    } else {
+        const size_t size = pd->scratchpad_size(scratchpad_mode::library);
+        if (size) {
+            ptr = ctx.stream()->enter_scratchpad(size);
+            if (ptr == nullptr) return out_of_memory;
+            uses_stream_scratchpad = true;
         }
-
-        ctx.set_scratchpad_grantor(
-                primitive_impl_->pd()->scratchpad_registry().grantor(ptr));
     }
+
+    ctx.set_scratchpad_grantor(pd->scratchpad_registry().grantor(ptr));
     auto status = primitive_impl_->execute(ctx);
-    return status;
-}
 
-dnnl_primitive::~dnnl_primitive() {
-    delete global_scratchpad_;
-    dnnl::impl::free(scratchpad_buffer_);
+    if (uses_stream_scratchpad) ctx.stream()->leave_scratchpad();
+    if (status != success) return status;
+
+    // The outputs kept on each NUMA node are copied from the written one
+    for (const auto &arg : ctx.args()) {
+        if (arg.second.is_const || arg.second.mem == nullptr) continue;
+        status = arg.second.mem->memory_storage()->update_replicas();
+        if (status != success) return status;
+    }
+    return success;
 }
 
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
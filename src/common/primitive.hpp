@@ -25,7 +25,6 @@
 #include "memory_tracking.hpp"
 #include "primitive_exec_types.hpp"
 #include "primitive_impl.hpp"
-#include "scratchpad.hpp"
 
 #include <type_traits>
 
@@ -35,13 +34,18 @@
 #define CTX_IN_MEM(type, arg) \
     static_cast<const ARG_TYPE(type) *>(CTX_IN_STORAGE(arg).data_handle())
 
+// The copy of an input on the NUMA node of the calling thread, for the inputs
+// that are replicated on each node (see DNNL_MEMORY_ALLOCATE_REPLICATED)
+#define CTX_IN_LOCAL_MEM(type, arg) \
+    static_cast<const ARG_TYPE(type) *>( \
+            CTX_IN_STORAGE(arg).local_data_handle())
+
 #define CTX_OUT_MEM(type, arg) \
     static_cast<ARG_TYPE(type) *>(CTX_OUT_STORAGE(arg).data_handle())
 
 struct dnnl_primitive : public dnnl::impl::c_compatible {
-    dnnl_primitive(
-            const std::shared_ptr<dnnl::impl::primitive_impl_t> &primitive_impl,
-            bool use_global_scratchpad);
+    dnnl_primitive(const std::shared_ptr<dnnl::impl::primitive_impl_t>
+                    &primitive_impl);
 
     dnnl::impl::status_t init();
     dnnl::impl::engine_t *engine() const;
@@ -50,12 +54,8 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     get_primitive_impl() const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
-    ~dnnl_primitive();
-
 private:
     std::shared_ptr<dnnl::impl::primitive_impl_t> primitive_impl_;
-    void *scratchpad_buffer_;
-    dnnl::impl::scratchpad_t *global_scratchpad_;
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
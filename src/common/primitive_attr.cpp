@@ -52,6 +52,8 @@ status_t scales_t::set(dim_t count, int mask, const float *scales) {
 } // namespace dnnl
 
 status_t post_ops_t::append_sum(float scale) {
+    // The kernels take the post-ops scales at the creation
+    if (is_runtime_value(scale)) return invalid_arguments;
     if (len_ == capacity) return out_of_memory;
 
     entry_[len_].kind = primitive_kind::sum;
@@ -70,6 +72,9 @@ status_t post_ops_t::append_eltwise(
             eltwise_bounded_relu, eltwise_soft_relu, eltwise_logistic,
             eltwise_exp, eltwise_gelu, eltwise_swish);
     if (!known_alg) return invalid_arguments;
+    if (is_runtime_value(scale) || is_runtime_value(alpha)
+            || is_runtime_value(beta))
+        return invalid_arguments;
 
     if (len_ == capacity) return out_of_memory;
 
@@ -84,6 +89,48 @@ status_t post_ops_t::append_eltwise(
     return success;
 }
 
+status_t post_ops_t::append_dw_conv(dim_t kernel, dim_t stride, dim_t padding) {
+    bool ok = kernel > 0 && stride > 0 && 0 <= padding && padding < kernel;
+    if (!ok) return invalid_arguments;
+
+    // only a single depthwise convolution may be fused
+    if (find(primitive_kind::convolution) != -1) return invalid_arguments;
+
+    if (len_ == capacity) return out_of_memory;
+
+    entry_[len_].kind = primitive_kind::convolution;
+    entry_[len_].dw_conv.kernel = kernel;
+    entry_[len_].dw_conv.stride = stride;
+    entry_[len_].dw_conv.padding = padding;
+
+    len_++;
+
+    return success;
+}
+
+status_t post_ops_t::append_binary(
+        alg_kind_t alg, const memory_desc_t *src1_desc) {
+    using namespace alg_kind;
+    bool ok = one_of(alg, binary_add, binary_mul, binary_max, binary_min)
+            && src1_desc != nullptr && src1_desc->ndims > 0
+            && src1_desc->format_kind == format_kind::blocked
+            && !memory_desc_wrapper(src1_desc).has_runtime_dims_or_strides();
+    if (!ok) return invalid_arguments;
+
+    // only a single binary operation may be fused
+    if (find(primitive_kind::binary) != -1) return invalid_arguments;
+
+    if (len_ == capacity) return out_of_memory;
+
+    entry_[len_].kind = primitive_kind::binary;
+    entry_[len_].binary.alg = alg;
+    entry_[len_].binary.src1_desc = *src1_desc;
+
+    len_++;
+
+    return success;
+}
+
 status_t primitive_attr_t::set_scratchpad_mode(
         scratchpad_mode_t scratchpad_mode) {
     using namespace dnnl::impl::scratchpad_mode;
@@ -95,6 +142,17 @@ status_t primitive_attr_t::set_scratchpad_mode(
     return success;
 }
 
+status_t primitive_attr_t::set_impl_selection_mode(
+        impl_selection_mode_t impl_selection_mode) {
+    using namespace dnnl::impl::impl_selection_mode;
+
+    const bool ok = one_of(impl_selection_mode, first, fastest);
+    if (!ok) return invalid_arguments;
+
+    impl_selection_mode_ = impl_selection_mode;
+    return success;
+}
+
 status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     this->post_ops_ = post_ops;
     return success;
@@ -137,6 +195,23 @@ status_t dnnl_primitive_attr_set_scratchpad_mode(
     return attr->set_scratchpad_mode(scratchpad_mode);
 }
 
+status_t dnnl_primitive_attr_get_impl_selection_mode(
+        const primitive_attr_t *attr,
+        impl_selection_mode_t *impl_selection_mode) {
+    if (any_null(attr, impl_selection_mode)) return invalid_arguments;
+
+    *impl_selection_mode = attr->impl_selection_mode_;
+
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_impl_selection_mode(
+        primitive_attr_t *attr, impl_selection_mode_t impl_selection_mode) {
+    if (any_null(attr)) return invalid_arguments;
+
+    return attr->set_impl_selection_mode(impl_selection_mode);
+}
+
 status_t dnnl_primitive_attr_get_output_scales(const primitive_attr_t *attr,
         dim_t *count, int *mask, const float **scales) {
     if (any_null(attr, count, mask, scales)) return invalid_arguments;
@@ -153,6 +228,10 @@ status_t dnnl_primitive_attr_set_output_scales(
     bool ok = !any_null(attr, scales) && count > 0 && mask >= 0;
     if (!ok) return invalid_arguments;
 
+    // The runtime scales are set with a single value
+    for (dim_t c = 0; c < count; c++)
+        if (count > 1 && is_runtime_value(scales[c])) return invalid_arguments;
+
     return attr->output_scales_.set(count, mask, scales);
 }
 
@@ -245,6 +324,50 @@ status_t dnnl_post_ops_get_params_eltwise(const post_ops_t *post_ops, int index,
     return success;
 }
 
+status_t dnnl_post_ops_append_dw_conv(
+        post_ops_t *post_ops, dim_t kernel, dim_t stride, dim_t padding) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_dw_conv(kernel, stride, padding);
+}
+
+status_t dnnl_post_ops_get_params_dw_conv(const post_ops_t *post_ops,
+        int index, dim_t *kernel, dim_t *stride, dim_t *padding) {
+    bool ok = true
+            && simple_get_params_check(
+                    post_ops, index, primitive_kind::convolution)
+            && !any_null(kernel, stride, padding);
+    if (!ok) return invalid_arguments;
+
+    const auto &e = post_ops->entry_[index].dw_conv;
+    *kernel = e.kernel;
+    *stride = e.stride;
+    *padding = e.padding;
+
+    return success;
+}
+
+status_t dnnl_post_ops_append_binary(post_ops_t *post_ops, alg_kind_t alg,
+        const memory_desc_t *src1_desc) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_binary(alg, src1_desc);
+}
+
+status_t dnnl_post_ops_get_params_binary(const post_ops_t *post_ops,
+        int index, alg_kind_t *alg, const memory_desc_t **src1_desc) {
+    bool ok = true
+            && simple_get_params_check(post_ops, index, primitive_kind::binary)
+            && !any_null(alg, src1_desc);
+    if (!ok) return invalid_arguments;
+
+    const auto &e = post_ops->entry_[index].binary;
+    *alg = e.alg;
+    *src1_desc = &e.src1_desc;
+
+    return success;
+}
+
 status_t dnnl_primitive_attr_set_rnn_data_qparams(
         primitive_attr_t *attr, const float scale, const float shift) {
     if (attr == nullptr) return invalid_arguments;
@@ -21,6 +21,7 @@
 
 #include "c_types_map.hpp"
 #include "nstl.hpp"
+#include "type_helpers.hpp"
 #include "utils.hpp"
 
 namespace dnnl {
@@ -130,10 +131,16 @@ struct scales_t : public c_compatible {
     bool operator==(const scales_t &rhs) const {
         bool ret = count_ == rhs.count_ && mask_ == rhs.mask_
                 && !utils::any_null(scales_, rhs.scales_)
-                && utils::array_cmp(scales_, rhs.scales_, count_);
+                && defined() == rhs.defined()
+                && IMPLICATION(defined(),
+                        utils::array_cmp(scales_, rhs.scales_, count_));
         return ret;
     }
 
+    /** Returns false if the scales are passed at the execution, see
+     * DNNL_ARG_ATTR_OUTPUT_SCALES */
+    bool defined() const { return !is_runtime_value(scales_[0]); }
+
     bool has_default_values() const {
         for (dim_t c = 0; c < count_; ++c) {
             if (scales_[c] != 1.) return false;
@@ -148,8 +155,10 @@ struct scales_t : public c_compatible {
     int mask_;
     float *scales_;
 
-private:
+    // A single scale is kept repeated, so that the kernels can read a vector
     enum { scales_buf_size = 16 };
+
+private:
     float scales_buf_[scales_buf_size];
 
     void cleanup() {
@@ -171,12 +180,23 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             float scale, alpha, beta;
         };
 
+        struct dw_conv_t {
+            dnnl::impl::dim_t kernel, stride, padding;
+        };
+
+        struct binary_t {
+            dnnl::impl::alg_kind_t alg;
+            dnnl::impl::memory_desc_t src1_desc;
+        };
+
         dnnl::impl::primitive_kind_t kind;
         union {
             struct {
                 float scale;
             } sum;
             eltwise_t eltwise;
+            dw_conv_t dw_conv;
+            binary_t binary;
         };
 
         bool is_eltwise(bool require_scale_one = true) const {
@@ -199,6 +219,14 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                     && IMPLICATION(require_scale_one, sum.scale == 1.f);
         }
 
+        bool is_dw_conv() const {
+            return kind == dnnl::impl::primitive_kind::convolution;
+        }
+
+        bool is_binary() const {
+            return kind == dnnl::impl::primitive_kind::binary;
+        }
+
         bool operator==(const entry_t &rhs) const {
             using namespace dnnl::impl;
             if (kind != rhs.kind) { return false; }
@@ -213,6 +241,15 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 case primitive_kind::sum:
                     ret = sum.scale == rhs.sum.scale;
                     break;
+                case primitive_kind::convolution:
+                    ret = dw_conv.kernel == rhs.dw_conv.kernel
+                            && dw_conv.stride == rhs.dw_conv.stride
+                            && dw_conv.padding == rhs.dw_conv.padding;
+                    break;
+                case primitive_kind::binary:
+                    ret = binary.alg == rhs.binary.alg
+                            && binary.src1_desc == rhs.binary.src1_desc;
+                    break;
                 default: assert(!"unsupported post_op");
             }
             return ret;
@@ -228,6 +265,10 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
     dnnl::impl::status_t append_sum(float scale);
     dnnl::impl::status_t append_eltwise(
             float scale, dnnl::impl::alg_kind_t alg, float alpha, float beta);
+    dnnl::impl::status_t append_dw_conv(dnnl::impl::dim_t kernel,
+            dnnl::impl::dim_t stride, dnnl::impl::dim_t padding);
+    dnnl::impl::status_t append_binary(dnnl::impl::alg_kind_t alg,
+            const dnnl::impl::memory_desc_t *src1_desc);
 
     int find(dnnl::impl::primitive_kind_t kind, int start = 0,
             int stop = -1) const {
@@ -258,7 +299,8 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
 
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
-        : scratchpad_mode_(dnnl::impl::scratchpad_mode::library) {}
+        : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
+        , impl_selection_mode_(dnnl::impl::impl_selection_mode::first) {}
 
     dnnl_primitive_attr *clone() const {
         return new dnnl_primitive_attr(*this);
@@ -266,7 +308,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     /** Returns true if the attributes have default values.
      *
-     * @note The scratchpad_mode_ is not take into account */
+     * @note The scratchpad_mode_ and impl_selection_mode_ are not take into
+     * account */
     bool has_default_values() const {
         return true && output_scales_.has_default_values()
                 && post_ops_.has_default_values()
@@ -277,6 +320,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
+                && impl_selection_mode_ == rhs.impl_selection_mode_
                 && output_scales_ == rhs.output_scales_
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
@@ -287,10 +331,13 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
 
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
+    dnnl::impl::status_t set_impl_selection_mode(
+            dnnl::impl::impl_selection_mode_t impl_selection_mode);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
 
     // NOTE: make sure that the types below have overloaded comparison operator
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
+    dnnl::impl::impl_selection_mode_t impl_selection_mode_;
     dnnl::impl::scales_t output_scales_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
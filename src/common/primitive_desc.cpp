@@ -17,12 +17,40 @@
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "nstl.hpp"
 #include "primitive_desc.hpp"
 
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 
+const std::vector<int> &primitive_desc_t::exec_args() {
+    static const std::vector<int> args = {DNNL_ARG_SRC_0, DNNL_ARG_SRC_1,
+            DNNL_ARG_SRC_2, DNNL_ARG_DST_0, DNNL_ARG_DST_1, DNNL_ARG_DST_2,
+            DNNL_ARG_WEIGHTS_0, DNNL_ARG_WEIGHTS_1, DNNL_ARG_BIAS,
+            DNNL_ARG_MEAN, DNNL_ARG_VARIANCE, DNNL_ARG_SEQ_LENGTHS,
+            DNNL_ARG_WORKSPACE, DNNL_ARG_SCRATCHPAD, DNNL_ARG_DIFF_SRC_0,
+            DNNL_ARG_DIFF_SRC_1, DNNL_ARG_DIFF_SRC_2, DNNL_ARG_DIFF_DST_0,
+            DNNL_ARG_DIFF_DST_1, DNNL_ARG_DIFF_DST_2, DNNL_ARG_DIFF_WEIGHTS_0,
+            DNNL_ARG_DIFF_WEIGHTS_1, DNNL_ARG_DIFF_BIAS,
+            DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+            DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS,
+            DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1};
+    return args;
+}
+
+dim_t primitive_desc_t::args_bytes(arg_usage_t usage) const {
+    // The scratchpad is written and read back, whoever provides it
+    dim_t bytes = (dim_t)scratchpad_registry().size();
+    for (int arg : exec_args()) {
+        if (arg == DNNL_ARG_SCRATCHPAD || arg_usage(arg) != usage) continue;
+        const size_t size = memory_desc_wrapper(arg_md(arg)).size();
+        if (size == DNNL_RUNTIME_SIZE_VAL) return 0;
+        bytes += (dim_t)size;
+    }
+    return bytes;
+}
+
 status_t primitive_desc_t::query(query_t what, int idx, void *result) const {
     auto safe_ret_md = [&](const memory_desc_t *_) {
         if (_ == nullptr) return not_required;
@@ -66,6 +94,12 @@ status_t primitive_desc_t::query(query_t what, int idx, void *result) const {
 
         case query::impl_info_str: *(const char **)result = name(); break;
 
+        case query::flops_s64: *(dim_t *)result = flops(); break;
+        case query::bytes_read_s64: *(dim_t *)result = bytes_read(); break;
+        case query::bytes_written_s64:
+            *(dim_t *)result = bytes_written();
+            break;
+
         default: return unimplemented;
     }
     return success;
@@ -18,6 +18,7 @@
 #define PRIMITIVE_DESC_HPP
 
 #include <typeindex>
+#include <vector>
 
 #include "dnnl.h"
 
@@ -69,9 +70,26 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
         using dnnl::impl::types::is_zero_md;
         if (arg == DNNL_ARG_SCRATCHPAD && !is_zero_md(scratchpad_md()))
             return arg_usage_t::output;
+        if (arg == DNNL_ARG_ATTR_OUTPUT_SCALES
+                && !attr()->output_scales_.defined())
+            return arg_usage_t::input;
+        if (arg == (DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1)
+                && attr()->post_ops_.find(dnnl::impl::primitive_kind::binary)
+                        != -1)
+            return arg_usage_t::input;
         return arg_usage_t::unused;
     }
 
+    /** Returns true if the implementation takes the output scales passed at
+     * the execution, see DNNL_ARG_ATTR_OUTPUT_SCALES. The other ones are not
+     * created for the attributes with the runtime output scales. */
+    virtual bool supports_runtime_output_scales() const { return false; }
+
+    /** Returns true if the implementation applies the binary post operation,
+     * whose second source is DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1.
+     * The other ones are not created for the attributes with it. */
+    virtual bool supports_binary_post_op() const { return false; }
+
 #define DECLARE_MD_STUB(stub) \
     virtual const dnnl::impl::memory_desc_t *stub(int idx = 0) const { \
         return &dnnl::impl::glob_zero_md; \
@@ -92,6 +110,60 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
         return idx == 0 ? &scratchpad_md_ : &dnnl::impl::glob_zero_md;
     }
 
+    /** Returns the memory descriptor of the execution argument @p arg, or
+     * the zero one if the primitive does not describe the argument */
+    virtual const dnnl::impl::memory_desc_t *arg_md(int arg) const {
+        switch (arg) {
+            case DNNL_ARG_SRC_0:
+            case DNNL_ARG_SRC_1:
+            case DNNL_ARG_SRC_2: return src_md(arg - DNNL_ARG_SRC_0);
+            case DNNL_ARG_DST_0:
+            case DNNL_ARG_DST_1:
+            case DNNL_ARG_DST_2: return dst_md(arg - DNNL_ARG_DST_0);
+            case DNNL_ARG_WEIGHTS_0:
+            case DNNL_ARG_WEIGHTS_1:
+                return weights_md(arg - DNNL_ARG_WEIGHTS_0);
+            case DNNL_ARG_BIAS: return weights_md(1);
+            case DNNL_ARG_WORKSPACE: return workspace_md(0);
+            case DNNL_ARG_SCRATCHPAD: return scratchpad_md(0);
+            case DNNL_ARG_DIFF_SRC_0:
+            case DNNL_ARG_DIFF_SRC_1:
+            case DNNL_ARG_DIFF_SRC_2:
+                return diff_src_md(arg - DNNL_ARG_DIFF_SRC_0);
+            case DNNL_ARG_DIFF_DST_0:
+            case DNNL_ARG_DIFF_DST_1:
+            case DNNL_ARG_DIFF_DST_2:
+                return diff_dst_md(arg - DNNL_ARG_DIFF_DST_0);
+            case DNNL_ARG_DIFF_WEIGHTS_0:
+            case DNNL_ARG_DIFF_WEIGHTS_1:
+                return diff_weights_md(arg - DNNL_ARG_DIFF_WEIGHTS_0);
+            case DNNL_ARG_DIFF_BIAS: return diff_weights_md(1);
+            case DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1: {
+                const auto &po = attr()->post_ops_;
+                const int idx = po.find(dnnl::impl::primitive_kind::binary);
+                if (idx != -1) return &po.entry_[idx].binary.src1_desc;
+                return &dnnl::impl::glob_zero_md;
+            }
+            default: return &dnnl::impl::glob_zero_md;
+        }
+    }
+
+    /** The execution arguments a primitive may take, except the multiple
+     * sources and destinations of concat and sum */
+    static const std::vector<int> &exec_args();
+
+    /** Estimates of the work of an execution, 0 if unknown (e.g. the problem
+     * has runtime dimensions). The arithmetic operations count a
+     * multiply-add as two, the memory traffic includes the scratchpad (e.g.
+     * the im2col buffer or the Winograd transforms) besides the arguments */
+    virtual dnnl::impl::dim_t flops() const { return 0; }
+    virtual dnnl::impl::dim_t bytes_read() const {
+        return args_bytes(arg_usage_t::input);
+    }
+    virtual dnnl::impl::dim_t bytes_written() const {
+        return args_bytes(arg_usage_t::output);
+    }
+
     virtual void init_scratchpad_md() {
         auto size = scratchpad_size(dnnl::impl::scratchpad_mode::user);
         dnnl::impl::dims_t dims = {size};
@@ -139,7 +211,13 @@ struct dnnl_primitive_desc : public dnnl::impl::c_compatible {
                 = reinterpret_cast<const typename pd_t::hint_class *>(hint_fwd);
         auto _pd = new pd_t(engine, (const pd_op_desc_t *)adesc, attr, hint);
         if (_pd == nullptr) return out_of_memory;
-        if (_pd->init() != success) {
+        if (_pd->init() != success
+                || !IMPLICATION(!_pd->attr()->output_scales_.defined(),
+                        _pd->supports_runtime_output_scales())
+                || !IMPLICATION(
+                        _pd->attr()->post_ops_.find(primitive_kind::binary)
+                                != -1,
+                        _pd->supports_binary_post_op())) {
             delete _pd;
             return unimplemented;
         }
@@ -156,6 +234,9 @@ protected:
 
     dnnl::impl::memory_desc_t scratchpad_md_;
 
+    /** Returns the size of the arguments with the usage and the scratchpad */
+    dnnl::impl::dim_t args_bytes(arg_usage_t usage) const;
+
     char info_[DNNL_VERBOSE_BUF_LEN];
 
     dnnl::impl::memory_tracking::registry_t scratchpad_registry_;
@@ -172,26 +253,16 @@ protected:
     }
 };
 
-#define DECLARE_COMMON_PD_t(impl_name, impl_type, use_global_scratchpad) \
+#define DECLARE_COMMON_PD_T(impl_name, impl_type) \
     virtual pd_t *clone() const override { return new pd_t(*this); } \
     virtual status_t create_primitive(primitive_t **p) const override { \
         auto status = this->engine()->get_primitive( \
-                p, this, [=] { return std::make_shared<impl_type>(this); }, \
-                use_global_scratchpad); \
+                p, this, [=] { return std::make_shared<impl_type>(this); }); \
         return status; \
     } \
     virtual const char *name() const override { return impl_name; } \
     virtual std::type_index impl_id() const override { return typeid(pd_t); }
 
-#define DECLARE_COMMON_PD_T_USE_GLOBAL_SCRATCHPAD(impl_name, impl_type) \
-    DECLARE_COMMON_PD_t(impl_name, impl_type, true)
-
-#define DECLARE_COMMON_PD_T_(impl_name, impl_type) \
-    DECLARE_COMMON_PD_t(impl_name, impl_type, false)
-
-#define DECLARE_COMMON_PD_T(impl_name, impl_type, ...) \
-    DECLARE_COMMON_PD_T_##__VA_ARGS__(impl_name, impl_type)
-
 #endif
 
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
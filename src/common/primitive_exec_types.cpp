@@ -29,6 +29,8 @@ status_t cvt_primtive_args(const primitive_desc_t *pd, int nargs,
 
     int n_inputs = 0;
     int n_outputs = 0;
+    int n_attr_inputs = 0; // e.g. the runtime output scales
+    int n_binary_inputs = 0; // the second source of the binary post-op
 
     for (int i = 0; i < nargs; ++i) {
         int arg = c_args[i].arg;
@@ -39,6 +41,9 @@ status_t cvt_primtive_args(const primitive_desc_t *pd, int nargs,
                 if (args.count(arg) != 0) return invalid_arguments;
                 args[arg] = {mem, true};
                 n_inputs++;
+                if (arg == DNNL_ARG_ATTR_OUTPUT_SCALES) n_attr_inputs++;
+                if (arg == (DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1))
+                    n_binary_inputs++;
                 break;
             case primitive_desc_t::arg_usage_t::output:
                 if (args.count(arg) != 0) return invalid_arguments;
@@ -51,43 +56,58 @@ status_t cvt_primtive_args(const primitive_desc_t *pd, int nargs,
 
     bool scratchpad_required = !types::is_zero_md(pd->scratchpad_md());
 
-    if (n_inputs != pd->n_inputs()) return invalid_arguments;
+    const bool runtime_scales = !pd->attr()->output_scales_.defined();
+    const bool with_binary
+            = pd->attr()->post_ops_.find(primitive_kind::binary) != -1;
+    if (n_attr_inputs != (runtime_scales ? 1 : 0)) return invalid_arguments;
+    if (n_binary_inputs != (with_binary ? 1 : 0)) return invalid_arguments;
+    if (n_inputs != pd->n_inputs() + n_attr_inputs + n_binary_inputs)
+        return invalid_arguments;
     if (n_outputs != pd->n_outputs() + (scratchpad_required ? 1 : 0))
         return invalid_arguments;
 
     return success;
 }
 
-memory_t *exec_ctx_t::input(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
-    assert(ma.is_const);
-    return ma.mem;
+memory_desc_wrapper exec_ctx_t::memory_mdw(
+        int arg, const memory_desc_t *md_from_primitive_desc) const {
+    if (md_from_primitive_desc) {
+        memory_desc_wrapper mdw_from_primitive_desc(md_from_primitive_desc);
+        if (!mdw_from_primitive_desc.has_runtime_dims_or_strides())
+            return mdw_from_primitive_desc;
+    }
+    if (args_.count(arg) != 1) return memory_desc_wrapper(&glob_zero_md);
+    return memory_desc_wrapper(args_.at(arg).mem->md());
 }
 
-memory_t *exec_ctx_t::output(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
-    assert(!ma.is_const);
-    return ma.mem;
-}
+const float *get_output_scales(
+        const exec_ctx_t &ctx, const primitive_desc_t *pd, float *buf) {
+    const auto &oscales = pd->attr()->output_scales_;
+    if (oscales.defined()) return oscales.scales_;
 
-memory_t *exec_ctx_t::memory(int arg) const {
-    assert(args_.count(arg) == 1);
-    const auto ma = args_.at(arg);
-    assert(!ma.is_const);
-    return ma.mem;
-}
+    const memory_t *mem = ctx.input(DNNL_ARG_ATTR_OUTPUT_SCALES);
+    if (mem == nullptr) return nullptr;
 
-void exec_ctx_t::set_scratchpad_grantor(
-        const memory_tracking::grantor_t &scratchpad_grantor) {
-    scratchpad_grantor_ = utils::make_unique<memory_tracking::grantor_t>(
-            scratchpad_grantor);
-}
+    // The count of the scales is the product of the dimensions of the mask
+    const memory_desc_wrapper dst_d(pd->dst_md());
+    dim_t count = 1;
+    for (int d = 0; d < dst_d.ndims(); d++)
+        if (oscales.mask_ & (1 << d)) count *= dst_d.dims()[d];
+
+    const memory_desc_wrapper scales_d(mem->md());
+    const bool ok = scales_d.data_type() == data_type::f32
+            && scales_d.ndims() == 1 && scales_d.dims()[0] == count
+            && scales_d.is_dense();
+    if (!ok) return nullptr;
 
-const memory_tracking::grantor_t &exec_ctx_t::get_scratchpad_grantor() const {
-    assert(scratchpad_grantor_.get());
-    return *(scratchpad_grantor_.get());
+    const float *scales
+            = static_cast<const float *>(mem->memory_storage()->data_handle());
+    if (scales == nullptr) return nullptr;
+    if (count > 1) return scales;
+
+    utils::array_set(buf, scales[0], scales_t::scales_buf_size);
+    return buf;
 }
+
 } // namespace impl
 } // namespace dnnl
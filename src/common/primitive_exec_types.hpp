@@ -17,7 +17,9 @@
 #ifndef PRIMITIVE_EXEC_TYPES_HPP
 #define PRIMITIVE_EXEC_TYPES_HPP
 
-#include <unordered_map>
+#include <initializer_list>
+#include <utility>
+#include <vector>
 
 #include "dnnl_types.h"
 
@@ -42,7 +44,70 @@ struct memory_arg_t {
     bool is_const;
 };
 
-using exec_args_t = std::unordered_map<int, memory_arg_t>;
+/** The memory arguments of an execution: a flat table of (arg, memory)
+ * pairs with the interface of a map.
+ *
+ * A primitive takes a handful of arguments, so the table is kept in place
+ * and looked up with a scan, which is cheaper than hashing and needs no heap
+ * allocation. A table with more arguments than fit in place (e.g. the sources
+ * of a sum) is moved to the heap. */
+struct exec_args_t {
+    using value_type = std::pair<int, memory_arg_t>;
+
+    exec_args_t() : size_(0) {}
+    exec_args_t(std::initializer_list<value_type> l) : size_(0) {
+        for (const auto &v : l)
+            (*this)[v.first] = v.second;
+    }
+
+    memory_arg_t &operator[](int arg) {
+        value_type *v = find(arg);
+        if (v) return v->second;
+
+        if (heap_.empty() && size_ < in_place_capacity) {
+            in_place_[size_] = {arg, {nullptr, false}};
+            return in_place_[size_++].second;
+        }
+        if (heap_.empty()) heap_.assign(in_place_, in_place_ + size_);
+        heap_.push_back({arg, {nullptr, false}});
+        size_++;
+        return heap_.back().second;
+    }
+
+    const memory_arg_t &at(int arg) const {
+        const value_type *v = find(arg);
+        assert(v != nullptr);
+        return v->second;
+    }
+
+    size_t count(int arg) const { return find(arg) ? 1 : 0; }
+    size_t size() const { return size_; }
+
+    const value_type *begin() const { return data(); }
+    const value_type *end() const { return data() + size_; }
+
+private:
+    enum { in_place_capacity = 16 };
+
+    const value_type *data() const {
+        return heap_.empty() ? in_place_ : heap_.data();
+    }
+    value_type *data() { return heap_.empty() ? in_place_ : heap_.data(); }
+
+    const value_type *find(int arg) const {
+        for (const value_type *v = begin(); v != end(); v++)
+            if (v->first == arg) return v;
+        return nullptr;
+    }
+    value_type *find(int arg) {
+        return const_cast<value_type *>(
+                static_cast<const exec_args_t *>(this)->find(arg));
+    }
+
+    value_type in_place_[in_place_capacity];
+    std::vector<value_type> heap_;
+    size_t size_;
+};
 
 status_t cvt_primtive_args(const primitive_desc_t *pd, int nargs,
         const dnnl_exec_arg_t *c_args, exec_args_t &args);
@@ -56,21 +121,72 @@ struct exec_ctx_t {
     stream_t *stream() const { return stream_; }
     const exec_args_t &args() const { return args_; }
 
-    memory_t *input(int arg) const;
-    memory_t *output(int arg) const;
-    memory_t *memory(int arg) const;
+    memory_t *input(int arg) const {
+        if (args_.count(arg) != 1) return nullptr;
+        const auto &ma = args_.at(arg);
+        assert(ma.is_const);
+        return ma.mem;
+    }
+
+    memory_t *output(int arg) const {
+        if (args_.count(arg) != 1) return nullptr;
+        const auto &ma = args_.at(arg);
+        assert(!ma.is_const);
+        return ma.mem;
+    }
+
+    memory_t *memory(int arg) const {
+        assert(args_.count(arg) == 1);
+        const auto &ma = args_.at(arg);
+        assert(!ma.is_const);
+        return ma.mem;
+    }
+
+    // Returns memory descriptor wrapper for the corresponding memory argument.
+    //
+    // To support sub-memory flow (when primitive descriptor was created with
+    // a sub-memory, but the primitive is executed on the original memory),
+    // it is recommended to pass the memory descriptor from the primitive
+    // descriptor. If this memory descriptor is fully defined (i.e. no reason
+    // to use memory descriptor from the input memory), exactly it will be
+    // returned.
+    //
+    // Note: fully defined memory descriptor mentioned above is a synonym to
+    //       `mdw::has_runtime_dims_or_strides() == false`.
+    memory_desc_wrapper memory_mdw(int arg,
+            const memory_desc_t *md_from_primitive_desc = nullptr) const;
 
     void set_scratchpad_grantor(
-            const memory_tracking::grantor_t &scratchpad_grantor);
-    const memory_tracking::grantor_t &get_scratchpad_grantor() const;
+            const memory_tracking::grantor_t &scratchpad_grantor) {
+        scratchpad_grantor_ = scratchpad_grantor;
+    }
+
+    const memory_tracking::grantor_t &get_scratchpad_grantor() const {
+        assert(scratchpad_grantor_.is_initialized());
+        return scratchpad_grantor_;
+    }
 
 private:
     stream_t *stream_;
     exec_args_t args_;
-    std::unique_ptr<memory_tracking::grantor_t> scratchpad_grantor_;
+    memory_tracking::grantor_t scratchpad_grantor_;
 };
 
+/** Returns the output scales of an execution: the ones of the attributes of
+ * the primitive descriptor or, for the runtime scales, the ones passed as
+ * DNNL_ARG_ATTR_OUTPUT_SCALES. A single runtime scale is repeated in @p buf
+ * of scales_t::scales_buf_size values, like the one of the attributes.
+ * Returns nullptr if the runtime scales do not match the mask. */
+const float *get_output_scales(
+        const exec_ctx_t &ctx, const primitive_desc_t *pd, float *buf);
+
 } // namespace impl
 } // namespace dnnl
 
+#define DEFINE_SCALES_BUFFER(scales) \
+    alignas(64) float CONCAT2(scales, _buf)[scales_t::scales_buf_size]; \
+    const float *scales \
+            = get_output_scales(ctx, pd(), CONCAT2(scales, _buf)); \
+    if (scales == nullptr) return status::invalid_arguments;
+
 #endif
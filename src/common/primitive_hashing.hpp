@@ -49,6 +49,9 @@ struct key_t {
                 ret = cast_and_compare<batch_normalization_desc_t>(
                         op_desc_, rhs.op_desc_);
                 break;
+            case primitive_kind::binary:
+                ret = cast_and_compare<binary_desc_t>(op_desc_, rhs.op_desc_);
+                break;
             case primitive_kind::concat:
                 ret = cast_and_compare<concat_desc_t>(op_desc_, rhs.op_desc_);
                 break;
@@ -77,9 +80,20 @@ struct key_t {
             case primitive_kind::lrn:
                 ret = cast_and_compare<lrn_desc_t>(op_desc_, rhs.op_desc_);
                 break;
+            case primitive_kind::matmul:
+                ret = cast_and_compare<matmul_desc_t>(op_desc_, rhs.op_desc_);
+                break;
             case primitive_kind::pooling:
                 ret = cast_and_compare<pooling_desc_t>(op_desc_, rhs.op_desc_);
                 break;
+            case primitive_kind::reduction:
+                ret = cast_and_compare<reduction_desc_t>(
+                        op_desc_, rhs.op_desc_);
+                break;
+            case primitive_kind::resampling:
+                ret = cast_and_compare<resampling_desc_t>(
+                        op_desc_, rhs.op_desc_);
+                break;
             case primitive_kind::reorder:
                 ret = cast_and_compare<reorder_desc_t>(op_desc_, rhs.op_desc_);
                 break;
@@ -144,6 +158,9 @@ static inline size_t get_attr_hash(const primitive_attr_t *attr) {
     size_t seed = 0;
     // scratchpad_mode
     seed = hash_combine(seed, static_cast<size_t>(attr->scratchpad_mode_));
+    // impl_selection_mode
+    seed = hash_combine(
+            seed, static_cast<size_t>(attr->impl_selection_mode_));
     // output_scales: mask
     seed = hash_combine(seed, attr->output_scales_.mask_);
     // output_scales: scales[:]
@@ -166,6 +183,16 @@ static inline size_t get_attr_hash(const primitive_attr_t *attr) {
             case primitive_kind::sum:
                 seed = hash_combine(seed, entry.sum.scale);
                 break;
+            case primitive_kind::convolution:
+                seed = hash_combine(seed, entry.dw_conv.kernel);
+                seed = hash_combine(seed, entry.dw_conv.stride);
+                seed = hash_combine(seed, entry.dw_conv.padding);
+                break;
+            case primitive_kind::binary:
+                seed = hash_combine(
+                        seed, static_cast<size_t>(entry.binary.alg));
+                seed = hash_combine(seed, get_md_hash(entry.binary.src1_desc));
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -277,6 +304,20 @@ size_t get_desc_hash<concat_desc_t>(const op_desc_t *op_desc) {
     return seed;
 }
 
+template <>
+size_t get_desc_hash<binary_desc_t>(const op_desc_t *op_desc) {
+    const auto *desc = reinterpret_cast<const binary_desc_t *>(op_desc);
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc->primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc->alg_kind));
+    // Memory descriptors
+    seed = get_array_hash(seed, desc->src_desc, 2);
+    seed = hash_combine(seed, get_md_hash(desc->dst_desc));
+    // Combined hash for binary op desc
+    return seed;
+}
+
 template <>
 size_t get_desc_hash<batch_normalization_desc_t>(const op_desc_t *op_desc) {
     const auto *desc
@@ -442,6 +483,23 @@ size_t get_desc_hash<lrn_desc_t>(const op_desc_t *op_desc) {
     return seed;
 }
 
+template <>
+size_t get_desc_hash<matmul_desc_t>(const op_desc_t *op_desc) {
+    const auto *desc = reinterpret_cast<const matmul_desc_t *>(op_desc);
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc->primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc->src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc->bias_desc));
+    seed = hash_combine(seed, get_md_hash(desc->dst_desc));
+    // Accumulator type
+    seed = hash_combine(seed, static_cast<size_t>(desc->accum_data_type));
+    // Combined hash for matmul op desc
+    return seed;
+}
+
 template <>
 size_t get_desc_hash<pooling_desc_t>(const op_desc_t *op_desc) {
     const auto *desc = reinterpret_cast<const pooling_desc_t *>(op_desc);
@@ -466,6 +524,42 @@ size_t get_desc_hash<pooling_desc_t>(const op_desc_t *op_desc) {
     return seed;
 }
 
+template <>
+size_t get_desc_hash<reduction_desc_t>(const op_desc_t *op_desc) {
+    const auto *desc = reinterpret_cast<const reduction_desc_t *>(op_desc);
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc->primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc->alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc->src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->dst_desc));
+    // P, eps
+    seed = hash_combine(seed, desc->p);
+    seed = hash_combine(seed, desc->eps);
+    // Combined hash for reduction desc
+    return seed;
+}
+
+template <>
+size_t get_desc_hash<resampling_desc_t>(const op_desc_t *op_desc) {
+    const auto *desc = reinterpret_cast<const resampling_desc_t *>(op_desc);
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc->primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc->prop_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc->alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc->src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->diff_src_desc));
+    seed = hash_combine(seed, get_md_hash(desc->dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc->diff_dst_desc));
+    // Factors
+    seed = get_array_hash(seed, desc->factors, DNNL_MAX_NDIMS);
+    // Combined hash for resampling desc
+    return seed;
+}
+
 template <>
 size_t get_desc_hash<reorder_desc_t>(const op_desc_t *op_desc) {
     const auto *desc = reinterpret_cast<const reorder_desc_t *>(op_desc);
@@ -606,6 +700,10 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
                         get_desc_hash<batch_normalization_desc_t>(
                                 key.op_desc_));
                 break;
+            case primitive_kind::binary:
+                seed = hash_combine(
+                        seed, get_desc_hash<binary_desc_t>(key.op_desc_));
+                break;
             case primitive_kind::concat:
                 seed = hash_combine(
                         seed, get_desc_hash<concat_desc_t>(key.op_desc_));
@@ -639,10 +737,22 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
                 seed = hash_combine(
                         seed, get_desc_hash<lrn_desc_t>(key.op_desc_));
                 break;
+            case primitive_kind::matmul:
+                seed = hash_combine(
+                        seed, get_desc_hash<matmul_desc_t>(key.op_desc_));
+                break;
             case primitive_kind::pooling:
                 seed = hash_combine(
                         seed, get_desc_hash<pooling_desc_t>(key.op_desc_));
                 break;
+            case primitive_kind::reduction:
+                seed = hash_combine(
+                        seed, get_desc_hash<reduction_desc_t>(key.op_desc_));
+                break;
+            case primitive_kind::resampling:
+                seed = hash_combine(
+                        seed, get_desc_hash<resampling_desc_t>(key.op_desc_));
+                break;
             case primitive_kind::reorder:
                 seed = hash_combine(
                         seed, get_desc_hash<reorder_desc_t>(key.op_desc_));
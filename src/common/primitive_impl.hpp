@@ -29,7 +29,10 @@ namespace dnnl {
 namespace impl {
 
 struct primitive_impl_t : public c_compatible {
-    primitive_impl_t(const primitive_desc_t *pd) : pd_(pd->clone()) {}
+    primitive_impl_t(const primitive_desc_t *pd)
+        : pd_(pd->clone())
+        , flops_(pd_->flops())
+        , bytes_(pd_->bytes_read() + pd_->bytes_written()) {}
     virtual ~primitive_impl_t() { delete pd_; }
 
     virtual status_t init() { return status::success; }
@@ -38,8 +41,15 @@ struct primitive_impl_t : public c_compatible {
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    /** The work estimates of the primitive descriptor, computed once for the
+     * tracing and the verbose mode */
+    dim_t flops() const { return flops_; }
+    dim_t bytes() const { return bytes_; }
+
 protected:
     const primitive_desc_t *pd_;
+    const dim_t flops_;
+    const dim_t bytes_;
 
 private:
     primitive_impl_t() = delete;
@@ -27,11 +27,26 @@
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 
+namespace {
+// The depthwise convolution post operation changes the destination of the
+// primitive, hence it is only accepted on top of a forward convolution.
+bool post_ops_ok(const op_desc_t *op_desc, const primitive_attr_t *attr) {
+    if (attr == nullptr
+            || attr->post_ops_.find(primitive_kind::convolution) == -1)
+        return true;
+
+    return op_desc->kind == primitive_kind::convolution
+            && utils::one_of(op_desc->convolution.prop_kind,
+                    prop_kind::forward_training, prop_kind::forward_inference);
+}
+} // namespace
+
 status_t dnnl_primitive_desc_iterator_create(
         primitive_desc_iterator_t **iterator, const_c_op_desc_t c_op_desc,
         const primitive_attr_t *attr, engine_t *engine,
         const primitive_desc_t *hint_fwd_pd) {
     const op_desc_t *op_desc = (const op_desc_t *)c_op_desc;
+    if (!post_ops_ok(op_desc, attr)) return unimplemented;
 
     auto it = new primitive_desc_iterator_t(engine, op_desc, attr, hint_fwd_pd);
     if (it == nullptr) return out_of_memory;
@@ -77,6 +92,7 @@ status_t dnnl_primitive_desc_create(primitive_desc_t **primitive_desc,
         const_c_op_desc_t c_op_desc, const primitive_attr_t *attr,
         engine_t *engine, const primitive_desc_t *hint_fwd_pd) {
     const op_desc_t *op_desc = (const op_desc_t *)c_op_desc;
+    if (!post_ops_ok(op_desc, attr)) return unimplemented;
 
     dnnl_primitive_desc_iterator it(engine, op_desc, attr, hint_fwd_pd);
     ++it;
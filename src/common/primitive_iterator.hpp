@@ -20,6 +20,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "impl_selection.hpp"
 #include "primitive_desc.hpp"
 #include "type_helpers.hpp"
 
@@ -37,7 +38,9 @@ struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
         , attr_(attr ? *attr : dnnl::impl::primitive_attr_t())
         , hint_fwd_pd_(hint_fwd_pd)
         , impl_list_(engine_->get_implementation_list())
-        , last_idx_(0) {
+        , last_idx_(0)
+        , scan_idx_(-1)
+        , best_idx_(-1) {
         while (impl_list_[last_idx_] != nullptr)
             ++last_idx_;
     }
@@ -61,11 +64,31 @@ struct dnnl_primitive_desc_iterator : public dnnl::impl::c_compatible {
             delete pd_;
             pd_ = nullptr;
         }
-        while (++idx_ != last_idx_) {
-            auto s = impl_list_[idx_](
+        // In the fastest implementation selection mode the measured winner
+        // goes first and the rest follow in the order of the list
+        if (idx_ == -1
+                && attr_.impl_selection_mode_
+                        == dnnl::impl::impl_selection_mode::fastest) {
+            best_idx_ = dnnl::impl::get_fastest_impl_idx(
+                    engine_, op_desc_, &attr_, hint_fwd_pd_);
+            if (best_idx_ != -1) {
+                auto s = impl_list_[best_idx_](
+                        &pd_, op_desc_, &attr_, engine_, hint_fwd_pd_);
+                if (s == dnnl::impl::status::success) {
+                    idx_ = best_idx_;
+                    return *this;
+                }
+                best_idx_ = -1;
+            }
+        }
+
+        while (++scan_idx_ != last_idx_) {
+            if (scan_idx_ == best_idx_) continue;
+            auto s = impl_list_[scan_idx_](
                     &pd_, op_desc_, &attr_, engine_, hint_fwd_pd_);
             if (s == dnnl::impl::status::success) { break; }
         }
+        idx_ = scan_idx_;
         return *this;
     }
 
@@ -83,6 +106,8 @@ protected:
     const dnnl::impl::primitive_desc_t *hint_fwd_pd_;
     const pd_create_f *impl_list_;
     int last_idx_;
+    int scan_idx_; // the last implementation tried in the order of the list
+    int best_idx_; // the fastest implementation, -1 if not selected
 
 private:
     dnnl_primitive_desc_iterator(dnnl::impl::engine_t *engine, int last_idx)
@@ -92,7 +117,9 @@ private:
         , op_desc_(nullptr)
         , hint_fwd_pd_(nullptr)
         , impl_list_(nullptr)
-        , last_idx_(last_idx) {}
+        , last_idx_(last_idx)
+        , scan_idx_(last_idx)
+        , best_idx_(-1) {}
 
     dnnl_primitive_desc_iterator(dnnl_primitive_desc_iterator &&other)
         : idx_(other.idx_)
@@ -101,7 +128,10 @@ private:
         , op_desc_(other.op_desc_)
         , attr_(other.attr_)
         , hint_fwd_pd_(other.hint_fwd_pd_)
-        , impl_list_(other.impl_list_) {
+        , impl_list_(other.impl_list_)
+        , last_idx_(other.last_idx_)
+        , scan_idx_(other.scan_idx_)
+        , best_idx_(other.best_idx_) {
         other.pd_ = nullptr;
     }
 
@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <assert.h>
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::alg_kind;
+
+namespace {
+status_t reduction_desc_init(reduction_desc_t *reduction_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, float p, float eps) {
+    bool args_ok = true && !any_null(reduction_desc, src_desc, dst_desc)
+            && one_of(alg_kind, reduction_max, reduction_min, reduction_sum,
+                    reduction_mul, reduction_mean, reduction_norm_lp_max,
+                    reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+                    reduction_norm_lp_power_p_sum);
+    if (!args_ok) return invalid_arguments;
+
+    const bool is_norm = one_of(alg_kind, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum);
+    if (is_norm && !(p >= 1.f)) return invalid_arguments;
+
+    const int ndims = src_desc->ndims;
+    args_ok = 0 < ndims && ndims <= DNNL_MAX_NDIMS
+            && dst_desc->ndims == ndims
+            && src_desc->format_kind != format_kind::any;
+    if (!args_ok) return invalid_arguments;
+
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides();
+    if (runtime_dims_or_strides) return unimplemented;
+
+    // The dimensions of dst of size 1 are reduced, the others are kept
+    for (int d = 0; d < ndims; ++d)
+        if (!one_of(dst_desc->dims[d], 1, src_desc->dims[d]))
+            return invalid_arguments;
+
+    auto rd = reduction_desc_t();
+    rd.primitive_kind = primitive_kind::reduction;
+    rd.alg_kind = alg_kind;
+    rd.src_desc = *src_desc;
+    rd.dst_desc = *dst_desc;
+    rd.p = p;
+    rd.eps = eps;
+
+    *reduction_desc = rd;
+    return success;
+}
+} // namespace
+
+status_t dnnl_reduction_desc_init(reduction_desc_t *reduction_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, float p, float eps) {
+    return reduction_desc_init(
+            reduction_desc, alg_kind, src_desc, dst_desc, p, eps);
+}
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef REDUCTION_PD_HPP
+#define REDUCTION_PD_HPP
+
+#include <assert.h>
+
+#include "dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct reduction_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::reduction;
+
+    typedef reduction_pd_t base_class;
+    typedef reduction_pd_t hint_class;
+
+    reduction_pd_t(engine_t *engine, const reduction_desc_t *adesc,
+            const primitive_attr_t *attr, const reduction_pd_t *hint_fwd_pd)
+        : primitive_desc_t(engine, attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc) {}
+
+    const reduction_desc_t *desc() const { return &desc_; }
+    virtual const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+    virtual void init_info() override { impl::init_info(this, this->info_); }
+
+    virtual status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::reduction_d:
+                *(const reduction_desc_t **)result = desc();
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    virtual arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    virtual const memory_desc_t *src_md(int index = 0) const override {
+        return index == 0 ? &src_md_ : &glob_zero_md;
+    }
+    virtual const memory_desc_t *dst_md(int index = 0) const override {
+        return index == 0 ? &dst_md_ : &glob_zero_md;
+    }
+
+    virtual int n_inputs() const override { return 1; }
+    virtual int n_outputs() const override { return 1; }
+
+    /* common reduction aux functions */
+
+    int ndims() const { return src_md_.ndims; }
+
+    /** returns true if the dimension @p d is reduced */
+    bool is_reduced(int d) const {
+        return dst_md_.dims[d] != src_md_.dims[d];
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(src_md_).has_zero_dim();
+    }
+
+protected:
+    reduction_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+
+    /* sets the layout of src for the destination if it has
+     * format_kind::any */
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        if (src_md_.format_kind != format_kind::blocked)
+            return status::unimplemented;
+        return memory_desc_init_by_blocking_desc(
+                dst_md_, src_md_.format_desc.blocking);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -66,6 +66,10 @@ status_t dnnl_reorder_primitive_desc_create(primitive_desc_t **reorder_pd,
 
     if (!s_mdw.consistent_with(d_mdw)) return invalid_arguments;
 
+    if (s_mdw.has_runtime_dims_or_strides()
+            || d_mdw.has_runtime_dims_or_strides())
+        return unimplemented;
+
     const primitive_attr_t dummy_attr;
     if (attr == NULL) attr = &dummy_attr;
 
@@ -73,6 +77,15 @@ status_t dnnl_reorder_primitive_desc_create(primitive_desc_t **reorder_pd,
     for (auto r = e->get_reorder_implementation_list(); *r; ++r) {
         if ((*r)(r_pd, e, attr, src_engine, src_md, dst_engine, dst_md)
                 == success) {
+            const bool with_binary
+                    = attr->post_ops_.find(primitive_kind::binary) != -1;
+            if ((!attr->output_scales_.defined()
+                        && !(*r_pd)->supports_runtime_output_scales())
+                    || (with_binary && !(*r_pd)->supports_binary_post_op())) {
+                delete *r_pd;
+                *r_pd = nullptr;
+                continue;
+            }
             return success;
         }
     }
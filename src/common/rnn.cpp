@@ -14,10 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <initializer_list>
+
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
 #include "cpu/gemm/os_blas.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -69,6 +72,42 @@ rnn_desc_t zero_rnn_desc() {
     return rd;
 }
 
+status_t check_runtime_dims_or_strides(
+        std::initializer_list<const memory_desc_t *> l) {
+    for (auto md : l)
+        if (md && memory_desc_wrapper(md).has_runtime_dims_or_strides())
+            return unimplemented;
+    return success;
+}
+
+/* Only the number of iterations and the minibatch of the forward inference
+ * may be specified at run-time: these are dims 0 and 1 of the layer tensors
+ * and dim 2 of the iteration tensors. The strides that depend on them may
+ * be run-time too, the implementations check the actual ones at execution */
+status_t check_runtime_dims_fwd(prop_kind_t prop_kind,
+        std::initializer_list<const memory_desc_t *> layer_mds,
+        std::initializer_list<const memory_desc_t *> iter_mds,
+        std::initializer_list<const memory_desc_t *> other_mds) {
+    auto runtime_dims_ok = [](const memory_desc_t *md, unsigned mask) {
+        if (!md) return true;
+        for (int d = 0; d < md->ndims; ++d)
+            if (md->dims[d] == DNNL_RUNTIME_DIM_VAL && !(mask & (1u << d)))
+                return false;
+        return true;
+    };
+
+    bool runtime = check_runtime_dims_or_strides(layer_mds) != success
+            || check_runtime_dims_or_strides(iter_mds) != success;
+    if (!runtime) return check_runtime_dims_or_strides(other_mds);
+
+    if (prop_kind != prop_kind::forward_inference) return unimplemented;
+    for (auto md : layer_mds)
+        if (!runtime_dims_ok(md, (1u << 0) | (1u << 1))) return unimplemented;
+    for (auto md : iter_mds)
+        if (!runtime_dims_ok(md, 1u << 2)) return unimplemented;
+    return check_runtime_dims_or_strides(other_mds);
+}
+
 status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
         prop_kind_t prop_kind, const memory_desc_t *src_layer_desc,
         const memory_desc_t *src_iter_desc,
@@ -139,8 +178,8 @@ status_t check_data_type_consistency_fwd(dnnl_alg_kind_t cell_kind,
 }
 
 status_t check_dim_consistency(dnnl_alg_kind_t cell_kind,
-        rnn_direction_t direction, int L, int D, int T, int N, int G, int SLC,
-        int SIC, int DLC, int DIC, const memory_desc_t *src_layer_desc,
+        rnn_direction_t direction, int L, int D, dim_t T, dim_t N, int G,
+        int SLC, int SIC, int DLC, int DIC, const memory_desc_t *src_layer_desc,
         const memory_desc_t *src_iter_desc,
         const memory_desc_t *src_iter_c_desc,
         const memory_desc_t *weights_layer_desc,
@@ -242,7 +281,7 @@ status_t check_dim_consistency(dnnl_alg_kind_t cell_kind,
 
     // * unrolling/fusion conditions
     args_ok = true && IMPLICATION(L > 1, (dlc_multiplier * SLC) == DLC)
-            && IMPLICATION(T > 1, SIC == DIC);
+            && IMPLICATION(T > 1 || T == DNNL_RUNTIME_DIM_VAL, SIC == DIC);
     if (!args_ok) return invalid_arguments;
 
     return success;
@@ -272,6 +311,13 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
                     dst_layer_desc);
     if (!args_ok) return invalid_arguments;
 
+    if (flags & ~(unsigned)dnnl_rnn_flags_use_seq_lengths)
+        return invalid_arguments;
+
+    CHECK(check_runtime_dims_fwd(prop_kind, {src_layer_desc, dst_layer_desc},
+            {src_iter_desc, src_iter_c_desc, dst_iter_desc, dst_iter_c_desc},
+            {weights_layer_desc, weights_iter_desc, bias_desc}));
+
     // check that optional parameters are passed properly, namely:
     // - if lstm and XXX_iter is provided, XXX_iter_c should be provided too
     auto xnor_md = [=](const memory_desc_t *a_md, const memory_desc_t *b_md) {
@@ -285,8 +331,8 @@ status_t rnn_common_fwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
 
     //check dimensions consistency
     int L = weights_layer_desc->dims[0];
-    int T = src_layer_desc->dims[0];
-    int N = src_layer_desc->dims[1];
+    dim_t T = src_layer_desc->dims[0];
+    dim_t N = src_layer_desc->dims[1];
     const int D = one_of(direction, dnnl_unidirectional_left2right,
                           dnnl_unidirectional_right2left)
             ? 1
@@ -372,6 +418,13 @@ status_t rnn_common_bwd_desc_init(dnnl_rnn_desc_t *rnn_desc,
                     diff_dst_layer_desc);
     if (!args_ok) return invalid_arguments;
 
+    CHECK(check_runtime_dims_or_strides({src_layer_desc, src_iter_desc,
+            src_iter_c_desc, weights_layer_desc, weights_iter_desc, bias_desc,
+            dst_layer_desc, dst_iter_desc, dst_iter_c_desc, diff_src_layer_desc,
+            diff_src_iter_desc, diff_src_iter_c_desc, diff_weights_layer_desc,
+            diff_weights_iter_desc, diff_bias_desc, diff_dst_layer_desc,
+            diff_dst_iter_desc, diff_dst_iter_c_desc}));
+
     // check that optional parameters are passed properly, namely:
     // - if lstm and XXX_iter is provided, XXX_iter_c should be provided too
     // - if XXX_iter is provided, diff_XXX_iter should be provided too
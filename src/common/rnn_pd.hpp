@@ -62,6 +62,14 @@ struct rnn_pd_t : public primitive_desc_t {
         return status::success;
     }
 
+    // The gates of each cell are computed by a layer and an iteration GEMM,
+    // the backward pass has twice as many for the data and the weights
+    virtual dim_t flops() const override {
+        const dim_t fwd_flops = 2 * L() * D() * T() * MB() * G() * DIC()
+                * (SLC() + SIC());
+        return is_fwd() ? fwd_flops : 2 * fwd_flops;
+    }
+
     virtual const memory_desc_t *src_md(int index = 0) const override {
         if (index == 0) return &src_layer_md_;
         if (index == 1 && with_src_iter()) return &src_iter_md_;
@@ -131,6 +139,10 @@ struct rnn_pd_t : public primitive_desc_t {
         return is_lstm() && !memory_desc_wrapper(desc_.dst_iter_desc).is_zero();
     }
 
+    bool with_seq_lengths() const {
+        return desc_.flags & dnnl_rnn_flags_use_seq_lengths;
+    }
+
     dnnl::impl::alg_kind_t cell_kind() const { return desc_.cell_kind; }
     dnnl::impl::alg_kind_t activation_kind() const {
         return desc_.activation_kind;
@@ -181,6 +193,9 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
 
         if (arg == DNNL_ARG_BIAS && with_bias()) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SEQ_LENGTHS && with_seq_lengths())
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DST_LAYER) return arg_usage_t::output;
 
         if (arg == DNNL_ARG_DST_ITER && with_dst_iter())
@@ -195,8 +210,14 @@ struct rnn_fwd_pd_t : public rnn_pd_t {
         return primitive_desc_t::arg_usage(arg);
     }
 
+    virtual const memory_desc_t *arg_md(int arg) const override {
+        if (arg == DNNL_ARG_BIAS) return weights_md(2);
+        return primitive_desc_t::arg_md(arg);
+    }
+
     virtual int n_inputs() const override {
-        return 3 + with_bias() + with_src_iter() + with_src_iter_c();
+        return 3 + with_bias() + with_src_iter() + with_src_iter_c()
+                + with_seq_lengths();
     }
     virtual int n_outputs() const override {
         return 1 + with_dst_iter() + with_dst_iter_c() + is_training();
@@ -263,6 +284,14 @@ struct rnn_bwd_pd_t : public rnn_pd_t {
         return primitive_desc_t::arg_usage(arg);
     }
 
+    virtual const memory_desc_t *arg_md(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_BIAS: return weights_md(2);
+            case DNNL_ARG_DIFF_BIAS: return diff_weights_md(2);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
     virtual const memory_desc_t *diff_src_md(int index = 0) const override {
         if (index == 0) return &diff_src_layer_md_;
         if (index == 1 && with_src_iter()) return &diff_src_iter_md_;
@@ -36,6 +36,15 @@ status_t softmax_desc_init(softmax_desc_t *softmax_desc, prop_kind_t prop_kind,
             && 0 <= softmax_axis && softmax_axis < data_desc->ndims;
     if (!args_ok) return invalid_arguments;
 
+    // run-time dimensions are supported for forward propagation only
+    bool runtime_dims_or_strides
+            = memory_desc_wrapper(data_desc).has_runtime_dims_or_strides()
+            || (diff_desc
+                    && memory_desc_wrapper(diff_desc)
+                               .has_runtime_dims_or_strides());
+    if (runtime_dims_or_strides && prop_kind == backward_data)
+        return unimplemented;
+
     auto sd = softmax_desc_t();
     sd.primitive_kind = primitive_kind::softmax;
     sd.prop_kind = prop_kind;
@@ -87,6 +87,22 @@ struct softmax_pd_t : public primitive_desc_t {
         return memory_desc_wrapper(data_desc()).has_zero_dim();
     }
 
+    bool has_runtime_dims_or_strides() const {
+        return memory_desc_wrapper(data_desc()).has_runtime_dims_or_strides();
+    }
+
+    /** returns true if only the dimensions preceding the softmax axis are
+     * specified at run-time, and the axis is the innermost one, so that the
+     * data may be treated as rows of axis_size() elements */
+    bool runtime_dims_supported() const {
+        const memory_desc_wrapper data_d(data_desc());
+        for (int d = axis(); d < ndims(); ++d)
+            if (data_d.dims()[d] == DNNL_RUNTIME_DIM_VAL) return false;
+        return data_d.is_plain() && inner_size() == 1
+                && data_d.blocking_desc().strides[axis()] == 1
+                && outer_stride() != DNNL_RUNTIME_DIM_VAL;
+    }
+
 protected:
     softmax_desc_t desc_;
     const softmax_fwd_pd_t *hint_fwd_pd_;
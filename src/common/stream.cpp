@@ -26,6 +26,36 @@ using namespace dnnl::impl;
 using namespace dnnl::impl::status;
 using namespace dnnl::impl::utils;
 
+/* Allocating scratchpads on a page boundary to reduce TLB/page misses */
+static const size_t scratchpad_alignment = 2097152;
+
+dnnl_stream::~dnnl_stream() {
+    assert(scratchpad_level_ == 0);
+    for (auto &s : scratchpads_)
+        dnnl::impl::free(s.ptr);
+}
+
+void *dnnl_stream::enter_scratchpad(size_t size) {
+    if ((int)scratchpads_.size() == scratchpad_level_)
+        scratchpads_.push_back({nullptr, 0});
+
+    auto &s = scratchpads_[scratchpad_level_];
+    if (s.size < size) {
+        dnnl::impl::free(s.ptr);
+        s.ptr = dnnl::impl::malloc(size, scratchpad_alignment);
+        s.size = s.ptr ? size : 0;
+    }
+    if (s.ptr == nullptr) return nullptr;
+
+    scratchpad_level_++;
+    return s.ptr;
+}
+
+void dnnl_stream::leave_scratchpad() {
+    assert(scratchpad_level_ > 0);
+    scratchpad_level_--;
+}
+
 /* API */
 
 status_t dnnl_stream_create(
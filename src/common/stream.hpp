@@ -18,6 +18,8 @@
 #define STREAM_HPP
 
 #include <assert.h>
+#include <vector>
+
 #include "dnnl.h"
 
 #include "c_types_map.hpp"
@@ -25,8 +27,8 @@
 
 struct dnnl_stream : public dnnl::impl::c_compatible {
     dnnl_stream(dnnl::impl::engine_t *engine, unsigned flags)
-        : engine_(engine), flags_(flags) {}
-    virtual ~dnnl_stream() {}
+        : engine_(engine), flags_(flags), scratchpad_level_(0) {}
+    virtual ~dnnl_stream();
 
     /** returns stream's engine */
     dnnl::impl::engine_t *engine() const { return engine_; }
@@ -37,9 +39,31 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     /** blocks until all submitted primitives to the stream are completed */
     virtual dnnl::impl::status_t wait() = 0;
 
+    /** returns the host scratchpad of at least @p size bytes for the
+     * primitive being executed, or nullptr if it cannot be allocated. The
+     * scratchpad is returned to the stream by leave_scratchpad().
+     *
+     * The scratchpad belongs to the stream, so a primitive can be executed
+     * on several streams at once. A primitive may execute other primitives
+     * (e.g. the reorders of a sum) while its scratchpad is in use, hence each
+     * nesting level has its own buffer, which grows to the largest size
+     * requested at this level and is reused by all the primitives. */
+    void *enter_scratchpad(size_t size);
+    void leave_scratchpad();
+
 protected:
     dnnl::impl::engine_t *engine_;
     unsigned flags_;
+
+private:
+    struct scratchpad_buffer_t {
+        void *ptr;
+        size_t size;
+    };
+    std::vector<scratchpad_buffer_t> scratchpads_;
+    int scratchpad_level_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_stream);
 };
 
 #endif
@@ -20,6 +20,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "memory_desc_wrapper.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -42,6 +43,10 @@ status_t dnnl_sum_primitive_desc_create(primitive_desc_t **sum_pd,
     const int ndims = src_mds[0].ndims;
     const dims_t &dims = src_mds[0].dims;
 
+    for (int i = 0; i < n; ++i)
+        if (memory_desc_wrapper(src_mds[i]).has_runtime_dims_or_strides())
+            return unimplemented;
+
     for (int i = 1; i < n; ++i) {
         if (src_mds[i].ndims != ndims) return invalid_arguments;
         for (int d = 0; d < ndims; ++d) {
@@ -52,6 +57,8 @@ status_t dnnl_sum_primitive_desc_create(primitive_desc_t **sum_pd,
     memory_desc_t dummy_dst_md;
     if (dst_md) {
         if (dst_md->ndims != ndims) return invalid_arguments;
+        if (memory_desc_wrapper(dst_md).has_runtime_dims_or_strides())
+            return unimplemented;
         for (int d = 0; d < ndims; ++d) {
             if (dst_md->dims[d] != dims[d]) return invalid_arguments;
         }
@@ -0,0 +1,226 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdio.h>
+#include <vector>
+
+#include "dnnl.h"
+#include "dnnl_debug.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "primitive.hpp"
+#include "primitive_desc.hpp"
+#include "trace.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+namespace {
+
+struct record_t {
+    dnnl_trace_event_kind_t kind;
+    primitive_kind_t prim_kind;
+    engine_kind_t engine_kind;
+    double start_us, end_us;
+    dim_t scratchpad_size;
+    dim_t flops, bytes;
+    int cache_hit;
+    char impl_name[64];
+    char info[DNNL_VERBOSE_BUF_LEN];
+};
+
+// The events of a thread. Only the owning thread writes, so recording takes
+// no locks: the count is published after the record is written.
+struct ring_t {
+    ring_t(int capacity, int thread_id)
+        : records(capacity), thread_id(thread_id), count(0), exited(false) {}
+
+    std::vector<record_t> records;
+    const int thread_id;
+    std::atomic<size_t> count; // the last records.size() events are kept
+    std::atomic<bool> exited;
+};
+
+std::atomic<bool> enabled(false);
+
+// The rings outlive their threads so that the events can be collected later
+std::mutex rings_mutex;
+std::vector<std::shared_ptr<ring_t>> rings;
+int last_thread_id = 0;
+
+struct ring_holder_t {
+    ~ring_holder_t() {
+        if (ring) ring->exited = true;
+    }
+    std::shared_ptr<ring_t> ring;
+};
+thread_local ring_holder_t ring_holder;
+
+ring_t *get_ring() {
+    if (!ring_holder.ring) {
+        const int capacity = getenv_int("DNNL_TRACE_CAPACITY", 4096);
+        std::lock_guard<std::mutex> guard(rings_mutex);
+        ring_holder.ring = std::make_shared<ring_t>(
+                nstl::max(capacity, 1), ++last_thread_id);
+        rings.push_back(ring_holder.ring);
+    }
+    return ring_holder.ring.get();
+}
+
+std::vector<std::shared_ptr<ring_t>> get_rings() {
+    std::lock_guard<std::mutex> guard(rings_mutex);
+    return rings;
+}
+
+template <typename F>
+void for_each_record(const F &f) {
+    for (const auto &ring : get_rings()) {
+        const size_t capacity = ring->records.size();
+        const size_t count = ring->count.load(std::memory_order_acquire);
+        for (size_t i = count > capacity ? count - capacity : 0; i < count; i++)
+            f(*ring, ring->records[i % capacity]);
+    }
+}
+
+// Writes the string as the body of a JSON string
+void dump_json_str(FILE *f, const char *s) {
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\')
+            fprintf(f, "\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            fprintf(f, "\\u%04x", *s);
+        else
+            fputc(*s, f);
+    }
+}
+
+} // namespace
+
+namespace dnnl {
+namespace impl {
+
+bool trace_enabled() {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void trace_record(dnnl_trace_event_kind_t kind, const primitive_t *primitive,
+        double start_ms, double end_ms, bool cache_hit) {
+    const primitive_desc_t *pd = primitive->pd();
+    ring_t *ring = get_ring();
+    const size_t idx = ring->count.load(std::memory_order_relaxed);
+    record_t &r = ring->records[idx % ring->records.size()];
+
+    r.kind = kind;
+    r.prim_kind = pd->kind();
+    r.engine_kind = pd->engine()->kind();
+    r.start_us = 1e3 * start_ms;
+    r.end_us = 1e3 * end_ms;
+    r.scratchpad_size = (dim_t)pd->scratchpad_registry().size();
+    r.flops = primitive->get_primitive_impl()->flops();
+    r.bytes = primitive->get_primitive_impl()->bytes();
+    r.cache_hit = cache_hit;
+    snprintf(r.impl_name, sizeof(r.impl_name), "%s", pd->name());
+    snprintf(r.info, sizeof(r.info), "%s", pd->info());
+
+    ring->count.store(idx + 1, std::memory_order_release);
+}
+
+} // namespace impl
+} // namespace dnnl
+
+status_t dnnl_set_trace(int enable) {
+    enabled = enable != 0;
+    return success;
+}
+
+status_t dnnl_trace_visit(dnnl_trace_callback_t callback, void *user_data) {
+    if (callback == nullptr) return invalid_arguments;
+
+    for_each_record([&](const ring_t &ring, const record_t &r) {
+        dnnl_trace_event_t e;
+        e.kind = r.kind;
+        e.info = r.info;
+        e.impl_name = r.impl_name;
+        e.engine_kind = r.engine_kind;
+        e.thread_id = ring.thread_id;
+        e.start_us = r.start_us;
+        e.end_us = r.end_us;
+        e.scratchpad_size = r.scratchpad_size;
+        e.flops = r.flops;
+        e.bytes = r.bytes;
+        e.cache_hit = r.cache_hit;
+        callback(&e, user_data);
+    });
+    return success;
+}
+
+status_t dnnl_trace_dump(const char *path) {
+    if (path == nullptr) return invalid_arguments;
+
+    FILE *f = dnnl::impl::fopen(path, "w");
+    if (!f) return invalid_arguments;
+
+    // Complete events ("ph":"X") with the times in microseconds
+    fprintf(f, "{\"traceEvents\":[");
+    bool first = true;
+    for_each_record([&](const ring_t &ring, const record_t &r) {
+        const bool create = r.kind == dnnl_trace_event_create;
+        fprintf(f, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+                   "\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d,",
+                first ? "" : ",", dnnl_prim_kind2str(r.prim_kind),
+                create ? "create" : "exec", r.start_us, r.end_us - r.start_us,
+                ring.thread_id);
+        fprintf(f, "\"args\":{\"impl\":\"");
+        dump_json_str(f, r.impl_name);
+        fprintf(f, "\",\"engine\":\"%s\",\"scratchpad_size\":%lld",
+                dnnl_engine_kind2str(r.engine_kind),
+                (long long)r.scratchpad_size);
+        if (create)
+            fprintf(f, ",\"cache\":\"%s\"", r.cache_hit ? "hit" : "miss");
+        // The work per us / 1e3 gives GFLOPS and GB/s
+        const double us = r.end_us - r.start_us;
+        if (!create && us > 0)
+            fprintf(f, ",\"gflops\":%g,\"gbps\":%g", r.flops / us / 1e3,
+                    r.bytes / us / 1e3);
+        fprintf(f, ",\"info\":\"");
+        dump_json_str(f, r.info);
+        fprintf(f, "\"}}");
+        first = false;
+    });
+    fprintf(f, "\n]}\n");
+
+    const bool ok = !ferror(f);
+    fclose(f);
+    return ok ? success : runtime_error;
+}
+
+status_t dnnl_trace_clear() {
+    std::lock_guard<std::mutex> guard(rings_mutex);
+    std::vector<std::shared_ptr<ring_t>> alive;
+    for (auto &ring : rings) {
+        if (ring->exited) continue;
+        ring->count = 0;
+        alive.push_back(ring);
+    }
+    rings.swap(alive);
+    return success;
+}
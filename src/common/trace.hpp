@@ -0,0 +1,38 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include "dnnl_types.h"
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+/** Returns true if the trace events are collected, see dnnl_set_trace() */
+bool trace_enabled();
+
+/** Records an event of the @p primitive in the ring buffer of the calling
+ * thread. The times are the ones returned by get_msec(). */
+void trace_record(dnnl_trace_event_kind_t kind, const primitive_t *primitive,
+        double start_ms, double end_ms, bool cache_hit = false);
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <memory>
 
@@ -421,6 +422,14 @@ inline derived_type downcast(base_type *base) {
 
 } // namespace utils
 
+// Returns true if the value is #DNNL_RUNTIME_F32_VAL. The value is a NaN, so
+// it is compared bitwise.
+inline bool is_runtime_value(float val) {
+    unsigned u;
+    memcpy(&u, &val, sizeof(u));
+    return u == DNNL_RUNTIME_F32_VAL_REP.u;
+}
+
 int32_t fetch_and_add(int32_t *dst, int32_t val);
 inline void yield_thread() {}
 
@@ -26,6 +26,7 @@
 #include "verbose.hpp"
 
 #include "batch_normalization_pd.hpp"
+#include "binary_pd.hpp"
 #include "concat_pd.hpp"
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
@@ -34,8 +35,11 @@
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
+#include "matmul_pd.hpp"
 #include "pooling_pd.hpp"
+#include "reduction_pd.hpp"
 #include "reorder_pd.hpp"
+#include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
@@ -150,11 +154,20 @@ void clear_buf(char *buf, int &written) {
         } \
     } while (0)
 
+// Outputs a dimension, the ones specified at run-time are shown as `*`
+const char *dim2str(char *str, int len, dim_t dim) {
+    if (dim == DNNL_RUNTIME_DIM_VAL) return "*";
+    snprintf(str, len, DFMT, dim);
+    return str;
+}
+
 // XXX: Outputs strings corresponding to memory formats used for data tensors.
 void format_prb_desc_str(char *str, int len, const memory_desc_t *md) {
     const auto dims = md->dims;
     int written = 0;
-    if (md->ndims == 1)
+    if (memory_desc_wrapper(md).has_runtime_dims())
+        dnnl_md2dim_str(str, len, md);
+    else if (md->ndims == 1)
         DPRINT(str, len, written, "x" DFMT, dims[0]);
     else if (md->ndims == 2)
         DPRINT(str, len, written, "mb" DFMT "ic" DFMT, dims[0], dims[1]);
@@ -384,6 +397,39 @@ static void init_info_eltwise(pd_t *s, char *buffer) {
             s->desc()->prop_kind, dat_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_binary(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    const char *prefixes[3] = {"src_", " src1_", " dst_"};
+    const memory_desc_t *mds[3] = {s->src_md(0), s->src_md(1), s->dst_md()};
+    for (int i = 0; i < 3; i++) {
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "%s", prefixes[i]);
+        int l = dnnl_md2fmt_str(dat_str + dat_written,
+                DNNL_VERBOSE_DAT_LEN - dat_written, mds[i]);
+        if (l >= 0)
+            dat_written += l;
+        else
+            clear_buf(dat_str, dat_written);
+    }
+
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "alg:%s",
+            dnnl_alg_kind2str(s->desc()->alg_kind));
+
+    for (int i = 0; i < 2; i++) { // src0 and src1 dims
+        if (i > 0) DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+        int l = dnnl_md2dim_str(prb_str + prb_written,
+                DNNL_VERBOSE_PRB_LEN - prb_written, mds[i]);
+        if (l >= 0)
+            prb_written += l;
+        else
+            clear_buf(prb_str, prb_written);
+    }
+
+    verbose_templ(buffer, s->engine(), s->kind(), s->name(), prop_kind::undef,
+            dat_str, aux_str, prb_str);
+}
+
 template <typename pd_t>
 static void init_info_gemm(pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
@@ -398,6 +444,84 @@ static void init_info_gemm(pd_t *s, char *buffer) {
             dat_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_matmul(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    if (1) { // src
+        auto md = s->src_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "src_");
+        int l = dnnl_md2fmt_str(
+                dat_str + dat_written, DNNL_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0)
+            dat_written += l;
+        else
+            clear_buf(dat_str, dat_written);
+    }
+    if (1) { // wei
+        auto md = s->weights_md(0);
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " wei_");
+        int l = dnnl_md2fmt_str(
+                dat_str + dat_written, DNNL_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0)
+            dat_written += l;
+        else
+            clear_buf(dat_str, dat_written);
+    }
+    if (1) { // bia
+        auto md = s->weights_md(1);
+        if (s->with_bias()) {
+            DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " bia_");
+            int l = dnnl_md2fmt_str(dat_str + dat_written,
+                    DNNL_VERBOSE_DAT_LEN - dat_written, md);
+            if (l >= 0)
+                dat_written += l;
+            else
+                clear_buf(dat_str, dat_written);
+        }
+    }
+    if (1) { // dst
+        auto md = s->dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+        int l = dnnl_md2fmt_str(
+                dat_str + dat_written, DNNL_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0)
+            dat_written += l;
+        else
+            clear_buf(dat_str, dat_written);
+    }
+
+    if (1) { // src dims
+        int l = dnnl_md2dim_str(prb_str + prb_written,
+                DNNL_VERBOSE_PRB_LEN - prb_written, s->src_md());
+        if (l >= 0)
+            prb_written += l;
+        else
+            clear_buf(prb_str, prb_written);
+    }
+    if (1) { // wei dims
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+        int l = dnnl_md2dim_str(prb_str + prb_written,
+                DNNL_VERBOSE_PRB_LEN - prb_written, s->weights_md(0));
+        if (l >= 0)
+            prb_written += l;
+        else
+            clear_buf(prb_str, prb_written);
+    }
+    if (1) { // dst dims
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+        int l = dnnl_md2dim_str(prb_str + prb_written,
+                DNNL_VERBOSE_PRB_LEN - prb_written, s->dst_md());
+        if (l >= 0)
+            prb_written += l;
+        else
+            clear_buf(prb_str, prb_written);
+    }
+
+    verbose_templ(buffer, s->engine(), s->kind(), s->name(), prop_kind::undef,
+            dat_str, aux_str, prb_str);
+}
+
 template <typename pd_t>
 static void init_info_iprod(pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
@@ -451,8 +575,10 @@ static void init_info_iprod(pd_t *s, char *buffer) {
             clear_buf(dat_str, dat_written);
     }
 
+    char mb_str[32];
     DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written,
-            "mb" DFMT "ic" DFMT "oc" DFMT, s->MB(), s->IC_total(), s->OC());
+            "mb%sic" DFMT "oc" DFMT, dim2str(mb_str, 32, s->MB()),
+            s->IC_total(), s->OC());
 
     verbose_templ(buffer, s->engine(), s->kind(), s->name(),
             s->desc()->prop_kind, dat_str, aux_str, prb_str);
@@ -597,6 +723,83 @@ static void init_info_pool(pd_t *s, char *buffer) {
             s->desc()->prop_kind, dat_str, aux_str, prb_str);
 }
 
+template <typename pd_t>
+static void init_info_reduction(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    const char *prefixes[2] = {"src_", " dst_"};
+    const memory_desc_t *mds[2] = {s->src_md(), s->dst_md()};
+    for (int i = 0; i < 2; i++) {
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "%s", prefixes[i]);
+        int l = dnnl_md2fmt_str(dat_str + dat_written,
+                DNNL_VERBOSE_DAT_LEN - dat_written, mds[i]);
+        if (l >= 0)
+            dat_written += l;
+        else
+            clear_buf(dat_str, dat_written);
+    }
+
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "alg:%s p:%g eps:%g",
+            dnnl_alg_kind2str(s->desc()->alg_kind), s->desc()->p,
+            s->desc()->eps);
+
+    for (int i = 0; i < 2; i++) { // src and dst dims
+        if (i > 0) DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, ":");
+        int l = dnnl_md2dim_str(prb_str + prb_written,
+                DNNL_VERBOSE_PRB_LEN - prb_written, mds[i]);
+        if (l >= 0)
+            prb_written += l;
+        else
+            clear_buf(prb_str, prb_written);
+    }
+
+    verbose_templ(buffer, s->engine(), s->kind(), s->name(), prop_kind::undef,
+            dat_str, aux_str, prb_str);
+}
+
+template <typename pd_t>
+static void init_info_resampling(pd_t *s, char *buffer) {
+    DECL_DAT_AUX_PRB_STRS();
+
+    if (1) { // src
+        auto md = s->is_fwd() ? s->src_md() : s->diff_src_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, "src_");
+        int l = dnnl_md2fmt_str(
+                dat_str + dat_written, DNNL_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0)
+            dat_written += l;
+        else
+            clear_buf(dat_str, dat_written);
+    }
+    if (1) { // dst
+        auto md = s->is_fwd() ? s->dst_md() : s->diff_dst_md();
+        DPRINT(dat_str, DNNL_VERBOSE_DAT_LEN, dat_written, " dst_");
+        int l = dnnl_md2fmt_str(
+                dat_str + dat_written, DNNL_VERBOSE_DAT_LEN - dat_written, md);
+        if (l >= 0)
+            dat_written += l;
+        else
+            clear_buf(dat_str, dat_written);
+    }
+
+    DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "alg:%s",
+            dnnl_alg_kind2str(s->desc()->alg_kind));
+
+    DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, "mb" DFMT "ic" DFMT "_",
+            s->MB(), s->C());
+    if (s->ndims() >= 5)
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written,
+                "id" DFMT "od" DFMT "_", s->ID(), s->OD());
+    if (s->ndims() >= 4)
+        DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written,
+                "ih" DFMT "oh" DFMT "_", s->IH(), s->OH());
+    DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written, "iw" DFMT "ow" DFMT,
+            s->IW(), s->OW());
+
+    verbose_templ(buffer, s->engine(), s->kind(), s->name(),
+            s->desc()->prop_kind, dat_str, aux_str, prb_str);
+}
+
 template <typename pd_t>
 static void init_info_softmax(pd_t *s, char *buffer) {
     DECL_DAT_AUX_PRB_STRS();
@@ -712,10 +915,11 @@ static void init_info_rnn(pd_t *s, char *buffer) {
     DPRINT(aux_str, DNNL_VERBOSE_AUX_LEN, aux_written, "alg:%s_%s",
             dnnl_alg_kind2str(alg_kind), dnnl_rnn_direction2str(rnn_dir));
 
+    char t_str[32], mb_str[32];
     DPRINT(prb_str, DNNL_VERBOSE_PRB_LEN, prb_written,
-            "l" DFMT "t" DFMT "mb" DFMT "sic" DFMT "slc" DFMT "dic" DFMT
-            "dlc" DFMT,
-            s->L(), s->T(), s->MB(), s->SIC(), s->SLC(), s->DIC(), s->DLC());
+            "l" DFMT "t%smb%ssic" DFMT "slc" DFMT "dic" DFMT "dlc" DFMT,
+            s->L(), dim2str(t_str, 32, s->T()), dim2str(mb_str, 32, s->MB()),
+            s->SIC(), s->SLC(), s->DIC(), s->DLC());
 
     verbose_templ(buffer, s->engine(), s->kind(), s->name(),
             s->desc()->prop_kind, dat_str, aux_str, prb_str);
@@ -732,14 +936,18 @@ static void init_info_rnn(pd_t *s, char *buffer) {
         UNUSED(buffer); \
     }
 
+DEFINE_STUB(binary);
 DEFINE_STUB(bnorm);
 DEFINE_STUB(conv);
 DEFINE_STUB(eltwise);
 DEFINE_STUB(gemm);
 DEFINE_STUB(iprod);
 DEFINE_STUB(lrn);
+DEFINE_STUB(matmul);
 DEFINE_STUB(mem);
 DEFINE_STUB(pool);
+DEFINE_STUB(reduction);
+DEFINE_STUB(resampling);
 DEFINE_STUB(softmax);
 DEFINE_STUB(rnn);
 DEFINE_STUB(shuffle);
@@ -754,6 +962,9 @@ void init_info(batch_normalization_pd_t *s, char *b) {
 void init_info(layer_normalization_pd_t *s, char *b) {
     init_info_bnorm(s, b);
 }
+void init_info(binary_pd_t *s, char *b) {
+    init_info_binary(s, b);
+}
 void init_info(concat_pd_t *s, char *b) {
     init_info_mem(s, b);
 }
@@ -775,12 +986,21 @@ void init_info(inner_product_pd_t *s, char *b) {
 void init_info(lrn_pd_t *s, char *b) {
     init_info_lrn(s, b);
 }
+void init_info(matmul_pd_t *s, char *b) {
+    init_info_matmul(s, b);
+}
 void init_info(pooling_pd_t *s, char *b) {
     init_info_pool(s, b);
 }
+void init_info(reduction_pd_t *s, char *b) {
+    init_info_reduction(s, b);
+}
 void init_info(reorder_pd_t *s, char *b) {
     init_info_mem(s, b);
 }
+void init_info(resampling_pd_t *s, char *b) {
+    init_info_resampling(s, b);
+}
 void init_info(rnn_pd_t *s, char *b) {
     init_info_rnn(s, b);
 }
@@ -799,7 +1019,7 @@ void init_info(sum_pd_t *s, char *b) {
 
 dnnl_status_t dnnl_set_verbose(int level) {
     using namespace dnnl::impl::status;
-    if (level < 0 || level > 2) return invalid_arguments;
+    if (level < 0 || level > 3) return invalid_arguments;
     dnnl::impl::verbose.level = level;
     dnnl::impl::initialized = true;
     return success;
@@ -17,6 +17,7 @@
 #include <memory>
 #include "bfloat16.hpp"
 #include "cpu_isa_traits.hpp"
+#include "jit_avx2_bf16cvt.hpp"
 #include "jit_avx512_core_bf16cvt.hpp"
 
 namespace dnnl {
@@ -31,35 +32,28 @@ union float_raw {
 };
 
 bfloat16_t &bfloat16_t::operator=(float f) {
-    if (cpu::mayiuse(cpu::cpu_isa_t::avx512_core)) {
-        jit_call_t p;
-        p.inp = (void *)&f;
-        p.out = (void *)this;
-        static const cpu::jit_avx512_core_cvt_ps_to_bf16_t cvt_one_ps_to_bf16(
-                1);
-        cvt_one_ps_to_bf16.jit_ker(&p);
-    } else {
-        float_raw r = {f};
-        switch (std::fpclassify(f)) {
-            case FP_SUBNORMAL:
-            case FP_ZERO:
-                // sign preserving zero (denormal go to zero)
-                raw_bits_ = r.iraw[1];
-                raw_bits_ &= 0x8000;
-                break;
-            case FP_INFINITE: raw_bits_ = r.iraw[1]; break;
-            case FP_NAN:
-                // truncate and set MSB of the mantissa force QNAN
-                raw_bits_ = r.iraw[1];
-                raw_bits_ |= 1 << 6;
-                break;
-            case FP_NORMAL:
-                // round to nearest even and truncate
-                unsigned int rounding_bias = 0x00007FFF + (r.iraw[1] & 0x1);
-                r.int_raw += rounding_bias;
-                raw_bits_ = r.iraw[1];
-                break;
-        }
+    // a scalar conversion is much cheaper than a call to a jit kernel for a
+    // single element; the bulk conversions below should be used for arrays
+    float_raw r = {f};
+    switch (std::fpclassify(f)) {
+        case FP_SUBNORMAL:
+        case FP_ZERO:
+            // sign preserving zero (denormal go to zero)
+            raw_bits_ = r.iraw[1];
+            raw_bits_ &= 0x8000;
+            break;
+        case FP_INFINITE: raw_bits_ = r.iraw[1]; break;
+        case FP_NAN:
+            // truncate and set MSB of the mantissa force QNAN
+            raw_bits_ = r.iraw[1];
+            raw_bits_ |= 1 << 6;
+            break;
+        case FP_NORMAL:
+            // round to nearest even and truncate
+            unsigned int rounding_bias = 0x00007FFF + (r.iraw[1] & 0x1);
+            r.int_raw += rounding_bias;
+            raw_bits_ = r.iraw[1];
+            break;
     }
     return *this;
 }
@@ -80,7 +74,18 @@ void cvt_float_to_bfloat16(bfloat16_t *out, const float *inp, size_t size) {
         static const cpu::jit_avx512_core_cvt_ps_to_bf16_t cvt_ps_to_bf16;
         cvt_ps_to_bf16.jit_ker(&p_);
     } else {
-        for (size_t i = 0; i < size; ++i)
+        size_t i = 0;
+        if (cpu::mayiuse(cpu::cpu_isa_t::avx2)) {
+            typedef cpu::jit_avx2_cvt_ps_to_bf16_t cvt_t;
+            jit_call_t p_;
+            p_.inp = (void *)inp;
+            p_.out = (void *)out;
+            p_.size = size;
+            static const cvt_t cvt_ps_to_bf16;
+            cvt_ps_to_bf16.jit_ker(&p_);
+            i = size - size % cvt_t::simd_w;
+        }
+        for (; i < size; ++i)
             out[i] = inp[i];
     }
 }
@@ -94,7 +99,18 @@ void cvt_bfloat16_to_float(float *out, const bfloat16_t *inp, size_t size) {
         static const cpu::jit_avx512_core_cvt_bf16_to_ps_t cvt_bf16_to_ps;
         cvt_bf16_to_ps.jit_ker(&p_);
     } else {
-        for (size_t i = 0; i < size; ++i)
+        size_t i = 0;
+        if (cpu::mayiuse(cpu::cpu_isa_t::avx2)) {
+            typedef cpu::jit_avx2_cvt_bf16_to_ps_t cvt_t;
+            jit_call_t p_;
+            p_.inp = (void *)inp;
+            p_.out = (void *)out;
+            p_.size = size;
+            static const cvt_t cvt_bf16_to_ps;
+            cvt_bf16_to_ps.jit_ker(&p_);
+            i = size - size % cvt_t::simd_w;
+        }
+        for (; i < size; ++i)
             out[i] = inp[i];
     }
 }
@@ -111,7 +127,19 @@ void add_floats_and_cvt_to_bfloat16(
                 add_cvt_ps_to_bf16;
         add_cvt_ps_to_bf16.jit_ker(&p_);
     } else {
-        for (size_t i = 0; i < size; ++i)
+        size_t i = 0;
+        if (cpu::mayiuse(cpu::cpu_isa_t::avx2)) {
+            typedef cpu::jit_avx2_add_cvt_ps_to_bf16_t cvt_t;
+            jit_call_t p_;
+            p_.inp = (void *)inp0;
+            p_.add = (void *)inp1;
+            p_.out = (void *)out;
+            p_.size = size;
+            static const cvt_t add_cvt_ps_to_bf16;
+            add_cvt_ps_to_bf16.jit_ker(&p_);
+            i = size - size % cvt_t::simd_w;
+        }
+        for (; i < size; ++i)
             out[i] = inp0[i] + inp1[i];
     }
 }
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_BINARY_PD_HPP
+#define CPU_BINARY_PD_HPP
+
+#include <assert.h>
+
+#include "binary_pd.hpp"
+#include "c_types_map.hpp"
+#include "cpu_engine.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_binary_pd_t : public binary_pd_t {
+    using binary_pd_t::binary_pd_t;
+
+protected:
+    /* supported post-ops: (eltwise)?, with the unit scale */
+    bool post_ops_ok() const {
+        const auto &po = attr()->post_ops_;
+        return po.len_ == 0
+                || (po.len_ == 1 && po.entry_[0].is_eltwise()
+                        && po.entry_[0].eltwise.scale == 1.f);
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -24,11 +24,18 @@
 #include "cpu_stream.hpp"
 #include "memory.hpp"
 
+#include "cpu/matmul/gemm_bf16_matmul.hpp"
+#include "cpu/matmul/gemm_f32_matmul.hpp"
+#include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
+#include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/rnn/ref_rnn.hpp"
 
+#include "cpu/fft_convolution.hpp"
 #include "cpu/gemm_bf16_convolution.hpp"
 #include "cpu/gemm_bf16_inner_product.hpp"
 #include "cpu/gemm_convolution.hpp"
+#include "cpu/gemm_deconvolution.hpp"
+#include "cpu/gemm_wino_convolution.hpp"
 #include "cpu/gemm_inner_product.hpp"
 #include "cpu/gemm_x8s8s32x_convolution.hpp"
 #include "cpu/gemm_x8s8s32x_inner_product.hpp"
@@ -51,17 +58,20 @@
 #include "cpu/jit_sse41_convolution.hpp"
 #include "cpu/jit_uni_batch_normalization.hpp"
 #include "cpu/jit_uni_batch_normalization_s8.hpp"
+#include "cpu/jit_uni_binary.hpp"
 #include "cpu/jit_uni_dw_convolution.hpp"
 #include "cpu/jit_uni_eltwise.hpp"
 #include "cpu/jit_uni_i8i8_pooling.hpp"
 #include "cpu/jit_uni_lrn.hpp"
 #include "cpu/jit_uni_pooling.hpp"
+#include "cpu/jit_uni_resampling.hpp"
 #include "cpu/jit_uni_softmax.hpp"
 #include "cpu/nchw_pooling.hpp"
 #include "cpu/ncsp_batch_normalization.hpp"
 #include "cpu/nhwc_pooling.hpp"
 #include "cpu/nspc_batch_normalization.hpp"
 #include "cpu/ref_batch_normalization.hpp"
+#include "cpu/ref_binary.hpp"
 #include "cpu/ref_convolution.hpp"
 #include "cpu/ref_deconvolution.hpp"
 #include "cpu/ref_eltwise.hpp"
@@ -69,9 +79,12 @@
 #include "cpu/ref_layer_normalization.hpp"
 #include "cpu/ref_lrn.hpp"
 #include "cpu/ref_pooling.hpp"
+#include "cpu/ref_reduction.hpp"
+#include "cpu/ref_resampling.hpp"
 #include "cpu/ref_shuffle.hpp"
 #include "cpu/ref_softmax.hpp"
 #include "cpu/simple_layer_normalization.hpp"
+#include "cpu/simple_reduction.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -91,6 +104,7 @@ using pd_create_f = dnnl::impl::engine_t::primitive_desc_create_f;
 
 namespace {
 using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::cpu::matmul;
 
 #define INSTANCE(...) &primitive_desc_t::create<__VA_ARGS__::pd_t>
 static const pd_create_f cpu_impl_list[] = {
@@ -112,6 +126,9 @@ static const pd_create_f cpu_impl_list[] = {
         INSTANCE(jit_avx512_common_convolution_winograd_fwd_t),
         INSTANCE(jit_avx512_common_convolution_winograd_bwd_data_t),
         INSTANCE(jit_avx512_common_convolution_winograd_bwd_weights_t),
+        INSTANCE(gemm_wino_convolution_fwd_t),
+        INSTANCE(gemm_wino_convolution_bwd_data_t),
+        INSTANCE(fft_convolution_fwd_t),
         INSTANCE(jit_avx512_common_convolution_fwd_t<f32>),
         INSTANCE(jit_avx512_common_convolution_bwd_data_t<f32>),
         INSTANCE(jit_avx512_common_convolution_bwd_weights_t<f32>),
@@ -215,6 +232,8 @@ static const pd_create_f cpu_impl_list[] = {
         INSTANCE(_jit_avx512_core_x8s8s32x_deconvolution_fwd_t<s8, u8>),
         INSTANCE(_jit_avx512_core_x8s8s32x_deconvolution_fwd_t<s8, s8>),
         INSTANCE(_jit_avx512_core_x8s8s32x_deconvolution_fwd_t<s8, f32>),
+        INSTANCE(gemm_deconvolution_fwd_t<f32>),
+        INSTANCE(gemm_deconvolution_fwd_t<bf16>),
         INSTANCE(ref_deconvolution_bwd_weights_t),
         INSTANCE(ref_deconvolution_bwd_data_t),
         INSTANCE(ref_deconvolution_fwd_t),
@@ -353,6 +372,67 @@ static const pd_create_f cpu_impl_list[] = {
         INSTANCE(ref_layer_normalization_bwd_t<f32>),
         INSTANCE(ref_layer_normalization_fwd_t<bf16>),
         INSTANCE(ref_layer_normalization_bwd_t<bf16>),
+        /* matmul */
+        INSTANCE(gemm_f32_matmul_t),
+        INSTANCE(ref_matmul_t<f32>),
+        /* matmul (bfloat16) */
+        INSTANCE(gemm_bf16_matmul_t<f32>),
+        INSTANCE(gemm_bf16_matmul_t<bf16>),
+        INSTANCE(ref_matmul_t<bf16, bf16, f32, f32>),
+        INSTANCE(ref_matmul_t<bf16, bf16, bf16, f32>),
+        /* matmul (int) */
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, f32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, s32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, s8>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<u8, u8>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, f32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, s32>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, s8>),
+        INSTANCE(gemm_x8s8s32x_matmul_t<s8, u8>),
+        INSTANCE(ref_matmul_t<u8, s8, f32, s32>),
+        INSTANCE(ref_matmul_t<u8, s8, s32, s32>),
+        INSTANCE(ref_matmul_t<u8, s8, s8, s32>),
+        INSTANCE(ref_matmul_t<u8, s8, u8, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, f32, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, s32, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, s8, s32>),
+        INSTANCE(ref_matmul_t<s8, s8, u8, s32>),
+        /* binary */
+        INSTANCE(jit_uni_binary_t<avx512_common, f32>),
+        INSTANCE(jit_uni_binary_t<avx512_core, bf16>),
+        INSTANCE(jit_uni_binary_t<avx512_common, s8>),
+        INSTANCE(jit_uni_binary_t<avx512_common, u8>),
+        INSTANCE(jit_uni_binary_t<avx2, f32>),
+        INSTANCE(ref_binary_t<f32>),
+        INSTANCE(ref_binary_t<bf16>),
+        INSTANCE(ref_binary_t<s8>),
+        INSTANCE(ref_binary_t<u8>),
+        /* reduction */
+        INSTANCE(simple_reduction_t<f32, f32>),
+        INSTANCE(simple_reduction_t<bf16, bf16>),
+        INSTANCE(simple_reduction_t<bf16, f32>),
+        INSTANCE(simple_reduction_t<s8, s8>),
+        INSTANCE(simple_reduction_t<s8, f32>),
+        INSTANCE(simple_reduction_t<u8, u8>),
+        INSTANCE(simple_reduction_t<u8, f32>),
+        INSTANCE(ref_reduction_t<f32, f32>),
+        INSTANCE(ref_reduction_t<bf16, bf16>),
+        INSTANCE(ref_reduction_t<bf16, f32>),
+        INSTANCE(ref_reduction_t<s8, s8>),
+        INSTANCE(ref_reduction_t<s8, f32>),
+        INSTANCE(ref_reduction_t<u8, u8>),
+        INSTANCE(ref_reduction_t<u8, f32>),
+        /* resampling */
+        INSTANCE(jit_uni_resampling_fwd_t<avx512_core, bf16>),
+        INSTANCE(jit_uni_resampling_fwd_t<avx512_common, f32>),
+        INSTANCE(jit_uni_resampling_fwd_t<avx2, f32>),
+        INSTANCE(jit_uni_resampling_bwd_t<avx512_core, bf16>),
+        INSTANCE(jit_uni_resampling_bwd_t<avx512_common, f32>),
+        INSTANCE(jit_uni_resampling_bwd_t<avx2, f32>),
+        INSTANCE(ref_resampling_fwd_t<f32>),
+        INSTANCE(ref_resampling_fwd_t<bf16>),
+        INSTANCE(ref_resampling_bwd_t<f32>),
+        INSTANCE(ref_resampling_bwd_t<bf16>),
         /* eol */
         nullptr,
 };
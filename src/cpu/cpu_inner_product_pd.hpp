@@ -76,6 +76,22 @@ inline bool dense_gemm_consitency_check(const memory_desc_wrapper &src_d,
             && src_d.is_dense(true) && dst_d.is_dense() && wei_d.is_dense(true);
 }
 
+/* same as dense_gemm_consitency_check(), but also accepts the run-time
+ * minibatch: the layouts are then checked as if the minibatch were 1 */
+inline bool dense_gemm_consitency_check_runtime_mb(const memory_desc_t *src_md,
+        const memory_desc_t *wei_md, const memory_desc_t *dst_md) {
+    if (src_md->dims[0] != DNNL_RUNTIME_DIM_VAL)
+        return dense_gemm_consitency_check(src_md, wei_md, dst_md);
+
+    memory_desc_t src_md_mb1 = *src_md, dst_md_mb1 = *dst_md;
+    src_md_mb1.dims[0] = src_md_mb1.padded_dims[0] = 1;
+    dst_md_mb1.dims[0] = dst_md_mb1.padded_dims[0] = 1;
+    const memory_desc_wrapper src_d(src_md_mb1), dst_d(dst_md_mb1);
+    return !src_d.has_runtime_dims_or_strides()
+            && !dst_d.has_runtime_dims_or_strides()
+            && dense_gemm_consitency_check(src_d, wei_md, dst_d);
+}
+
 void transpose_md(memory_desc_t &md) {
     // Note: we cannot directly use good leading dimension for a
     // in padded_dims.  This is because inner_blks does not
@@ -161,8 +177,10 @@ protected:
             CHECK(memory_desc_init_by_tag(weights_md_, get_tag(src_md_)));
             /* with batch = 1, no transpose to use the faster gemv kernels */
             /* otherwise, we transpose the weights to improve efficiency of no-copy kernels*/
+            /* the run-time batch is assumed to be greater than 1 */
             auto batch = src_md_.dims[0];
-            if (batch > 1) transpose_md(weights_md_);
+            if (batch > 1 || batch == DNNL_RUNTIME_DIM_VAL)
+                transpose_md(weights_md_);
 
             return status::success;
         };
@@ -17,11 +17,19 @@
 #ifndef CPU_MEMORY_STORAGE_HPP
 #define CPU_MEMORY_STORAGE_HPP
 
+#include <string.h>
+#include <vector>
+
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory.hpp"
 #include "common/memory_storage.hpp"
+#include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_numa.hpp"
+#include "cpu/cpu_topology.hpp"
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -30,14 +38,25 @@ class cpu_memory_storage_t : public memory_storage_t {
 public:
     cpu_memory_storage_t(
             engine_t *engine, unsigned flags, size_t size, void *handle)
-        : memory_storage_t(engine) {
+        : memory_storage_t(engine), size_(size) {
         if (size == 0 || (!handle && (flags & memory_flags_t::alloc) == 0)) {
             data_ = nullptr;
             is_owned_ = false;
             return;
         }
         if (flags & memory_flags_t::alloc) {
-            data_ = malloc(size, 64);
+            const int nnodes = get_num_numa_nodes();
+            if ((flags & memory_flags_t::replicate) && nnodes > 1) {
+                // A copy on each node, the first one is the data handle
+                policy_ = numa_policy::local;
+                replicas_.resize(nnodes, nullptr);
+                for (int n = 0; n < nnodes; n++)
+                    replicas_[n] = numa_malloc(size, policy_, n);
+                data_ = replicas_[0];
+            } else {
+                policy_ = get_numa_policy();
+                data_ = numa_malloc(size, policy_);
+            }
             is_owned_ = true;
         } else if (flags & memory_flags_t::use_backend_ptr) {
             data_ = handle;
@@ -45,9 +64,7 @@ public:
         }
     }
 
-    virtual ~cpu_memory_storage_t() override {
-        if (is_owned_) { free(data_); }
-    }
+    virtual ~cpu_memory_storage_t() override { release(); }
 
     virtual status_t get_data_handle(void **handle) const override {
         *handle = data_;
@@ -55,15 +72,55 @@ public:
     }
 
     virtual status_t set_data_handle(void *handle) override {
-        if (is_owned_) { free(data_); }
+        release();
         data_ = handle;
         is_owned_ = false;
         return status::success;
     }
 
+    virtual status_t get_local_data_handle(void **handle) const override {
+        *handle = replicas_.empty() ? data_
+                                    : replicas_[get_current_numa_node()];
+        return status::success;
+    }
+
+    virtual status_t update_replicas() const override {
+        if (replicas_.empty()) return status::success;
+
+        // The copies are done by chunks to be spread over the threads
+        const size_t chunk = 1 << 16;
+        const size_t nchunks = utils::div_up(size_, chunk);
+        const int ncopies = (int)replicas_.size() - 1;
+        parallel_nd(ncopies, nchunks, [&](int r, size_t c) {
+            const size_t off = c * chunk;
+            const size_t len = nstl::min(chunk, size_ - off);
+            memcpy((char *)replicas_[r + 1] + off, (char *)data_ + off, len);
+        });
+        return status::success;
+    }
+
+    virtual status_t unmap_data(void *mapped_ptr) const override {
+        UNUSED(mapped_ptr);
+        return update_replicas();
+    }
+
 private:
+    void release() {
+        if (!is_owned_) return;
+        if (replicas_.empty()) {
+            numa_free(data_, size_, policy_);
+        } else {
+            for (void *r : replicas_)
+                numa_free(r, size_, policy_);
+            replicas_.clear();
+        }
+    }
+
     void *data_ = nullptr;
+    size_t size_ = 0;
     bool is_owned_ = false;
+    numa_policy_t policy_ = numa_policy::first_touch;
+    std::vector<void *> replicas_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_memory_storage_t);
 };
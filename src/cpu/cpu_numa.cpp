@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include <string.h>
+#include <atomic>
+
+#include "dnnl.h"
+
+#include "utils.hpp"
+
+#include "cpu_numa.hpp"
+#include "cpu_topology.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// The policy set with dnnl_set_numa_policy(), if any
+std::atomic<int> numa_policy_override(-1);
+
+numa_policy_t get_env_numa_policy() {
+    static const numa_policy_t policy = []() {
+        char val[32];
+        if (getenv("DNNL_NUMA_POLICY", val, sizeof(val)) > 0) {
+            if (strcmp(val, "interleave") == 0) return numa_policy::interleave;
+            if (strcmp(val, "local") == 0) return numa_policy::local;
+        }
+        return numa_policy::first_touch;
+    }();
+    return policy;
+}
+
+// The memory is placed with mbind(2) only if there is a choice of nodes,
+// otherwise it is allocated as usual
+bool is_placed(numa_policy_t policy) {
+#if defined(__linux__)
+    return policy != numa_policy::first_touch && get_num_numa_nodes() > 1;
+#else
+    UNUSED(policy);
+    return false;
+#endif
+}
+
+} // namespace
+
+numa_policy_t get_numa_policy() {
+    const int policy = numa_policy_override.load();
+    return policy >= 0 ? (numa_policy_t)policy : get_env_numa_policy();
+}
+
+void *numa_malloc(size_t size, numa_policy_t policy, int node) {
+    if (!is_placed(policy)) return malloc(size, 64);
+#if defined(__linux__)
+    void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) return nullptr;
+
+    // The mode values and the node mask of mbind(2)
+    enum { mpol_preferred = 1, mpol_interleave = 3, max_nodes = 1024 };
+    const int bits = 8 * sizeof(unsigned long);
+    unsigned long mask[max_nodes / bits] = {0};
+    auto add_node = [&](int index) {
+        const int id = get_numa_node_id(index);
+        if (id < max_nodes) mask[id / bits] |= 1UL << (id % bits);
+    };
+
+    int mode = mpol_preferred;
+    if (policy == numa_policy::interleave) {
+        mode = mpol_interleave;
+        for (int i = 0; i < get_num_numa_nodes(); i++)
+            add_node(i);
+    } else {
+        add_node(node < 0 ? get_current_numa_node() : node);
+    }
+
+    // The placement is a hint: the memory is usable even if it fails
+    syscall(SYS_mbind, ptr, size, mode, mask, max_nodes + 1, 0);
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void numa_free(void *ptr, size_t size, numa_policy_t policy) {
+    if (ptr == nullptr) return;
+    if (!is_placed(policy)) {
+        free(ptr);
+        return;
+    }
+#if defined(__linux__)
+    munmap(ptr, size);
+#endif
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_set_numa_policy(dnnl_numa_policy_t policy) {
+    using namespace dnnl::impl;
+    if (!utils::one_of(policy, numa_policy::first_touch,
+                numa_policy::interleave, numa_policy::local))
+        return status::invalid_arguments;
+    cpu::numa_policy_override.store(policy);
+    return status::success;
+}
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_NUMA_HPP
+#define CPU_NUMA_HPP
+
+#include <stddef.h>
+
+#include "c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Returns the placement of the memory objects of the CPU engine, set with
+// dnnl_set_numa_policy() or the DNNL_NUMA_POLICY environment variable
+numa_policy_t get_numa_policy();
+
+// Allocates the memory placed on the NUMA nodes with the policy. The local
+// policy places it on the node of the index, or on the node of the calling
+// thread if the index is negative. The memory is at least 64-byte aligned and
+// is freed with numa_free() and the same size and policy.
+void *numa_malloc(size_t size, numa_policy_t policy, int node = -1);
+void numa_free(void *ptr, size_t size, numa_policy_t policy);
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
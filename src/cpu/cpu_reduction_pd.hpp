@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2017-2018 Intel Corporation
+* Copyright 2019 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -14,23 +14,29 @@
 * limitations under the License.
 *******************************************************************************/
 
-#ifndef COMMON_SCRATCHPAD_HPP
-#define COMMON_SCRATCHPAD_HPP
+#ifndef CPU_REDUCTION_PD_HPP
+#define CPU_REDUCTION_PD_HPP
 
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "cpu_engine.hpp"
+#include "reduction_pd.hpp"
+#include "type_helpers.hpp"
 #include "utils.hpp"
 
 namespace dnnl {
 namespace impl {
+namespace cpu {
 
-struct scratchpad_t {
-    virtual ~scratchpad_t() {}
-    virtual char *get() const = 0;
+struct cpu_reduction_pd_t : public reduction_pd_t {
+    using reduction_pd_t::reduction_pd_t;
 };
 
-scratchpad_t *create_scratchpad(size_t size);
-
+} // namespace cpu
 } // namespace impl
 } // namespace dnnl
+
 #endif
 
 // vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
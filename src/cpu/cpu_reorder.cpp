@@ -128,6 +128,10 @@ static const rpd_create_f cpu_reorder_impl_list[] = {
         /* jit */
         jit_uni_reorder_create,
 
+        /* bf16: direct copy with the bulk converters */
+        REG_SR(f32, any, bf16, any, fmt_order::any, spec::direct_copy),
+        REG_SR(bf16, any, f32, any, fmt_order::any, spec::direct_copy),
+
         /* fp32: flat <-> blocked with tail */
         REG_SR_BIDIR(f32, any, f32, nCw4c),
         REG_SR_BIDIR(f32, any, f32, nCw8c),
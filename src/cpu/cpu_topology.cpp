@@ -0,0 +1,266 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "cpu_topology.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+enum { max_cache_level = 3 };
+
+struct cache_t {
+    unsigned int size; // the whole cache
+    unsigned int per_core; // the share of a core
+};
+
+#if defined(__linux__)
+bool read_line(const char *path, char *buf, int buf_size) {
+    FILE *f = impl::fopen(path, "r");
+    if (!f) return false;
+    const bool ok = fgets(buf, buf_size, f) != NULL;
+    fclose(f);
+    return ok;
+}
+
+// Calls f for each number in a sysfs list such as "0-3,8-11"
+template <typename F>
+void for_each_in_list(const char *list, F f) {
+    const char *p = list;
+    while (*p) {
+        char *end = NULL;
+        const long first = strtol(p, &end, 10);
+        if (end == p) break;
+        long last = first;
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+            if (end == p) break;
+        }
+        for (long i = first; i <= last; i++)
+            f((int)i);
+        p = *end == ',' ? end + 1 : end;
+    }
+}
+
+// Counts the cpus in a sysfs list such as "0-3,8-11"
+int count_cpu_list(const char *list) {
+    int count = 0;
+    for_each_in_list(list, [&](int) { count++; });
+    return count;
+}
+
+// Reads the data or unified cache of the level from sysfs: unlike cpuid it
+// reports the cpus that actually share the cache (e.g. sub-NUMA clusters).
+bool get_sysfs_cache(int level, unsigned int &size, int &sharing) {
+    const char *base = "/sys/devices/system/cpu/cpu0/cache/index";
+    for (int idx = 0; idx < 16; idx++) {
+        char path[128], buf[256];
+        snprintf(path, sizeof(path), "%s%d/level", base, idx);
+        if (!read_line(path, buf, sizeof(buf))) return false;
+        if (atoi(buf) != level) continue;
+
+        snprintf(path, sizeof(path), "%s%d/type", base, idx);
+        if (!read_line(path, buf, sizeof(buf))
+                || strncmp(buf, "Instruction", 11) == 0)
+            continue;
+
+        snprintf(path, sizeof(path), "%s%d/size", base, idx);
+        if (!read_line(path, buf, sizeof(buf))) continue;
+        char *suffix = NULL;
+        unsigned long s = strtoul(buf, &suffix, 10);
+        if (*suffix == 'K') s *= 1024;
+        if (*suffix == 'M') s *= 1024 * 1024;
+
+        snprintf(path, sizeof(path), "%s%d/shared_cpu_list", base, idx);
+        sharing = read_line(path, buf, sizeof(buf)) ? count_cpu_list(buf) : 1;
+        size = (unsigned int)s;
+        return size > 0;
+    }
+    return false;
+}
+#endif
+
+// The cache topology does not change while the process runs, so it is
+// detected once. cpuid is queried through a local object rather than the
+// global one since the sizes are requested by static initializers.
+const cache_t &get_cache(int level) {
+    static const struct caches_t {
+        cache_t c[max_cache_level];
+        caches_t() {
+            // the defaults for when the topology is unknown, per core
+            const unsigned int default_size[max_cache_level]
+                    = {32000, 512000, 1024000};
+            Xbyak::util::Cpu cpu_info;
+            const unsigned int cpuid_levels = cpu_info.getDataCacheLevels();
+
+            for (int l = 1; l <= max_cache_level; l++) {
+                cache_t &cache = c[l - 1];
+                unsigned int size = 0;
+                int sharing = 1;
+                bool found = false;
+#if defined(__linux__)
+                found = get_sysfs_cache(l, size, sharing);
+#endif
+                if (!found && (unsigned int)l <= cpuid_levels) {
+                    size = cpu_info.getDataCacheSize(l - 1);
+                    sharing = cpu_info.getCoresSharingDataCache(l - 1);
+                    found = true;
+                }
+                if (found) {
+                    cache.size = size;
+                    cache.per_core = size / nstl::max(sharing, 1);
+                } else if (cpuid_levels == 0) {
+                    cache.size = 0;
+                    cache.per_core = default_size[l - 1];
+                } else {
+                    cache.size = cache.per_core = 0;
+                }
+
+                char env_name[32];
+                snprintf(env_name, sizeof(env_name), "DNNL_L%d_CACHE_SIZE", l);
+                const int env_size = getenv_int(env_name, 0);
+                if (env_size > 0) {
+                    cache.size = 0;
+                    cache.per_core = (unsigned int)env_size;
+                }
+            }
+        }
+    } caches;
+    return caches.c[level - 1];
+}
+
+struct numa_topology_t {
+    std::vector<int> node_ids; // of the nodes with both cpus and memory
+    std::vector<int> cpu_node; // the index of the node of each cpu
+};
+
+const numa_topology_t &get_numa_topology() {
+    static const numa_topology_t topology = []() {
+        numa_topology_t t;
+#if defined(__linux__)
+        char nodes[1024], cpus[1024];
+        const char *dir = "/sys/devices/system/node";
+        char path[128];
+        snprintf(path, sizeof(path), "%s/has_memory", dir);
+        bool ok = read_line(path, nodes, sizeof(nodes));
+        if (!ok) {
+            snprintf(path, sizeof(path), "%s/online", dir);
+            ok = read_line(path, nodes, sizeof(nodes));
+        }
+        if (ok) {
+            for_each_in_list(nodes, [&](int id) {
+                snprintf(path, sizeof(path), "%s/node%d/cpulist", dir, id);
+                if (!read_line(path, cpus, sizeof(cpus))) return;
+                const int index = (int)t.node_ids.size();
+                bool has_cpus = false;
+                for_each_in_list(cpus, [&](int cpu) {
+                    if (cpu >= (int)t.cpu_node.size())
+                        t.cpu_node.resize(cpu + 1, 0);
+                    t.cpu_node[cpu] = index;
+                    has_cpus = true;
+                });
+                if (has_cpus) t.node_ids.push_back(id);
+            });
+        }
+#endif
+        if (t.node_ids.empty()) {
+            t.node_ids.assign(1, 0);
+            t.cpu_node.clear();
+        }
+        return t;
+    }();
+    return topology;
+}
+
+} // namespace
+
+int get_num_numa_nodes() {
+    return (int)get_numa_topology().node_ids.size();
+}
+
+int get_numa_node_id(int index) {
+    return get_numa_topology().node_ids[index];
+}
+
+int get_current_numa_node() {
+#if defined(__linux__)
+    const auto &t = get_numa_topology();
+    const int cpu = sched_getcpu();
+    if (cpu >= 0 && cpu < (int)t.cpu_node.size()) return t.cpu_node[cpu];
+#endif
+    return 0;
+}
+
+int get_num_available_cores() {
+    static const int num_cores = []() {
+        int n = 0;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) n = CPU_COUNT(&set);
+
+        // cgroup v2 keeps "<quota> <period>" or "max <period>" in cpu.max,
+        // cgroup v1 keeps them in separate files with quota -1 for no limit
+        char buf[64];
+        long quota = -1, period = 0;
+        if (read_line("/sys/fs/cgroup/cpu.max", buf, sizeof(buf))) {
+            if (sscanf(buf, "%ld %ld", &quota, &period) != 2) quota = -1;
+        } else if (read_line(
+                           "/sys/fs/cgroup/cpu/cpu.cfs_quota_us", buf, 64)) {
+            quota = atol(buf);
+            if (read_line("/sys/fs/cgroup/cpu/cpu.cfs_period_us", buf, 64))
+                period = atol(buf);
+        }
+        if (quota > 0 && period > 0) {
+            const int quota_cores = (int)utils::div_up(quota, period);
+            n = n > 0 ? nstl::min(n, quota_cores) : quota_cores;
+        }
+#endif
+        return n > 0 ? n : dnnl_get_max_threads();
+    }();
+    return num_cores;
+}
+
+unsigned int get_cache_size(int level, bool per_core) {
+    if (level < 1 || level > max_cache_level) return 0;
+    const cache_t &cache = get_cache(level);
+    if (per_core) return cache.per_core;
+
+    const int nthr
+            = nstl::min(dnnl_get_max_threads(), get_num_available_cores());
+    const unsigned int available = cache.per_core * nstl::max(nthr, 1);
+    return cache.size == 0 ? available : nstl::min(cache.size, available);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
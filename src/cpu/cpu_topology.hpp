@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_TOPOLOGY_HPP
+#define CPU_TOPOLOGY_HPP
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Returns the number of cores the process may run on: the size of its
+// affinity mask limited by the cgroup cpu quota, if any.
+int get_num_available_cores();
+
+// Returns the number of the NUMA nodes with cpus and memory, 1 if the system
+// is not NUMA or the nodes cannot be detected. The nodes are referred to by
+// their index, less than the number of nodes.
+int get_num_numa_nodes();
+
+// Returns the system id of the NUMA node of the index
+int get_numa_node_id(int index);
+
+// Returns the index of the NUMA node of the cpu the calling thread runs on
+int get_current_numa_node();
+
+// Returns the size in bytes of the data cache of the given level (1-3).
+// The per core size is the share of a core among the cores that really share
+// the cache. Otherwise the size is the part of the cache available to the
+// threads in use, i.e. no more than their per core shares together.
+// The per core sizes can be set with the DNNL_L<level>_CACHE_SIZE
+// environment variables.
+unsigned int get_cache_size(int level, bool per_core = true);
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,469 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_topology.hpp"
+#include "fft_convolution.hpp"
+#include "gemm/gemm.hpp"
+#include "jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+int pow2_ge(int v) {
+    int p = 1;
+    while (p < v)
+        p <<= 1;
+    return p;
+}
+
+void init_twiddles(std::vector<float> &re, std::vector<float> &im, int n) {
+    const double pi = 3.14159265358979323846;
+    re.resize(nstl::max(n / 2, 1), 1.f);
+    im.resize(nstl::max(n / 2, 1), 0.f);
+    for (int k = 0; k < n / 2; k++) {
+        const double phi = -2. * pi * k / n;
+        re[k] = (float)cos(phi);
+        im[k] = (float)sin(phi);
+    }
+}
+
+/* In-place radix-2 FFT of the n points at the given stride. The inverse
+ * transform is not scaled by 1 / n. */
+void fft(float *re, float *im, int n, int stride, const float *tw_re,
+        const float *tw_im, bool inverse) {
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            nstl::swap(re[i * stride], re[j * stride]);
+            nstl::swap(im[i * stride], im[j * stride]);
+        }
+    }
+
+    const float sign = inverse ? -1.f : 1.f;
+    for (int len = 2; len <= n; len <<= 1) {
+        const int half = len / 2, step = n / len;
+        for (int i = 0; i < n; i += len)
+            for (int k = 0; k < half; k++) {
+                const float w_re = tw_re[k * step];
+                const float w_im = sign * tw_im[k * step];
+                float &a_re = re[(i + k) * stride];
+                float &a_im = im[(i + k) * stride];
+                float &b_re = re[(i + k + half) * stride];
+                float &b_im = im[(i + k + half) * stride];
+                const float x_re = b_re * w_re - b_im * w_im;
+                const float x_im = b_re * w_im + b_im * w_re;
+                b_re = a_re - x_re;
+                b_im = a_im - x_im;
+                a_re += x_re;
+                a_im += x_im;
+            }
+    }
+}
+
+/* The 2D transforms of a real lh x lw segment. Only the columns v <= lw / 2
+ * of the spectrum are computed, the others follow from the symmetry. */
+struct fft_2d_t {
+    int lh, lw;
+    const float *tw_h_re, *tw_h_im, *tw_w_re, *tw_w_im;
+
+    // The rows of re out of [i_s, i_e) are zero, im is overwritten
+    void forward(float *re, float *im, int i_s, int i_e) const {
+        for (int i = 0; i < lh * lw; i++)
+            im[i] = 0.f;
+        for (int i = i_s; i < i_e; i++)
+            fft(re + i * lw, im + i * lw, lw, 1, tw_w_re, tw_w_im, false);
+        if (lh > 1)
+            for (int v = 0; v <= lw / 2; v++)
+                fft(re + v, im + v, lh, lw, tw_h_re, tw_h_im, false);
+    }
+
+    // Only the first nrows rows of the (real) result are computed
+    void backward(float *re, float *im, int nrows) const {
+        if (lh > 1)
+            for (int v = 0; v <= lw / 2; v++)
+                fft(re + v, im + v, lh, lw, tw_h_re, tw_h_im, true);
+        for (int i = 0; i < nrows; i++) {
+            float *row_re = re + i * lw, *row_im = im + i * lw;
+            for (int v = 1; v < lw / 2; v++) {
+                row_re[lw - v] = row_re[v];
+                row_im[lw - v] = -row_im[v];
+            }
+            fft(row_re, row_im, lw, 1, tw_w_re, tw_w_im, true);
+        }
+    }
+};
+
+} // namespace
+
+namespace fft_convolution_utils {
+
+double fft_cost(const jit_conv_fft_conf_t &jcp) {
+    const double npts = (double)jcp.lh * jcp.lw;
+    const double fft_flops = npts > 1 ? 5. * npts * log2(npts) : 0.;
+    // The transforms are scalar code, they are weighted by the width of the
+    // vectors the GEMM and the direct convolution use
+    const double transforms
+            = 8. * jcp.ntiles * (jcp.ic_ph + jcp.oc) * fft_flops;
+    // A complex multiply-add is 4 real ones
+    const double products = 8. * jcp.ntiles * jcp.nbins * jcp.ic_ph * jcp.oc;
+    return transforms + products;
+}
+
+double direct_cost(const jit_conv_fft_conf_t &jcp) {
+    return 2. * jcp.mb * jcp.oc * jcp.ic * jcp.oh * jcp.ow * jcp.kh * jcp.kw;
+}
+
+status_t init_conf(jit_conv_fft_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d, int max_threads) {
+    const int ndims = src_d.ndims();
+    const bool is_1d = ndims == 3;
+    const bool with_groups = weights_d.ndims() == ndims + 1;
+    if (with_groups) return unimplemented;
+
+    jcp.mb = src_d.dims()[0];
+    jcp.ic = src_d.dims()[1];
+    jcp.oc = dst_d.dims()[1];
+    jcp.ih = is_1d ? 1 : src_d.dims()[ndims - 2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.oh = is_1d ? 1 : dst_d.dims()[ndims - 2];
+    jcp.ow = dst_d.dims()[ndims - 1];
+    jcp.kh = is_1d ? 1 : weights_d.dims()[ndims - 2];
+    jcp.kw = weights_d.dims()[ndims - 1];
+    jcp.stride_h = is_1d ? 1 : cd.strides[0];
+    jcp.stride_w = cd.strides[ndims - 3];
+    jcp.dilate_h = is_1d ? 0 : cd.dilates[0];
+    jcp.dilate_w = cd.dilates[ndims - 3];
+    jcp.t_pad = is_1d ? 0 : cd.padding[0][0];
+    jcp.l_pad = cd.padding[0][ndims - 3];
+    jcp.with_bias = cd.bias_desc.format_kind != format_kind::undef;
+    jcp.nthr = max_threads;
+
+    jcp.nphases = jcp.stride_h * jcp.stride_w;
+    jcp.ic_ph = jcp.ic * jcp.nphases;
+    const int ext_kh = (jcp.kh - 1) * (jcp.dilate_h + 1) + 1;
+    const int ext_kw = (jcp.kw - 1) * (jcp.dilate_w + 1) + 1;
+    jcp.kh_ph = div_up(ext_kh, jcp.stride_h);
+    jcp.kw_ph = div_up(ext_kw, jcp.stride_w);
+
+    const int max_lh = 256, max_lw = 4096, max_npts = 1 << 16;
+    const int min_lh = pow2_ge(jcp.kh_ph), min_lw = pow2_ge(jcp.kw_ph);
+    if (min_lh > max_lh || min_lw > max_lw) return unimplemented;
+    const int top_lh = nstl::max(
+            min_lh, nstl::min(max_lh, pow2_ge(jcp.oh + jcp.kh_ph - 1)));
+    const int top_lw = nstl::max(
+            min_lw, nstl::min(max_lw, pow2_ge(jcp.ow + jcp.kw_ph - 1)));
+
+    // The transformed inputs and outputs of a block of tiles should stay
+    // in the last level cache, yet the block should be large enough for
+    // the GEMM to be efficient
+    const size_t budget = nstl::max(
+            (size_t)get_cache_size(3, false), (size_t)16 * 1024 * 1024);
+    const int min_tile_block = 16;
+
+    jit_conv_fft_conf_t best = jcp;
+    double best_cost = -1.;
+    for (int lh = min_lh; lh <= top_lh; lh *= 2)
+        for (int lw = min_lw; lw <= top_lw; lw *= 2) {
+            const bool is_smallest = lh == min_lh && lw == min_lw;
+            if (lh * lw > max_npts && !is_smallest) continue;
+
+            jit_conv_fft_conf_t c = jcp;
+            c.lh = lh;
+            c.lw = lw;
+            c.th = lh - c.kh_ph + 1;
+            c.tw = lw - c.kw_ph + 1;
+            c.htiles = div_up(c.oh, c.th);
+            c.wtiles = div_up(c.ow, c.tw);
+            c.ntiles = c.mb * c.htiles * c.wtiles;
+            c.nbins = lh * (lw / 2 + 1);
+
+            const size_t tile_sz = sizeof(float) * c.nbins * 2
+                    * (2 * (size_t)c.ic_ph + c.oc);
+            c.tile_block = (int)nstl::max(
+                    (size_t)1, nstl::min((size_t)c.ntiles, budget / tile_sz));
+            if (c.tile_block < nstl::min(c.ntiles, min_tile_block)
+                    && !is_smallest)
+                continue;
+            c.nb_tile_blocks = div_up(c.ntiles, c.tile_block);
+
+            const double cost = fft_cost(c);
+            if (best_cost < 0 || cost < best_cost) {
+                best = c;
+                best_cost = cost;
+            }
+        }
+    jcp = best;
+
+    return success;
+}
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_conv_fft_conf_t &jcp) {
+    const size_t inp_sz = (size_t)jcp.nbins * 4 * jcp.ic_ph * jcp.tile_block;
+    const size_t out_sz = (size_t)jcp.nbins * 2 * jcp.oc * jcp.tile_block;
+    const size_t work_sz = (size_t)jcp.nthr * 2 * jcp.lh * jcp.lw;
+    scratchpad.book(key_conv_fft_inp, sizeof(float) * inp_sz, PAGE_4K);
+    scratchpad.book(key_conv_fft_out, sizeof(float) * out_sz, PAGE_4K);
+    scratchpad.book(key_conv_fft_work, sizeof(float) * work_sz, PAGE_4K);
+}
+
+} // namespace fft_convolution_utils
+
+fft_convolution_fwd_t::fft_convolution_fwd_t(const pd_t *apd)
+    : primitive_impl_t(apd), sum_scale_(0.f), eltwise_(nullptr) {
+    const auto &post_ops = pd()->attr()->post_ops_;
+    const int sum_idx = post_ops.find(primitive_kind::sum);
+    if (sum_idx != -1) sum_scale_ = post_ops.entry_[sum_idx].sum.scale;
+
+    const int entry_idx = post_ops.find(primitive_kind::eltwise);
+    if (entry_idx != -1)
+        eltwise_ = new ref_eltwise_scalar_fwd_t(
+                post_ops.entry_[entry_idx].eltwise);
+
+    const auto &jcp = pd()->jcp_;
+    init_twiddles(tw_h_re_, tw_h_im_, jcp.lh);
+    init_twiddles(tw_w_re_, tw_w_im_, jcp.lw);
+}
+
+std::shared_ptr<const fft_convolution_fwd_t::transformed_weights_t>
+fft_convolution_fwd_t::get_transformed_weights(const float *weights,
+        const memory_tracking::grantor_t &scratchpad) const {
+    const auto &jcp = pd()->jcp_;
+    const size_t wei_sz = (size_t)jcp.oc * jcp.ic * jcp.kh * jcp.kw;
+
+    // The weights are compared with the ones the cached transforms were
+    // made of, so that the changes done by the user in place are noticed
+    std::lock_guard<std::mutex> guard(weights_mutex_);
+    if (weights_
+            && !memcmp(weights_->weights.data(), weights,
+                    sizeof(float) * wei_sz))
+        return weights_;
+
+    auto tr = std::make_shared<transformed_weights_t>();
+    tr->weights.assign(weights, weights + wei_sz);
+    tr->bins.resize((size_t)jcp.nbins * 2 * jcp.ic_ph * jcp.oc);
+
+    const fft_2d_t fft_2d = {jcp.lh, jcp.lw, tw_h_re_.data(), tw_h_im_.data(),
+            tw_w_re_.data(), tw_w_im_.data()};
+    const size_t bin_sz = (size_t)2 * jcp.ic_ph * jcp.oc;
+    const int nv = jcp.lw / 2 + 1;
+    float *work_base = scratchpad.get<float>(key_conv_fft_work);
+    float *bins = tr->bins.data();
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(jcp.oc * jcp.ic_ph, nthr, ithr, start, end);
+        float *re = work_base + (size_t)ithr * 2 * jcp.lh * jcp.lw;
+        float *im = re + jcp.lh * jcp.lw;
+
+        for (int iwork = start; iwork < end; iwork++) {
+            const int oc = iwork / jcp.ic_ph, c = iwork % jcp.ic_ph;
+            const int ic = c / jcp.nphases;
+            const int ph = (c % jcp.nphases) / jcp.stride_w;
+            const int pw = c % jcp.stride_w;
+            const float *w = weights
+                    + ((size_t)oc * jcp.ic + ic) * jcp.kh * jcp.kw;
+
+            // The phase (ph, pw) of the dilated weights
+            for (int i = 0; i < jcp.lh * jcp.lw; i++)
+                re[i] = 0.f;
+            for (int i = 0; i < jcp.kh_ph; i++) {
+                const int kh = i * jcp.stride_h + ph;
+                if (kh % (jcp.dilate_h + 1) != 0) continue;
+                if (kh / (jcp.dilate_h + 1) >= jcp.kh) continue;
+                for (int j = 0; j < jcp.kw_ph; j++) {
+                    const int kw = j * jcp.stride_w + pw;
+                    if (kw % (jcp.dilate_w + 1) != 0) continue;
+                    if (kw / (jcp.dilate_w + 1) >= jcp.kw) continue;
+                    re[i * jcp.lw + j] = w[kh / (jcp.dilate_h + 1) * jcp.kw
+                            + kw / (jcp.dilate_w + 1)];
+                }
+            }
+            fft_2d.forward(re, im, 0, jcp.kh_ph);
+
+            for (int u = 0; u < jcp.lh; u++)
+                for (int v = 0; v < nv; v++) {
+                    float *bin = bins + (u * nv + v) * bin_sz;
+                    bin[(size_t)c * jcp.oc + oc] = re[u * jcp.lw + v];
+                    bin[(size_t)(jcp.ic_ph + c) * jcp.oc + oc]
+                            = im[u * jcp.lw + v];
+                }
+        }
+    });
+
+    weights_ = tr;
+    return weights_;
+}
+
+void fft_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &jcp = pd()->jcp_;
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    const auto tr_weights = get_transformed_weights(weights, scratchpad);
+    const float *W = tr_weights->bins.data();
+
+    float *X = scratchpad.get<float>(key_conv_fft_inp);
+    float *Y = scratchpad.get<float>(key_conv_fft_out);
+    float *work_base = scratchpad.get<float>(key_conv_fft_work);
+
+    const fft_2d_t fft_2d = {jcp.lh, jcp.lw, tw_h_re_.data(), tw_h_im_.data(),
+            tw_w_re_.data(), tw_w_im_.data()};
+    const int nv = jcp.lw / 2 + 1;
+    const int npts = jcp.lh * jcp.lw;
+    const size_t W_bin_sz = (size_t)2 * jcp.ic_ph * jcp.oc;
+    const size_t X_bin_sz = (size_t)4 * jcp.ic_ph * jcp.tile_block;
+    const size_t Y_bin_sz = (size_t)2 * jcp.oc * jcp.tile_block;
+    const float scale = 1.f / npts;
+
+    for (int tb = 0; tb < jcp.nb_tile_blocks; tb++) {
+        const int tile_s = tb * jcp.tile_block;
+        const int ntiles = nstl::min(jcp.tile_block, jcp.ntiles - tile_s);
+
+        // X[b] (2 * ic_ph x 2 * ntiles) = [Xr Xi; Xi -Xr], column major
+        parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+            int start {0}, end {0};
+            balance211(ntiles * jcp.ic_ph, nthr, ithr, start, end);
+            float *re = work_base + (size_t)ithr * 2 * npts;
+            float *im = re + npts;
+
+            for (int iwork = start; iwork < end; iwork++) {
+                const int t = iwork / jcp.ic_ph, c = iwork % jcp.ic_ph;
+                const int tile = tile_s + t;
+                const int n = tile / (jcp.htiles * jcp.wtiles);
+                const int hi = (tile / jcp.wtiles) % jcp.htiles;
+                const int wi = tile % jcp.wtiles;
+                const int ic = c / jcp.nphases;
+                const int ph = (c % jcp.nphases) / jcp.stride_w;
+                const int pw = c % jcp.stride_w;
+                const float *inp = src
+                        + ((size_t)n * jcp.ic + ic) * jcp.ih * jcp.iw;
+
+                int i_s = jcp.lh, i_e = 0;
+                for (int i = 0; i < npts; i++)
+                    re[i] = 0.f;
+                for (int i = 0; i < jcp.lh; i++) {
+                    const int ih = (hi * jcp.th + i) * jcp.stride_h + ph
+                            - jcp.t_pad;
+                    if (ih < 0 || ih >= jcp.ih) continue;
+                    i_s = nstl::min(i_s, i);
+                    i_e = i + 1;
+                    for (int j = 0; j < jcp.lw; j++) {
+                        const int iw = (wi * jcp.tw + j) * jcp.stride_w + pw
+                                - jcp.l_pad;
+                        if (iw < 0 || iw >= jcp.iw) continue;
+                        re[i * jcp.lw + j] = inp[(size_t)ih * jcp.iw + iw];
+                    }
+                }
+                fft_2d.forward(re, im, i_s, i_e);
+
+                for (int u = 0; u < jcp.lh; u++)
+                    for (int v = 0; v < nv; v++) {
+                        float *x = X + (u * nv + v) * X_bin_sz;
+                        const float x_re = re[u * jcp.lw + v];
+                        const float x_im = im[u * jcp.lw + v];
+                        float *x0 = x + (size_t)t * 2 * jcp.ic_ph;
+                        float *x1 = x + (size_t)(ntiles + t) * 2 * jcp.ic_ph;
+                        x0[c] = x_re;
+                        x0[jcp.ic_ph + c] = x_im;
+                        x1[c] = x_im;
+                        x1[jcp.ic_ph + c] = -x_re;
+                    }
+            }
+        });
+
+        // Y[b] (oc x 2 * ntiles) = W[b] (oc x 2 * ic_ph) * X[b], which is
+        // [Yr Yi] of the products X * conj(W) summed over the channels
+        parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+            int start {0}, end {0};
+            balance211(jcp.nbins, nthr, ithr, start, end);
+            const float one = 1.f, zero = 0.f;
+            const int N = 2 * ntiles, K = 2 * jcp.ic_ph;
+            for (int b = start; b < end; b++)
+                extended_sgemm("N", "N", &jcp.oc, &N, &K, &one,
+                        W + b * W_bin_sz, &jcp.oc, X + b * X_bin_sz, &K, &zero,
+                        Y + b * Y_bin_sz, &jcp.oc);
+        });
+
+        parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+            int start {0}, end {0};
+            balance211(ntiles * jcp.oc, nthr, ithr, start, end);
+            float *re = work_base + (size_t)ithr * 2 * npts;
+            float *im = re + npts;
+
+            for (int iwork = start; iwork < end; iwork++) {
+                const int t = iwork / jcp.oc, oc = iwork % jcp.oc;
+                const int tile = tile_s + t;
+                const int n = tile / (jcp.htiles * jcp.wtiles);
+                const int hi = (tile / jcp.wtiles) % jcp.htiles;
+                const int wi = tile % jcp.wtiles;
+
+                for (int u = 0; u < jcp.lh; u++)
+                    for (int v = 0; v < nv; v++) {
+                        const float *y = Y + (u * nv + v) * Y_bin_sz;
+                        re[u * jcp.lw + v] = y[(size_t)t * jcp.oc + oc];
+                        im[u * jcp.lw + v]
+                                = y[(size_t)(ntiles + t) * jcp.oc + oc];
+                    }
+
+                const int oh_s = hi * jcp.th, ow_s = wi * jcp.tw;
+                const int nrows = nstl::min(jcp.th, jcp.oh - oh_s);
+                const int ncols = nstl::min(jcp.tw, jcp.ow - ow_s);
+                fft_2d.backward(re, im, nrows);
+
+                const float b = jcp.with_bias ? bias[oc] : 0.f;
+                float *out = dst + ((size_t)n * jcp.oc + oc) * jcp.oh * jcp.ow;
+                for (int i = 0; i < nrows; i++)
+                    for (int j = 0; j < ncols; j++) {
+                        float &d = out[(size_t)(oh_s + i) * jcp.ow + ow_s + j];
+                        float val = re[i * jcp.lw + j] * scale + b;
+                        if (sum_scale_ != 0.f) val += sum_scale_ * d;
+                        if (eltwise_) val = eltwise_->compute_scalar(val);
+                        d = val;
+                    }
+            }
+        });
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
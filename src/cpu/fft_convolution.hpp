@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_FFT_CONVOLUTION_HPP
+#define CPU_FFT_CONVOLUTION_HPP
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_convolution_pd.hpp"
+#include "jit_primitive_conf.hpp"
+#include "ref_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* FFT convolution for the large kernels, e.g. of 1D audio and sequence
+ * models.
+ *
+ * The output is split into tiles that are computed with overlap-save: the
+ * lh x lw segment of the input of a tile and the weights are transformed with
+ * a 2D FFT, the transforms are multiplied point-wise and the product is
+ * transformed back. The point-wise products of all the channels form, for
+ * each frequency bin, a complex matrix product that is done with the real
+ * GEMM. The strides are handled by splitting the input and the weights into
+ * the stride_h * stride_w phases, each of them a convolution with unit
+ * stride. The transformed weights are kept by the primitive and recomputed
+ * only when the weights change. */
+namespace fft_convolution_utils {
+
+status_t init_conf(jit_conv_fft_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d, int max_threads);
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_conv_fft_conf_t &jcp);
+
+// Returns an estimate of the cost of the FFT convolution and of the direct
+// one, in flops of the direct convolution
+double fft_cost(const jit_conv_fft_conf_t &jcp);
+double direct_cost(const jit_conv_fft_conf_t &jcp);
+
+} // namespace fft_convolution_utils
+
+struct fft_convolution_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(engine_t *engine, const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T("fft:any", fft_convolution_fwd_t);
+
+        status_t init() {
+            using namespace data_type;
+            using namespace format_tag;
+            const bool is_1d = ndims() == 3;
+            const auto dat_tag = is_1d ? ncw : nchw;
+            const auto wei_tag = is_1d ? oiw : oihw;
+
+            bool ok = true && is_fwd() && utils::one_of(ndims(), 3, 4)
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_fft)
+                    && expect_data_types(f32, f32, f32, f32, f32)
+                    && !has_zero_dim_memory()
+                    && attr()->output_scales_.has_default_values()
+                    && post_ops_ok()
+                    && set_default_formats_common(dat_tag, wei_tag, dat_tag)
+                    && memory_desc_matches_tag(*src_md(), dat_tag)
+                    && memory_desc_matches_tag(*weights_md(), wei_tag)
+                    && memory_desc_matches_tag(*dst_md(), dat_tag)
+                    && IMPLICATION(with_bias(),
+                            memory_desc_matches_tag(*weights_md(1), x));
+            if (!ok) return status::unimplemented;
+
+            status_t status = fft_convolution_utils::init_conf(jcp_, *desc(),
+                    src_md(), weights_md(), dst_md(), dnnl_get_max_threads());
+            if (status != status::success) return status;
+
+            // The auto algorithm takes the FFT only when it is expected to
+            // be faster than the direct convolution
+            if (desc()->alg_kind == alg_kind::convolution_auto
+                    && fft_convolution_utils::fft_cost(jcp_)
+                            >= fft_convolution_utils::direct_cost(jcp_))
+                return status::unimplemented;
+            set_default_alg_kind(alg_kind::convolution_fft);
+
+            auto scratchpad = scratchpad_registry().registrar();
+            fft_convolution_utils::init_scratchpad(scratchpad, jcp_);
+
+            return status::success;
+        }
+
+        jit_conv_fft_conf_t jcp_;
+
+    protected:
+        bool post_ops_ok() const {
+            auto const &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+            auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(); };
+
+            switch (po.len_) {
+                case 0: return true; // no post_ops
+                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+                default: return false;
+            }
+            return false;
+        }
+    };
+
+    fft_convolution_fwd_t(const pd_t *apd);
+    ~fft_convolution_fwd_t() { delete eltwise_; }
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    // The transformed weights and a copy of the weights they were made of
+    struct transformed_weights_t {
+        std::vector<float> weights;
+        std::vector<float> bins; // nbins x (oc x 2 * ic_ph), column major
+    };
+
+    void execute_forward(const exec_ctx_t &ctx) const;
+    std::shared_ptr<const transformed_weights_t> get_transformed_weights(
+            const float *weights,
+            const memory_tracking::grantor_t &scratchpad) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    float sum_scale_;
+    ref_eltwise_scalar_fwd_t *eltwise_;
+
+    // The twiddle factors exp(-2 pi i k / n), k < n / 2, of the FFT sizes
+    std::vector<float> tw_h_re_, tw_h_im_, tw_w_re_, tw_w_im_;
+
+    mutable std::mutex weights_mutex_;
+    mutable std::shared_ptr<const transformed_weights_t> weights_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
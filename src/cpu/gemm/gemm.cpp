@@ -238,6 +238,51 @@ dnnl_status_t gemm_s8x8s32(const char *transa, const char *transb,
     return status;
 }
 
+namespace {
+// bf16 storage with f32 compute for the machines without avx512_core: the
+// matrices are up-converted with the bulk converters and multiplied by the
+// f32 gemm
+dnnl_status_t gemm_bf16bf16f32_cvt(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const bfloat16_t *A, const int *lda, const bfloat16_t *B,
+        const int *ldb, const float *beta, float *C, const int *ldc) {
+    const bool tr_a = utils::one_of(*transa, 't', 'T');
+    const bool tr_b = utils::one_of(*transb, 't', 'T');
+    const int a_rows = tr_a ? *K : *M, a_cols = tr_a ? *M : *K;
+    const int b_rows = tr_b ? *N : *K, b_cols = tr_b ? *K : *N;
+
+    const size_t a_size = (size_t)a_rows * a_cols;
+    const size_t b_size = (size_t)b_rows * b_cols;
+    float *A_f32 = (float *)malloc(
+            sizeof(float) * nstl::max(a_size, (size_t)1), PAGE_4K);
+    float *B_f32 = (float *)malloc(
+            sizeof(float) * nstl::max(b_size, (size_t)1), PAGE_4K);
+    if (utils::any_null(A_f32, B_f32)) {
+        free(A_f32);
+        free(B_f32);
+        return dnnl_out_of_memory;
+    }
+
+    auto up_convert = [](float *out, const bfloat16_t *inp, int rows,
+                              int cols, int ld) {
+        parallel_nd(cols, [&](int j) {
+            cvt_bfloat16_to_float(
+                    out + (size_t)j * rows, inp + (size_t)j * ld, rows);
+        });
+    };
+    up_convert(A_f32, A, a_rows, a_cols, *lda);
+    up_convert(B_f32, B, b_rows, b_cols, *ldb);
+
+    const int lda_f32 = nstl::max(1, a_rows), ldb_f32 = nstl::max(1, b_rows);
+    dnnl_status_t status = extended_sgemm(transa, transb, M, N, K, alpha,
+            A_f32, &lda_f32, B_f32, &ldb_f32, beta, C, ldc);
+
+    free(A_f32);
+    free(B_f32);
+    return status;
+}
+} // namespace
+
 dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const int64_t *M, const int64_t *N, const int64_t *K,
         const float *alpha, const bfloat16_t *A, const int64_t *lda,
@@ -263,6 +308,9 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
                 alpha, (const bfloat16_t *)A, &lda_s32, dummy_ao,
                 (const bfloat16_t *)B, &ldb_s32, dummy_bo, beta, (float *)C,
                 &ldc_s32, dummy_co, false);
+    } else if (mayiuse(avx2)) {
+        return gemm_bf16bf16f32_cvt(transa, transb, &M_s32, &N_s32, &K_s32,
+                alpha, A, &lda_s32, B, &ldb_s32, beta, C, &ldc_s32);
     } else {
         return dnnl_unimplemented;
     }
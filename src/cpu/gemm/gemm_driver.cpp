@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <cstdint>
+#include <unordered_map>
 #if defined(_MSC_VER)
 #include <malloc.h>
 #endif
@@ -29,6 +30,7 @@
 #include "f32/jit_avx_gemm_f32.hpp"
 #include "gemm_info.hpp"
 #include "gemm_partition.hpp"
+#include "gemm_profile.hpp"
 #include "gemm_threading.hpp"
 #include "gemv_driver.hpp"
 #include "jit_generator.hpp"
@@ -531,6 +533,23 @@ void gemm_kernel(const dim_t m, const dim_t n, const dim_t k, const float alpha,
     }
 }
 
+// Returns the copy buffers of the calling thread. They are kept between the
+// calls, so that the kernel drivers do not allocate memory on every call.
+static char *get_thread_workspace(size_t size) {
+    static thread_local struct workspace_t {
+        char *ptr = nullptr;
+        size_t size = 0;
+        ~workspace_t() { free(ptr); }
+    } ws;
+
+    if (size > ws.size) {
+        free(ws.ptr);
+        ws.ptr = (char *)malloc(size, 128);
+        ws.size = ws.ptr ? size : 0;
+    }
+    return ws.ptr;
+}
+
 template <typename a_type, typename b_type, typename c_type>
 static dnnl_status_t gemm_kernel_driver(int ithr, dim_t m, dim_t n, dim_t k,
         const a_type *a, const b_type *b, float beta, c_type *c, dim_t ldc,
@@ -605,7 +624,7 @@ static dnnl_status_t gemm_kernel_driver(int ithr, dim_t m, dim_t n, dim_t k,
     char *mem = NULL;
 
     if (mem_size > 0) {
-        mem = (char *)malloc(mem_size, 128);
+        mem = get_thread_workspace(mem_size);
         if (!mem) return dnnl_out_of_memory;
     }
 
@@ -736,8 +755,6 @@ static dnnl_status_t gemm_kernel_driver(int ithr, dim_t m, dim_t n, dim_t k,
         }
     }
 
-    free(mem);
-
     return dnnl_success;
 }
 
@@ -787,7 +804,7 @@ static dnnl_status_t kernel_driver_parallel_acopiedbcopy(int ithr, dim_t m,
     char *mem = NULL;
 
     if (mem_size > 0) {
-        mem = (char *)malloc(mem_size, 128);
+        mem = get_thread_workspace(mem_size);
         if (!mem) return dnnl_out_of_memory;
     }
 
@@ -847,8 +864,6 @@ static dnnl_status_t kernel_driver_parallel_acopiedbcopy(int ithr, dim_t m,
         }
     }
 
-    free(mem);
-
     return dnnl_success;
 }
 
@@ -1464,6 +1479,126 @@ static dnnl_status_t call_no_copy_sgemm(
         return pack_no_copy(arg);
 }
 
+// Threading decisions for a non-packed GEMM. They depend only on the GEMM
+// signature, the number of threads and the tuning profile, so they are
+// memoized per signature.
+struct gemm_plan_t {
+    int nthr_goal;
+    bool no_copy;
+    int nthr_opt; // the number of threads used by thread_info
+    gemm_threading_t thread_info; // valid if nthr_goal > 1 and !no_copy
+    bool forced; // thread_info comes from the profile and must be used as is
+    int profile_version;
+};
+
+struct gemm_plan_key_t {
+    int transa, transb;
+    offset_type offsetc;
+    dim_t m, n, k;
+    dim_t lda, ldb, ldc;
+    int nthr_max;
+    bool force_nocopy;
+
+    bool operator==(const gemm_plan_key_t &rhs) const {
+        return transa == rhs.transa && transb == rhs.transb
+                && offsetc == rhs.offsetc && m == rhs.m && n == rhs.n
+                && k == rhs.k && lda == rhs.lda && ldb == rhs.ldb
+                && ldc == rhs.ldc && nthr_max == rhs.nthr_max
+                && force_nocopy == rhs.force_nocopy;
+    }
+};
+
+struct gemm_plan_key_hash_t {
+    size_t operator()(const gemm_plan_key_t &key) const {
+        size_t seed = 0;
+        auto combine = [&](size_t v) {
+            seed ^= v + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+        combine(key.transa);
+        combine(key.transb);
+        combine(static_cast<size_t>(key.offsetc));
+        combine(key.m);
+        combine(key.n);
+        combine(key.k);
+        combine(key.lda);
+        combine(key.ldb);
+        combine(key.ldc);
+        combine(key.nthr_max);
+        combine(key.force_nocopy);
+        return seed;
+    }
+};
+
+// Looks up the threading of the problem in the tuning profile. The block
+// sizes are aligned the way the driver expects them.
+template <typename a_type, typename b_type, typename c_type>
+static bool get_profile_threading(int nthr_max, gemm_threading_t &thread_info,
+        const gemm_info_t<a_type, b_type, c_type> *arg) {
+    constexpr bool is_int8 = (data_traits<a_type>::data_type == data_type::s8);
+
+    if (!gemm_profile_find(data_traits<a_type>::data_type,
+                data_traits<b_type>::data_type, arg->transa, arg->transb,
+                arg->m, arg->n, arg->k, nthr_max, thread_info))
+        return false;
+
+    // The no-copy kernels of the parallel section do not apply the offsets
+    if (thread_info.copy == copy_type::no_copy
+            && (!mayiuse(avx) || arg->offsetc != offset_type::none))
+        return false;
+    if (thread_info.copy == copy_type::shared_a && !dnnl_thr_syncable())
+        return false;
+
+    auto align = [](int &block, dim_t unroll) {
+        if (block > 0) block = (int)utils::rnd_up(block, unroll);
+    };
+    align(thread_info.block_m, is_int8 ? 16 : get_vector_length<a_type>());
+    align(thread_info.block_n, arg->un);
+    align(thread_info.block_k, nstl::max(arg->uk, dim_t(4)));
+    return true;
+}
+
+// The plans are kept per calling thread and per data types, so no lock is
+// taken. A thread keeps at most max_plans of them.
+template <typename a_type, typename b_type, typename c_type>
+static const gemm_plan_t &get_gemm_plan(
+        int nthr_max, const gemm_info_t<a_type, b_type, c_type> *arg) {
+    enum { max_plans = 1024 };
+    static thread_local std::unordered_map<gemm_plan_key_t, gemm_plan_t,
+            gemm_plan_key_hash_t>
+            plans;
+
+    const gemm_plan_key_t key = {arg->transa, arg->transb, arg->offsetc,
+            arg->m, arg->n, arg->k, arg->lda, arg->ldb, arg->ldc, nthr_max,
+            arg->force_nocopy};
+
+    const int profile_version = gemm_profile_version();
+    auto it = plans.find(key);
+    if (it != plans.end() && it->second.profile_version == profile_version)
+        return it->second;
+
+    gemm_plan_t plan;
+    plan.profile_version = profile_version;
+    plan.forced = get_profile_threading(nthr_max, plan.thread_info, arg);
+    if (plan.forced) {
+        plan.nthr_goal = plan.nthr_opt = plan.thread_info.nthrs();
+        // A single thread runs the kernels directly, not in the threading
+        plan.no_copy = plan.nthr_goal == 1
+                && plan.thread_info.copy == copy_type::no_copy;
+    } else {
+        plan.nthr_goal = nthr_max;
+        adjust_thread_count<c_type>(arg->m, arg->n, arg->k, &plan.nthr_goal);
+        plan.no_copy = nocopy_checker(plan.nthr_goal, arg);
+        plan.nthr_opt = 1;
+        if (!plan.no_copy && plan.nthr_goal > 1)
+            plan.nthr_opt
+                    = set_thread_opts(plan.nthr_goal, plan.thread_info, arg);
+    }
+
+    if (it != plans.end()) return it->second = plan;
+    if (plans.size() >= max_plans) plans.clear();
+    return plans.emplace(key, plan).first->second;
+}
+
 template <typename a_type, typename b_type, typename c_type>
 static dnnl_status_t gemm_threading_driver(
         gemm_info_t<a_type, b_type, c_type> *arg) {
@@ -1492,10 +1627,20 @@ static dnnl_status_t gemm_threading_driver(
     auto nthr_max = (dnnl_in_parallel()) ? 1 : dnnl_get_max_threads();
     int nthr_goal = nthr_max;
 
-    adjust_thread_count<c_type>(arg->m, arg->n, arg->k, &nthr_goal);
+    const gemm_plan_t *plan = nullptr;
+    if (!packing && !is_a_packed && !is_b_packed) {
+        plan = &get_gemm_plan(nthr_max, arg);
+        nthr_goal = plan->nthr_goal;
+    } else
+        adjust_thread_count<c_type>(arg->m, arg->n, arg->k, &nthr_goal);
 
     const gemm_threading_t *force_threading = nullptr;
 
+    if (plan && plan->forced) {
+        force_threading = &plan->thread_info;
+        arg->update_blocking(*force_threading);
+    }
+
     if (!packing) {
         // Override choice of thread count if data is pre-packed for a particular
         //  number of threads.
@@ -1557,7 +1702,8 @@ static dnnl_status_t gemm_threading_driver(
         if (arg->measure_only) return dnnl_success;
     }
 
-    if (nocopy_checker(nthr_goal, arg)) return call_no_copy_sgemm(arg);
+    if (plan ? plan->no_copy : nocopy_checker(nthr_goal, arg))
+        return call_no_copy_sgemm(arg);
 
     if (nthr_goal == 1)
         return gemm_kernel_driver(0, arg->m, arg->n, arg->k, arg->a, arg->b,
@@ -1629,7 +1775,11 @@ static dnnl_status_t gemm_threading_driver(
             if (force_threading)
                 thread_info = *force_threading;
             else {
-                nthr_eff = set_thread_opts(nthr_eff, thread_info, arg);
+                if (plan && nthr_eff == plan->nthr_goal) {
+                    thread_info = plan->thread_info;
+                    nthr_eff = plan->nthr_opt;
+                } else
+                    nthr_eff = set_thread_opts(nthr_eff, thread_info, arg);
                 thread_arg[ithr].slice = thread_info.get_thread_slice(
                         ithr, arg->m, arg->n, arg->k);
             }
@@ -0,0 +1,237 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+#include "gemm_info.hpp"
+#include "gemm_profile.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+struct entry_t {
+    data_type_t a_dt, b_dt;
+    int transa, transb;
+    dim_t m, n, k;
+    int nthr;
+    gemm_threading_t thread_info;
+};
+
+std::mutex profile_mutex;
+std::vector<entry_t> profile;
+std::atomic<bool> profile_initialized(false);
+std::atomic<int> profile_version(0);
+
+bool parse_types(const char *str, data_type_t &a_dt, data_type_t &b_dt) {
+    using namespace data_type;
+    if (!strcmp(str, "f32")) {
+        a_dt = b_dt = f32;
+    } else if (!strcmp(str, "bf16")) {
+        a_dt = b_dt = bf16;
+    } else if (!strcmp(str, "s8u8")) {
+        a_dt = s8;
+        b_dt = u8;
+    } else if (!strcmp(str, "s8s8")) {
+        a_dt = b_dt = s8;
+    } else
+        return false;
+    return true;
+}
+
+bool parse_trans(char c, int &trans) {
+    if (c != 'N' && c != 'n' && c != 'T' && c != 't') return false;
+    trans = (c == 'N' || c == 'n') ? no_trans : do_trans;
+    return true;
+}
+
+bool parse_partition(const char *str, partition_type &partition) {
+    if (!strcmp(str, "row_1d"))
+        partition = partition_type::row_1d;
+    else if (!strcmp(str, "col_1d"))
+        partition = partition_type::col_1d;
+    else if (!strcmp(str, "col_major_2d"))
+        partition = partition_type::col_major_2d;
+    else if (!strcmp(str, "mnk_3d"))
+        partition = partition_type::mnk_3d;
+    else
+        return false;
+    return true;
+}
+
+bool parse_copy(const char *str, copy_type &copy) {
+    if (!strcmp(str, "nonshared"))
+        copy = copy_type::nonshared;
+    else if (!strcmp(str, "shared_a"))
+        copy = copy_type::shared_a;
+    else if (!strcmp(str, "no_copy"))
+        copy = copy_type::no_copy;
+    else
+        return false;
+    return true;
+}
+
+// Parses a line of the profile. Returns false if the line is malformed or
+// describes a threading the GEMM driver does not support.
+bool parse_entry(const char *line, entry_t &e) {
+    char types[8], transa, transb, partition[16], copy[16];
+    long long m, n, k;
+    int nthrs_m, nthrs_n, nthrs_k, block_m, block_n, block_k;
+    int nitems = sscanf(line,
+            "%7s %c %c %lld %lld %lld %d %d %d %d %15s %15s %d %d %d", types,
+            &transa, &transb, &m, &n, &k, &e.nthr, &nthrs_m, &nthrs_n,
+            &nthrs_k, partition, copy, &block_m, &block_n, &block_k);
+    if (nitems != 15) return false;
+
+    auto &ti = e.thread_info;
+    bool ok = parse_types(types, e.a_dt, e.b_dt)
+            && parse_trans(transa, e.transa) && parse_trans(transb, e.transb)
+            && parse_partition(partition, ti.partition)
+            && parse_copy(copy, ti.copy);
+    if (!ok) return false;
+
+    e.m = m;
+    e.n = n;
+    e.k = k;
+    ti.nthrs_m = nthrs_m;
+    ti.nthrs_n = nthrs_n;
+    ti.nthrs_k = nthrs_k;
+    ti.block_m = block_m;
+    ti.block_n = block_n;
+    ti.block_k = block_k;
+    ti.thread_m = ti.thread_n = ti.thread_k = -1;
+
+    if (e.m <= 0 || e.n <= 0 || e.k <= 0) return false;
+    if (nthrs_m < 1 || nthrs_n < 1 || nthrs_k < 1) return false;
+    if (ti.nthrs() > e.nthr) return false;
+
+    switch (ti.partition) {
+        case partition_type::row_1d: ok = nthrs_n == 1 && nthrs_k == 1; break;
+        case partition_type::col_1d: ok = nthrs_m == 1 && nthrs_k == 1; break;
+        case partition_type::col_major_2d: ok = nthrs_k == 1; break;
+        case partition_type::mnk_3d: ok = true; break;
+    }
+    // The copy strategies come with the partitions the driver uses them with
+    if (ti.copy == copy_type::shared_a)
+        ok = ok && ti.partition == partition_type::col_1d;
+    if (ti.copy == copy_type::no_copy)
+        ok = ok && ti.partition == partition_type::mnk_3d
+                && e.a_dt == data_type::f32;
+    return ok;
+}
+
+// Must be called with profile_mutex held
+status_t load_locked(const char *path) {
+    profile.clear();
+    if (path == NULL || *path == '\0') return status::success;
+
+    FILE *f = impl::fopen(path, "r");
+    if (!f) return status::invalid_arguments;
+
+    status_t status = status::success;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        const char *p = line;
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0') continue;
+
+        entry_t e;
+        if (!parse_entry(p, e)) {
+            status = status::invalid_arguments;
+            break;
+        }
+        profile.push_back(e);
+    }
+    fclose(f);
+
+    if (status != status::success) profile.clear();
+    return status;
+}
+
+void init_profile() {
+    if (profile_initialized.load()) return;
+
+    std::lock_guard<std::mutex> guard(profile_mutex);
+    if (profile_initialized.load()) return;
+
+    char path[1024];
+    if (getenv("DNNL_GEMM_PROFILE", path, sizeof(path)) > 0)
+        load_locked(path);
+    profile_initialized.store(true);
+}
+
+} // namespace
+
+bool gemm_profile_find(data_type_t a_dt, data_type_t b_dt, int transa,
+        int transb, dim_t m, dim_t n, dim_t k, int nthr,
+        gemm_threading_t &thread_info) {
+    init_profile();
+
+    std::lock_guard<std::mutex> guard(profile_mutex);
+    for (const auto &e : profile) {
+        if (e.a_dt != a_dt || e.b_dt != b_dt || e.transa != transa
+                || e.transb != transb || e.m != m || e.n != n || e.k != k
+                || e.nthr != nthr)
+            continue;
+
+        thread_info = e.thread_info;
+        if (thread_info.partition == partition_type::mnk_3d) {
+            // Every thread gets an equal non-empty part of each dimension
+            auto split = [](dim_t size, int &nthr_z, dim_t &thread_z) {
+                thread_z = utils::div_up(size, nthr_z);
+                nthr_z = (int)utils::div_up(size, thread_z);
+            };
+            split(m, thread_info.nthrs_m, thread_info.thread_m);
+            split(n, thread_info.nthrs_n, thread_info.thread_n);
+            split(k, thread_info.nthrs_k, thread_info.thread_k);
+        }
+        return true;
+    }
+    return false;
+}
+
+int gemm_profile_version() {
+    init_profile();
+    return profile_version.load();
+}
+
+status_t gemm_profile_load(const char *path) {
+    std::lock_guard<std::mutex> guard(profile_mutex);
+    status_t status = load_locked(path);
+    profile_initialized.store(true);
+    profile_version++;
+    return status;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_set_gemm_profile(const char *path) {
+    return dnnl::impl::cpu::gemm_profile_load(path);
+}
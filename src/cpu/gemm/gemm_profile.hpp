@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GEMM_PROFILE_HPP
+#define GEMM_PROFILE_HPP
+
+#include "c_types_map.hpp"
+#include "gemm_threading.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// GEMM tuning profile: the threading and blocking parameters measured to be
+// the best for particular problems, e.g. by the gemm_tune driver of benchdnn.
+// The profile is read from the file named by the DNNL_GEMM_PROFILE
+// environment variable, or from the one set with dnnl_set_gemm_profile().
+//
+// Each line of the file, except the empty ones and the comments starting
+// with '#', describes a problem in the column-major terms of the GEMM driver:
+//   TYPE TRANSA TRANSB M N K NTHR NTHRS_M NTHRS_N NTHRS_K PARTITION COPY
+//   BLOCK_M BLOCK_N BLOCK_K
+// where TYPE is f32, bf16, s8u8 or s8s8 (the types of A and B), TRANSA and
+// TRANSB are N or T, NTHR is the maximal number of threads of the call,
+// PARTITION is row_1d, col_1d, col_major_2d or mnk_3d, COPY is nonshared,
+// shared_a or no_copy, and a block size of -1 keeps the default one.
+
+// Looks up the parameters of the problem, returns false if the profile has
+// none. The thread sizes of the mnk_3d partition are set as well.
+bool gemm_profile_find(data_type_t a_dt, data_type_t b_dt, int transa,
+        int transb, dim_t m, dim_t n, dim_t k, int nthr,
+        gemm_threading_t &thread_info);
+
+// Returns the number of times the profile was changed, so that the
+// decisions based on it can be invalidated.
+int gemm_profile_version();
+
+// Replaces the profile with the one from the file, or clears it if path is
+// NULL or empty. The profile is left empty if the file is malformed.
+status_t gemm_profile_load(const char *path);
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -61,30 +61,36 @@ gemm_bf16_convolution_fwd_t<dst_data_type>::pp_ker_t::pp_ker_t(const pd_t *pd)
     , compute_reg_step_(1)
     , data_reg_base_idx_(0)
     , bf16_emu_(nullptr)
-    , eltwise_injector_(nullptr) {
+    , eltwise_injector_(nullptr)
+    , ref_eltwise_(nullptr) {
     using namespace types;
     using namespace Xbyak;
 
-    if (!mayiuse(avx512_core))
-        // bf16 is not supported
-        return;
-
     auto &post_ops = pd->attr()->post_ops_;
     const int eltwise_ind = post_ops.find(primitive_kind::eltwise);
     do_eltwise_ = eltwise_ind != -1;
+    do_sum_ = dst_data_type != data_type::f32
+            && post_ops.contain(primitive_kind::sum, 0);
+    do_bias_ = pd->with_bias();
+
+    if (!mayiuse(avx512_core)) {
+        // use the fallback code, the configuration above is used by it
+        if (do_eltwise_)
+            ref_eltwise_ = new ref_eltwise_scalar_fwd_t(
+                    post_ops.entry_[eltwise_ind].eltwise);
+        return;
+    }
+
     if (do_eltwise_)
         eltwise_injector_ = new jit_uni_eltwise_injector_f32<avx512_common>(
                 this, post_ops.entry_[eltwise_ind].eltwise, true,
                 reserved_eltwise_gpr, reserved_eltwise_maskr);
 
-    do_sum_ = dst_data_type != data_type::f32
-            && post_ops.contain(primitive_kind::sum, 0);
     if (do_sum_) {
         compute_reg_step_ = 2;
         vreg_sum_scale = Zmm(data_reg_base_idx_++);
     }
 
-    do_bias_ = pd->with_bias();
     if (do_bias_) vreg_bias = Zmm(data_reg_base_idx_++);
 
     vlen_ = cpu_isa_traits<avx512_common>::vlen / sizeof(float);
@@ -250,9 +256,36 @@ void gemm_bf16_convolution_fwd_t<dst_data_type>::pp_ker_t::operator()(
         dst_data_t *dst, const acc_data_t *acc, const acc_data_t *bias,
         float sum_scale, size_t dst_stride_in_elements,
         size_t acc_stride_in_elements, size_t len, bool do_parallel) {
-    assert(ker_);
     if (len == 0) return;
 
+    if (!ker_) {
+        // the fallback code: post-processing is done in f32 by blocks that
+        // are stored to dst with the bulk conversion
+        parallel(do_parallel ? 0 : 1, [&](const int ithr, const int nthr) {
+            size_t start_oc = 0, end_oc = 0;
+            balance211(OC_, nthr, ithr, start_oc, end_oc);
+            for (size_t oc = start_oc; oc < end_oc; oc++) {
+                const acc_data_t *a = acc + oc * acc_stride_in_elements;
+                dst_data_t *d = dst + oc * dst_stride_in_elements;
+                const float b = do_bias_ ? bias[oc] : 0.f;
+                for (size_t s = 0; s < len; s += pp_block) {
+                    const size_t block = nstl::min((size_t)pp_block, len - s);
+                    float buf[pp_block];
+                    for (size_t i = 0; i < block; i++)
+                        buf[i] = a[s + i] + b;
+                    if (do_sum_)
+                        for (size_t i = 0; i < block; i++)
+                            buf[i] += sum_scale * (float)d[s + i];
+                    if (do_eltwise_)
+                        for (size_t i = 0; i < block; i++)
+                            buf[i] = ref_eltwise_->compute_scalar(buf[i]);
+                    store(d + s, buf, block);
+                }
+            }
+        });
+        return;
+    }
+
     parallel(do_parallel ? 0 : 1, [&](const int ithr, const int nthr) {
         size_t start_oc = 0, end_oc = 0;
         balance211(OC_, nthr, ithr, start_oc, end_oc);
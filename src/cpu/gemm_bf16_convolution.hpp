@@ -27,6 +27,7 @@
 #include "gemm_convolution_utils.hpp"
 #include "jit_avx512_core_bf16cvt.hpp"
 #include "jit_uni_eltwise.hpp"
+#include "ref_eltwise.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -41,8 +42,7 @@ struct gemm_bf16_convolution_fwd_t : public primitive_impl_t {
             : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
             , jcp_() {}
 
-        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_bf16_convolution_fwd_t,
-                USE_GLOBAL_SCRATCHPAD);
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_bf16_convolution_fwd_t);
 
         status_t init() {
             bool ok = true && is_fwd()
@@ -146,6 +146,7 @@ private:
         ~pp_ker_t() {
             delete bf16_emu_;
             delete eltwise_injector_;
+            delete ref_eltwise_;
         }
 
         void operator()(dst_data_t *dst, const acc_data_t *acc,
@@ -165,6 +166,15 @@ private:
         };
 
         enum { default_unroll_2_pow_ = 2 };
+        // size of the blocks processed by the fallback code
+        enum { pp_block = 256 };
+
+        static void store(float *d, const float *buf, size_t n) {
+            utils::array_copy(d, buf, n);
+        }
+        static void store(bfloat16_t *d, const float *buf, size_t n) {
+            cvt_float_to_bfloat16(d, buf, n);
+        }
 
         Xbyak::Reg64 reg_param = abi_param1;
         Xbyak::Reg64 reg_dst_base = rdx;
@@ -206,6 +216,7 @@ private:
         cpu_isa_t isa_;
         bf16_emulation_t *bf16_emu_;
         jit_uni_eltwise_injector_f32<avx512_common> *eltwise_injector_;
+        ref_eltwise_scalar_fwd_t *ref_eltwise_;
 
         void generate();
         int vreg_dst_idx(int iter) {
@@ -249,8 +260,7 @@ struct gemm_bf16_convolution_bwd_data_t : public primitive_impl_t {
             : cpu_convolution_bwd_data_pd_t(engine, adesc, attr, hint_fwd_pd)
             , jcp_() {}
 
-        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_bf16_convolution_bwd_data_t,
-                USE_GLOBAL_SCRATCHPAD);
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_bf16_convolution_bwd_data_t);
 
         status_t init() {
             bool ok = true && desc()->prop_kind == prop_kind::backward_data
@@ -312,8 +322,7 @@ struct gemm_bf16_convolution_bwd_weights_t : public primitive_impl_t {
             : cpu_convolution_bwd_weights_pd_t(engine, adesc, attr, hint_fwd_pd)
             , jcp_() {}
 
-        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_bf16_convolution_bwd_weights_t,
-                USE_GLOBAL_SCRATCHPAD);
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_bf16_convolution_bwd_weights_t);
 
         status_t init() {
             bool ok = true && desc()->prop_kind == prop_kind::backward_weights
@@ -42,7 +42,7 @@ struct gemm_bf16_inner_product_fwd_t : public primitive_impl_t {
             using namespace utils;
             using namespace data_type;
 
-            bool ok = true && mayiuse(avx512_core) && is_fwd()
+            bool ok = true && mayiuse(avx2) && is_fwd()
                     && !has_zero_dim_memory()
                     && everyone_is(
                             bf16, src_md()->data_type, weights_md()->data_type)
@@ -139,7 +139,7 @@ struct gemm_bf16_inner_product_bwd_data_t : public primitive_impl_t {
         status_t init() {
             using namespace data_type;
 
-            bool ok = true && mayiuse(avx512_core)
+            bool ok = true && mayiuse(avx2)
                     && desc()->prop_kind == prop_kind::backward_data
                     && !has_zero_dim_memory()
                     && utils::everyone_is(bf16, weights_md()->data_type,
@@ -202,7 +202,7 @@ struct gemm_bf16_inner_product_bwd_weights_t : public primitive_impl_t {
             using namespace utils;
             using namespace data_type;
 
-            bool ok = true && mayiuse(avx512_core)
+            bool ok = true && mayiuse(avx2)
                     && desc()->prop_kind == prop_kind::backward_weights
                     && !has_zero_dim_memory()
                     && everyone_is(
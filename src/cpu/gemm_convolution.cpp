@@ -53,6 +53,17 @@ void gemm_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
 
     const jit_gemm_conv_conf_t &jcp = this->pd()->jcp_;
 
+    const data_t *binary_src1 = nullptr;
+    dim_t src1_stride_mb = 0, src1_stride_c = 0, src1_stride_sp = 0;
+    if (binary_) {
+        const auto &po = pd()->attr()->post_ops_;
+        binary_src1 = CTX_IN_MEM(const data_t *,
+                DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1);
+        binary_post_op_src1_strides(
+                po.entry_[po.find(primitive_kind::binary)].binary.src1_desc,
+                src1_stride_mb, src1_stride_c, src1_stride_sp);
+    }
+
     const size_t src_step = jcp.ic * jcp.ih * jcp.iw * jcp.id;
     const size_t weights_oc_size = jcp.ic * jcp.ks;
     const size_t weights_g_size = weights_oc_size * jcp.oc;
@@ -148,6 +159,19 @@ void gemm_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
                         }
                     });
                 }
+                if (binary_) {
+                    const dim_t sp_start = curr.od * jcp.os + curr.sp;
+                    parallel_nd(step.oc, [&](const int oc) {
+                        const data_t *s1_ = binary_src1
+                                + curr.n * src1_stride_mb
+                                + (oc_start + oc) * src1_stride_c
+                                + sp_start * src1_stride_sp;
+                        data_t *d_ = _dst + oc * M;
+                        for (int oS = 0; oS < m; ++oS)
+                            d_[oS] = binary_->compute_scalar(
+                                    d_[oS], s1_[oS * src1_stride_sp]);
+                    });
+                }
             }
         };
         im_pos_t start, end;
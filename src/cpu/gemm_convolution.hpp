@@ -22,6 +22,7 @@
 
 #include "gemm/gemm.hpp"
 #include "gemm_convolution_utils.hpp"
+#include "ref_binary.hpp"
 #include "ref_eltwise.hpp"
 
 #include "cpu_convolution_pd.hpp"
@@ -38,8 +39,7 @@ struct gemm_convolution_fwd_t : public primitive_impl_t {
             : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
             , jcp_() {}
 
-        DECLARE_COMMON_PD_T(
-                GEMM_IMPL_STR, gemm_convolution_fwd_t, USE_GLOBAL_SCRATCHPAD);
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_convolution_fwd_t);
 
         status_t init() {
             bool ok = true && is_fwd()
@@ -61,6 +61,8 @@ struct gemm_convolution_fwd_t : public primitive_impl_t {
                     dnnl_get_max_threads());
         }
 
+        virtual bool supports_binary_post_op() const override { return true; }
+
         jit_gemm_conv_conf_t jcp_;
 
     protected:
@@ -80,19 +82,24 @@ struct gemm_convolution_fwd_t : public primitive_impl_t {
             auto is_eltwise
                     = [&](int idx) { return po.entry_[idx].is_eltwise(); };
             auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(); };
-
-            switch (po.len_) {
-                case 0: return true; // no post_ops
-                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
-                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
-                default: return false;
-            }
-            return false;
+            auto is_binary = [&](int idx) {
+                return po.entry_[idx].is_binary()
+                        && binary_post_op_src1_ok(
+                                po.entry_[idx].binary.src1_desc, *dst_md(),
+                                dat_tag());
+            };
+
+            // (sum)? -> (eltwise)? -> (binary)?
+            int idx = 0;
+            if (idx < po.len_ && is_sum(idx)) idx++;
+            if (idx < po.len_ && is_eltwise(idx)) idx++;
+            if (idx < po.len_ && is_binary(idx)) idx++;
+            return idx == po.len_;
         }
     };
 
     gemm_convolution_fwd_t(const pd_t *apd)
-        : primitive_impl_t(apd), eltwise_(nullptr) {
+        : primitive_impl_t(apd), eltwise_(nullptr), binary_(nullptr) {
         const auto &post_ops = pd()->attr()->post_ops_;
         const data_t one = 1.0, zero = 0.0;
         beta_ = post_ops.find(primitive_kind::sum) >= 0 ? one : zero;
@@ -101,9 +108,17 @@ struct gemm_convolution_fwd_t : public primitive_impl_t {
         if (entry_idx != -1)
             eltwise_ = new ref_eltwise_scalar_fwd_t(
                     post_ops.entry_[entry_idx].eltwise);
+
+        const int binary_idx = post_ops.find(primitive_kind::binary);
+        if (binary_idx != -1)
+            binary_ = new ref_binary_scalar_t(
+                    post_ops.entry_[binary_idx].binary);
     }
 
-    ~gemm_convolution_fwd_t() { delete eltwise_; }
+    ~gemm_convolution_fwd_t() {
+        delete eltwise_;
+        delete binary_;
+    }
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
@@ -119,6 +134,7 @@ private:
     data_t beta_;
 
     ref_eltwise_scalar_fwd_t *eltwise_;
+    ref_binary_scalar_t *binary_;
 };
 
 struct gemm_convolution_bwd_data_t : public primitive_impl_t {
@@ -129,8 +145,7 @@ struct gemm_convolution_bwd_data_t : public primitive_impl_t {
             : cpu_convolution_bwd_data_pd_t(engine, adesc, attr, hint_fwd_pd)
             , jcp_() {}
 
-        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_convolution_bwd_data_t,
-                USE_GLOBAL_SCRATCHPAD);
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_convolution_bwd_data_t);
 
         status_t init() {
             bool ok = true && desc()->prop_kind == prop_kind::backward_data
@@ -188,8 +203,7 @@ struct gemm_convolution_bwd_weights_t : public primitive_impl_t {
             : cpu_convolution_bwd_weights_pd_t(engine, adesc, attr, hint_fwd_pd)
             , jcp_() {}
 
-        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_convolution_bwd_weights_t,
-                USE_GLOBAL_SCRATCHPAD);
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_convolution_bwd_weights_t);
 
         status_t init() {
             bool ok = true && desc()->prop_kind == prop_kind::backward_weights
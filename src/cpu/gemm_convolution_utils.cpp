@@ -617,7 +617,8 @@ status_t init_conf(jit_gemm_conv_conf_t &jcp,
             || (is_bwd_w
                     && utils::everyone_is(
                             bf16, src_d.data_type(), dst_d.data_type()));
-    if (is_bf16_conv && !mayiuse(avx512_core)) return status::unimplemented;
+    // without avx512_core bf16 is up-converted and computed in f32
+    if (is_bf16_conv && !mayiuse(avx2)) return status::unimplemented;
 
     bool is_bf16_to_bf16_conv = is_bf16_conv
             && ((is_fwd && bf16 == dst_d.data_type())
@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_topology.hpp"
+#include "gemm_deconvolution.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace gemm_deconvolution_utils {
+
+void init_phase_dim(phase_dim_t &phd, int r, int stride, int dilate, int k,
+        int pad, int out) {
+    // The outputs o = q * stride + r - pad with 0 <= o < out
+    phd.q0 = pad > r ? div_up(pad - r, stride) : 0;
+    const int q_last = out - 1 + pad - r >= 0 ? (out - 1 + pad - r) / stride
+                                               : -1;
+    phd.nq = nstl::max(0, q_last - phd.q0 + 1);
+
+    // The input i contributes to the output i * stride - pad + kk * (dilate
+    // + 1), so the phase takes the taps kk * (dilate + 1) = r (mod stride)
+    phd.taps.clear();
+    phd.offs.clear();
+    for (int kk = 0; kk < k; kk++) {
+        const int off = kk * (dilate + 1);
+        if (off % stride != r) continue;
+        phd.taps.push_back(kk);
+        phd.offs.push_back((off - r) / stride);
+    }
+}
+
+status_t init_conf(jit_deconv_gemm_conf_t &jcp,
+        const deconvolution_desc_t &dd, const memory_desc_wrapper &src_d,
+        const memory_desc_wrapper &weights_d, const memory_desc_wrapper &dst_d,
+        int max_threads) {
+    const int ndims = src_d.ndims();
+    const bool is_1d = ndims == 3;
+    const bool with_groups = weights_d.ndims() == ndims + 1;
+
+    jcp = zero<decltype(jcp)>();
+    jcp.mb = src_d.dims()[0];
+    jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
+    jcp.ic = src_d.dims()[1] / jcp.ngroups;
+    jcp.oc = dst_d.dims()[1] / jcp.ngroups;
+    jcp.ih = is_1d ? 1 : src_d.dims()[2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.oh = is_1d ? 1 : dst_d.dims()[2];
+    jcp.ow = dst_d.dims()[ndims - 1];
+    jcp.kh = is_1d ? 1 : weights_d.dims()[with_groups + 2];
+    jcp.kw = weights_d.dims()[with_groups + ndims - 1];
+    jcp.stride_h = is_1d ? 1 : dd.strides[0];
+    jcp.stride_w = dd.strides[ndims - 3];
+    jcp.dilate_h = is_1d ? 0 : dd.dilates[0];
+    jcp.dilate_w = dd.dilates[ndims - 3];
+    jcp.t_pad = is_1d ? 0 : dd.padding[0][0];
+    jcp.l_pad = dd.padding[0][ndims - 3];
+    jcp.with_bias = dd.bias_desc.format_kind != format_kind::undef;
+
+    jcp.nphases = jcp.stride_h * jcp.stride_w;
+    int max_taps = 0;
+    phase_dim_t h, w;
+    for (int rh = 0; rh < jcp.stride_h; rh++) {
+        init_phase_dim(h, rh, jcp.stride_h, jcp.dilate_h, jcp.kh, jcp.t_pad,
+                jcp.oh);
+        jcp.max_qh = nstl::max(jcp.max_qh, h.nq);
+        for (int rw = 0; rw < jcp.stride_w; rw++) {
+            init_phase_dim(w, rw, jcp.stride_w, jcp.dilate_w, jcp.kw,
+                    jcp.l_pad, jcp.ow);
+            if (rh == 0) jcp.max_qw = nstl::max(jcp.max_qw, w.nq);
+            max_taps = nstl::max(
+                    max_taps, (int)h.taps.size() * (int)w.taps.size());
+        }
+    }
+    jcp.max_k = jcp.ic * max_taps;
+
+    // The col and the products of a GEMM are kept in L2
+    const size_t L2 = get_cache_size(2, true) / sizeof(float);
+    const size_t row_sz = (size_t)(jcp.max_k + jcp.oc) * jcp.max_qw;
+    jcp.qh_block = (int)nstl::min<size_t>(
+            nstl::max(1, jcp.max_qh), nstl::max<size_t>(1, L2 / row_sz));
+    jcp.nb_qh = div_up(nstl::max(1, jcp.max_qh), jcp.qh_block);
+
+    const int work_amount = jcp.mb * jcp.ngroups * jcp.nphases * jcp.nb_qh;
+    jcp.outer_threading = max_threads == 1 || work_amount >= max_threads;
+    jcp.nthr = jcp.outer_threading ? nstl::min(max_threads, work_amount)
+                                   : max_threads;
+
+    return status::success;
+}
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_deconv_gemm_conf_t &jcp) {
+    const size_t nbufs = jcp.outer_threading ? jcp.nthr : 1;
+    const size_t col_sz
+            = rnd_up((size_t)jcp.max_k * jcp.qh_block * jcp.max_qw, 16);
+    const size_t acc_sz
+            = rnd_up((size_t)jcp.oc * jcp.qh_block * jcp.max_qw, 16);
+    const size_t wei_sz
+            = (size_t)jcp.ngroups * jcp.oc * jcp.ic * jcp.kh * jcp.kw;
+
+    scratchpad.book(key_deconv_gemm_wei, sizeof(float) * wei_sz);
+    scratchpad.book(key_deconv_gemm_col, sizeof(float) * nbufs * col_sz);
+    scratchpad.book(key_deconv_gemm_acc, sizeof(float) * nbufs * acc_sz);
+}
+
+} // namespace gemm_deconvolution_utils
+
+template <data_type_t data_type>
+gemm_deconvolution_fwd_t<data_type>::gemm_deconvolution_fwd_t(
+        const pd_t *apd)
+    : primitive_impl_t(apd), sum_scale_(0.f), eltwise_(nullptr) {
+    using namespace gemm_deconvolution_utils;
+    const auto &jcp = pd()->jcp_;
+
+    size_t wei_off = 0;
+    for (int rh = 0; rh < jcp.stride_h; rh++)
+        for (int rw = 0; rw < jcp.stride_w; rw++) {
+            phase_t ph;
+            init_phase_dim(ph.h, rh, jcp.stride_h, jcp.dilate_h, jcp.kh,
+                    jcp.t_pad, jcp.oh);
+            init_phase_dim(ph.w, rw, jcp.stride_w, jcp.dilate_w, jcp.kw,
+                    jcp.l_pad, jcp.ow);
+            ph.k = jcp.ic * (int)ph.h.taps.size() * (int)ph.w.taps.size();
+            ph.wei_off = wei_off;
+            wei_off += (size_t)jcp.ngroups * jcp.oc * ph.k;
+            phases_.push_back(ph);
+        }
+
+    const auto &post_ops = pd()->attr()->post_ops_;
+    const int sum_idx = post_ops.find(primitive_kind::sum);
+    if (sum_idx != -1) sum_scale_ = post_ops.entry_[sum_idx].sum.scale;
+
+    const int entry_idx = post_ops.find(primitive_kind::eltwise);
+    if (entry_idx != -1)
+        eltwise_ = new ref_eltwise_scalar_fwd_t(
+                post_ops.entry_[entry_idx].eltwise);
+}
+
+// The weights of each phase are gathered into (oc x k) matrices, where
+// k = ic * taps
+template <data_type_t data_type>
+void gemm_deconvolution_fwd_t<data_type>::pack_weights(
+        const data_t *weights, float *wei) const {
+    const auto &jcp = pd()->jcp_;
+
+    parallel_nd(jcp.ngroups, jcp.oc, [&](int g, int oc) {
+        const size_t g_oc = (size_t)g * jcp.oc + oc;
+        const data_t *w_oc = weights + g_oc * jcp.ic * jcp.kh * jcp.kw;
+        for (const auto &ph : phases_) {
+            const int nth = (int)ph.h.taps.size();
+            const int ntw = (int)ph.w.taps.size();
+            float *w = wei + ph.wei_off + g_oc * ph.k;
+            for (int ic = 0; ic < jcp.ic; ic++)
+                for (int th = 0; th < nth; th++)
+                    for (int tw = 0; tw < ntw; tw++) {
+                        const int kh = ph.h.taps[th], kw = ph.w.taps[tw];
+                        *w++ = w_oc[(ic * jcp.kh + kh) * jcp.kw + kw];
+                    }
+        }
+    });
+}
+
+template <data_type_t data_type>
+void gemm_deconvolution_fwd_t<data_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const auto &jcp = pd()->jcp_;
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *wei = scratchpad.template get<float>(key_deconv_gemm_wei);
+    float *col_base = scratchpad.template get<float>(key_deconv_gemm_col);
+    float *acc_base = scratchpad.template get<float>(key_deconv_gemm_acc);
+
+    const size_t col_sz
+            = rnd_up((size_t)jcp.max_k * jcp.qh_block * jcp.max_qw, 16);
+    const size_t acc_sz
+            = rnd_up((size_t)jcp.oc * jcp.qh_block * jcp.max_qw, 16);
+
+    const bool bia_f32 = jcp.with_bias
+            && pd()->weights_md(1)->data_type == data_type::f32;
+    auto bias_value = [&](size_t g_oc) -> float {
+        if (!jcp.with_bias) return 0.f;
+        return bia_f32 ? ((const float *)bias)[g_oc]
+                       : (float)((const data_t *)bias)[g_oc];
+    };
+
+    pack_weights(weights, wei);
+
+    // The rows [qb, qb + nrows) of the outputs of the phase p. The loops
+    // are split among nthr_loops threads, the GEMM takes the threads the
+    // context gives it.
+    auto compute = [&](int n, int g, int p, int qb, float *col, float *acc,
+                           int nthr_loops) {
+        const phase_t &ph = phases_[p];
+        const int nrows = nstl::min(jcp.qh_block, ph.h.nq - qb);
+        if (nrows <= 0 || ph.w.nq == 0) return;
+
+        const int nth = (int)ph.h.taps.size();
+        const int ntw = (int)ph.w.taps.size();
+        const int Q = nrows * ph.w.nq;
+        const int K = ph.k;
+        const size_t g_oc = (size_t)g * jcp.oc;
+
+        const data_t *src_g = src
+                + ((size_t)n * jcp.ngroups + g) * jcp.ic * jcp.ih * jcp.iw;
+        data_t *dst_g = dst
+                + ((size_t)n * jcp.ngroups + g) * jcp.oc * jcp.oh * jcp.ow;
+
+        // col[k][q]: the input of the tap k for the output q
+        parallel(nthr_loops, [&](const int ithr, const int nthr) {
+            for_nd(ithr, nthr, jcp.ic, nth, ntw, [&](int ic, int th, int tw) {
+                float *c = col + (size_t)((ic * nth + th) * ntw + tw) * Q;
+                const data_t *s = src_g + (size_t)ic * jcp.ih * jcp.iw;
+
+                const int iw_s = ph.w.q0 - ph.w.offs[tw];
+                const int j_s = nstl::min(ph.w.nq, nstl::max(0, -iw_s));
+                const int j_e = nstl::max(
+                        j_s, nstl::min(ph.w.nq, jcp.iw - iw_s));
+                for (int i = 0; i < nrows; i++) {
+                    float *c_row = c + i * ph.w.nq;
+                    const int ih = ph.h.q0 + qb + i - ph.h.offs[th];
+                    if (ih < 0 || ih >= jcp.ih) {
+                        for (int j = 0; j < ph.w.nq; j++)
+                            c_row[j] = 0.f;
+                        continue;
+                    }
+                    const data_t *s_row = s + (size_t)ih * jcp.iw + iw_s;
+                    for (int j = 0; j < j_s; j++)
+                        c_row[j] = 0.f;
+                    PRAGMA_OMP_SIMD()
+                    for (int j = j_s; j < j_e; j++)
+                        c_row[j] = s_row[j];
+                    for (int j = j_e; j < ph.w.nq; j++)
+                        c_row[j] = 0.f;
+                }
+            });
+        });
+
+        // acc[oc][q] = sum_k wei[oc][k] * col[k][q]
+        if (K > 0) {
+            const float *w = wei + ph.wei_off + g_oc * K;
+            const float one = 1.f, zero = 0.f;
+            extended_sgemm("N", "N", &Q, &jcp.oc, &K, &one, col, &Q, w, &K,
+                    &zero, acc, &Q);
+        }
+
+        // The bias and the post-ops are applied on the way to dst
+        parallel(nthr_loops, [&](const int ithr, const int nthr) {
+            for_nd(ithr, nthr, jcp.oc, nrows, [&](int oc, int i) {
+                const int oh = (ph.h.q0 + qb + i) * jcp.stride_h
+                        + (p / jcp.stride_w) - jcp.t_pad;
+                const int ow0 = ph.w.q0 * jcp.stride_w + (p % jcp.stride_w)
+                        - jcp.l_pad;
+                const float *a = acc + (size_t)oc * Q + i * ph.w.nq;
+                const float b = bias_value(g_oc + oc);
+                data_t *d = dst_g + ((size_t)oc * jcp.oh + oh) * jcp.ow + ow0;
+                for (int j = 0; j < ph.w.nq; j++) {
+                    float val = (K > 0 ? a[j] : 0.f) + b;
+                    data_t &o = d[j * jcp.stride_w];
+                    if (sum_scale_ != 0.f) val += sum_scale_ * (float)o;
+                    if (eltwise_) val = eltwise_->compute_scalar(val);
+                    o = val;
+                }
+            });
+        });
+    };
+
+    if (jcp.outer_threading) {
+        const int work_amount
+                = jcp.mb * jcp.ngroups * jcp.nphases * jcp.nb_qh;
+        parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+            float *col = col_base + ithr * col_sz;
+            float *acc = acc_base + ithr * acc_sz;
+
+            int start {0}, end {0};
+            balance211(work_amount, nthr, ithr, start, end);
+
+            int n {0}, g {0}, p {0}, qbb {0};
+            nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, p,
+                    jcp.nphases, qbb, jcp.nb_qh);
+            for (int iwork = start; iwork < end; iwork++) {
+                compute(n, g, p, qbb * jcp.qh_block, col, acc, 1);
+                nd_iterator_step(n, jcp.mb, g, jcp.ngroups, p, jcp.nphases,
+                        qbb, jcp.nb_qh);
+            }
+        });
+    } else {
+        for (int n = 0; n < jcp.mb; n++)
+            for (int g = 0; g < jcp.ngroups; g++)
+                for (int p = 0; p < jcp.nphases; p++)
+                    for (int qbb = 0; qbb < jcp.nb_qh; qbb++)
+                        compute(n, g, p, qbb * jcp.qh_block, col_base,
+                                acc_base, jcp.nthr);
+    }
+}
+
+template struct gemm_deconvolution_fwd_t<data_type::f32>;
+template struct gemm_deconvolution_fwd_t<data_type::bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
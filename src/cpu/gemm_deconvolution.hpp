@@ -0,0 +1,189 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_DECONVOLUTION_HPP
+#define CPU_GEMM_DECONVOLUTION_HPP
+
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_deconvolution_pd.hpp"
+#include "cpu_isa_traits.hpp"
+#include "gemm/gemm.hpp"
+#include "jit_primitive_conf.hpp"
+#include "ref_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Forward deconvolution computed directly instead of as the backward data
+ * convolution.
+ *
+ * A strided deconvolution is split into the stride_h * stride_w sub-pixel
+ * phases (see jit_deconv_gemm_conf_t), each of them a dense convolution of
+ * unit stride: the taps of the phase gather the source into a col matrix
+ * that is multiplied by the weights of the phase with the JIT GEMM. The
+ * bias and the post-ops are applied when the products are scattered to the
+ * destination, so each of its points is written once. */
+namespace gemm_deconvolution_utils {
+
+// The outputs q0 <= q < q0 + nq of a phase along a dimension and its taps.
+// The output q * stride + r - pad takes the input q - offs[i] with the
+// weights taps[i].
+struct phase_dim_t {
+    int q0, nq;
+    std::vector<int> taps, offs;
+};
+
+void init_phase_dim(phase_dim_t &phd, int r, int stride, int dilate, int k,
+        int pad, int out);
+
+status_t init_conf(jit_deconv_gemm_conf_t &jcp,
+        const deconvolution_desc_t &dd, const memory_desc_wrapper &src_d,
+        const memory_desc_wrapper &weights_d, const memory_desc_wrapper &dst_d,
+        int max_threads);
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_deconv_gemm_conf_t &jcp);
+
+} // namespace gemm_deconvolution_utils
+
+template <impl::data_type_t data_type>
+struct gemm_deconvolution_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_deconvolution_fwd_pd_t {
+        pd_t(engine_t *engine, const deconvolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const deconvolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_deconvolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_deconvolution_fwd_t);
+
+        status_t init() {
+            using namespace data_type;
+            bool ok = true && is_fwd() && utils::one_of(ndims(), 3, 4)
+                    && desc()->alg_kind == alg_kind::deconvolution_direct
+                    && utils::everyone_is(data_type, src_md()->data_type,
+                            weights_md()->data_type, dst_md()->data_type)
+                    && IMPLICATION(with_bias(),
+                            utils::one_of(weights_md(1)->data_type, f32,
+                                    data_type))
+                    && desc()->accum_data_type == f32
+                    && IMPLICATION(data_type == bf16, mayiuse(avx512_core))
+                    && !has_zero_dim_memory()
+                    && attr()->output_scales_.has_default_values()
+                    && post_ops_ok() && set_default_formats();
+            if (!ok) return status::unimplemented;
+
+            status_t status = gemm_deconvolution_utils::init_conf(jcp_,
+                    *desc(), src_md(), weights_md(), dst_md(),
+                    dnnl_get_max_threads());
+            if (status != status::success) return status;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            gemm_deconvolution_utils::init_scratchpad(scratchpad, jcp_);
+
+            return status::success;
+        }
+
+        jit_deconv_gemm_conf_t jcp_;
+
+    protected:
+        bool post_ops_ok() const {
+            auto const &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+            auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(); };
+
+            switch (po.len_) {
+                case 0: return true; // no post_ops
+                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+                default: return false;
+            }
+            return false;
+        }
+
+        bool set_default_formats() {
+            using namespace format_tag;
+            const bool is_1d = ndims() == 3;
+            const auto dat_tag = is_1d ? ncw : nchw;
+            const auto wei_tag = with_groups() ? (is_1d ? goiw : goihw)
+                                               : (is_1d ? oiw : oihw);
+
+            // The unit stride deconvolutions without post-ops are left to
+            // the convolution based implementation, unless the user asks for
+            // the plain formats
+            const bool is_strided = KSH() > 1 || KSW() > 1;
+            const bool has_any = utils::one_of(format_kind::any,
+                    src_md_.format_kind, weights_md_.format_kind,
+                    dst_md_.format_kind);
+            if (has_any && !is_strided && attr()->post_ops_.len_ == 0)
+                return false;
+
+            auto init_md = [](memory_desc_t &md, format_tag_t tag) {
+                return md.format_kind != format_kind::any
+                        || memory_desc_init_by_tag(md, tag) == status::success;
+            };
+            if (!(init_md(src_md_, dat_tag) && init_md(weights_md_, wei_tag)
+                        && init_md(dst_md_, dat_tag)
+                        && init_md(bias_md_, x)))
+                return false;
+
+            return memory_desc_matches_tag(src_md_, dat_tag)
+                    && memory_desc_matches_tag(weights_md_, wei_tag)
+                    && memory_desc_matches_tag(dst_md_, dat_tag)
+                    && IMPLICATION(
+                            with_bias(), memory_desc_matches_tag(bias_md_, x));
+        }
+    };
+
+    gemm_deconvolution_fwd_t(const pd_t *apd);
+    ~gemm_deconvolution_fwd_t() { delete eltwise_; }
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    struct phase_t {
+        gemm_deconvolution_utils::phase_dim_t h, w;
+        size_t wei_off; // of the weights of the phase in the packed ones
+        int k; // ic * taps, the rows of the col
+    };
+
+    void execute_forward(const exec_ctx_t &ctx) const;
+    void pack_weights(const data_t *weights, float *wei) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    std::vector<phase_t> phases_;
+    float sum_scale_;
+    ref_eltwise_scalar_fwd_t *eltwise_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -31,14 +31,25 @@ using namespace dnnl::impl::format_tag;
 using namespace dnnl::impl::primitive_kind;
 
 template <impl::data_type_t data_type>
-void gemm_inner_product_fwd_t<data_type>::execute_forward(
+status_t gemm_inner_product_fwd_t<data_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
-    const int MB = pd()->MB();
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+
+    if (pd()->has_runtime_dims_or_strides()) {
+        const bool ok = true
+                && memory_desc_wrapper(pd()->src_md()).matches_runtime_md(src_d)
+                && memory_desc_wrapper(pd()->dst_md()).matches_runtime_md(dst_d)
+                && src_d.dims()[0] == dst_d.dims()[0];
+        if (!ok) return status::invalid_arguments;
+    }
+
+    const int MB = src_d.dims()[0];
     const int OC = pd()->OC();
     const int IC = pd()->IC_total_padded();
 
@@ -59,6 +70,23 @@ void gemm_inner_product_fwd_t<data_type>::execute_forward(
             (*pp_kernel_)(dst, dst, (char *)bias, scales, start, end);
         });
     }
+
+    if (binary_) {
+        const auto &po = pd()->attr()->post_ops_;
+        auto src1 = CTX_IN_MEM(
+                const data_t *, DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1);
+        dim_t stride_mb, stride_oc, stride_sp;
+        binary_post_op_src1_strides(
+                po.entry_[po.find(primitive_kind::binary)].binary.src1_desc,
+                stride_mb, stride_oc, stride_sp);
+        parallel_nd(MB, OC, [&](int mb, int oc) {
+            data_t &d = dst[(size_t)mb * OC + oc];
+            d = binary_->compute_scalar(
+                    d, src1[mb * stride_mb + oc * stride_oc]);
+        });
+    }
+
+    return status::success;
 }
 
 template <impl::data_type_t data_type>
@@ -27,6 +27,7 @@
 #include "gemm_inner_product_utils.hpp"
 
 #include "cpu_inner_product_pd.hpp"
+#include "ref_binary.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -48,29 +49,41 @@ struct gemm_inner_product_fwd_t : public primitive_impl_t {
                             with_bias() ? weights_md(1)->data_type : data_type)
                     && attr()->output_scales_.has_default_values()
                     && post_ops_ok() && set_default_params() == status::success
-                    && dense_gemm_consitency_check(
+                    && dense_gemm_consitency_check_runtime_mb(
                             src_md(), weights_md(), dst_md());
             return ok ? status::success : status::unimplemented;
         }
 
+        virtual bool supports_binary_post_op() const override { return true; }
+
     protected:
         bool post_ops_ok() const {
+            using namespace format_tag;
             auto const &po = attr()->post_ops_;
             auto is_eltwise
                     = [&](int idx) { return po.entry_[idx].is_eltwise(false); };
             auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(false); };
-            switch (po.len_) {
-                case 0: return true; // no post_ops
-                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
-                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
-                default: return false;
-            }
-            return false;
+            auto is_binary = [&](int idx) {
+                return po.entry_[idx].is_binary()
+                        && binary_post_op_src1_ok(
+                                po.entry_[idx].binary.src1_desc, *dst_md(),
+                                nc);
+            };
+
+            // (sum)? -> (eltwise)? -> (binary)?
+            int idx = 0;
+            if (idx < po.len_ && is_sum(idx)) idx++;
+            if (idx < po.len_ && is_eltwise(idx)) idx++;
+            if (idx < po.len_ && is_binary(idx)) idx++;
+            return idx == po.len_;
         }
     };
 
     gemm_inner_product_fwd_t(const pd_t *apd)
-        : primitive_impl_t(apd), pp_kernel_(nullptr), postops_in_ip_(false) {
+        : primitive_impl_t(apd)
+        , pp_kernel_(nullptr)
+        , postops_in_ip_(false)
+        , binary_(nullptr) {
         bool has_bias = pd()->with_bias(),
              has_eltwise
                 = pd()->attr()->post_ops_.find(primitive_kind::eltwise) >= 0;
@@ -82,23 +95,31 @@ struct gemm_inner_product_fwd_t : public primitive_impl_t {
         auto sum_idx = pd()->attr()->post_ops_.find(primitive_kind::sum);
         beta_ = sum_idx >= 0 ? pd()->attr()->post_ops_.entry_[sum_idx].sum.scale
                              : 0.0;
+
+        auto binary_idx = pd()->attr()->post_ops_.find(primitive_kind::binary);
+        if (binary_idx >= 0)
+            binary_ = new ref_binary_scalar_t(
+                    pd()->attr()->post_ops_.entry_[binary_idx].binary);
+    }
+    ~gemm_inner_product_fwd_t() {
+        delete pp_kernel_;
+        delete binary_;
     }
-    ~gemm_inner_product_fwd_t() { delete pp_kernel_; }
 
     typedef typename prec_traits<data_type>::type data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 
     inner_product_utils::pp_kernel_t<data_type, data_type> *pp_kernel_;
     bool postops_in_ip_;
     float beta_;
+    ref_binary_scalar_t *binary_;
 };
 
 template <impl::data_type_t data_type>
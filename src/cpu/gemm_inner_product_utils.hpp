@@ -37,6 +37,8 @@ template <impl::data_type_t acc_type, impl::data_type_t dst_type>
 class pp_kernel_t : jit_generator {
 public:
     DECLARE_CPU_JIT_AUX_FUNCTIONS(gemm_x8s8s32x_inner_product_fwd_t::pp_kernel);
+    pp_kernel_t(size_t OC, data_type_t bias_dt, const primitive_attr_t *attr,
+            int oc_scale_mask, bool skip_sum);
     pp_kernel_t(const cpu_inner_product_fwd_pd_t *pd, bool skip_sum);
     ~pp_kernel_t() {
         if (do_eltwise_) {
@@ -0,0 +1,459 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_types.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_topology.hpp"
+#include "gemm/gemm.hpp"
+#include "gemm_wino_convolution.hpp"
+#include "jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+
+const int simd_w = 8;
+
+/* The 1D transforms of the points of a tile. A point is a vector of simd_w
+ * channels, the points of the input (d) and the output (o) are at the given
+ * strides. The F(4x4, 3x3) transforms use the same interpolation points as
+ * the AVX-512 implementations and the wino reorder: 0, +-5/8, +-3/2 and
+ * infinity. */
+template <int m>
+struct wino_trans_t;
+
+template <>
+struct wino_trans_t<2> {
+    static void input(float *o, int os, const float *d, int ds) {
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; v++) {
+            const float d0 = d[0 * ds + v], d1 = d[1 * ds + v];
+            const float d2 = d[2 * ds + v], d3 = d[3 * ds + v];
+            o[0 * os + v] = d0 - d2;
+            o[1 * os + v] = d1 + d2;
+            o[2 * os + v] = d2 - d1;
+            o[3 * os + v] = d1 - d3;
+        }
+    }
+
+    static void output(float *o, int os, const float *d, int ds) {
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; v++) {
+            const float d0 = d[0 * ds + v], d1 = d[1 * ds + v];
+            const float d2 = d[2 * ds + v], d3 = d[3 * ds + v];
+            o[0 * os + v] = d0 + d1 + d2;
+            o[1 * os + v] = d1 - d2 - d3;
+        }
+    }
+
+    static const float G[4][3];
+};
+
+const float wino_trans_t<2>::G[4][3] = {{1.f, 0.f, 0.f}, {.5f, .5f, .5f},
+        {.5f, -.5f, .5f}, {0.f, 0.f, 1.f}};
+
+template <>
+struct wino_trans_t<4> {
+    static void input(float *o, int os, const float *d, int ds) {
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; v++) {
+            const float d0 = d[0 * ds + v], d1 = d[1 * ds + v];
+            const float d2 = d[2 * ds + v], d3 = d[3 * ds + v];
+            const float d4 = d[4 * ds + v], d5 = d[5 * ds + v];
+            const float t0 = d2 * -2.25f + d4;
+            const float t1 = d1 * -2.25f + d3;
+            const float t2 = d2 * -0.390625f + d4;
+            const float t3 = d1 * -0.390625f + d3;
+            const float t4 = d0 * 0.87890625f + d4;
+            const float t5 = d1 * 0.87890625f + d5;
+            o[0 * os + v] = d2 * -2.640625f + t4;
+            o[1 * os + v] = t1 * 0.625f + t0;
+            o[2 * os + v] = t1 * -0.625f + t0;
+            o[3 * os + v] = t3 * 1.5f + t2;
+            o[4 * os + v] = t3 * -1.5f + t2;
+            o[5 * os + v] = d3 * -2.640625f + t5;
+        }
+    }
+
+    static void output(float *o, int os, const float *d, int ds) {
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; v++) {
+            const float d0 = d[0 * ds + v], d1 = d[1 * ds + v];
+            const float d2 = d[2 * ds + v], d3 = d[3 * ds + v];
+            const float d4 = d[4 * ds + v], d5 = d[5 * ds + v];
+            const float t0 = d1 + d2, t1 = d3 + d4;
+            const float t2 = d1 - d2, t3 = d3 - d4;
+            o[0 * os + v] = t0 + t1 + d0;
+            o[1 * os + v] = t2 * 0.625f + t3 * 1.5f;
+            o[2 * os + v] = t0 * 0.390625f + t1 * 2.25f;
+            o[3 * os + v] = t2 * 0.244140625f + t3 * 3.375f + d5;
+        }
+    }
+
+    static const float G[6][3];
+};
+
+const float wino_trans_t<4>::G[6][3] = {{1.13777777777778f, 0.f, 0.f},
+        {-0.688403361344538f, -0.430252100840336f, -0.26890756302521f},
+        {-0.688403361344538f, 0.430252100840336f, -0.26890756302521f},
+        {0.119514472455649f, 0.179271708683473f, 0.26890756302521f},
+        {0.119514472455649f, -0.179271708683473f, 0.26890756302521f},
+        {0.f, 0.f, 1.f}};
+
+struct wino_post_ops_t {
+    float sum_scale;
+    ref_eltwise_scalar_fwd_t *eltwise;
+};
+
+// Transforms the flipped and transposed weights of the backward data pass.
+// U is alpha x alpha matrices of (oc x ic), the weights are oihw.
+template <int m>
+void weights_transform_bwd_data(const jit_conv_gemm_wino_conf_t &jcp,
+        const float *wei, float *U) {
+    const int alpha = m + 2;
+    const auto &G = wino_trans_t<m>::G;
+    const size_t U_stride = (size_t)jcp.oc * jcp.ic;
+
+    parallel_nd(jcp.oc, jcp.ic, [&](int oc, int ic) {
+        const float *w = wei + ((size_t)oc * jcp.ic + ic) * 9;
+        float T[alpha][3];
+        for_(int i = 0; i < alpha; i++)
+        for (int kw = 0; kw < 3; kw++) {
+            float t = 0;
+            for (int kh = 0; kh < 3; kh++)
+                t += G[i][kh] * w[(2 - kh) * 3 + 2 - kw];
+            T[i][kw] = t;
+        }
+        float *u = U + (size_t)oc * jcp.ic + ic;
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float t = 0;
+            for (int kw = 0; kw < 3; kw++)
+                t += T[i][kw] * G[j][kw];
+            u[(i * alpha + j) * U_stride] = t;
+        }
+    });
+}
+
+template <int m>
+void input_transform(const jit_conv_gemm_wino_conf_t &jcp, const float *inp,
+        float *V, int tile, int tile_in_block) {
+    const int alpha = m + 2;
+    const int nb_c = jcp.inp_c / simd_w;
+    const int tiles_per_img = jcp.itiles * jcp.jtiles;
+    const int n = tile / tiles_per_img;
+    const int y0 = (tile % tiles_per_img) / jcp.jtiles * m - jcp.t_pad;
+    const int x0 = tile % jcp.jtiles * m - jcp.l_pad;
+    const int V_stride = jcp.tile_block * jcp.inp_c;
+
+    float I[alpha][alpha][simd_w];
+    float T[alpha][alpha][simd_w];
+
+    for (int cb = 0; cb < nb_c; cb++) {
+        const float *inp_c = inp
+                + (size_t)(n * nb_c + cb) * jcp.inp_h * jcp.inp_w * simd_w;
+        for (int i = 0; i < alpha; i++) {
+            const int y = y0 + i;
+            const bool y_ok = y >= 0 && y < jcp.inp_h;
+            for (int j = 0; j < alpha; j++) {
+                const int x = x0 + j;
+                if (y_ok && x >= 0 && x < jcp.inp_w) {
+                    const float *p
+                            = inp_c + ((size_t)y * jcp.inp_w + x) * simd_w;
+                    PRAGMA_OMP_SIMD()
+                    for (int v = 0; v < simd_w; v++)
+                        I[i][j][v] = p[v];
+                } else {
+                    PRAGMA_OMP_SIMD()
+                    for (int v = 0; v < simd_w; v++)
+                        I[i][j][v] = 0.f;
+                }
+            }
+        }
+
+        for (int j = 0; j < alpha; j++)
+            wino_trans_t<m>::input(&T[0][j][0], alpha * simd_w, &I[0][j][0],
+                    alpha * simd_w);
+
+        float *v_base = V + (size_t)tile_in_block * jcp.inp_c + cb * simd_w;
+        for (int i = 0; i < alpha; i++)
+            wino_trans_t<m>::input(v_base + (size_t)i * alpha * V_stride,
+                    V_stride, &T[i][0][0], simd_w);
+    }
+}
+
+template <int m>
+void output_transform(const jit_conv_gemm_wino_conf_t &jcp, const float *M,
+        const float *bias, const wino_post_ops_t &p_ops, float *out, int tile,
+        int tile_in_block) {
+    const int alpha = m + 2;
+    const int nb_c = jcp.out_c / simd_w;
+    const int tiles_per_img = jcp.itiles * jcp.jtiles;
+    const int n = tile / tiles_per_img;
+    const int y0 = (tile % tiles_per_img) / jcp.jtiles * m;
+    const int x0 = tile % jcp.jtiles * m;
+    const int M_stride = jcp.tile_block * jcp.out_c;
+    const int ye = nstl::min(m, jcp.out_h - y0);
+    const int xe = nstl::min(m, jcp.out_w - x0);
+
+    float T[m][alpha][simd_w];
+    float O[m][m][simd_w];
+
+    for (int cb = 0; cb < nb_c; cb++) {
+        const float *m_base
+                = M + (size_t)tile_in_block * jcp.out_c + cb * simd_w;
+        for (int j = 0; j < alpha; j++)
+            wino_trans_t<m>::output(&T[0][j][0], alpha * simd_w,
+                    m_base + (size_t)j * M_stride, alpha * M_stride);
+        for (int i = 0; i < m; i++)
+            wino_trans_t<m>::output(&O[i][0][0], simd_w, &T[i][0][0], simd_w);
+
+        float b[simd_w];
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; v++)
+            b[v] = bias ? bias[cb * simd_w + v] : 0.f;
+
+        float *out_c = out
+                + (size_t)(n * nb_c + cb) * jcp.out_h * jcp.out_w * simd_w;
+        for_(int i = 0; i < ye; i++)
+        for (int j = 0; j < xe; j++) {
+            float *p = out_c
+                    + ((size_t)(y0 + i) * jcp.out_w + x0 + j) * simd_w;
+            if (p_ops.sum_scale != 0.f) {
+                PRAGMA_OMP_SIMD()
+                for (int v = 0; v < simd_w; v++)
+                    p[v] = O[i][j][v] + b[v] + p_ops.sum_scale * p[v];
+            } else {
+                PRAGMA_OMP_SIMD()
+                for (int v = 0; v < simd_w; v++)
+                    p[v] = O[i][j][v] + b[v];
+            }
+            if (p_ops.eltwise)
+                for (int v = 0; v < simd_w; v++)
+                    p[v] = p_ops.eltwise->compute_scalar(p[v]);
+        }
+    }
+}
+
+template <int m>
+void execute_data(const jit_conv_gemm_wino_conf_t &jcp, const float *inp,
+        const float *U, const float *bias, float *out,
+        const wino_post_ops_t &p_ops,
+        const memory_tracking::grantor_t &scratchpad) {
+    const int alpha = m + 2;
+    const size_t V_sz = (size_t)alpha * alpha * jcp.tile_block * jcp.inp_c;
+    const size_t M_sz = (size_t)alpha * alpha * jcp.tile_block * jcp.out_c;
+    const size_t U_stride = (size_t)jcp.inp_c * jcp.out_c;
+    float *V_base = scratchpad.get<float>(key_wino_V);
+    float *M_base = scratchpad.get<float>(key_wino_M);
+
+    parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+        int start {0}, end {0};
+        balance211(jcp.nb_tile_blocks, nthr, ithr, start, end);
+        float *V = V_base + ithr * V_sz;
+        float *M = M_base + ithr * M_sz;
+
+        for (int tb = start; tb < end; tb++) {
+            const int tile_s = tb * jcp.tile_block;
+            const int ntiles = nstl::min(jcp.tile_block, jcp.ntiles - tile_s);
+
+            for (int t = 0; t < ntiles; t++)
+                input_transform<m>(jcp, inp, V, tile_s + t, t);
+
+            // M[a] (out_c x ntiles) = U[a] (out_c x inp_c) * V[a], column
+            // major
+            const float one = 1.f, zero = 0.f;
+            for (int a = 0; a < alpha * alpha; a++) {
+                const size_t V_off = (size_t)a * jcp.tile_block * jcp.inp_c;
+                const size_t M_off = (size_t)a * jcp.tile_block * jcp.out_c;
+                extended_sgemm("N", "N", &jcp.out_c, &ntiles, &jcp.inp_c,
+                        &one, U + a * U_stride, &jcp.out_c, V + V_off,
+                        &jcp.inp_c, &zero, M + M_off, &jcp.out_c);
+            }
+
+            for (int t = 0; t < ntiles; t++)
+                output_transform<m>(jcp, M, bias, p_ops, out, tile_s + t, t);
+        }
+    });
+}
+
+} // namespace
+
+namespace gemm_wino_convolution_utils {
+
+status_t init_conf(jit_conv_gemm_wino_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d, int max_threads) {
+    if (!mayiuse(avx2)) return unimplemented;
+
+    const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
+    const bool is_fwd = cd.prop_kind != prop_kind::backward_data;
+
+    jcp.prop_kind = cd.prop_kind;
+    jcp.mb = src_d.dims()[0];
+    jcp.ic = src_d.dims()[1];
+    jcp.oc = dst_d.dims()[1];
+    jcp.r = 3;
+
+    bool ok = true && !with_groups && weights_d.dims()[2] == jcp.r
+            && weights_d.dims()[3] == jcp.r && cd.strides[0] == 1
+            && cd.strides[1] == 1 && cd.dilates[0] == 0 && cd.dilates[1] == 0
+            && jcp.ic % simd_w == 0 && jcp.oc % simd_w == 0
+            && utils::everyone_is(0, src_d.padded_offsets()[1],
+                    dst_d.padded_offsets()[1]);
+    if (!ok) return unimplemented;
+
+    // The backward data pass pads diff_dst with r - 1 - pad
+    const int t_pad = cd.padding[0][0], l_pad = cd.padding[0][1];
+    if (t_pad < 0 || t_pad >= jcp.r || l_pad < 0 || l_pad >= jcp.r)
+        return unimplemented;
+
+    const int ih = src_d.dims()[2], iw = src_d.dims()[3];
+    const int oh = dst_d.dims()[2], ow = dst_d.dims()[3];
+    jcp.inp_c = is_fwd ? jcp.ic : jcp.oc;
+    jcp.inp_h = is_fwd ? ih : oh;
+    jcp.inp_w = is_fwd ? iw : ow;
+    jcp.out_c = is_fwd ? jcp.oc : jcp.ic;
+    jcp.out_h = is_fwd ? oh : ih;
+    jcp.out_w = is_fwd ? ow : iw;
+    jcp.t_pad = is_fwd ? t_pad : jcp.r - 1 - t_pad;
+    jcp.l_pad = is_fwd ? l_pad : jcp.r - 1 - l_pad;
+
+    // F(4x4, 3x3) does 2.25 times less multiplications than F(2x2, 3x3) per
+    // output point, but covers the output with coarser tiles
+    auto cost = [&](int m) {
+        return (m + 2) * (m + 2) * div_up(jcp.out_h, m) * div_up(jcp.out_w, m);
+    };
+    jcp.m = cost(4) <= cost(2) ? 4 : 2;
+    jcp.alpha = jcp.m + jcp.r - 1;
+    jcp.itiles = div_up(jcp.out_h, jcp.m);
+    jcp.jtiles = div_up(jcp.out_w, jcp.m);
+    jcp.ntiles = jcp.mb * jcp.itiles * jcp.jtiles;
+
+    // The transforms only pay off when the GEMMs are large enough. The
+    // AVX-512 machines have their own Winograd and direct implementations.
+    if (cd.alg_kind == alg_kind::convolution_auto) {
+        const bool is_faster = !mayiuse(avx512_common) && jcp.inp_c >= 64
+                && jcp.out_c >= 64 && jcp.ntiles >= 2 * max_threads;
+        if (!is_faster) return unimplemented;
+    }
+
+    // A block of tiles keeps the transformed input and output in L2 but has
+    // to be large enough for the transformed weights, that are streamed once
+    // per block, not to dominate the memory traffic
+    const int aa = jcp.alpha * jcp.alpha;
+    const size_t tile_sz = sizeof(float) * aa * (jcp.inp_c + jcp.out_c);
+    const int L2_tiles = (int)(get_cache_size(2, true) / tile_sz);
+    const int wei_tiles = jcp.inp_c * jcp.out_c / (jcp.inp_c + jcp.out_c);
+    jcp.tile_block = rnd_up(nstl::max(L2_tiles, wei_tiles), simd_w);
+    jcp.tile_block = nstl::max(simd_w, nstl::min(256, jcp.tile_block));
+    jcp.tile_block = nstl::min(jcp.tile_block,
+            rnd_up(div_up(jcp.ntiles, max_threads), simd_w));
+    jcp.nb_tile_blocks = div_up(jcp.ntiles, jcp.tile_block);
+
+    jcp.with_bias = is_fwd && cd.bias_desc.format_kind != format_kind::undef;
+    jcp.nthr = nstl::min(max_threads, jcp.nb_tile_blocks);
+
+    return success;
+}
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_conv_gemm_wino_conf_t &jcp) {
+    const size_t aa = (size_t)jcp.alpha * jcp.alpha;
+    const size_t V_sz = aa * jcp.tile_block * jcp.inp_c * jcp.nthr;
+    const size_t M_sz = aa * jcp.tile_block * jcp.out_c * jcp.nthr;
+    scratchpad.book(key_wino_V, sizeof(float) * V_sz, PAGE_4K);
+    scratchpad.book(key_wino_M, sizeof(float) * M_sz, PAGE_4K);
+
+    if (jcp.prop_kind == prop_kind::backward_data) {
+        const size_t U_sz = aa * jcp.ic * jcp.oc;
+        scratchpad.book(key_wino_U, sizeof(float) * U_sz, PAGE_4K);
+    }
+}
+
+void init_wino_weights_md(
+        memory_desc_t &wei_md, const jit_conv_gemm_wino_conf_t &jcp) {
+    // With the whole channels in the blocks, the aaOio layout is alpha x
+    // alpha matrices of (ic x oc)
+    wei_md.format_kind = format_kind::wino;
+    wei_md.data_type = data_type::f32;
+    dnnl_wino_desc_t &wd = wei_md.format_desc.wino_desc;
+    wd.wino_format = dnnl_wino_wei_aaOio;
+    wd.r = jcp.r;
+    wd.alpha = jcp.alpha;
+    wd.ic = jcp.ic;
+    wd.oc = jcp.oc;
+    wd.ic_block = jcp.ic;
+    wd.oc_block = jcp.oc;
+    wd.ic2_block = 1;
+    wd.oc2_block = 1;
+    wd.adj_scale = 1.f;
+    wd.size = sizeof(float) * jcp.alpha * jcp.alpha * jcp.ic * jcp.oc;
+}
+
+} // namespace gemm_wino_convolution_utils
+
+void gemm_wino_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const auto &jcp = pd()->jcp_;
+    const wino_post_ops_t p_ops = {sum_scale_, eltwise_};
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    if (jcp.m == 4)
+        execute_data<4>(jcp, src, weights, bias, dst, p_ops, scratchpad);
+    else
+        execute_data<2>(jcp, src, weights, bias, dst, p_ops, scratchpad);
+}
+
+void gemm_wino_convolution_bwd_data_t::execute_backward_data(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const float *, DNNL_ARG_DIFF_DST);
+    auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto diff_src = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC);
+
+    const auto &jcp = pd()->jcp_;
+    const wino_post_ops_t p_ops = {0.f, nullptr};
+    const auto scratchpad = ctx.get_scratchpad_grantor();
+    float *U = scratchpad.get<float>(key_wino_U);
+    if (jcp.m == 4) {
+        weights_transform_bwd_data<4>(jcp, weights, U);
+        execute_data<4>(jcp, diff_dst, U, nullptr, diff_src, p_ops,
+                scratchpad);
+    } else {
+        weights_transform_bwd_data<2>(jcp, weights, U);
+        execute_data<2>(jcp, diff_dst, U, nullptr, diff_src, p_ops,
+                scratchpad);
+    }
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
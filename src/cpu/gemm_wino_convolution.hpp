@@ -0,0 +1,211 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_WINO_CONVOLUTION_HPP
+#define CPU_GEMM_WINO_CONVOLUTION_HPP
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_convolution_pd.hpp"
+#include "cpu_isa_traits.hpp"
+#include "jit_primitive_conf.hpp"
+#include "ref_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Winograd F(4x4, 3x3) and F(2x2, 3x3) convolutions for AVX2.
+ *
+ * A block of output tiles is processed at once: the input tiles are
+ * transformed into alpha * alpha matrices of (tiles x inp_c), each of them is
+ * multiplied by the matching (inp_c x out_c) matrix of the transformed
+ * weights with the JIT GEMM, and the products are transformed back to the
+ * output tiles. The source and destination are nChw8c. */
+namespace gemm_wino_convolution_utils {
+
+status_t init_conf(jit_conv_gemm_wino_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &weights_d,
+        const memory_desc_wrapper &dst_d, int max_threads);
+
+void init_scratchpad(memory_tracking::registrar_t &scratchpad,
+        const jit_conv_gemm_wino_conf_t &jcp);
+
+// The weights of the forward pass are transformed by the wino reorder
+void init_wino_weights_md(
+        memory_desc_t &wei_md, const jit_conv_gemm_wino_conf_t &jcp);
+
+} // namespace gemm_wino_convolution_utils
+
+struct gemm_wino_convolution_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        pd_t(engine_t *engine, const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("gemm_wino:", avx2, ""),
+                gemm_wino_convolution_fwd_t);
+
+        status_t init() {
+            using namespace data_type;
+            using namespace format_tag;
+            bool ok = true && is_fwd() && ndims() == 4
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(f32, f32, f32, f32, f32)
+                    && !has_zero_dim_memory()
+                    && attr()->output_scales_.has_default_values()
+                    && post_ops_ok()
+                    && set_default_formats_common(nChw8c, any, nChw8c)
+                    && memory_desc_matches_tag(*src_md(), nChw8c)
+                    && memory_desc_matches_tag(*dst_md(), nChw8c)
+                    && IMPLICATION(with_bias(),
+                            memory_desc_matches_tag(*weights_md(1), x));
+            if (!ok) return status::unimplemented;
+
+            status_t status = gemm_wino_convolution_utils::init_conf(jcp_,
+                    *desc(), src_md(), weights_md(), dst_md(),
+                    dnnl_get_max_threads());
+            if (status != status::success) return status;
+            set_default_alg_kind(alg_kind::convolution_winograd);
+
+            memory_desc_t expect_wei_md = *weights_md();
+            gemm_wino_convolution_utils::init_wino_weights_md(
+                    expect_wei_md, jcp_);
+            if (weights_md_.format_kind == format_kind::any)
+                weights_md_ = expect_wei_md;
+            if (weights_md_ != expect_wei_md) return status::unimplemented;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            gemm_wino_convolution_utils::init_scratchpad(scratchpad, jcp_);
+
+            return status::success;
+        }
+
+        jit_conv_gemm_wino_conf_t jcp_;
+
+    protected:
+        bool post_ops_ok() const {
+            auto const &po = attr()->post_ops_;
+            auto is_eltwise
+                    = [&](int idx) { return po.entry_[idx].is_eltwise(); };
+            auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(); };
+
+            switch (po.len_) {
+                case 0: return true; // no post_ops
+                case 1: return is_eltwise(0) || is_sum(0); // sum OR eltwise
+                case 2: return is_sum(0) && is_eltwise(1); // sum -> eltwise
+                default: return false;
+            }
+            return false;
+        }
+    };
+
+    gemm_wino_convolution_fwd_t(const pd_t *apd)
+        : primitive_impl_t(apd), sum_scale_(0.f), eltwise_(nullptr) {
+        const auto &post_ops = pd()->attr()->post_ops_;
+        const int sum_idx = post_ops.find(primitive_kind::sum);
+        if (sum_idx != -1) sum_scale_ = post_ops.entry_[sum_idx].sum.scale;
+
+        const int entry_idx = post_ops.find(primitive_kind::eltwise);
+        if (entry_idx != -1)
+            eltwise_ = new ref_eltwise_scalar_fwd_t(
+                    post_ops.entry_[entry_idx].eltwise);
+    }
+
+    ~gemm_wino_convolution_fwd_t() { delete eltwise_; }
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    float sum_scale_;
+    ref_eltwise_scalar_fwd_t *eltwise_;
+};
+
+struct gemm_wino_convolution_bwd_data_t : public primitive_impl_t {
+    struct pd_t : public cpu_convolution_bwd_data_pd_t {
+        pd_t(engine_t *engine, const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_data_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("gemm_wino:", avx2, ""),
+                gemm_wino_convolution_bwd_data_t);
+
+        status_t init() {
+            using namespace data_type;
+            using namespace format_tag;
+            bool ok = true && desc()->prop_kind == prop_kind::backward_data
+                    && ndims() == 4
+                    && utils::one_of(desc()->alg_kind,
+                            alg_kind::convolution_auto,
+                            alg_kind::convolution_winograd)
+                    && expect_data_types(
+                            f32, f32, data_type::undef, f32, f32)
+                    && !has_zero_dim_memory()
+                    && attr()->has_default_values()
+                    && set_default_formats_common(nChw8c, oihw, nChw8c)
+                    && memory_desc_matches_tag(*diff_src_md(), nChw8c)
+                    && memory_desc_matches_tag(*diff_dst_md(), nChw8c)
+                    && memory_desc_matches_tag(*weights_md(), oihw);
+            if (!ok) return status::unimplemented;
+
+            status_t status = gemm_wino_convolution_utils::init_conf(jcp_,
+                    *desc(), diff_src_md(), weights_md(), diff_dst_md(),
+                    dnnl_get_max_threads());
+            if (status != status::success) return status;
+            set_default_alg_kind(alg_kind::convolution_winograd);
+
+            auto scratchpad = scratchpad_registry().registrar();
+            gemm_wino_convolution_utils::init_scratchpad(scratchpad, jcp_);
+
+            return status::success;
+        }
+
+        jit_conv_gemm_wino_conf_t jcp_;
+    };
+
+    gemm_wino_convolution_bwd_data_t(const pd_t *apd)
+        : primitive_impl_t(apd) {}
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward_data(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_backward_data(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
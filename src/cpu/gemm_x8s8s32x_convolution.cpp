@@ -34,13 +34,15 @@ using namespace dnnl::impl::math;
 using namespace dnnl::impl::memory_tracking::names;
 
 template <data_type_t src_type, data_type_t dst_type>
-void _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward(
+status_t _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src_base = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto wei_base = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bia_base = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto dst_base = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
+    DEFINE_SCALES_BUFFER(scales);
+
     auto scratchpad = ctx.get_scratchpad_grantor();
 
     const jit_gemm_conv_conf_t &jcp = this->pd()->jcp_;
@@ -50,9 +52,11 @@ void _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward(
     assert(IMPLICATION(jcp.ow_block != jcp.ow, jcp.oh_block == 1));
 
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
-        execute_forward_thr(
-                ithr, nthr, src_base, wei_base, bia_base, dst_base, scratchpad);
+        execute_forward_thr(ithr, nthr, src_base, wei_base, bia_base, scales,
+                dst_base, scratchpad);
     });
+
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
@@ -508,7 +512,8 @@ void _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::pp_ker_t::operator()(
 template <data_type_t src_type, data_type_t dst_type>
 void _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
         const int ithr, const int nthr, const src_data_t *src_base,
-        const wei_data_t *wei_base, const char *bia_base, dst_data_t *dst_base,
+        const wei_data_t *wei_base, const char *bia_base, const float *scales,
+        dst_data_t *dst_base,
         const memory_tracking::grantor_t &scratchpad) const {
     const jit_gemm_conv_conf_t &jcp = this->pd()->jcp_;
 
@@ -523,8 +528,6 @@ void _gemm_x8s8s32x_convolution_fwd_t<src_type, dst_type>::execute_forward_thr(
     const size_t dst_mb_stride = dst_md.blk_off(1);
     const size_t dst_g_stride = dst_md.blk_off(0, 1) * jcp.oc;
 
-    const float *scales = pd()->attr()->output_scales_.scales_;
-
     const auto &post_ops = pd()->attr()->post_ops_;
     const bool do_sum = post_ops.contain(primitive_kind::sum, 0);
     const float sum_scale = do_sum ? post_ops.entry_[0].sum.scale : 0;
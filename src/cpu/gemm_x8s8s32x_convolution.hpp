@@ -44,7 +44,11 @@ struct _gemm_x8s8s32x_convolution_fwd_t : public primitive_impl_t {
             , jcp_() {}
 
         DECLARE_COMMON_PD_T(IGEMM_S8U8S32_ISA_STR,
-                _gemm_x8s8s32x_convolution_fwd_t, USE_GLOBAL_SCRATCHPAD);
+                _gemm_x8s8s32x_convolution_fwd_t);
+
+        virtual bool supports_runtime_output_scales() const override {
+            return true;
+        }
 
         status_t init() {
             using namespace data_type;
@@ -132,8 +136,7 @@ struct _gemm_x8s8s32x_convolution_fwd_t : public primitive_impl_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
@@ -189,10 +192,10 @@ private:
     };
 
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     void execute_forward_thr(const int ithr, const int nthr,
             const src_data_t *src_base, const wei_data_t *wei_base,
-            const char *bia_base, dst_data_t *dst_base,
+            const char *bia_base, const float *scales, dst_data_t *dst_base,
             const memory_tracking::grantor_t &scratchpad) const;
 
     int nthr_ = 0;
@@ -209,7 +212,7 @@ struct _gemm_u8s8s32x_convolution_bwd_data_t : public primitive_impl_t {
             , jcp_() {}
 
         DECLARE_COMMON_PD_T(IGEMM_S8U8S32_ISA_STR,
-                _gemm_u8s8s32x_convolution_bwd_data_t, USE_GLOBAL_SCRATCHPAD);
+                _gemm_u8s8s32x_convolution_bwd_data_t);
 
         status_t init() {
             using namespace data_type;
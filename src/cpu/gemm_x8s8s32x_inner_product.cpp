@@ -30,13 +30,15 @@ using namespace format_tag;
 using namespace memory_tracking::names;
 
 template <data_type_t src_type, data_type_t dst_type>
-void gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
+status_t gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
+    DEFINE_SCALES_BUFFER(scales);
+
     const int MB = pd()->MB();
     const int OC = pd()->OC();
 
@@ -50,8 +52,6 @@ void gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
     const src_data_t off_b = 0;
     const int32_t off_c = 0;
 
-    const float *scales = pd()->attr()->output_scales_.scales_;
-
     acc_data_t *acc = pd()->dst_is_acc_
             ? (acc_data_t *)dst
             : ctx.get_scratchpad_grantor().template get<acc_data_t>(
@@ -70,6 +70,8 @@ void gemm_x8s8s32x_inner_product_fwd_t<src_type, dst_type>::execute_forward(
             (*pp_kernel_)(dst, acc, bias, scales, start, end);
         });
     }
+
+    return status::success;
 }
 
 using namespace data_type;
@@ -41,7 +41,11 @@ struct gemm_x8s8s32x_inner_product_fwd_t : public primitive_impl_t {
 
         DECLARE_COMMON_PD_T(src_type == data_type::u8 ? IGEMM_S8U8S32_IMPL_STR
                                                       : IGEMM_S8S8S32_IMPL_STR,
-                gemm_x8s8s32x_inner_product_fwd_t, USE_GLOBAL_SCRATCHPAD);
+                gemm_x8s8s32x_inner_product_fwd_t);
+
+        virtual bool supports_runtime_output_scales() const override {
+            return true;
+        }
 
         status_t init() {
             using namespace data_type;
@@ -108,12 +112,11 @@ struct gemm_x8s8s32x_inner_product_fwd_t : public primitive_impl_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 
     inner_product_utils::pp_kernel_t<data_type::s32, dst_type> *pp_kernel_;
@@ -168,6 +168,149 @@ void jit_avx2_1x1_convolution_fwd_t::execute_forward(
     if (pd()->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad();
 }
 
+void jit_avx2_1x1_convolution_fwd_t::execute_forward_with_dw_conv(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
+    auto dw_weights = CTX_IN_MEM(
+            const data_t *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS);
+    auto dw_bias = CTX_IN_MEM(
+            const data_t *, DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper weights_d(pd()->weights_md(0));
+    const memory_desc_wrapper dw_weights_d(pd()->weights_md(2));
+
+    const auto &jcp = kernel_->jcp;
+    const auto &jcp_dw = pd()->dw_jcp_;
+    auto row_buffer = ctx.get_scratchpad_grantor().get<data_t>(
+            key_conv_dw_row_buffer);
+
+    const size_t row_size = (size_t)jcp.ow * jcp.oc_block;
+    const int str_h = jcp_dw.stride_h;
+    const int str_w = jcp_dw.stride_w;
+
+    // computes the row ih of the 1x1 convolution for the output block ocb
+    auto compute_row = [&](int n, int ocb, int ih, data_t *row) {
+        auto p = jit_1x1_conv_call_s();
+
+        p.bcast_dim = jcp.ow;
+        p.load_dim = jcp.oc_block;
+        p.output_data = row;
+        p.bias_data = bias ? &bias[ocb * jcp.oc_block] : nullptr;
+
+        for (int icb = 0; icb < jcp.nb_reduce; icb += jcp.nb_reduce_blocking) {
+            p.first_last_flag = 0 | (icb == 0 ? FLAG_REDUCE_FIRST : 0)
+                    | (icb + jcp.nb_reduce_blocking >= jcp.nb_reduce
+                                    ? FLAG_REDUCE_LAST
+                                    : 0);
+
+            p.reduce_dim = this_block_size(icb * jcp.ic_block, jcp.ic,
+                    jcp.nb_reduce_blocking * jcp.ic_block);
+
+            p.load_data = &weights[weights_d.blk_off(ocb, icb)];
+            p.bcast_data = &src[src_d.blk_off(n, icb, ih, 0)];
+
+            kernel_->jit_ker(&p);
+        }
+    };
+
+    // computes the row oh of the depthwise convolution, the rows in use
+    // start at the row ih of the 1x1 convolution
+    auto compute_dw_row = [&](int n, int ocb, int oh, int kh, int kh_padding,
+                                  const data_t *rows) {
+        auto dw_ker = [&](int ur_w_step, int ow) {
+            auto par_conv = jit_conv_call_s();
+
+            const int i_l_overflow = nstl::max(0, jcp_dw.l_pad - ow * str_w);
+            const int i_r_overflow = nstl::max(jcp_dw.iw,
+                                             ow * str_w + jcp_dw.kw
+                                                     - jcp_dw.l_pad)
+                    - jcp_dw.iw;
+
+            const int iw = nstl::max(ow * str_w - jcp_dw.l_pad, 0);
+            const int kw = i_l_overflow;
+            const int kw_padding = jcp_dw.kw - i_l_overflow - i_r_overflow;
+
+            par_conv.src = &rows[iw * jcp_dw.ch_block];
+            par_conv.dst = &dst[dst_d.blk_off(n, ocb, oh, ow)];
+            par_conv.filt
+                    = &dw_weights[dw_weights_d.blk_off(ocb, 0, 0, kh, kw)];
+            par_conv.bias = &dw_bias[ocb * jcp_dw.ch_block];
+
+            par_conv.kh_padding = (size_t)nstl::max(0, kh_padding);
+            par_conv.kw_padding = (size_t)nstl::max(0, kw_padding);
+
+            par_conv.ur_w = (size_t)ur_w_step;
+            par_conv.ch_blocks = 1;
+
+            dw_kernel_->jit_ker(&par_conv);
+        };
+
+        // left border
+        int ow = 0;
+        int l_border = nstl::min(div_up(jcp_dw.l_pad, str_w), jcp_dw.ow);
+        for (; ow < l_border; ow++)
+            dw_ker(1, ow);
+
+        // main loop
+        int ur_w_step = (jcp_dw.iw - jcp_dw.kw + jcp_dw.l_pad) / str_w - ow + 1;
+        if (ur_w_step > 0) {
+            dw_ker(ur_w_step, ow);
+            ow += ur_w_step;
+        }
+
+        // right border
+        for (; ow < jcp_dw.ow; ow++)
+            dw_ker(1, ow);
+    };
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        data_t *rows = row_buffer + ithr * jcp_dw.kh * row_size;
+
+        const int work_amount = jcp.mb * jcp.nb_load * jcp_dw.oh;
+        int start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        int n {0}, ocb {0}, oh {0};
+        nd_iterator_init(start, n, jcp.mb, ocb, jcp.nb_load, oh, jcp_dw.oh);
+
+        // the rows [row_start, row_start + row_count) of the 1x1 output are
+        // kept in the buffer for the current (n, ocb)
+        int row_start = 0, row_count = 0;
+        for (int iwork = start; iwork < end; ++iwork) {
+            if (oh == 0 || iwork == start) row_count = 0;
+
+            const int ih_virt = oh * str_h - jcp_dw.t_pad;
+            const int ih_s = nstl::max(ih_virt, 0);
+            const int ih_e = nstl::min(ih_virt + jcp_dw.kh, jcp_dw.ih);
+
+            // reuse the rows shared with the previous output row
+            const int keep = row_start + row_count - ih_s;
+            if (row_count > 0 && ih_s >= row_start && keep > 0) {
+                if (ih_s != row_start)
+                    utils::array_copy(rows,
+                            rows + (ih_s - row_start) * row_size,
+                            keep * row_size);
+                row_count = keep;
+            } else
+                row_count = 0;
+            row_start = ih_s;
+
+            for (int ih = row_start + row_count; ih < ih_e; ++ih)
+                compute_row(n, ocb, ih, rows + (ih - row_start) * row_size);
+            row_count = ih_e - row_start;
+
+            compute_dw_row(n, ocb, oh, ih_s - ih_virt, ih_e - ih_s, rows);
+
+            nd_iterator_step(n, jcp.mb, ocb, jcp.nb_load, oh, jcp_dw.oh);
+        }
+    });
+}
+
 /* convolution backward wtr data */
 
 void jit_avx2_1x1_convolution_bwd_data_t::execute_backward_data(
@@ -27,12 +27,15 @@
 
 #include "jit_avx2_1x1_conv_kernel_f32.hpp"
 #include "jit_uni_1x1_conv_utils.hpp"
+#include "jit_uni_dw_conv_kernel_utils.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct jit_avx2_1x1_convolution_fwd_t : public primitive_impl_t {
+    typedef jit_uni_dw_conv_fwd_kernel<avx2, data_type::f32> dw_kernel_t;
+
     // TODO: (Roma) Code duplication duplication! Remove with templates
     //              (maybe...)!
     struct pd_t : public cpu_convolution_fwd_pd_t {
@@ -41,7 +44,8 @@ struct jit_avx2_1x1_convolution_fwd_t : public primitive_impl_t {
                 const typename pd_t::base_class *hint_fwd_pd)
             : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
             , jcp_()
-            , rtus_() {}
+            , rtus_()
+            , dw_jcp_() {}
 
         DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_1x1:", avx2, ""),
                 jit_avx2_1x1_convolution_fwd_t);
@@ -56,10 +60,19 @@ struct jit_avx2_1x1_convolution_fwd_t : public primitive_impl_t {
 
             const convolution_desc_t *conv_d = desc();
             const memory_desc_t *src_d = src_md();
-            rtus_prepare(this, conv_d, src_d, dst_md());
+            // dst_md() is the depthwise convolution destination when fused
+            rtus_prepare(this, conv_d, src_d, &dst_md_);
+
+            // the post operations preceding the fused depthwise convolution
+            // are applied by the 1x1 kernel, the following ones by the
+            // depthwise kernel
+            const int dw_idx
+                    = attr()->post_ops_.find(primitive_kind::convolution);
+            conv_attr_ = *attr();
+            if (dw_idx != -1) conv_attr_.post_ops_.len_ = dw_idx;
 
-            status_t status = jit_avx2_1x1_conv_kernel_f32::init_conf(
-                    jcp_, *conv_d, *src_d, *weights_md(), *dst_md(), *attr());
+            status_t status = jit_avx2_1x1_conv_kernel_f32::init_conf(jcp_,
+                    *conv_d, *src_d, *weights_md(), dst_md_, conv_attr_);
             if (status != status::success) return status;
 
             auto scratchpad = scratchpad_registry().registrar();
@@ -67,13 +80,121 @@ struct jit_avx2_1x1_convolution_fwd_t : public primitive_impl_t {
 
             rtus_prepare_space_info(this, scratchpad);
 
+            if (dw_idx != -1) return init_dw_conv(dw_idx);
+
             return status::success;
         }
 
+        virtual arg_usage_t arg_usage(int arg) const override {
+            if (with_dw_conv()
+                    && utils::one_of(arg,
+                            DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+                            DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS))
+                return arg_usage_t::input;
+
+            return cpu_convolution_fwd_pd_t::arg_usage(arg);
+        }
+
+        virtual const memory_desc_t *arg_md(int arg) const override {
+            if (with_dw_conv()) {
+                if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS))
+                    return weights_md(2);
+                if (arg == (DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS))
+                    return weights_md(3);
+            }
+            return cpu_convolution_fwd_pd_t::arg_md(arg);
+        }
+
+        virtual const memory_desc_t *dst_md(int index = 0) const override {
+            if (index == 0 && with_dw_conv()) return &dw_dst_md_;
+            return cpu_convolution_fwd_pd_t::dst_md(index);
+        }
+
+        virtual const memory_desc_t *weights_md(int index = 0) const override {
+            if (with_dw_conv()) {
+                if (index == 2) return &dw_weights_md_;
+                if (index == 3) return &dw_bias_md_;
+            }
+            return cpu_convolution_fwd_pd_t::weights_md(index);
+        }
+
+        virtual int n_inputs() const override {
+            return cpu_convolution_fwd_pd_t::n_inputs() + 2 * with_dw_conv();
+        }
+
+        bool with_dw_conv() const {
+            return attr()->post_ops_.find(primitive_kind::convolution) != -1;
+        }
+
         jit_1x1_conv_conf_t jcp_;
         reduce_to_unit_stride_t rtus_;
 
+        primitive_attr_t conv_attr_;
+        jit_conv_conf_t dw_jcp_;
+
     protected:
+        memory_desc_t dw_weights_md_;
+        memory_desc_t dw_bias_md_;
+        memory_desc_t dw_dst_md_;
+
+        /* The 1x1 convolution output is never stored: the rows needed by
+         * the depthwise convolution are computed in a per-thread buffer
+         * right before the depthwise kernel consumes them. */
+        status_t init_dw_conv(int dw_idx) {
+            using namespace format_tag;
+            using namespace memory_tracking::names;
+            const auto &po = attr()->post_ops_;
+            const auto &dw = po.entry_[dw_idx].dw_conv;
+
+            bool ok = true && ndims() == 4 && !rtus_.reduce_src_
+                    && jcp_.oc == jcp_.oc_without_padding
+                    && conv_attr_.post_ops_.find(primitive_kind::sum) == -1;
+            if (!ok) return status::unimplemented;
+
+            for (int i = dw_idx + 1; i < po.len_; ++i)
+                dw_attr_.post_ops_.entry_[dw_attr_.post_ops_.len_++]
+                        = po.entry_[i];
+
+            const dim_t k = dw.kernel, str = dw.stride, pad = dw.padding;
+            const dim_t dw_oh = (OH() + 2 * pad - k) / str + 1;
+            const dim_t dw_ow = (OW() + 2 * pad - k) / str + 1;
+            if (dw_oh <= 0 || dw_ow <= 0) return status::unimplemented;
+
+            dims_t dst_dims = {MB(), OC(), dw_oh, dw_ow};
+            dims_t wei_dims = {OC(), 1, 1, k, k};
+            dims_t bia_dims = {OC()};
+            CHECK(dnnl_memory_desc_init_by_tag(
+                    &dw_dst_md_, 4, dst_dims, data_type::f32, nChw8c));
+            CHECK(dnnl_memory_desc_init_by_tag(
+                    &dw_weights_md_, 5, wei_dims, data_type::f32, Goihw8g));
+            CHECK(dnnl_memory_desc_init_by_tag(
+                    &dw_bias_md_, 1, bia_dims, data_type::f32, x));
+
+            convolution_desc_t dw_cd;
+            dims_t strides = {str, str}, padding = {pad, pad};
+            CHECK(conv_desc_init(&dw_cd, prop_kind::forward_inference,
+                    alg_kind::convolution_direct, &dst_md_, &dw_weights_md_,
+                    &dw_bias_md_, &dw_dst_md_, strides, nullptr, padding,
+                    padding));
+
+            status_t status = dw_kernel_t::init_conf(dw_jcp_, dw_cd, dst_md_,
+                    dw_weights_md_, dw_dst_md_, dw_attr_);
+            if (status != status::success) return status;
+
+            // a single row of the 1x1 output holds a single channel block
+            dw_jcp_.nb_ch_blocking = 1;
+            jcp_.ur_tail = jcp_.ow % jcp_.ur;
+
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(key_conv_dw_row_buffer,
+                    sizeof(float) * dnnl_get_max_threads() * dw_jcp_.kh
+                            * jcp_.ow * jcp_.oc_block);
+
+            return status::success;
+        }
+
+        primitive_attr_t dw_attr_;
+
         bool set_default_formats() {
             using namespace format_tag;
 
@@ -90,28 +211,40 @@ struct jit_avx2_1x1_convolution_fwd_t : public primitive_impl_t {
     friend void init_rtus_driver(conv_t *self);
 
     jit_avx2_1x1_convolution_fwd_t(const pd_t *apd)
-        : primitive_impl_t(apd), kernel_(nullptr), rtus_driver_(nullptr) {
-        kernel_ = new jit_avx2_1x1_conv_kernel_f32(pd()->jcp_, *pd()->attr());
+        : primitive_impl_t(apd)
+        , kernel_(nullptr)
+        , dw_kernel_(nullptr)
+        , rtus_driver_(nullptr) {
+        kernel_ = new jit_avx2_1x1_conv_kernel_f32(
+                pd()->jcp_, pd()->conv_attr_);
+        if (pd()->with_dw_conv())
+            dw_kernel_ = new dw_kernel_t(pd()->dw_jcp_);
         init_rtus_driver<avx2>(this);
     }
 
     ~jit_avx2_1x1_convolution_fwd_t() {
         delete kernel_;
+        delete dw_kernel_;
         delete rtus_driver_;
     }
 
     typedef typename prec_traits<data_type::f32>::type data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
+        if (pd()->with_dw_conv())
+            execute_forward_with_dw_conv(ctx);
+        else
+            execute_forward(ctx);
         return status::success;
     }
 
 private:
     void execute_forward(const exec_ctx_t &ctx) const;
+    void execute_forward_with_dw_conv(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 
     jit_avx2_1x1_conv_kernel_f32 *kernel_;
+    dw_kernel_t *dw_kernel_;
     rtus_driver_t<avx2> *rtus_driver_;
 };
 
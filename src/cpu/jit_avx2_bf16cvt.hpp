@@ -0,0 +1,226 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_AVX2_BF16CVT_HPP
+#define JIT_AVX2_BF16CVT_HPP
+
+#include "c_types_map.hpp"
+
+#include "bfloat16.hpp"
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+#define GET_OFF(field) offsetof(bf16_support::jit_call_t, field)
+
+// Bulk bf16 <-> f32 conversions for the machines without avx512_core.
+// The kernels process the elements by blocks of simd_w, the remaining
+// (size % simd_w) elements are left to the caller.
+// The f32 -> bf16 conversion matches bfloat16_t::operator=(float): round to
+// nearest even, denormals are flushed to the signed zero and NaNs are quiet.
+struct jit_avx2_cvt_ps_to_bf16_base_t : public jit_generator {
+    static constexpr int simd_w = 8;
+
+    void (*jit_ker)(bf16_support::jit_call_t *);
+
+protected:
+    void init_cvt_ps_to_bf16() {
+        auto bcast = [&](Xbyak::Ymm ymm, uint32_t v) {
+            mov(reg32_scratch, v);
+            vmovd(Xbyak::Xmm(ymm.getIdx()), reg32_scratch);
+            vpbroadcastd(ymm, Xbyak::Xmm(ymm.getIdx()));
+        };
+        bcast(ymm_one, 0x1);
+        bcast(ymm_even, 0x7fff);
+        bcast(ymm_qnan, 0x40);
+        bcast(ymm_exp, 0x7f800000);
+        bcast(ymm_sign, 0x8000);
+        vpxor(ymm_zero, ymm_zero, ymm_zero);
+    }
+
+    // converts ymm_inp and stores the 8 bf16 values to out
+    void cvt_ps_to_bf16(const Xbyak::Address &out) {
+        // round to nearest even
+        vpsrld(ymm_res, ymm_inp, 16);
+        vpand(ymm_res, ymm_res, ymm_one);
+        vpaddd(ymm_res, ymm_res, ymm_even);
+        vpaddd(ymm_res, ymm_res, ymm_inp);
+        vpsrld(ymm_res, ymm_res, 16);
+        // NaN: truncate and force the quiet bit
+        vpsrld(ymm_tmp, ymm_inp, 16);
+        vpor(ymm_tmp, ymm_tmp, ymm_qnan);
+        vcmpunordps(ymm_mask, ymm_inp, ymm_inp);
+        vblendvps(ymm_res, ymm_res, ymm_tmp, ymm_mask);
+        // zero and denormals: keep the sign only
+        vpand(ymm_mask, ymm_inp, ymm_exp);
+        vpcmpeqd(ymm_mask, ymm_mask, ymm_zero);
+        vpsrld(ymm_tmp, ymm_inp, 16);
+        vpand(ymm_tmp, ymm_tmp, ymm_sign);
+        vblendvps(ymm_res, ymm_res, ymm_tmp, ymm_mask);
+        // pack the 16 lower bits of each dword
+        vextracti128(xmm_tmp, ymm_res, 1);
+        vpackusdw(xmm_res, xmm_res, xmm_tmp);
+        vmovdqu(out, xmm_res);
+    }
+
+    Xbyak::Ymm ymm_inp = Xbyak::Ymm(0);
+    Xbyak::Ymm ymm_res = Xbyak::Ymm(1);
+    Xbyak::Xmm xmm_res = Xbyak::Xmm(1);
+    Xbyak::Ymm ymm_tmp = Xbyak::Ymm(2);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(2);
+    Xbyak::Ymm ymm_mask = Xbyak::Ymm(3);
+    Xbyak::Ymm ymm_one = Xbyak::Ymm(4);
+    Xbyak::Ymm ymm_even = Xbyak::Ymm(5);
+    Xbyak::Ymm ymm_qnan = Xbyak::Ymm(6);
+    Xbyak::Ymm ymm_exp = Xbyak::Ymm(7);
+    Xbyak::Ymm ymm_sign = Xbyak::Ymm(8);
+    Xbyak::Ymm ymm_zero = Xbyak::Ymm(9);
+
+    Xbyak::Reg64 reg_inp = rax;
+    Xbyak::Reg64 reg_out = rbx;
+    Xbyak::Reg64 reg_add = r11;
+    Xbyak::Reg64 reg_size = rdx;
+    Xbyak::Reg32 reg32_scratch = r8d;
+};
+
+struct jit_avx2_cvt_ps_to_bf16_t : public jit_avx2_cvt_ps_to_bf16_base_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_cvt_ps_to_bf16)
+
+    jit_avx2_cvt_ps_to_bf16_t() {
+        generate();
+        jit_ker = (void (*)(bf16_support::jit_call_t *))getCode();
+    }
+
+    void generate() {
+        preamble();
+
+        mov(reg_inp, ptr[abi_param1 + GET_OFF(inp)]);
+        mov(reg_out, ptr[abi_param1 + GET_OFF(out)]);
+        mov(reg_size, ptr[abi_param1 + GET_OFF(size)]);
+
+        init_cvt_ps_to_bf16();
+
+        Xbyak::Label l_loop, l_end;
+        L(l_loop);
+        {
+            cmp(reg_size, simd_w);
+            jl(l_end, T_NEAR);
+            vmovups(ymm_inp, ptr[reg_inp]);
+            cvt_ps_to_bf16(ptr[reg_out]);
+            add(reg_inp, simd_w * sizeof(float));
+            add(reg_out, simd_w * sizeof(bfloat16_t));
+            sub(reg_size, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_end);
+
+        postamble();
+    }
+};
+
+struct jit_avx2_add_cvt_ps_to_bf16_t : public jit_avx2_cvt_ps_to_bf16_base_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_add_cvt_ps_to_bf16)
+
+    jit_avx2_add_cvt_ps_to_bf16_t() {
+        generate();
+        jit_ker = (void (*)(bf16_support::jit_call_t *))getCode();
+    }
+
+    void generate() {
+        preamble();
+
+        mov(reg_inp, ptr[abi_param1 + GET_OFF(inp)]);
+        mov(reg_add, ptr[abi_param1 + GET_OFF(add)]);
+        mov(reg_out, ptr[abi_param1 + GET_OFF(out)]);
+        mov(reg_size, ptr[abi_param1 + GET_OFF(size)]);
+
+        init_cvt_ps_to_bf16();
+
+        Xbyak::Label l_loop, l_end;
+        L(l_loop);
+        {
+            cmp(reg_size, simd_w);
+            jl(l_end, T_NEAR);
+            vmovups(ymm_inp, ptr[reg_inp]);
+            vaddps(ymm_inp, ymm_inp, ptr[reg_add]);
+            cvt_ps_to_bf16(ptr[reg_out]);
+            add(reg_inp, simd_w * sizeof(float));
+            add(reg_add, simd_w * sizeof(float));
+            add(reg_out, simd_w * sizeof(bfloat16_t));
+            sub(reg_size, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_end);
+
+        postamble();
+    }
+};
+
+struct jit_avx2_cvt_bf16_to_ps_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_cvt_bf16_to_ps)
+
+    static constexpr int simd_w = 8;
+
+    jit_avx2_cvt_bf16_to_ps_t() {
+        generate();
+        jit_ker = (void (*)(bf16_support::jit_call_t *))getCode();
+    }
+
+    void generate() {
+        preamble();
+
+        mov(reg_inp, ptr[abi_param1 + GET_OFF(inp)]);
+        mov(reg_out, ptr[abi_param1 + GET_OFF(out)]);
+        mov(reg_size, ptr[abi_param1 + GET_OFF(size)]);
+
+        Xbyak::Label l_loop, l_end;
+        L(l_loop);
+        {
+            cmp(reg_size, simd_w);
+            jl(l_end, T_NEAR);
+            vpmovzxwd(ymm_out, ptr[reg_inp]);
+            vpslld(ymm_out, ymm_out, 16);
+            vmovups(ptr[reg_out], ymm_out);
+            add(reg_inp, simd_w * sizeof(bfloat16_t));
+            add(reg_out, simd_w * sizeof(float));
+            sub(reg_size, simd_w);
+            jmp(l_loop, T_NEAR);
+        }
+        L(l_end);
+
+        postamble();
+    }
+
+    void (*jit_ker)(bf16_support::jit_call_t *);
+
+private:
+    Xbyak::Ymm ymm_out = Xbyak::Ymm(0);
+
+    Xbyak::Reg64 reg_inp = rax;
+    Xbyak::Reg64 reg_out = rbx;
+    Xbyak::Reg64 reg_size = rdx;
+};
+
+#undef GET_OFF
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
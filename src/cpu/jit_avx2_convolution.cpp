@@ -44,7 +44,6 @@ using namespace dnnl::impl::utils;
 
 void jit_avx2_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
-    auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const data_t *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
@@ -60,6 +59,8 @@ void jit_avx2_convolution_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
             = jcp.mb * jcp.ngroups * ocb_work * jcp.od * jcp.oh;
 
     auto ker = [&](const int ithr, const int nthr) {
+        // The copy of the weights on the NUMA node of the thread, if any
+        auto weights = CTX_IN_LOCAL_MEM(const data_t *, DNNL_ARG_WEIGHTS);
         size_t start {0}, end {0};
         balance211(work_amount, nthr, ithr, start, end);
 
@@ -39,7 +39,6 @@ template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type>
 void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
         dst_type>::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
-    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const dst_data_t *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
@@ -56,6 +55,8 @@ void jit_avx512_common_1x1_convolution_fwd_t<src_type, wei_type,
     }
 
     parallel(0, [&](const int ithr, const int nthr) {
+        // Replicated weights are read from the node of the thread
+        auto weights = CTX_IN_LOCAL_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
         execute_forward_thr(ithr, nthr, src, weights, bias, dst, scratchpad);
     });
 
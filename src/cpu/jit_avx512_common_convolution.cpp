@@ -165,7 +165,6 @@ template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type>
 void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         dst_type>::execute_forward_1d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
-    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const dst_data_t *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
@@ -188,6 +187,8 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         nthr = dnnl_get_max_threads();
 
     parallel(nthr, [&](const int ithr, const int nthr) {
+        // The copy of the weights on the NUMA node of the thread, if any
+        auto weights = CTX_IN_LOCAL_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
         int start {0}, end {0}, start_copy;
         balance211(work_amount, nthr, ithr, start, end);
         start_copy = start;
@@ -260,7 +261,6 @@ template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type>
 void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         dst_type>::execute_forward_2d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
-    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const dst_data_t *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
@@ -283,6 +283,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         nthr = dnnl_get_max_threads();
 
     parallel(nthr, [&](const int ithr, const int nthr) {
+        auto weights = CTX_IN_LOCAL_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
         int start {0}, end {0}, start_copy;
         balance211(work_amount, nthr, ithr, start, end);
         start_copy = start;
@@ -388,7 +389,6 @@ template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type>
 void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
         dst_type>::execute_forward_3d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
-    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const dst_data_t *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
@@ -403,6 +403,7 @@ void jit_avx512_common_convolution_fwd_t<src_type, wei_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     parallel(0, [&](const int ithr, const int nthr) {
+        auto weights = CTX_IN_LOCAL_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
         int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
         int start {0}, end {0}, start_copy;
         int work_amount = jcp.mb * jcp.ngroups * oc_chunks * jcp.od * jcp.oh
@@ -93,8 +93,7 @@ struct jit_avx512_common_convolution_winograd_fwd_t
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_wino:", avx512_common, ""),
-                jit_avx512_common_convolution_winograd_fwd_t,
-                USE_GLOBAL_SCRATCHPAD);
+                jit_avx512_common_convolution_winograd_fwd_t);
 
         status_t init() {
             bool ok = true && is_fwd()
@@ -165,8 +164,7 @@ struct jit_avx512_common_convolution_winograd_bwd_data_t
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_wino:", avx512_common, ""),
-                jit_avx512_common_convolution_winograd_bwd_data_t,
-                USE_GLOBAL_SCRATCHPAD);
+                jit_avx512_common_convolution_winograd_bwd_data_t);
 
         status_t init() {
             bool ok = true && desc()->prop_kind == prop_kind::backward_data
@@ -235,8 +233,7 @@ struct jit_avx512_common_convolution_winograd_bwd_weights_t
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_wino:", avx512_common, ""),
-                jit_avx512_common_convolution_winograd_bwd_weights_t,
-                USE_GLOBAL_SCRATCHPAD);
+                jit_avx512_common_convolution_winograd_bwd_weights_t);
 
         status_t init() {
             bool ok = true && desc()->prop_kind == prop_kind::backward_weights
@@ -122,7 +122,7 @@ struct jit_avx512_core_f32_wino_conv_4x3_fwd_t
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_wino_4x3:", avx512_core, ""),
-                jit_avx512_core_f32_wino_conv_4x3_fwd_t, USE_GLOBAL_SCRATCHPAD);
+                jit_avx512_core_f32_wino_conv_4x3_fwd_t);
 
         status_t init() {
             bool ok = true && dnnl_thr_syncable() && is_fwd()
@@ -203,8 +203,7 @@ struct jit_avx512_core_f32_wino_conv_4x3_bwd_data_t
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_wino_4x3:", avx512_core, ""),
-                jit_avx512_core_f32_wino_conv_4x3_bwd_data_t,
-                USE_GLOBAL_SCRATCHPAD);
+                jit_avx512_core_f32_wino_conv_4x3_bwd_data_t);
 
         status_t init() {
             bool ok = true && dnnl_thr_syncable()
@@ -285,8 +284,7 @@ struct jit_avx512_core_f32_wino_conv_4x3_bwd_weights_t
 
         DECLARE_COMMON_PD_T(
                 JIT_IMPL_NAME_HELPER("jit_wino_4x3:", avx512_core, ""),
-                jit_avx512_core_f32_wino_conv_4x3_bwd_weights_t,
-                USE_GLOBAL_SCRATCHPAD);
+                jit_avx512_core_f32_wino_conv_4x3_bwd_weights_t);
 
         status_t init() {
             bool ok = true && dnnl_thr_syncable()
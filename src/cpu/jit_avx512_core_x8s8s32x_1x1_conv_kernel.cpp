@@ -798,7 +798,9 @@ void jit_avx512_core_x8s8s32x_1x1_conv_kernel::init_scratchpad(
     using namespace dnnl::impl::memory_tracking::names;
 
     if (jcp.signed_input && jcp.ver != ver_vnni) {
-        dim_t count = nstl::max<dim_t>(attr.output_scales_.count_, 16);
+        dim_t count = nstl::max<dim_t>(
+                jcp.is_oc_scale ? jcp.ngroups * jcp.oc_without_padding : 1,
+                16);
         scratchpad.book(key_conv_adjusted_scales, sizeof(float) * count);
     }
 }
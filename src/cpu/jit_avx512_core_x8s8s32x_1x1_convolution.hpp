@@ -48,6 +48,10 @@ struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t
                                     ""),
                 jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t);
 
+        virtual bool supports_runtime_output_scales() const override {
+            return true;
+        }
+
         status_t init() {
             bool ok = true && is_fwd()
                     && set_default_alg_kind(alg_kind::convolution_direct)
@@ -137,15 +141,14 @@ struct jit_avx512_core_x8s8s32x_1x1_convolution_fwd_t
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     void execute_forward_thr(const int ithr, const int nthr,
             const src_data_t *src, const wei_data_t *weights, const char *bias,
-            dst_data_t *dst,
+            const float *oscales, dst_data_t *dst,
             const memory_tracking::grantor_t &scratchpad) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 
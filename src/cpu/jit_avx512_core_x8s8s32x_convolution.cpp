@@ -38,7 +38,7 @@ using jit_conv_ker_t = void (*)(jit_conv_call_s *);
                          : (d).blk_off(__VA_ARGS__))
 
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
+status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_1d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -58,11 +58,11 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(oscales);
     if (jcp.signed_input && jcp.ver != ver_vnni) {
         auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
                 key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
+        size_t count = jcp.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(local_scales, oscales[0] * factor, 16);
@@ -153,10 +153,11 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
             }
         }
     });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
+status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_2d(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -178,11 +179,11 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(oscales);
     if (jcp.signed_input && jcp.ver != ver_vnni) {
         auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
                 key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
+        size_t count = jcp.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(local_scales, oscales[0] * factor, 16);
@@ -305,10 +306,11 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
             }
         }
     });
+    return status::success;
 }
 
 template <data_type_t src_type, data_type_t dst_type>
-void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
+status_t jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
         dst_type>::execute_forward_2d_dw(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
@@ -332,11 +334,11 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
     assert(jcp.nb_oc_blocking == 1);
     assert(jcp.nb_ch % jcp.nb_ch_blocking == 0);
 
-    const float *oscales = pd()->attr()->output_scales_.scales_;
+    DEFINE_SCALES_BUFFER(oscales);
     if (jcp.signed_input && jcp.ver != ver_vnni) {
         auto local_scales = ctx.get_scratchpad_grantor().template get<float>(
                 key_conv_adjusted_scales);
-        size_t count = pd()->attr()->output_scales_.count_;
+        size_t count = jcp.is_oc_scale ? pd()->OC() : 1;
         float factor = 1.f / pd()->jcp_.wei_adj_scale;
         if (count == 1) {
             utils::array_set(local_scales, oscales[0] * factor, 16);
@@ -406,6 +408,7 @@ void jit_avx512_core_x8s8s32x_convolution_fwd_t<src_type,
 
                 kernel_->jit_ker(&p);
             });
+    return status::success;
 }
 
 template struct jit_avx512_core_x8s8s32x_convolution_fwd_t<data_type::s8,
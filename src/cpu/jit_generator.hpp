@@ -23,6 +23,7 @@
 #include "utils.hpp"
 
 #include "cpu_isa_traits.hpp"
+#include "cpu_topology.hpp"
 #include "jit_utils/jit_utils.hpp"
 
 #if defined(_WIN32) && !defined(__GNUC__)
@@ -105,29 +106,6 @@ static const Xbyak::Reg64 abi_param1(Xbyak::Operand::RDI),
 #endif
 #endif
 
-inline unsigned int get_cache_size(int level, bool per_core = true) {
-    unsigned int l = level - 1;
-    // Currently, if XByak is not able to fetch the cache topology
-    // we default to 32KB of L1, 512KB of L2 and 1MB of L3 per core.
-    if (cpu.getDataCacheLevels() == 0) {
-        const int L1_cache_per_core = 32000;
-        const int L2_cache_per_core = 512000;
-        const int L3_cache_per_core = 1024000;
-        int num_cores = per_core ? 1 : dnnl_get_max_threads();
-        switch (l) {
-            case (0): return L1_cache_per_core * num_cores;
-            case (1): return L2_cache_per_core * num_cores;
-            case (2): return L3_cache_per_core * num_cores;
-            default: return 0;
-        }
-    }
-    if (l < cpu.getDataCacheLevels()) {
-        return cpu.getDataCacheSize(l)
-                / (per_core ? cpu.getCoresSharingDataCache(l) : 1);
-    } else
-        return 0;
-}
-
 } // namespace
 
 class jit_generator : public Xbyak::CodeGenerator {
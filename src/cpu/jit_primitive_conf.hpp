@@ -464,6 +464,74 @@ struct jit_gemm_conv_conf_t {
     int nthr_oc;
 };
 
+// The Winograd F(m x m, 3x3) convolution with the products done by GEMMs.
+// The forward pass transforms src into dst; the backward data pass is the
+// same computation transforming diff_dst into diff_src with flipped weights,
+// so the conf describes the transformed (inp) and the produced (out) tensors.
+struct jit_conv_gemm_wino_conf_t {
+    prop_kind_t prop_kind;
+
+    int mb;
+    int ic, oc; // of the convolution
+    int inp_c, inp_h, inp_w;
+    int out_c, out_h, out_w;
+    int t_pad, l_pad; // of inp
+
+    int m, r, alpha;
+    int itiles, jtiles, ntiles;
+    int tile_block, nb_tile_blocks;
+
+    bool with_bias;
+    int nthr;
+};
+
+struct jit_conv_fft_conf_t {
+    int mb;
+    int ic, oc;
+    int ih, iw, oh, ow; // 1D convolutions have ih = oh = 1
+    int kh, kw;
+    int stride_h, stride_w;
+    int dilate_h, dilate_w;
+    int t_pad, l_pad;
+
+    // The strided convolution is split into stride_h * stride_w phases of
+    // unit stride, each phase is a set of ic channels of the decimated input
+    int nphases, ic_ph;
+    int kh_ph, kw_ph; // of the dilated and decimated weights
+
+    int lh, lw; // the FFT sizes, powers of 2
+    int th, tw; // the outputs of a tile
+    int htiles, wtiles, ntiles;
+    int nbins; // lh * (lw / 2 + 1), the rest follows from the symmetry
+    int tile_block, nb_tile_blocks;
+
+    bool with_bias;
+    int nthr;
+};
+
+// The sub-pixel deconvolution: the outputs oh = qh * stride_h + rh - t_pad of
+// the phase rh take only the kernel taps kh with
+// kh * (dilate_h + 1) % stride_h == rh, so each of the stride_h * stride_w
+// phases is a dense convolution of unit stride.
+struct jit_deconv_gemm_conf_t {
+    int mb, ngroups;
+    int ic, oc; // per group
+    int ih, iw, oh, ow; // 1D deconvolutions have ih = oh = 1
+    int kh, kw;
+    int stride_h, stride_w;
+    int dilate_h, dilate_w;
+    int t_pad, l_pad;
+
+    int nphases;
+    int max_k; // the largest ic * taps of the phases, the rows of the col
+    int max_qh, max_qw; // the largest outputs of the phases
+    int qh_block, nb_qh; // the rows of the outputs a GEMM computes
+
+    bool with_bias;
+    bool outer_threading;
+    int nthr;
+};
+
 struct jit_1x1_conv_call_s {
     const void *bcast_data;
     const void *load_data;
@@ -494,6 +562,7 @@ struct jit_pool_conf_t {
     bool pad_w_is_null;
     bool is_backward;
     bool simple_alg;
+    bool is_nspc; // channels-last: the points along w are c apart
     data_type_t ind_dt;
 
     int c_block, c_tail, nb_c;
@@ -524,10 +593,74 @@ struct jit_pool_call_s {
     size_t kh_padding_shift;
     size_t kd_padding_shift;
     size_t kw_padding;
+    size_t b_c; // the channel block, the last one may be of c_tail channels
     const void *init_value;
     float ker_area_h;
 };
 
+// The binary primitive sees src0 as mb x c x sp and walks it in the order of
+// its layout. Unless src1 is of the same shape as src0, its values are
+// broadcast from an f32 buffer of src1_mb x c_padded.
+enum jit_binary_bcast_t {
+    binary_bcast_none, // src1 is laid out as src0
+    binary_bcast_scalar, // one src1 value per call: the spatial of (n, c)
+    binary_bcast_row, // the channels of a point advance with src0
+    binary_bcast_block, // one channel block of src1 per call
+};
+
+struct jit_binary_conf_t {
+    jit_binary_bcast_t bcast;
+    alg_kind_t alg;
+    data_type_t dt;
+
+    dim_t mb, c, sp;
+    dim_t c_padded, nb_c; // nb_c is set for binary_bcast_block only
+    int c_block;
+    dim_t src1_mb; // 1 or mb
+    bool src1_c_bcast;
+    dim_t nelems; // the padded size of src0, for binary_bcast_none
+
+    bool with_eltwise;
+};
+
+struct jit_binary_call_s {
+    const void *src0;
+    const void *src1;
+    const void *dst;
+    size_t work_amount;
+};
+
+/* Resampling of the planes of the input (src for the forward, diff_dst for
+ * the backward) to the ones of the output, the points of a plane being of
+ * inner contiguous values: the channels for the channels-last layouts, and
+ * the channel blocks for the blocked ones */
+struct jit_resampling_conf_t {
+    cpu_isa_t isa;
+    data_type_t dt;
+    bool is_fwd;
+
+    dim_t nplanes; // mb for channels-last, mb * nb_c for blocked
+    dim_t inner; // c for channels-last, c_block for blocked
+    dim_t id, ih, iw; // the input plane
+    dim_t od, oh, ow; // the output plane
+};
+
+/* Computes work output points of a row. The point p is the sum over the rows
+ * r and the taps k of w_beg[p] <= k < w_beg[p + 1] of the input points at
+ * src + row_offs[r] + w_offs[k] weighted by row_weights[r] * w_weights[k],
+ * the offsets being in bytes */
+struct jit_resampling_call_s {
+    const void *src;
+    const dim_t *row_offs;
+    const float *row_weights;
+    size_t nrows;
+    const dim_t *w_beg;
+    const dim_t *w_offs;
+    const float *w_weights;
+    void *dst;
+    size_t work_amount;
+};
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -59,6 +59,7 @@ struct jit_bnorm_t : public jit_generator {
         const acc_data_t *diff_scale_shift;
         const void *src, *dst;
         const void *diff_src, *diff_dst;
+        const void *src_1, *diff_src_1;
         const acc_data_t *rbuf1, *rbuf2;
         const uint8_t *ws;
         barrier::ctx_t *barrier;
@@ -105,6 +106,9 @@ struct jit_bnorm_t : public jit_generator {
     Reg64 reg_diff_src = reg_rbuf1;
     Reg64 reg_dst = rsi;
     Reg64 reg_diff_dst = reg_dst;
+    // rbuf2 is only used by the backward reduction of the diff_scale_shift
+    Reg64 reg_src_1 = reg_rbuf2;
+    Reg64 reg_diff_src_1 = reg_rbuf2;
 
     Reg64 reg_tmp_off = reg_roff;
 
@@ -114,7 +118,7 @@ struct jit_bnorm_t : public jit_generator {
     Reg64 reg_tmp = reg_ctr;
 
     // Relu section
-    bool with_relu, with_relu_inf_only;
+    bool with_relu, with_relu_inf_only, with_add;
     Vmm vzero; // is_fwd() ? vdiff_beta : vbeta
     Reg64 reg_ws = reg_roff;
     Label l_relu_mask_avx2;
@@ -164,7 +168,9 @@ struct jit_bnorm_t : public jit_generator {
         stack_off_s_s = 80,
         stack_off_s_tail = 88,
         stack_off_is_cblk_tail = 96,
-        stack_size_required = 104,
+        stack_off_src_1 = 104,
+        stack_off_diff_src_1 = 112,
+        stack_size_required = 120,
     };
 
     int bit_shift() { return 5 - is_bf16_; }
@@ -233,6 +239,12 @@ struct jit_bnorm_t : public jit_generator {
             mov(reg_tmp, ptr[reg_param + PARAM_OFF(is_cblk_tail)]);
             mov(ptr[rsp + stack_off_is_cblk_tail], reg_tmp);
         }
+        if (bdesc_->fuse_norm_add_relu()) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(src_1)]);
+            mov(ptr[rsp + stack_off_src_1], reg_tmp);
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(diff_src_1)]);
+            mov(ptr[rsp + stack_off_diff_src_1], reg_tmp);
+        }
 
         if (bdesc_->is_fwd()) {
             mov(reg_tmp, ptr[reg_param + PARAM_OFF(var)]);
@@ -270,11 +282,13 @@ struct jit_bnorm_t : public jit_generator {
     }
 
     void prepare_relu() {
+        with_add = bdesc_->fuse_norm_add_relu();
+        const bool fuse_relu = bdesc_->fuse_norm_relu() || with_add;
         with_relu = bdesc_->is_fwd()
-                ? bdesc_->with_relu_post_op() || bdesc_->fuse_norm_relu()
-                : bdesc_->fuse_norm_relu();
+                ? bdesc_->with_relu_post_op() || fuse_relu
+                : fuse_relu;
         with_relu_inf_only = with_relu && bdesc_->is_fwd()
-                && !(bdesc_->fuse_norm_relu() && bdesc_->is_training());
+                && !(fuse_relu && bdesc_->is_training());
 
         vzero = bdesc_->is_fwd() ? vdiff_beta : vbeta;
         if (with_relu) {
@@ -728,6 +742,11 @@ struct jit_bnorm_t : public jit_generator {
                             } else {
                                 uni_vmulps(v, v, vsqrtvar);
                             }
+                            if (with_add) {
+                                uni_vmovups_spat_data(vbuf,
+                                        vmmword[reg_src_1 + reg_soff + offt]);
+                                uni_vaddps(v, v, vbuf);
+                            }
                             if (with_relu_inf_only) {
                                 uni_vmaxps(v, v, vzero);
                             } else if (with_relu) {
@@ -770,6 +789,7 @@ struct jit_bnorm_t : public jit_generator {
         mov(reg_src, ptr[rsp + stack_off_src]);
         mov(reg_dst, ptr[rsp + stack_off_dst]);
         mov(reg_ws, ptr[rsp + stack_off_ws]);
+        if (with_add) mov(reg_src_1, ptr[rsp + stack_off_src_1]);
 
         xor_(reg_soff, reg_soff);
         Label dst_spatial;
@@ -903,6 +923,14 @@ struct jit_bnorm_t : public jit_generator {
                                 else
                                     assert(false);
                             }
+                            if (with_add) {
+                                // the addend gets the masked diff_dst as is
+                                uni_vmovups(t, v);
+                                uni_vmovups_spat_data(
+                                        vmmword[reg_diff_src_1 + reg_soff
+                                                + offt],
+                                        t);
+                            }
                             if (!bdesc_->use_global_stats()) {
                                 uni_vsubps(v, v, vdiff_beta);
                                 uni_vmovups_spat_data(
@@ -1039,6 +1067,7 @@ struct jit_bnorm_t : public jit_generator {
         barrier();
 
         mov(reg_diff_src, ptr[rsp + stack_off_diff_src]);
+        if (with_add) mov(reg_diff_src_1, ptr[rsp + stack_off_diff_src_1]);
         if (with_relu) {
             assert(isa == avx2 || isa == avx512_common);
             mov(reg_ws, ptr[rsp + stack_off_ws]);
@@ -1162,7 +1191,8 @@ struct driver_t : public c_compatible {
     }
 
     void exec(int ithr, int nthr, const void *src, void *diff_src, void *dst,
-            const void *diff_dst, const acc_data_t *scale_shift,
+            const void *diff_dst, const void *src_1, void *diff_src_1,
+            const acc_data_t *scale_shift,
             acc_data_t *diff_scale_shift, const acc_data_t *mean,
             const acc_data_t *var, const uint8_t *ws,
             const memory_tracking::grantor_t &scratchpad) {
@@ -1197,7 +1227,8 @@ struct driver_t : public c_compatible {
         dim_t C_blks_per_iter {1};
         int64_t iters {1};
         if (do_blocking_) {
-            int num_tensors = bdesc_->is_fwd() ? 1 : 2;
+            int num_tensors = (bdesc_->is_fwd() ? 1 : 2)
+                    + bdesc_->fuse_norm_add_relu();
             size_t working_set_size
                     = dt_size_ * (N * D * H * W * simd_w) * num_tensors;
             bnorm_utils::cache_balance(
@@ -1261,6 +1292,8 @@ struct driver_t : public c_compatible {
             p.dst = (void *)((char *)dst + soff_base * dt_size_);
             p.diff_src = (void *)((char *)diff_src + soff_base * dt_size_);
             p.diff_dst = (void *)((char *)diff_dst + soff_base * dt_size_);
+            p.src_1 = (void *)((char *)src_1 + soff_base * dt_size_);
+            p.diff_src_1 = (void *)((char *)diff_src_1 + soff_base * dt_size_);
             p.ws = ws + soff_base / 8;
 
             p.mb_stride_Bc = dt_size_ * (img_size - p.coff_max * p.spat_size);
@@ -1341,7 +1374,10 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::pd_t::init() {
             && (attr()->has_default_values() || this->with_relu_post_op());
     if (!ok) return status::unimplemented;
 
-    if (is_training() && fuse_norm_relu()) {
+    // the addend is not split into the halves of the sse41 vectors
+    if (fuse_norm_add_relu() && isa < avx2) return status::unimplemented;
+
+    if (is_training() && (fuse_norm_relu() || fuse_norm_add_relu())) {
         if (isa < avx2) return status::unimplemented;
         init_default_ws(1);
     }
@@ -1376,6 +1412,8 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
                     CTX_IN_MEM(const acc_data_t *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(acc_data_t *, DNNL_ARG_VARIANCE);
 
+    auto src_1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
     auto ws = CTX_OUT_MEM(uint8_t *, DNNL_ARG_WORKSPACE);
 
@@ -1384,8 +1422,8 @@ status_t jit_uni_batch_normalization_fwd_t<isa>::execute(
     bnorm_driver_->init_barriers(scratchpad);
 
     parallel(0, [&](const int ithr, const int nthr) {
-        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, scale_shift,
-                nullptr, mean, var, ws, scratchpad);
+        bnorm_driver_->exec(ithr, nthr, src, nullptr, dst, nullptr, src_1,
+                nullptr, scale_shift, nullptr, mean, var, ws, scratchpad);
     });
 
     return status::success;
@@ -1421,7 +1459,7 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::pd_t::init() {
     if (memory_desc_wrapper(src_md()).padded_dims()[1] != C() && isa < avx2)
         return status::unimplemented;
 
-    if (fuse_norm_relu()) {
+    if (fuse_norm_relu() || fuse_norm_add_relu()) {
         if (isa < avx2) return status::unimplemented;
         init_default_ws(1);
         if (!compare_ws(hint_fwd_pd_)) return status::unimplemented;
@@ -1453,6 +1491,7 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
     auto ws = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WORKSPACE);
 
     auto diff_src = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC);
+    auto diff_src_1 = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC_1);
     auto diff_scale_shift
             = CTX_OUT_MEM(acc_data_t *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
@@ -1462,7 +1501,8 @@ status_t jit_uni_batch_normalization_bwd_t<isa>::execute(
 
     parallel(0, [&](const int ithr, const int nthr) {
         bnorm_driver_->exec(ithr, nthr, src, diff_src, nullptr, diff_dst,
-                scale_shift, diff_scale_shift, mean, var, ws, scratchpad);
+                nullptr, diff_src_1, scale_shift, diff_scale_shift, mean, var,
+                ws, scratchpad);
     });
 
     return status::success;
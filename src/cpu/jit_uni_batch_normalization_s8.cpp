@@ -469,7 +469,7 @@ status_t jit_uni_batch_normalization_s8_fwd_t<isa>::pd_t::init() {
     auto desired_fmt_tag = (ndims() == 4) ? nhwc : ndhwc;
 
     bool ok = true && mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
-            && one_of(ndims(), 4, 5) && stats_is_src()
+            && one_of(ndims(), 4, 5) && stats_is_src() && !fuse_norm_add_relu()
             && src_md()->data_type == s8
             && IMPLICATION(use_scaleshift(), weights_md()->data_type == f32)
             && memory_desc_matches_tag(*src_md(), desired_fmt_tag)
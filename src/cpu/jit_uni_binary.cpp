@@ -0,0 +1,510 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "memory_tracking.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+#include "jit_uni_binary.hpp"
+#include "jit_uni_eltwise.hpp"
+
+#define GET_OFF(field) offsetof(jit_binary_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+using namespace memory_tracking::names;
+
+struct jit_uni_binary_kernel_t : public c_compatible {
+    void (*ker_)(const jit_binary_call_s *);
+    void operator()(const jit_binary_call_s *args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_binary_kernel_t() : ker_(nullptr) {}
+    virtual ~jit_uni_binary_kernel_t() {}
+};
+
+namespace {
+
+/* Computes work_amount elements of dst = eltwise(src0 op src1) in f32. The
+ * elements are converted from and to the data type of the primitive on the
+ * fly. src1 either advances with src0, or is a value or a vector that is
+ * loaded once (see jit_binary_bcast_t). */
+template <cpu_isa_t isa>
+struct jit_uni_binary_kernel_f32 : public jit_uni_binary_kernel_t,
+                                   public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_binary_kernel_f32)
+
+    jit_uni_binary_kernel_f32(
+            const jit_binary_conf_t &conf, const post_ops_t &post_ops)
+        : jit_uni_binary_kernel_t()
+        , jit_generator()
+        , conf_(conf)
+        , eltwise_injector_(nullptr)
+        , bf16_emu_(nullptr) {
+        if (conf_.with_eltwise)
+            eltwise_injector_ = new jit_uni_eltwise_injector_f32<isa>(
+                    this, post_ops.entry_[0].eltwise, false, reg_table);
+        if (conf_.dt == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, reg_bf16_scratch,
+                    bf16_emu_reserv_4);
+
+        generate();
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+    ~jit_uni_binary_kernel_f32() {
+        delete eltwise_injector_;
+        delete bf16_emu_;
+    }
+
+private:
+    using Vmm = typename utils::conditional<isa == avx2, Ymm, Zmm>::type;
+
+    static constexpr bool is_avx512 = isa != avx2;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    const jit_binary_conf_t &conf_;
+
+    Reg64 reg_src0 = rax;
+    Reg64 reg_src1 = rbx;
+    Reg64 reg_dst = rdx;
+    Reg64 reg_work = r8;
+    Reg64 reg_table = r9;
+    Reg64 reg_tmp = r10;
+    Reg64 reg_bf16_scratch = r11;
+
+    Opmask k_tail = k2;
+
+    // vmm 0 and 2..5 are left to the eltwise injector
+    Vmm vmm_src0 = Vmm(1);
+    Vmm vmm_src1 = Vmm(10);
+    Vmm vmm_lbound = Vmm(11);
+    Vmm vmm_ubound = Vmm(12);
+
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+
+    jit_uni_eltwise_injector_f32<isa> *eltwise_injector_;
+    bf16_emulation_t *bf16_emu_;
+
+    bool is_int8() const {
+        return utils::one_of(conf_.dt, data_type::s8, data_type::u8);
+    }
+    bool src1_advances() const {
+        return utils::one_of(conf_.bcast, binary_bcast_none, binary_bcast_row);
+    }
+    data_type_t src1_dt() const {
+        return conf_.bcast == binary_bcast_none ? conf_.dt : data_type::f32;
+    }
+
+    void load(const Vmm &vmm, const Reg64 &reg, data_type_t dt, bool tail) {
+        using namespace data_type;
+        const Vmm vmm_masked = vmm | k_tail | T_z;
+        if (tail && !is_avx512) {
+            assert(dt == f32);
+            vmovss(Xmm(vmm.getIdx()), ptr[reg]);
+            return;
+        }
+
+        const Vmm &v = tail ? vmm_masked : vmm;
+        switch (dt) {
+            case f32: vmovups(v, ptr[reg]); break;
+            case bf16:
+                vpmovzxwd(v, ptr[reg]);
+                vpslld(vmm, vmm, 16);
+                break;
+            case s8:
+                vpmovsxbd(v, ptr[reg]);
+                vcvtdq2ps(vmm, vmm);
+                break;
+            case u8:
+                vpmovzxbd(v, ptr[reg]);
+                vcvtdq2ps(vmm, vmm);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void store(const Reg64 &reg, const Vmm &vmm, bool tail) {
+        using namespace data_type;
+        const Address addr = tail && is_avx512 ? ptr[reg] | k_tail : ptr[reg];
+        if (tail && !is_avx512) {
+            assert(conf_.dt == f32);
+            vmovss(ptr[reg], Xmm(vmm.getIdx()));
+            return;
+        }
+
+        const Ymm ymm = Ymm(vmm.getIdx());
+        switch (conf_.dt) {
+            case f32: vmovups(addr, vmm); break;
+            case bf16:
+                if (bf16_emu_)
+                    bf16_emu_->vcvtneps2bf16(ymm, Zmm(vmm.getIdx()));
+                else
+                    vcvtneps2bf16(ymm, Zmm(vmm.getIdx()));
+                vmovdqu16(addr, ymm);
+                break;
+            case s8:
+            case u8:
+                vmaxps(vmm, vmm, vmm_lbound);
+                vminps(vmm, vmm, vmm_ubound);
+                vcvtps2dq(vmm, vmm);
+                if (conf_.dt == s8)
+                    vpmovsdb(addr, vmm);
+                else
+                    vpmovusdb(addr, vmm);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void compute(bool tail) {
+        using namespace alg_kind;
+        load(vmm_src0, reg_src0, conf_.dt, tail);
+        if (src1_advances()) load(vmm_src1, reg_src1, src1_dt(), tail);
+
+        switch (conf_.alg) {
+            case binary_add: vaddps(vmm_src0, vmm_src0, vmm_src1); break;
+            case binary_mul: vmulps(vmm_src0, vmm_src0, vmm_src1); break;
+            case binary_max: vmaxps(vmm_src0, vmm_src0, vmm_src1); break;
+            case binary_min: vminps(vmm_src0, vmm_src0, vmm_src1); break;
+            default: assert(!"unknown binary alg_kind");
+        }
+
+        if (eltwise_injector_)
+            eltwise_injector_->compute_vector(vmm_src0.getIdx());
+
+        store(reg_dst, vmm_src0, tail);
+    }
+
+    void advance(int nelems) {
+        const int dt_size = (int)types::data_type_size(conf_.dt);
+        add(reg_src0, nelems * dt_size);
+        add(reg_dst, nelems * dt_size);
+        if (src1_advances())
+            add(reg_src1,
+                    nelems * (int)types::data_type_size(src1_dt()));
+    }
+
+    void init_saturation() {
+        const bool is_s8 = conf_.dt == data_type::s8;
+        const float lbound = is_s8 ? -128.f : 0.f;
+        const float ubound = is_s8 ? 127.f : 255.f;
+        mov(reg_tmp.cvt32(), float2int(lbound));
+        vmovd(Xmm(vmm_lbound.getIdx()), reg_tmp.cvt32());
+        vbroadcastss(vmm_lbound, Xmm(vmm_lbound.getIdx()));
+        mov(reg_tmp.cvt32(), float2int(ubound));
+        vmovd(Xmm(vmm_ubound.getIdx()), reg_tmp.cvt32());
+        vbroadcastss(vmm_ubound, Xmm(vmm_ubound.getIdx()));
+    }
+
+    void generate() {
+        preamble();
+
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+
+        mov(reg_src0, ptr[abi_param1 + GET_OFF(src0)]);
+        mov(reg_src1, ptr[abi_param1 + GET_OFF(src1)]);
+        mov(reg_dst, ptr[abi_param1 + GET_OFF(dst)]);
+        mov(reg_work, ptr[abi_param1 + GET_OFF(work_amount)]);
+
+        if (eltwise_injector_) eltwise_injector_->load_table_addr();
+        if (is_int8()) init_saturation();
+
+        if (conf_.bcast == binary_bcast_scalar)
+            vbroadcastss(vmm_src1, ptr[reg_src1]);
+        else if (conf_.bcast == binary_bcast_block)
+            vmovups(vmm_src1, ptr[reg_src1]);
+
+        Label vec_loop, tail_loop, end;
+
+        L(vec_loop);
+        {
+            cmp(reg_work, simd_w);
+            jl(tail_loop, T_NEAR);
+            compute(false);
+            advance(simd_w);
+            sub(reg_work, simd_w);
+            jmp(vec_loop, T_NEAR);
+        }
+
+        // the blocks of binary_bcast_block are of simd_w, so it has no tail
+        L(tail_loop);
+        if (conf_.bcast != binary_bcast_block) {
+            cmp(reg_work, 0);
+            jle(end, T_NEAR);
+            if (is_avx512) {
+                // the mask of the remaining work_amount < simd_w elements
+                mov(rcx, reg_work);
+                mov(reg_tmp.cvt32(), 1);
+                shl(reg_tmp.cvt32(), cl);
+                sub(reg_tmp.cvt32(), 1);
+                kmovw(k_tail, reg_tmp.cvt32());
+                compute(true);
+            } else {
+                compute(true);
+                advance(1);
+                dec(reg_work);
+                jmp(tail_loop, T_NEAR);
+            }
+        }
+
+        L(end);
+        postamble();
+
+        if (eltwise_injector_) eltwise_injector_->prepare_table();
+    }
+};
+
+} // namespace
+
+template <cpu_isa_t isa, data_type_t data_type>
+status_t jit_uni_binary_t<isa, data_type>::pd_t::init() {
+    using namespace data_type;
+
+    bool ok = true && mayiuse(isa)
+            && utils::everyone_is(data_type, src_md(0)->data_type,
+                    src_md(1)->data_type, dst_md()->data_type)
+            && IMPLICATION(isa == avx2, data_type == f32)
+            && IMPLICATION(data_type == bf16, mayiuse(avx512_core))
+            && !has_zero_dim_memory()
+            && attr()->output_scales_.has_default_values() && post_ops_ok()
+            && set_default_params() == status::success;
+    if (!ok) return status::unimplemented;
+
+    status_t status = init_conf();
+    if (status != status::success) return status;
+
+    if (conf_.bcast != binary_bcast_none) {
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.book(key_binary_bcast_src1,
+                sizeof(float) * conf_.src1_mb * conf_.c_padded);
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa, data_type_t data_type>
+status_t jit_uni_binary_t<isa, data_type>::pd_t::init_conf() {
+    using namespace format_tag;
+
+    const memory_desc_wrapper src0_d(src_md(0));
+    const memory_desc_wrapper src1_d(src_md(1));
+    const memory_desc_wrapper dst_d(dst_md());
+
+    // The padded area of src0 is computed as well: the binary operations
+    // keep the zeros, so must the eltwise post-op
+    const auto &po = attr()->post_ops_;
+    conf_.with_eltwise = po.len_ == 1;
+    const bool ok = src0_d == dst_d && src0_d.is_dense(true)
+            && IMPLICATION(!src0_d.is_dense(false) && conf_.with_eltwise,
+                    math::eltwise_fwd_preserves_zero(
+                            po.entry_[0].eltwise.alg, true));
+    if (!ok) return status::unimplemented;
+
+    conf_.alg = desc()->alg_kind;
+    conf_.dt = data_type;
+    conf_.nelems = src0_d.nelems(true);
+    conf_.nb_c = 0;
+    conf_.c_block = 1;
+
+    if (src1_d == src0_d) {
+        conf_.bcast = binary_bcast_none;
+        return status::success;
+    }
+
+    const int nd = ndims();
+    const dims_t &dims = src0_d.dims();
+    const dims_t &dims1 = src1_d.dims();
+
+    bool is_scalar = true;
+    for (int d = 0; d < nd; d++)
+        is_scalar = is_scalar && dims1[d] == 1;
+
+    // A single value for any dense layout
+    if (is_scalar && src0_d.is_dense(false)) {
+        conf_.bcast = binary_bcast_scalar;
+        conf_.mb = conf_.c = conf_.c_padded = conf_.src1_mb = 1;
+        conf_.sp = conf_.nelems;
+        conf_.src1_c_bcast = true;
+        return status::success;
+    }
+
+    // Otherwise src1 is of mb x c with unit spatial
+    if (nd < 2 || nd > 5) return status::unimplemented;
+    for (int d = 2; d < nd; d++)
+        if (dims1[d] != 1) return status::unimplemented;
+
+    conf_.mb = dims[0];
+    conf_.c = dims[1];
+    conf_.sp = utils::array_product(dims + 2, nd - 2);
+    conf_.src1_mb = is_broadcast(0) ? 1 : conf_.mb;
+    conf_.src1_c_bcast = is_broadcast(1);
+    conf_.c_padded = conf_.c;
+
+    const int blk = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const auto plain_tag = utils::pick(nd - 2, nc, ncw, nchw, ncdhw);
+    const auto cl_tag = utils::pick(nd - 2, nc, nwc, nhwc, ndhwc);
+    const auto blocked_tag = blk == 16
+            ? utils::pick(nd - 2, nc, nCw16c, nChw16c, nCdhw16c)
+            : utils::pick(nd - 2, nc, nCw8c, nChw8c, nCdhw8c);
+
+    if (src0_d.matches_tag(cl_tag)) {
+        conf_.bcast = binary_bcast_row;
+    } else if (src0_d.matches_tag(plain_tag)) {
+        conf_.bcast = binary_bcast_scalar;
+    } else if (nd > 2 && src0_d.matches_tag(blocked_tag)) {
+        conf_.bcast = binary_bcast_block;
+        conf_.c_block = blk;
+        conf_.nb_c = utils::div_up(conf_.c, blk);
+        conf_.c_padded = conf_.nb_c * blk;
+    } else
+        return status::unimplemented;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa, data_type_t data_type>
+jit_uni_binary_t<isa, data_type>::jit_uni_binary_t(const pd_t *apd)
+    : primitive_impl_t(apd), kernel_(nullptr) {
+    kernel_ = new jit_uni_binary_kernel_f32<isa>(
+            pd()->conf_, pd()->attr()->post_ops_);
+}
+
+template <cpu_isa_t isa, data_type_t data_type>
+jit_uni_binary_t<isa, data_type>::~jit_uni_binary_t() {
+    delete kernel_;
+}
+
+template <cpu_isa_t isa, data_type_t data_type>
+void jit_uni_binary_t<isa, data_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
+    auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const auto &conf = pd()->conf_;
+
+    src0 += src0_d.offset0();
+    dst += src0_d.offset0();
+
+    auto ker = [&](dim_t off, const void *s1, dim_t work) {
+        auto arg = jit_binary_call_s();
+        arg.src0 = (const void *)&src0[off];
+        arg.src1 = s1;
+        arg.dst = (const void *)&dst[off];
+        arg.work_amount = (size_t)work;
+        if (arg.work_amount) (*kernel_)(&arg);
+    };
+
+    const int cache_line = 64 / (int)sizeof(data_t);
+
+    if (conf.bcast == binary_bcast_none) {
+        src1 += src1_d.offset0();
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(utils::div_up(conf.nelems, cache_line), nthr, ithr,
+                    start, end);
+            start = nstl::min(conf.nelems, start * cache_line);
+            end = nstl::min(conf.nelems, end * cache_line);
+            ker(start, &src1[start], end - start);
+        });
+        return;
+    }
+
+    // Gathers the broadcast src1 in f32, zeros over the padded channels
+    float *bcast = ctx.get_scratchpad_grantor().template get<float>(
+            key_binary_bcast_src1);
+    for (dim_t n = 0; n < conf.src1_mb; n++)
+        for (dim_t c = 0; c < conf.c_padded; c++) {
+            float &b = bcast[n * conf.c_padded + c];
+            if (c >= conf.c) {
+                b = 0.f;
+                continue;
+            }
+            dims_t pos = {0};
+            if (src1_d.ndims() > 1) {
+                pos[0] = n;
+                pos[1] = conf.src1_c_bcast ? 0 : c;
+            }
+            b = (float)src1[src1_d.off_v(pos)];
+        }
+
+    if (conf.bcast == binary_bcast_row) {
+        parallel_nd(conf.mb, conf.sp, [&](dim_t n, dim_t sp) {
+            const dim_t n1 = conf.src1_mb == 1 ? 0 : n;
+            ker((n * conf.sp + sp) * conf.c, &bcast[n1 * conf.c_padded],
+                    conf.c);
+        });
+        return;
+    }
+
+    // binary_bcast_scalar and binary_bcast_block go over the planes of
+    // (n, c) or (n, cb) in the units of one value or one block of src1
+    const dim_t unit = conf.c_block;
+    const dim_t nc = conf.bcast == binary_bcast_block ? conf.nb_c : conf.c;
+    const dim_t nunits = conf.mb * nc * conf.sp;
+    const dim_t grain = nstl::max<dim_t>(1, cache_line / unit);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(utils::div_up(nunits, grain), nthr, ithr, start, end);
+        start = nstl::min(nunits, start * grain);
+        end = nstl::min(nunits, end * grain);
+
+        while (start < end) {
+            const dim_t plane = start / conf.sp;
+            const dim_t len
+                    = nstl::min(end - start, (plane + 1) * conf.sp - start);
+            const dim_t n = plane / nc, c = plane % nc;
+            const dim_t n1 = conf.src1_mb == 1 ? 0 : n;
+            ker(start * unit, &bcast[n1 * conf.c_padded + c * unit],
+                    len * unit);
+            start += len;
+        }
+    });
+}
+
+using namespace data_type;
+
+template struct jit_uni_binary_t<avx512_common, f32>;
+template struct jit_uni_binary_t<avx512_common, s8>;
+template struct jit_uni_binary_t<avx512_common, u8>;
+template struct jit_uni_binary_t<avx512_core, bf16>;
+template struct jit_uni_binary_t<avx2, f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
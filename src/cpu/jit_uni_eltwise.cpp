@@ -1584,15 +1584,22 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init() {
                     eltwise_exp, eltwise_gelu, eltwise_swish)
             && utils::one_of(d_type, bf16, f32);
 
+    // with run-time dimensions the data must be dense, which is checked at
+    // execution
+    const memory_desc_wrapper src_d(src_md());
+    const bool dense_ok = has_runtime_dims_or_strides()
+            ? src_d.is_plain()
+            : src_d.is_dense(true)
+                    && IMPLICATION(!src_d.is_dense(false),
+                            math::eltwise_fwd_preserves_zero(
+                                    desc()->alg_kind, true));
+
     bool ok = true && mayiuse(isa) && is_fwd()
             && desc()->data_desc.data_type == d_type
             && IMPLICATION(
                     desc()->data_desc.data_type == bf16, mayiuse(avx512_core))
             && utils::one_of(true, relu_ok, non_relu_ok)
-            && !has_zero_dim_memory()
-            && memory_desc_wrapper(src_md()).is_dense(true)
-            && IMPLICATION(!memory_desc_wrapper(src_md()).is_dense(false),
-                    math::eltwise_fwd_preserves_zero(desc()->alg_kind, true))
+            && !has_zero_dim_memory() && dense_ok
             && attr()->has_default_values();
 
     return ok ? status::success : status::unimplemented;
@@ -1619,12 +1626,21 @@ jit_uni_eltwise_fwd_t<isa, d_type>::~jit_uni_eltwise_fwd_t() {
 }
 
 template <cpu_isa_t isa, impl::data_type_t d_type>
-void jit_uni_eltwise_fwd_t<isa, d_type>::execute_forward(
+status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
-    const memory_desc_wrapper data_d(pd()->src_md());
+    const auto data_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+
+    if (pd()->has_runtime_dims_or_strides()) {
+        const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+        const bool ok = true
+                && memory_desc_wrapper(pd()->src_md()).matches_runtime_md(
+                        data_d)
+                && data_d.is_dense() && dst_d == data_d;
+        if (!ok) return status::invalid_arguments;
+    }
 
     const size_t nelems = data_d.nelems(true);
 
@@ -1646,6 +1662,8 @@ void jit_uni_eltwise_fwd_t<isa, d_type>::execute_forward(
         arg.work_amount = end - start;
         if (arg.work_amount) (*kernel_)(&arg);
     });
+
+    return status::success;
 }
 
 template <cpu_isa_t isa, data_type_t d_type>
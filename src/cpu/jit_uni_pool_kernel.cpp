@@ -59,8 +59,19 @@ status_t jit_uni_pool_kernel<isa>::init_conf(
     jpp.ndims = ndims;
     jpp.mb = src_d.dims()[0];
 
-    jpp.c = utils::rnd_up(src_d.dims()[1], simd_w);
-    if (jpp.c > src_d.padded_dims()[1]) return status::unimplemented;
+    // The channels-last tensors are not padded, so the channels of the last
+    // block are masked
+    const auto nspc_tag = ndims == 4 ? format_tag::nhwc : format_tag::ndhwc;
+    jpp.is_nspc = src_d.matches_tag(nspc_tag);
+    if (jpp.is_nspc) {
+        jpp.c = src_d.dims()[1];
+        jpp.c_tail = jpp.c % simd_w;
+        if (jpp.c_tail && !is_avx512) return status::unimplemented;
+    } else {
+        jpp.c = utils::rnd_up(src_d.dims()[1], simd_w);
+        if (jpp.c > src_d.padded_dims()[1]) return status::unimplemented;
+        jpp.c_tail = 0;
+    }
 
     jpp.id = (ndims == 5) ? src_d.dims()[2] : 1;
     jpp.ih = src_d.dims()[ndims - 2];
@@ -101,12 +112,15 @@ status_t jit_uni_pool_kernel<isa>::init_conf(
 
     jpp.dt_size = types::data_type_size(src_d.data_type());
 
+    // The kernel zeroes diff_src in the blocks of c_block channels, so the
+    // channels-last diff_src is zeroed beforehand
     jpp.simple_alg = jpp.is_training
-            || IMPLICATION(jpp.is_backward, jpp.kd <= jpp.stride_d);
+            || IMPLICATION(jpp.is_backward,
+                    jpp.kd <= jpp.stride_d && !jpp.is_nspc);
 
     jpp.c_block = simd_w;
 
-    jpp.nb_c = jpp.c / jpp.c_block;
+    jpp.nb_c = utils::div_up(jpp.c, jpp.c_block);
     if (jpp.alg == pooling_max) {
         jpp.ur_w = is_avx512 ? 16 : 4;
         if (jpp.is_training)
@@ -158,12 +172,12 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int pad_l, int pad_r) {
     int iw = jpp.iw;
     int kw = jpp.kw;
     int stride_w = jpp.stride_w;
-    int c_block = jpp.c_block;
+    int c_off = this->c_off();
     Label kd_label, kh_label;
 
     for (int jj = 0; jj < ur_w; jj++) {
         if (jpp.is_backward) {
-            load(jj, reg_output, jpp.dt_size * jj * c_block);
+            load(jj, reg_output, jpp.dt_size * jj * c_off);
             maybe_recalculate_divisor(jj, ur_w, pad_l, pad_r);
             uni_vdivps(vreg(jj), vreg(jj), vmm_tmp);
         } else {
@@ -192,31 +206,29 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int pad_l, int pad_r) {
                             nstl::max(0, ki + pad_r - (kw - 1)), stride_w);
 
             for (int jj = jj_start; jj < jj_end; jj++) {
-                int aux_input_offset = (ki + jj * stride_w - pad_l) * c_block;
-                if (aux_input_offset > iw * c_block) continue;
+                int aux_input_offset = (ki + jj * stride_w - pad_l) * c_off;
+                if (aux_input_offset > iw * c_off) continue;
                 int input_offset = jpp.dt_size * aux_input_offset;
                 if (jpp.is_backward) {
                     load(ur_w + jj, aux_reg_input, input_offset);
                     uni_vaddps(vreg(ur_w + jj), vreg(ur_w + jj), vreg(jj));
-                    if (jpp.is_bf16) {
-                        if (!isa_has_bf16(jpp.isa))
-                            bf16_emu_->vcvtneps2bf16(
-                                    yreg(ur_w + jj), zreg(ur_w + jj));
-                        else
-                            vcvtneps2bf16(yreg(ur_w + jj), vreg(ur_w + jj));
-                        vmovdqu16(ptr[aux_reg_input + input_offset],
-                                yreg(ur_w + jj));
-                    } else {
-                        uni_vmovups(vmmword[aux_reg_input + input_offset],
-                                vreg(ur_w + jj));
-                    }
+                    store(ur_w + jj, aux_reg_input, input_offset);
                 } else {
                     if (jpp.is_bf16) {
-                        vmovups(ymm_tmp_1, ptr[aux_reg_input + input_offset]);
+                        if (jpp.c_tail)
+                            vmovdqu16(ymm_tmp_1 | k_c_tail_mask | T_z,
+                                    ptr[aux_reg_input + input_offset]);
+                        else
+                            vmovups(ymm_tmp_1,
+                                    ptr[aux_reg_input + input_offset]);
                         vpermw(vmm_tmp_1 | k_mask_cvt | T_z, vmm_idx(),
                                 vmm_tmp_1);
 
                         uni_vaddps(vreg(jj), vreg(jj), vmm_tmp_1);
+                    } else if (jpp.c_tail) {
+                        vmovups(vmm_tmp_1 | k_c_tail_mask | T_z,
+                                ptr[aux_reg_input + input_offset]);
+                        uni_vaddps(vreg(jj), vreg(jj), vmm_tmp_1);
                     } else {
                         uni_vaddps(vreg(jj), vreg(jj),
                                 ptr[aux_reg_input + input_offset]);
@@ -224,14 +236,14 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int pad_l, int pad_r) {
                 }
             }
         }
-        add(aux_reg_input, jpp.dt_size * iw * c_block);
+        add(aux_reg_input, jpp.dt_size * iw * c_off);
         inc(kj);
         cmp(kj, reg_kh);
         jl(kh_label, T_NEAR);
     }
 
     if (jpp.simple_alg && jpp.ndims == 5) {
-        add(aux_reg_input_d, jpp.dt_size * jpp.ih * iw * c_block);
+        add(aux_reg_input_d, jpp.dt_size * jpp.ih * iw * c_off);
         dec(ki);
         cmp(ki, 0);
         jg(kd_label, T_NEAR);
@@ -243,17 +255,7 @@ inline void jit_uni_pool_kernel<isa>::avg_step(int ur_w, int pad_l, int pad_r) {
         for (int jj = 0; jj < ur_w; jj++) {
             maybe_recalculate_divisor(jj, ur_w, pad_l, pad_r);
             uni_vdivps(vreg(jj), vreg(jj), vmm_tmp);
-            if (jpp.is_bf16) {
-                if (!isa_has_bf16(jpp.isa))
-                    bf16_emu_->vcvtneps2bf16(yreg(jj), zreg(jj));
-                else
-                    vcvtneps2bf16(yreg(jj), vreg(jj));
-                vmovdqu16(
-                        ptr[reg_output + jpp.dt_size * jj * c_block], yreg(jj));
-            } else {
-                uni_vmovups(vmmword[reg_output + jpp.dt_size * jj * c_block],
-                        vreg(jj));
-            }
+            store(jj, reg_output, jpp.dt_size * jj * c_off);
         }
     }
 }
@@ -264,7 +266,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(
     int iw = jpp.iw;
     int kw = jpp.kw;
     int stride_w = jpp.stride_w;
-    int c_block = jpp.c_block;
+    int c_off = this->c_off();
     Label kd_label, kh_label;
 
     mov(tmp_gpr, float2int(nstl::numeric_limits<float>::lowest()));
@@ -300,8 +302,8 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(
                     - utils::div_up(
                             nstl::max(0, ki + pad_r - (kw - 1)), stride_w);
             for (int jj = jj_start; jj < jj_end; jj++) {
-                int aux_input_offset = (ki + jj * stride_w - pad_l) * c_block;
-                if (aux_input_offset > iw * c_block) continue;
+                int aux_input_offset = (ki + jj * stride_w - pad_l) * c_off;
+                if (aux_input_offset > iw * c_off) continue;
                 int input_offset = jpp.dt_size * aux_input_offset;
                 load(ur_w + jj, aux_reg_input, input_offset);
                 if (isa == sse41) {
@@ -335,14 +337,14 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(
                 }
             }
         }
-        add(aux_reg_input, jpp.dt_size * iw * c_block);
+        add(aux_reg_input, jpp.dt_size * iw * c_off);
         inc(kj);
         cmp(kj, reg_kh);
         jl(kh_label, T_NEAR);
     }
 
     if (jpp.ndims == 5) {
-        add(aux_reg_input_d, jpp.dt_size * jpp.ih * iw * c_block);
+        add(aux_reg_input_d, jpp.dt_size * jpp.ih * iw * c_off);
         if (jpp.is_training) {
             mov(tmp_gpr, ptr[reg_param + GET_OFF(kd_padding_shift)]);
             movq(xmm_tmp, tmp_gpr);
@@ -363,19 +365,10 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(
     }
 
     for (int jj = 0; jj < ur_w; jj++) {
-        if (jpp.is_bf16) {
-            if (!isa_has_bf16(jpp.isa))
-                bf16_emu_->vcvtneps2bf16(yreg(jj), zreg(jj));
-            else
-                vcvtneps2bf16(yreg(jj), vreg(jj));
-            vmovups(ptr[reg_output + jpp.dt_size * jj * c_block], yreg(jj));
-        } else {
-            uni_vmovups(
-                    vmmword[reg_output + jpp.dt_size * jj * c_block], vreg(jj));
-        }
+        store(jj, reg_output, jpp.dt_size * jj * c_off);
         if (jpp.is_training) {
             const size_t step_index
-                    = jj * c_block * types::data_type_size(jpp.ind_dt);
+                    = jj * c_off * types::data_type_size(jpp.ind_dt);
 
             auto x = xreg(2 * ur_w + jj);
             if (jpp.ind_dt == data_type::u8) {
@@ -402,11 +395,17 @@ inline void jit_uni_pool_kernel<isa>::max_step_fwd(
                         vpshufb(t, t, xmm_tmp); // ymm_tmp[:128]==ymm_tmp[127:0]
                         movd(ptr[reg_index + step_index + 4], t);
                     }
+                } else if (jpp.c_tail) {
+                    vpmovusdb(ptr[reg_index + step_index] | k_c_tail_mask,
+                            vreg(2 * ur_w + jj));
                 } else {
                     auto v = vreg(2 * ur_w + jj);
                     vpmovusdb(x, v);
                     vmovups(ptr[reg_index + step_index], v | k_index_mask);
                 }
+            } else if (jpp.c_tail) {
+                vmovups(ptr[reg_index + step_index] | k_c_tail_mask,
+                        vreg(2 * ur_w + jj));
             } else {
                 uni_vmovups(ptr[reg_index + step_index], vreg(2 * ur_w + jj));
             }
@@ -421,13 +420,13 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(
     int iw = jpp.iw;
     int kw = jpp.kw;
     int stride_w = jpp.stride_w;
-    int c_block = jpp.c_block;
+    int c_off = this->c_off();
     Label kd_label, kh_label;
 
     for (int jj = 0; jj < ur_w; jj++) {
-        load(jj, reg_output, jpp.dt_size * jj * c_block);
+        load(jj, reg_output, jpp.dt_size * jj * c_off);
         const size_t step_index
-                = jj * c_block * types::data_type_size(jpp.ind_dt);
+                = jj * c_off * types::data_type_size(jpp.ind_dt);
         if (jpp.ind_dt == data_type::u8) {
             if (isa == sse41) {
                 movd(xreg(ur_w + jj), ptr[reg_index + step_index]);
@@ -439,11 +438,17 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(
                 } else {
                     vpmovzxbd(vreg(ur_w + jj), xreg(ur_w + jj));
                 }
+            } else if (jpp.c_tail) {
+                vpmovzxbd(vreg(ur_w + jj) | k_c_tail_mask | T_z,
+                        ptr[reg_index + step_index]);
             } else {
                 vmovups(vreg(ur_w + jj) | k_index_mask,
                         ptr[reg_index + step_index]);
                 vpmovzxbd(vreg(ur_w + jj), xreg(ur_w + jj));
             }
+        } else if (jpp.c_tail) {
+            vmovups(vreg(ur_w + jj) | k_c_tail_mask | T_z,
+                    ptr[reg_index + step_index]);
         } else {
             uni_vmovups(vreg(ur_w + jj), ptr[reg_index + step_index]);
         }
@@ -477,8 +482,8 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(
                     - utils::div_up(
                             nstl::max(0, ki + pad_r - (kw - 1)), stride_w);
             for (int jj = jj_start; jj < jj_end; jj++) {
-                int aux_input_offset = (ki + jj * stride_w - pad_l) * c_block;
-                if (aux_input_offset > iw * c_block) continue;
+                int aux_input_offset = (ki + jj * stride_w - pad_l) * c_off;
+                if (aux_input_offset > iw * c_off) continue;
                 int input_offset = jpp.dt_size * aux_input_offset;
                 load(2 * ur_w + jj, aux_reg_input, input_offset);
                 if (isa == sse41) {
@@ -504,21 +509,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(
                     vpcmpeqd(k_store_mask, vreg(ur_w + jj), vmm_k_offset);
                     vblendmps(vmm_tmp | k_store_mask | T_z, vreg(jj), vreg(jj));
                     vaddps(vreg(2 * ur_w + jj), vreg(2 * ur_w + jj), vmm_tmp);
-                    if (jpp.is_bf16) {
-                        if (!isa_has_bf16(jpp.isa))
-                            bf16_emu_->vcvtneps2bf16(
-                                    yreg(2 * ur_w + jj), zreg(2 * ur_w + jj));
-                        else
-                            vcvtneps2bf16(
-                                    yreg(2 * ur_w + jj), vreg(2 * ur_w + jj));
-                        vmovdqu16(ptr[aux_reg_input
-                                          + jpp.dt_size * aux_input_offset],
-                                yreg(2 * ur_w + jj));
-                    } else {
-                        vmovups(vmmword[aux_reg_input
-                                        + jpp.dt_size * aux_input_offset],
-                                vreg(2 * ur_w + jj));
-                    }
+                    store(2 * ur_w + jj, aux_reg_input, input_offset);
                 }
             }
             if (isa == avx && !mayiuse(avx2)) {
@@ -527,13 +518,13 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(
                 uni_vpaddd(vmm_k_offset, vmm_k_offset, vmm_one);
             }
         }
-        add(aux_reg_input, jpp.dt_size * iw * c_block);
+        add(aux_reg_input, jpp.dt_size * iw * c_off);
         inc(kj);
         cmp(kj, reg_kh);
         jl(kh_label, T_NEAR);
     }
     if (jpp.simple_alg && jpp.ndims == 5) {
-        add(aux_reg_input_d, jpp.dt_size * jpp.ih * iw * c_block);
+        add(aux_reg_input_d, jpp.dt_size * jpp.ih * iw * c_off);
 
         mov(tmp_gpr, reg_kd_pad_shift);
         movq(xmm_tmp, tmp_gpr);
@@ -561,6 +552,7 @@ inline void jit_uni_pool_kernel<isa>::max_step_bwd(
 template <cpu_isa_t isa>
 void jit_uni_pool_kernel<isa>::maybe_zero_diff_src() {
     assert(jpp.c_block * sizeof(float) % cpu_isa_traits<isa>::vlen == 0);
+    assert(!jpp.is_nspc);
     Label l_skip, l_zero;
 
     auto reg_oh = tmp_gpr;
@@ -616,6 +608,7 @@ void jit_uni_pool_kernel<isa>::generate() {
     int kh = jpp.kh;
     int ur_w = jpp.ur_w;
     int c_block = jpp.c_block;
+    int c_off = this->c_off();
     int stride_w = jpp.stride_w;
     int l_pad = jpp.l_pad;
     int ur_w_tail = jpp.ur_w_tail;
@@ -651,6 +644,18 @@ void jit_uni_pool_kernel<isa>::generate() {
         vmovups(vmm_idx(), ptr[tmp_gpr]);
     }
 
+    if (jpp.c_tail) {
+        // All the channels of the block but for the last one
+        Label l_full_block;
+        mov(tmp_gpr.cvt32(), (1 << c_block) - 1);
+        mov(reg_kd_pad_shift, ptr[reg_param + GET_OFF(b_c)]);
+        cmp(reg_kd_pad_shift, jpp.nb_c - 1);
+        jne(l_full_block, T_NEAR);
+        mov(tmp_gpr.cvt32(), (1 << jpp.c_tail) - 1);
+        L(l_full_block);
+        kmovw(k_c_tail_mask, tmp_gpr.cvt32());
+    }
+
     if (jpp.is_backward && jpp.simple_alg) maybe_zero_diff_src();
 
     if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward)) {
@@ -698,18 +703,18 @@ void jit_uni_pool_kernel<isa>::generate() {
 
         if (isa == sse41) {
             add(reg_input,
-                    jpp.dt_size * (ur_w * stride_w - l_pad) * c_block - vlen);
-            add(reg_output, jpp.dt_size * ur_w * c_block - vlen);
+                    jpp.dt_size * (ur_w * stride_w - l_pad) * c_off - vlen);
+            add(reg_output, jpp.dt_size * ur_w * c_off - vlen);
             if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward))
                 add(reg_index,
-                        (2 * ur_w - 1) * c_block / 2
+                        (ur_w * c_off - c_block / 2)
                                 * types::data_type_size(jpp.ind_dt));
         } else {
-            add(reg_input, jpp.dt_size * (ur_w * stride_w - l_pad) * c_block);
-            add(reg_output, jpp.dt_size * ur_w * c_block);
+            add(reg_input, jpp.dt_size * (ur_w * stride_w - l_pad) * c_off);
+            add(reg_output, jpp.dt_size * ur_w * c_off);
             if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward))
                 add(reg_index,
-                        ur_w * c_block * types::data_type_size(jpp.ind_dt));
+                        ur_w * c_off * types::data_type_size(jpp.ind_dt));
         }
     }
 
@@ -723,20 +728,20 @@ void jit_uni_pool_kernel<isa>::generate() {
             if (isa == sse41) { step_high_half(ur_w, 0, 0); }
 
             if (isa == sse41) {
-                add(reg_input, jpp.dt_size * ur_w * stride_w * c_block - vlen);
-                add(reg_output, jpp.dt_size * ur_w * c_block - vlen);
+                add(reg_input, jpp.dt_size * ur_w * stride_w * c_off - vlen);
+                add(reg_output, jpp.dt_size * ur_w * c_off - vlen);
                 if (jpp.alg == pooling_max
                         && (jpp.is_training || jpp.is_backward))
                     add(reg_index,
-                            (2 * ur_w - 1) * c_block / 2
+                            (ur_w * c_off - c_block / 2)
                                     * types::data_type_size(jpp.ind_dt));
             } else {
-                add(reg_input, jpp.dt_size * ur_w * stride_w * c_block);
-                add(reg_output, jpp.dt_size * ur_w * c_block);
+                add(reg_input, jpp.dt_size * ur_w * stride_w * c_off);
+                add(reg_output, jpp.dt_size * ur_w * c_off);
                 if (jpp.alg == pooling_max
                         && (jpp.is_training || jpp.is_backward))
                     add(reg_index,
-                            ur_w * c_block * types::data_type_size(jpp.ind_dt));
+                            ur_w * c_off * types::data_type_size(jpp.ind_dt));
             }
 
             inc(oi_iter);
@@ -751,18 +756,18 @@ void jit_uni_pool_kernel<isa>::generate() {
         if (isa == sse41) { step_high_half(ur_w, 0, r_pad1); }
 
         if (isa == sse41) {
-            add(reg_input, jpp.dt_size * ur_w * stride_w * c_block - vlen);
-            add(reg_output, jpp.dt_size * ur_w * c_block - vlen);
+            add(reg_input, jpp.dt_size * ur_w * stride_w * c_off - vlen);
+            add(reg_output, jpp.dt_size * ur_w * c_off - vlen);
             if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward))
                 add(reg_index,
-                        (2 * ur_w - 1) * c_block / 2
+                        (ur_w * c_off - c_block / 2)
                                 * types::data_type_size(jpp.ind_dt));
         } else {
-            add(reg_input, jpp.dt_size * ur_w * stride_w * c_block);
-            add(reg_output, jpp.dt_size * ur_w * c_block);
+            add(reg_input, jpp.dt_size * ur_w * stride_w * c_off);
+            add(reg_output, jpp.dt_size * ur_w * c_off);
             if (jpp.alg == pooling_max && (jpp.is_training || jpp.is_backward))
                 add(reg_index,
-                        ur_w * c_block * types::data_type_size(jpp.ind_dt));
+                        ur_w * c_off * types::data_type_size(jpp.ind_dt));
         }
     }
 
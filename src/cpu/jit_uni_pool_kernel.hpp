@@ -105,6 +105,7 @@ private:
     Opmask k_index_mask = Opmask(6);
     Opmask k_store_mask = Opmask(7);
     Opmask k_mask_cvt = Opmask(5);
+    Opmask k_c_tail_mask = Opmask(4);
 
     // Here be some (tame) dragons. This kernel does not follow the regular
     // OS-agnostic ABI pattern because when isa is sse41 it uses maskmovdqu
@@ -147,17 +148,44 @@ private:
 
     void maybe_zero_diff_src();
 
+    // The distance between the points along w, in elements
+    int c_off() const { return jpp.is_nspc ? jpp.c : jpp.c_block; }
+
+    // With a channel tail, only the channels of k_c_tail_mask are accessed
     void load(int idx, reg64_t reg_ptr, int offset) {
         if (jpp.is_bf16) {
             /*TODO: maybe use vpmovzxwd + vpslld,
              * in order to free up vmm_idx() register */
-            vmovups(yreg(idx), ptr[reg_ptr + offset]);
+            if (jpp.c_tail)
+                vmovdqu16(yreg(idx) | k_c_tail_mask | T_z,
+                        ptr[reg_ptr + offset]);
+            else
+                vmovups(yreg(idx), ptr[reg_ptr + offset]);
             vpermw(vreg(idx) | k_mask_cvt | T_z, vmm_idx(), vreg(idx));
+        } else if (jpp.c_tail) {
+            vmovups(vreg(idx) | k_c_tail_mask | T_z, ptr[reg_ptr + offset]);
         } else {
             uni_vmovups(vreg(idx), ptr[reg_ptr + offset]);
         }
     };
 
+    void store(int idx, reg64_t reg_ptr, int offset) {
+        if (jpp.is_bf16) {
+            if (!isa_has_bf16(jpp.isa))
+                bf16_emu_->vcvtneps2bf16(yreg(idx), zreg(idx));
+            else
+                vcvtneps2bf16(yreg(idx), vreg(idx));
+            if (jpp.c_tail)
+                vmovdqu16(ptr[reg_ptr + offset] | k_c_tail_mask, yreg(idx));
+            else
+                vmovdqu16(ptr[reg_ptr + offset], yreg(idx));
+        } else if (jpp.c_tail) {
+            vmovups(ptr[reg_ptr + offset] | k_c_tail_mask, vreg(idx));
+        } else {
+            uni_vmovups(vmmword[reg_ptr + offset], vreg(idx));
+        }
+    }
+
     void step(int ur_w, int pad_l, int pad_r) {
         if (jpp.alg == alg_kind::pooling_max) {
             if (jpp.is_backward)
@@ -46,16 +46,18 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward(
                 = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
         const int ih = nstl::max(ij - jpp.t_pad, 0);
 
-        arg.src = (const void *)&src[src_d.blk_off(n, b_c, ih)];
-        arg.dst = (const void *)&dst[dst_d.blk_off(n, b_c, oh)];
+        const int c_off = jpp.is_nspc ? b_c * jpp.c_block : b_c;
+        arg.src = (const void *)&src[src_d.blk_off(n, c_off, ih)];
+        arg.dst = (const void *)&dst[dst_d.blk_off(n, c_off, oh)];
         if (indices) {
-            const size_t ind_off = indices_d.blk_off(n, b_c, oh);
+            const size_t ind_off = indices_d.blk_off(n, c_off, oh);
             arg.indices = (const void *)&indices[ind_off * ind_dt_size];
         }
         arg.oh = oh == 0;
         arg.kh_padding = jpp.kh - i_t_overflow - i_b_overflow;
         arg.kh_padding_shift = i_t_overflow * jpp.kw;
         arg.kw_padding = 0;
+        arg.b_c = b_c;
         arg.ker_area_h = (float)(jpp.kh
                 - nstl::max(0, oh * jpp.stride_h - jpp.t_pad + jpp.kh - jpp.ih)
                 - nstl::max(0, jpp.t_pad - oh * jpp.stride_h));
@@ -87,10 +89,11 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(
                 = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
         const int ih = nstl::max(ij - jpp.t_pad, 0);
 
-        arg.src = &src[src_d.blk_off(n, b_c, id, ih)];
-        arg.dst = &dst[dst_d.blk_off(n, b_c, od, oh)];
+        const int c_off = jpp.is_nspc ? b_c * jpp.c_block : b_c;
+        arg.src = &src[src_d.blk_off(n, c_off, id, ih)];
+        arg.dst = &dst[dst_d.blk_off(n, c_off, od, oh)];
         if (indices) {
-            const size_t ind_off = indices_d.blk_off(n, b_c, od, oh);
+            const size_t ind_off = indices_d.blk_off(n, c_off, od, oh);
             arg.indices = &indices[ind_off * ind_dt_size];
         }
         arg.oh = (oh + od == 0);
@@ -100,6 +103,7 @@ void jit_uni_pooling_fwd_t<isa, d_type>::execute_forward_3d(
                 = i_t_overflow * jpp.kw + d_t_overflow * jpp.kw * jpp.kh;
         arg.kd_padding_shift = (i_t_overflow + i_b_overflow) * jpp.kw;
         arg.kw_padding = 0;
+        arg.b_c = b_c;
         arg.ker_area_h = (float)(jpp.kh
                                  - nstl::max(0,
                                          oh * jpp.stride_h - jpp.t_pad + jpp.kh
@@ -145,16 +149,18 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
                 = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
         const int ih = nstl::max(ij - jpp.t_pad, 0);
 
-        arg.src = &diff_src[diff_src_d.blk_off(n, b_c, ih)];
-        arg.dst = &diff_dst[diff_dst_d.blk_off(n, b_c, oh)];
+        const int c_off = jpp.is_nspc ? b_c * jpp.c_block : b_c;
+        arg.src = &diff_src[diff_src_d.blk_off(n, c_off, ih)];
+        arg.dst = &diff_dst[diff_dst_d.blk_off(n, c_off, oh)];
         if (indices) {
-            const size_t ind_off = indices_d.blk_off(n, b_c, oh);
+            const size_t ind_off = indices_d.blk_off(n, c_off, oh);
             arg.indices = &indices[ind_off * ind_dt_size];
         }
         arg.oh = (oh == 0);
         arg.kh_padding = jpp.kh - i_t_overflow - i_b_overflow;
         arg.kh_padding_shift = i_t_overflow * jpp.kw;
         arg.kw_padding = 0;
+        arg.b_c = b_c;
         arg.ker_area_h = (float)(jpp.kh
                 - nstl::max(0, oh * jpp.stride_h - jpp.t_pad + jpp.kh - jpp.ih)
                 - nstl::max(0, jpp.t_pad - oh * jpp.stride_h));
@@ -162,6 +168,22 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward(
         (*kernel_)(&arg);
     };
 
+    // The channels of a point of the channels-last diff_src are of several
+    // blocks, so it is zeroed at once
+    if (jpp.is_nspc) {
+        const ptrdiff_t nelems = (ptrdiff_t)jpp.mb * (ptrdiff_t)jpp.c
+                * (ptrdiff_t)jpp.ih * (ptrdiff_t)jpp.iw;
+        parallel_nd(nelems, [&](ptrdiff_t idx) {
+            diff_src[idx] = static_cast<data_t>(0.f);
+        });
+
+        parallel_nd(jpp.mb, jpp.nb_c, [&](int n, int b_c) {
+            for (int oh = 0; oh < jpp.oh; ++oh)
+                ker(n, b_c, oh);
+        });
+        return;
+    }
+
     parallel_nd(jpp.mb, jpp.nb_c, [&](int n, int b_c) {
         auto src_diff_base_ptr = &diff_src[diff_src_d.blk_off(n, b_c, 0)];
         auto block_size = (ptrdiff_t)jpp.ih * (ptrdiff_t)jpp.iw
@@ -198,11 +220,13 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
                 = nstl::max(jpp.ih, ij + jpp.kh - jpp.t_pad) - jpp.ih;
         const int ih = nstl::max(ij - jpp.t_pad, 0);
 
+        const int c_off = jpp.is_nspc ? b_c * jpp.c_block : b_c;
         arg.src = (const void
-                        *)&diff_src[diff_src_d.blk_off(n, b_c, id + kd, ih)];
-        arg.dst = (const void *)&diff_dst[diff_dst_d.blk_off(n, b_c, od, oh)];
+                        *)&diff_src[diff_src_d.blk_off(n, c_off, id + kd, ih)];
+        arg.dst = (const void
+                        *)&diff_dst[diff_dst_d.blk_off(n, c_off, od, oh)];
         if (indices) {
-            const size_t ind_off = indices_d.blk_off(n, b_c, od, oh);
+            const size_t ind_off = indices_d.blk_off(n, c_off, od, oh);
             arg.indices = (const void *)&indices[ind_off * ind_dt_size];
         }
         arg.oh = zero_size;
@@ -212,6 +236,7 @@ void jit_uni_pooling_bwd_t<isa, d_type>::execute_backward_3d(
                 + d_t_overflow * jpp.kw * jpp.kh + kd * jpp.kw * jpp.kh;
         arg.kd_padding_shift = (i_t_overflow + i_b_overflow) * jpp.kw;
         arg.kw_padding = 0;
+        arg.b_c = b_c;
         arg.ker_area_h = (float)(jpp.kh
                                  - nstl::max(0,
                                          oh * jpp.stride_h - jpp.t_pad + jpp.kh
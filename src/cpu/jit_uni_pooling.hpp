@@ -46,8 +46,7 @@ struct jit_uni_pooling_fwd_t : public primitive_impl_t {
                     && everyone_is(
                             d_type, src_md()->data_type, dst_md()->data_type)
                     && attr()->has_default_values()
-                    && memory_desc_matches_tag(*src_md(), desired_fmt_tag())
-                    && memory_desc_matches_tag(*dst_md(), desired_fmt_tag());
+                    && fmt_ok(*src_md(), *dst_md());
             if (!ok) return status::unimplemented;
 
             bool is_training = desc_.prop_kind == prop_kind::forward_training;
@@ -57,11 +56,19 @@ struct jit_uni_pooling_fwd_t : public primitive_impl_t {
             return jit_uni_pool_kernel<isa>::init_conf(jpp_, this);
         }
 
-        format_tag_t desired_fmt_tag() {
+        // The blocked or the channels-last (nhwc, ndhwc) formats
+        bool fmt_ok(const memory_desc_t &src_md, const memory_desc_t &dst_md) {
             using namespace format_tag;
-            return utils::one_of(isa, avx512_common, avx512_core)
+            const format_tag_t blocked_tag
+                    = utils::one_of(isa, avx512_common, avx512_core)
                     ? (ndims() == 4 ? nChw16c : nCdhw16c)
                     : (ndims() == 4 ? nChw8c : nCdhw8c);
+            const format_tag_t nspc_tag = ndims() == 4 ? nhwc : ndhwc;
+            for (auto tag : {blocked_tag, nspc_tag})
+                if (memory_desc_matches_tag(src_md, tag)
+                        && memory_desc_matches_tag(dst_md, tag))
+                    return true;
+            return false;
         }
 
         jit_pool_conf_t jpp_;
@@ -112,10 +119,7 @@ struct jit_uni_pooling_bwd_t : public primitive_impl_t {
                     && everyone_is(d_type, diff_src_md()->data_type,
                             diff_dst_md()->data_type)
                     && attr()->has_default_values()
-                    && memory_desc_matches_tag(
-                            *diff_dst_md(), desired_fmt_tag())
-                    && memory_desc_matches_tag(
-                            *diff_src_md(), desired_fmt_tag());
+                    && fmt_ok(*diff_src_md(), *diff_dst_md());
             if (!ok) return status::unimplemented;
 
             if (desc()->alg_kind == alg_kind::pooling_max) {
@@ -126,11 +130,19 @@ struct jit_uni_pooling_bwd_t : public primitive_impl_t {
             return jit_uni_pool_kernel<isa>::init_conf(jpp_, this);
         }
 
-        format_tag_t desired_fmt_tag() {
+        // The blocked or the channels-last (nhwc, ndhwc) formats
+        bool fmt_ok(const memory_desc_t &src_md, const memory_desc_t &dst_md) {
             using namespace format_tag;
-            return utils::one_of(isa, avx512_common, avx512_core)
+            const format_tag_t blocked_tag
+                    = utils::one_of(isa, avx512_common, avx512_core)
                     ? (ndims() == 4 ? nChw16c : nCdhw16c)
                     : (ndims() == 4 ? nChw8c : nCdhw8c);
+            const format_tag_t nspc_tag = ndims() == 4 ? nhwc : ndhwc;
+            for (auto tag : {blocked_tag, nspc_tag})
+                if (memory_desc_matches_tag(src_md, tag)
+                        && memory_desc_matches_tag(dst_md, tag))
+                    return true;
+            return false;
         }
 
         jit_pool_conf_t jpp_;
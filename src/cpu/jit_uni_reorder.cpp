@@ -919,6 +919,10 @@ struct jit_uni_reorder_t : public primitive_impl_t {
 
         DECLARE_COMMON_PD_T("jit:uni", jit_uni_reorder_t);
 
+        virtual bool supports_runtime_output_scales() const override {
+            return true;
+        }
+
         static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
                 const primitive_attr_t *attr, engine_t *src_engine,
                 const memory_desc_t *src_md, engine_t *dst_engine,
@@ -1111,8 +1115,9 @@ struct jit_uni_reorder_t : public primitive_impl_t {
     virtual status_t execute(const exec_ctx_t &ctx) const override {
         auto in = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
         auto out = CTX_OUT_MEM(char *, DNNL_ARG_TO);
+        DEFINE_SCALES_BUFFER(scales);
 
-        omp_driver(in, out, pd()->attr()->output_scales_.scales_);
+        omp_driver(in, out, scales);
 
         return status::success;
     }
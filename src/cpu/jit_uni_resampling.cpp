@@ -0,0 +1,475 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "jit_avx512_core_bf16cvt.hpp"
+#include "jit_generator.hpp"
+#include "jit_uni_resampling.hpp"
+
+#define GET_OFF(field) offsetof(jit_resampling_call_s, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+struct jit_uni_resampling_kernel_t : public c_compatible {
+    void (*ker_)(const jit_resampling_call_s *);
+    void operator()(const jit_resampling_call_s *args) const {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_resampling_kernel_t() : ker_(nullptr) {}
+    virtual ~jit_uni_resampling_kernel_t() {}
+};
+
+namespace {
+
+/* Computes the points of an output row (see jit_resampling_call_s) in f32,
+ * over the inner values of a point in up to unroll vectors at a time. The
+ * values are converted from and to the data type of the primitive on the
+ * fly. */
+template <cpu_isa_t isa>
+struct jit_uni_resampling_kernel_f32 : public jit_uni_resampling_kernel_t,
+                                       public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_resampling_kernel_f32)
+
+    jit_uni_resampling_kernel_f32(const jit_resampling_conf_t &conf)
+        : jit_uni_resampling_kernel_t()
+        , jit_generator()
+        , conf_(conf)
+        , bf16_emu_(nullptr) {
+        if (conf_.dt == data_type::bf16 && !mayiuse(avx512_core_bf16))
+            bf16_emu_ = new bf16_emulation_t(this, bf16_emu_reserv_1,
+                    bf16_emu_reserv_2, bf16_emu_reserv_3, reg_bf16_scratch,
+                    bf16_emu_reserv_4);
+
+        generate();
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+    ~jit_uni_resampling_kernel_f32() { delete bf16_emu_; }
+
+private:
+    using Vmm = typename utils::conditional<isa == avx2, Ymm, Zmm>::type;
+
+    static constexpr bool is_avx512 = isa != avx2;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int unroll = 4;
+
+    const jit_resampling_conf_t &conf_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_dst = rax;
+    Reg64 reg_p = rbx; // the taps of the point in w_beg
+    Reg64 reg_p_end = rdx;
+    Reg64 reg_c = rsi; // the offset of the inner values, in bytes
+    Reg64 reg_roff = r8;
+    Reg64 reg_rwei = r9;
+    Reg64 reg_rend = r10;
+    Reg64 reg_bf16_scratch = r11;
+    Reg64 reg_row = r12;
+    Reg64 reg_tmp = r13;
+    Reg64 reg_koff = r14;
+    Reg64 reg_kend = r15;
+    Reg64 reg_kwei = rbp;
+
+    Opmask k_tail = k2;
+
+    // vmm 0 .. unroll - 1 are the accumulators
+    Vmm vmm_rwei = Vmm(unroll);
+    Vmm vmm_wei = Vmm(unroll + 1);
+    Vmm vmm_in = Vmm(unroll + 2);
+    Vmm vmm_tail_mask = Vmm(unroll + 3);
+
+    Zmm bf16_emu_reserv_1 = Zmm(28);
+    Zmm bf16_emu_reserv_2 = Zmm(29);
+    Zmm bf16_emu_reserv_3 = Zmm(30);
+    Zmm bf16_emu_reserv_4 = Zmm(31);
+
+    Label l_tail_mask;
+
+    bf16_emulation_t *bf16_emu_;
+
+    int dt_size() const { return (int)types::data_type_size(conf_.dt); }
+    int tail() const { return (int)(conf_.inner % simd_w); }
+
+    void load(const Vmm &vmm, const Address &addr, bool tail) {
+        using namespace data_type;
+        if (conf_.dt == f32) {
+            if (!tail)
+                vmovups(vmm, addr);
+            else if (is_avx512)
+                vmovups(vmm | k_tail | T_z, addr);
+            else
+                vmaskmovps(vmm, vmm_tail_mask, addr);
+            return;
+        }
+
+        assert(conf_.dt == bf16 && is_avx512);
+        vpmovzxwd(tail ? vmm | k_tail | T_z : vmm, addr);
+        vpslld(vmm, vmm, 16);
+    }
+
+    void store(const Address &addr, const Vmm &vmm, bool tail) {
+        using namespace data_type;
+        if (conf_.dt == f32) {
+            if (!tail)
+                vmovups(addr, vmm);
+            else if (is_avx512)
+                vmovups(addr | k_tail, vmm);
+            else
+                vmaskmovps(addr, vmm_tail_mask, vmm);
+            return;
+        }
+
+        assert(conf_.dt == bf16 && is_avx512);
+        const Ymm ymm = Ymm(vmm.getIdx());
+        if (bf16_emu_)
+            bf16_emu_->vcvtneps2bf16(ymm, Zmm(vmm.getIdx()));
+        else
+            vcvtneps2bf16(ymm, Zmm(vmm.getIdx()));
+        vmovdqu16(tail ? addr | k_tail : addr, ymm);
+    }
+
+    /* Computes nvecs vectors of the point at reg_c over the rows and the
+     * taps of the point */
+    void compute(int nvecs, bool tail) {
+        const int vec_size = simd_w * dt_size();
+
+        for (int v = 0; v < nvecs; ++v)
+            uni_vpxor(Vmm(v), Vmm(v), Vmm(v));
+
+        mov(reg_roff, ptr[reg_param + GET_OFF(row_offs)]);
+        mov(reg_rwei, ptr[reg_param + GET_OFF(row_weights)]);
+        mov(reg_rend, ptr[reg_param + GET_OFF(nrows)]);
+        lea(reg_rend, ptr[reg_roff + reg_rend * sizeof(dim_t)]);
+
+        Label row_loop, row_end, tap_loop, tap_end;
+
+        L(row_loop);
+        {
+            cmp(reg_roff, reg_rend);
+            jge(row_end, T_NEAR);
+
+            mov(reg_row, ptr[reg_param + GET_OFF(src)]);
+            add(reg_row, ptr[reg_roff]);
+            add(reg_row, reg_c);
+            vbroadcastss(vmm_rwei, ptr[reg_rwei]);
+
+            mov(reg_tmp, ptr[reg_p]);
+            mov(reg_kend, ptr[reg_p + sizeof(dim_t)]);
+            mov(reg_koff, ptr[reg_param + GET_OFF(w_offs)]);
+            lea(reg_kend, ptr[reg_koff + reg_kend * sizeof(dim_t)]);
+            lea(reg_koff, ptr[reg_koff + reg_tmp * sizeof(dim_t)]);
+            mov(reg_kwei, ptr[reg_param + GET_OFF(w_weights)]);
+            lea(reg_kwei, ptr[reg_kwei + reg_tmp * sizeof(float)]);
+
+            L(tap_loop);
+            {
+                cmp(reg_koff, reg_kend);
+                jge(tap_end, T_NEAR);
+
+                mov(reg_tmp, ptr[reg_koff]);
+                vbroadcastss(vmm_wei, ptr[reg_kwei]);
+                vmulps(vmm_wei, vmm_wei, vmm_rwei);
+                for (int v = 0; v < nvecs; ++v) {
+                    load(vmm_in, ptr[reg_row + reg_tmp + v * vec_size], tail);
+                    vfmadd231ps(Vmm(v), vmm_wei, vmm_in);
+                }
+
+                add(reg_koff, sizeof(dim_t));
+                add(reg_kwei, sizeof(float));
+                jmp(tap_loop, T_NEAR);
+            }
+            L(tap_end);
+
+            add(reg_roff, sizeof(dim_t));
+            add(reg_rwei, sizeof(float));
+            jmp(row_loop, T_NEAR);
+        }
+        L(row_end);
+
+        for (int v = 0; v < nvecs; ++v)
+            store(ptr[reg_dst + reg_c + v * vec_size], Vmm(v), tail);
+    }
+
+    void generate() {
+        preamble();
+
+        if (bf16_emu_) bf16_emu_->init_vcvtneps2bf16();
+
+        if (tail() && is_avx512) {
+            mov(reg_tmp.cvt32(), (1 << tail()) - 1);
+            kmovw(k_tail, reg_tmp.cvt32());
+        } else if (tail()) {
+            vmovups(vmm_tail_mask, ptr[rip + l_tail_mask]);
+        }
+
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_p, ptr[reg_param + GET_OFF(w_beg)]);
+        mov(reg_p_end, ptr[reg_param + GET_OFF(work_amount)]);
+        lea(reg_p_end, ptr[reg_p + reg_p_end * sizeof(dim_t)]);
+
+        const int vec_size = simd_w * dt_size();
+        const int nvecs = (int)(conf_.inner / simd_w);
+        const int nchunks = nvecs / unroll;
+
+        Label point_loop, point_end;
+
+        L(point_loop);
+        {
+            cmp(reg_p, reg_p_end);
+            jge(point_end, T_NEAR);
+
+            xor_(reg_c, reg_c);
+            if (nchunks > 0) {
+                Label chunk_loop;
+                L(chunk_loop);
+                compute(unroll, false);
+                add(reg_c, unroll * vec_size);
+                cmp(reg_c, nchunks * unroll * vec_size);
+                jl(chunk_loop, T_NEAR);
+            }
+            if (nvecs % unroll) {
+                compute(nvecs % unroll, false);
+                add(reg_c, (nvecs % unroll) * vec_size);
+            }
+            if (tail()) compute(1, true);
+
+            add(reg_dst, (int)conf_.inner * dt_size());
+            add(reg_p, sizeof(dim_t));
+            jmp(point_loop, T_NEAR);
+        }
+        L(point_end);
+
+        postamble();
+
+        if (tail() && !is_avx512) {
+            align(64);
+            L(l_tail_mask);
+            for (int i = 0; i < simd_w; ++i)
+                dd(i < tail() ? 0xffffffff : 0);
+        }
+    }
+};
+
+} // namespace
+
+namespace jit_uni_resampling_utils {
+
+status_t init_conf(jit_resampling_conf_t &conf, const resampling_pd_t *pd,
+        const memory_desc_wrapper &in_d, const memory_desc_wrapper &out_d,
+        cpu_isa_t isa) {
+    using namespace format_tag;
+
+    const int nd = pd->ndims();
+    const dim_t blk = isa == avx2 ? 8 : 16;
+    const auto cl_tag = utils::pick(nd - 3, nwc, nhwc, ndhwc);
+    const auto blocked_tag = blk == 16
+            ? utils::pick(nd - 3, nCw16c, nChw16c, nCdhw16c)
+            : utils::pick(nd - 3, nCw8c, nChw8c, nCdhw8c);
+
+    const bool is_cl = in_d.matches_tag(cl_tag) && out_d.matches_tag(cl_tag);
+    const bool is_blocked = !is_cl && in_d.matches_tag(blocked_tag)
+            && out_d.matches_tag(blocked_tag);
+    if (!is_cl && !is_blocked) return status::unimplemented;
+
+    conf.isa = isa;
+    conf.dt = in_d.data_type();
+    conf.is_fwd = pd->is_fwd();
+
+    // The padded channels of the blocked layouts are resampled too, so they
+    // stay zero
+    conf.nplanes = is_cl ? pd->MB() : pd->MB() * utils::div_up(pd->C(), blk);
+    conf.inner = is_cl ? pd->C() : blk;
+
+    const dims_t &in_dims = in_d.dims();
+    const dims_t &out_dims = out_d.dims();
+    conf.id = nd >= 5 ? in_dims[nd - 3] : 1;
+    conf.ih = nd >= 4 ? in_dims[nd - 2] : 1;
+    conf.iw = in_dims[nd - 1];
+    conf.od = nd >= 5 ? out_dims[nd - 3] : 1;
+    conf.oh = nd >= 4 ? out_dims[nd - 2] : 1;
+    conf.ow = out_dims[nd - 1];
+
+    return status::success;
+}
+
+resampler_t::resampler_t(const jit_resampling_conf_t &conf, alg_kind_t alg)
+    : conf_(conf), kernel_(nullptr) {
+    // The taps are of the src and dst dimensions, dst being the output of
+    // the forward and the input of the backward
+    const bool fwd = conf_.is_fwd;
+    taps_d_.init(alg, fwd ? conf_.id : conf_.od, fwd ? conf_.od : conf_.id,
+            fwd);
+    taps_h_.init(alg, fwd ? conf_.ih : conf_.oh, fwd ? conf_.oh : conf_.ih,
+            fwd);
+    taps_w_.init(alg, fwd ? conf_.iw : conf_.ow, fwd ? conf_.ow : conf_.iw,
+            fwd);
+
+    const dim_t point_size
+            = conf_.inner * (dim_t)types::data_type_size(conf_.dt);
+    w_offs_.resize(taps_w_.idx_.size());
+    for (size_t k = 0; k < w_offs_.size(); ++k)
+        w_offs_[k] = taps_w_.idx_[k] * point_size;
+
+    switch (conf_.isa) {
+        case avx512_common:
+        case avx512_core:
+            kernel_ = new jit_uni_resampling_kernel_f32<avx512_common>(conf_);
+            break;
+        case avx2:
+            kernel_ = new jit_uni_resampling_kernel_f32<avx2>(conf_);
+            break;
+        default: assert(!"unsupported isa");
+    }
+}
+
+resampler_t::~resampler_t() {
+    delete kernel_;
+}
+
+void resampler_t::operator()(const void *in, void *out) const {
+    const auto &c = conf_;
+    const dim_t dt_size = (dim_t)types::data_type_size(c.dt);
+    const dim_t in_row = c.iw * c.inner * dt_size;
+    const dim_t out_row = c.ow * c.inner * dt_size;
+    const dim_t in_plane = c.id * c.ih * in_row;
+    const dim_t out_plane = c.od * c.oh * out_row;
+    const dim_t max_nrows = taps_d_.max_ntaps() * taps_h_.max_ntaps();
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(c.nplanes * c.od * c.oh, nthr, ithr, start, end);
+
+        // The rows of the input the output row is computed from
+        std::vector<dim_t> row_offs(max_nrows);
+        std::vector<float> row_weights(max_nrows);
+
+        dim_t n {0}, od {0}, oh {0};
+        utils::nd_iterator_init(start, n, c.nplanes, od, c.od, oh, c.oh);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            size_t nrows = 0;
+            for (dim_t kd = taps_d_.beg_[od]; kd < taps_d_.beg_[od + 1]; ++kd)
+                for (dim_t kh = taps_h_.beg_[oh]; kh < taps_h_.beg_[oh + 1];
+                        ++kh) {
+                    const dim_t id = taps_d_.idx_[kd], ih = taps_h_.idx_[kh];
+                    row_offs[nrows] = (id * c.ih + ih) * in_row;
+                    row_weights[nrows] = taps_d_.wei_[kd] * taps_h_.wei_[kh];
+                    nrows++;
+                }
+
+            auto arg = jit_resampling_call_s();
+            arg.src = (const char *)in + n * in_plane;
+            arg.row_offs = row_offs.data();
+            arg.row_weights = row_weights.data();
+            arg.nrows = nrows;
+            arg.w_beg = taps_w_.beg_.data();
+            arg.w_offs = w_offs_.data();
+            arg.w_weights = taps_w_.wei_.data();
+            arg.dst = (char *)out + n * out_plane + (od * c.oh + oh) * out_row;
+            arg.work_amount = (size_t)c.ow;
+            (*kernel_)(&arg);
+
+            utils::nd_iterator_step(n, c.nplanes, od, c.od, oh, c.oh);
+        }
+    });
+}
+
+} // namespace jit_uni_resampling_utils
+
+template <cpu_isa_t isa, data_type_t data_type>
+status_t jit_uni_resampling_fwd_t<isa, data_type>::pd_t::init() {
+    using namespace data_type;
+
+    bool ok = true && mayiuse(isa) && is_fwd()
+            && utils::everyone_is(
+                    data_type, src_md()->data_type, dst_md()->data_type)
+            && IMPLICATION(isa == avx2, data_type == f32)
+            && IMPLICATION(data_type == bf16, mayiuse(avx512_core))
+            && !has_zero_dim_memory() && attr()->has_default_values()
+            && set_default_params() == status::success;
+    if (!ok) return status::unimplemented;
+
+    return jit_uni_resampling_utils::init_conf(
+            conf_, this, src_md(), dst_md(), isa);
+}
+
+template <cpu_isa_t isa, data_type_t data_type>
+void jit_uni_resampling_fwd_t<isa, data_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    resampler_(&src[src_d.offset0()], &dst[dst_d.offset0()]);
+}
+
+template <cpu_isa_t isa, data_type_t data_type>
+status_t jit_uni_resampling_bwd_t<isa, data_type>::pd_t::init() {
+    using namespace data_type;
+
+    bool ok = true && mayiuse(isa) && !is_fwd()
+            && utils::everyone_is(data_type, diff_src_md()->data_type,
+                    diff_dst_md()->data_type)
+            && IMPLICATION(isa == avx2, data_type == f32)
+            && IMPLICATION(data_type == bf16, mayiuse(avx512_core))
+            && !has_zero_dim_memory() && attr()->has_default_values()
+            && set_default_params() == status::success;
+    if (!ok) return status::unimplemented;
+
+    return jit_uni_resampling_utils::init_conf(
+            conf_, this, diff_dst_md(), diff_src_md(), isa);
+}
+
+template <cpu_isa_t isa, data_type_t data_type>
+void jit_uni_resampling_bwd_t<isa, data_type>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    resampler_(&diff_dst[diff_dst_d.offset0()],
+            &diff_src[diff_src_d.offset0()]);
+}
+
+using namespace data_type;
+
+template struct jit_uni_resampling_fwd_t<avx512_common, f32>;
+template struct jit_uni_resampling_fwd_t<avx512_core, bf16>;
+template struct jit_uni_resampling_fwd_t<avx2, f32>;
+template struct jit_uni_resampling_bwd_t<avx512_common, f32>;
+template struct jit_uni_resampling_bwd_t<avx512_core, bf16>;
+template struct jit_uni_resampling_bwd_t<avx2, f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
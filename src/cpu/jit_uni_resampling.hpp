@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_JIT_UNI_RESAMPLING_HPP
+#define CPU_JIT_UNI_RESAMPLING_HPP
+
+#include <assert.h>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_isa_traits.hpp"
+#include "cpu_resampling_pd.hpp"
+#include "jit_primitive_conf.hpp"
+#include "ref_resampling.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct jit_uni_resampling_kernel_t;
+
+/* Resampling for the channels-last and the blocked layouts: a kernel call
+ * computes a row of the output, vectorized over the channels of its points.
+ * The forward and the backward only differ by their taps. */
+namespace jit_uni_resampling_utils {
+
+status_t init_conf(jit_resampling_conf_t &conf, const resampling_pd_t *pd,
+        const memory_desc_wrapper &in_d, const memory_desc_wrapper &out_d,
+        cpu_isa_t isa);
+
+struct resampler_t {
+    resampler_t(const jit_resampling_conf_t &conf, alg_kind_t alg);
+    ~resampler_t();
+
+    void operator()(const void *in, void *out) const;
+
+private:
+    const jit_resampling_conf_t &conf_;
+    resampling_taps_t taps_d_, taps_h_, taps_w_;
+    std::vector<dim_t> w_offs_; // the taps along w in bytes
+    jit_uni_resampling_kernel_t *kernel_;
+};
+
+} // namespace jit_uni_resampling_utils
+
+template <cpu_isa_t isa, impl::data_type_t data_type>
+struct jit_uni_resampling_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_resampling_fwd_t);
+
+        status_t init();
+
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_fwd_t(const pd_t *apd)
+        : primitive_impl_t(apd)
+        , resampler_(pd()->conf_, pd()->desc()->alg_kind) {}
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    jit_uni_resampling_utils::resampler_t resampler_;
+};
+
+template <cpu_isa_t isa, impl::data_type_t data_type>
+struct jit_uni_resampling_bwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_resampling_bwd_t);
+
+        status_t init();
+
+        jit_resampling_conf_t conf_;
+    };
+
+    jit_uni_resampling_bwd_t(const pd_t *apd)
+        : primitive_impl_t(apd)
+        , resampler_(pd()->conf_, pd()->desc()->alg_kind) {}
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    jit_uni_resampling_utils::resampler_t resampler_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -462,8 +462,25 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
     const auto ou_stride = pd()->outer_stride();
+    dim_t outer_size = 0;
+
+    if (pd()->has_runtime_dims_or_strides()) {
+        const auto data_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+        const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+        const bool ok = true
+                && memory_desc_wrapper(pd()->src_md()).matches_runtime_md(
+                        data_d)
+                && data_d.is_dense() && dst_d == data_d;
+        if (!ok) return status::invalid_arguments;
+
+        outer_size = utils::array_product(data_d.dims(), pd()->axis());
+        src += data_d.offset0();
+        dst += data_d.offset0();
+    } else {
+        outer_size = pd()->outer_size();
+    }
 
-    parallel_nd(pd()->outer_size(), [&](int ou) {
+    parallel_nd(outer_size, [&](dim_t ou) {
         const data_t *src_ptr = src + ou * ou_stride;
         data_t *dst_ptr = dst + ou * ou_stride;
         softmax_driver_->exec(src_ptr, dst_ptr);
@@ -61,9 +61,14 @@ struct jit_uni_softmax_fwd_t : public primitive_impl_t {
                         && bd.strides[axis()] == axis_blk_size;
             };
 
+            // with run-time dimensions the data density is checked at
+            // execution
+            const bool dense_ok = has_runtime_dims_or_strides()
+                    ? runtime_dims_supported()
+                    : is_dense(); // not dense impl can be easily done
+
             bool ok = true && mayiuse(isa) && is_fwd() && !has_zero_dim_memory()
-                    && src_md()->data_type == data_type::f32
-                    && is_dense() // not dense impl can be easily done
+                    && src_md()->data_type == data_type::f32 && dense_ok
                     && (attr()->has_default_values());
             if (!ok) return status::unimplemented;
 
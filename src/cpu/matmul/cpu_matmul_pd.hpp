@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_PD_HPP
+#define CPU_MATMUL_PD_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "matmul_pd.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "../cpu_engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_matmul_pd_t : public matmul_pd_t {
+    using matmul_pd_t::matmul_pd_t;
+
+protected:
+    /* output scales are either common or per n (the last dimension) */
+    bool output_scales_mask_ok() const {
+        const auto &oscale = attr()->output_scales_;
+        if (oscale.mask_ == 0) return true;
+        return oscale.mask_ == 1 << (ndims() - 1)
+                && N() != DNNL_RUNTIME_DIM_VAL && oscale.count_ == N();
+    }
+
+    /* supported post-ops chains: (sum)? -> (eltwise)? */
+    bool post_ops_ok() const {
+        const auto &po = attr()->post_ops_;
+        auto is_eltwise
+                = [&](int idx) { return po.entry_[idx].is_eltwise(false); };
+        auto is_sum = [&](int idx) { return po.entry_[idx].is_sum(false); };
+        switch (po.len_) {
+            case 0: return true;
+            case 1: return is_eltwise(0) || is_sum(0);
+            case 2: return is_sum(0) && is_eltwise(1);
+            default: return false;
+        }
+        return false;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_BF16_MATMUL_HPP
+#define CPU_GEMM_BF16_MATMUL_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "../gemm/gemm.hpp"
+#include "../gemm_inner_product_utils.hpp"
+
+#include "cpu_matmul_pd.hpp"
+#include "matmul_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+template <impl::data_type_t dst_type>
+struct gemm_bf16_matmul_t : public primitive_impl_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(GEMM_IMPL_STR, gemm_bf16_matmul_t);
+
+        status_t init();
+
+        /* true if post-processing (bias, per-n scales, eltwise) is required
+         * after gemm */
+        bool do_pp_;
+        /* true if gemm results are accumulated directly in dst (the sum
+         * post-op, if any, is then done by gemm) */
+        bool dst_is_acc_;
+        /* output scale and sum scale passed to gemm as alpha and beta when
+         * no post-processing is required */
+        float gemm_alpha_, gemm_beta_;
+
+    private:
+        void init_scratchpad();
+    };
+
+    gemm_bf16_matmul_t(const pd_t *apd) : primitive_impl_t(apd) {
+        pp_kernel_ = nullptr;
+        if (pd()->do_pp_)
+            pp_kernel_ = new inner_product_utils::pp_kernel_t<data_type::f32,
+                    dst_type>(pd()->N(),
+                    pd()->with_bias() ? pd()->weights_md(1)->data_type
+                                      : data_type::undef,
+                    pd()->attr(), 1 << (pd()->ndims() - 1),
+                    pd()->dst_is_acc_);
+    }
+    ~gemm_bf16_matmul_t() { delete pp_kernel_; }
+
+    typedef typename prec_traits<data_type::bf16>::type src_data_t;
+    typedef typename prec_traits<data_type::bf16>::type wei_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+    typedef typename prec_traits<data_type::f32>::type acc_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_forward(ctx);
+    }
+
+private:
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    inner_product_utils::pp_kernel_t<data_type::f32, dst_type> *pp_kernel_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "type_helpers.hpp"
+
+#include "gemm_f32_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+using namespace data_type;
+using namespace memory_tracking::names;
+
+status_t gemm_f32_matmul_t::pd_t::init() {
+    auto check_bias = [&]() -> bool {
+        return !with_bias()
+                || (weights_md(1)->data_type == f32
+                        && bias_is_per_n(*weights_md(1)));
+    };
+
+    bool ok = true && src_md()->data_type == f32
+            && weights_md()->data_type == f32
+            && desc()->accum_data_type == f32 && dst_md()->data_type == f32
+            && check_bias() && !has_zero_dim_memory()
+            && output_scales_mask_ok() && post_ops_ok()
+            && set_default_formats() == status::success
+            && gemm_layout_supported(*src_md(), false)
+            && gemm_layout_supported(*weights_md(), false)
+            && gemm_layout_supported(*dst_md(), true);
+    if (!ok) return status::unimplemented;
+
+    const auto &po = attr()->post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    const bool with_sum = sum_idx >= 0;
+    const bool with_eltwise = po.find(primitive_kind::eltwise) >= 0;
+    const bool per_n_scales = attr()->output_scales_.mask_ != 0;
+
+    // Common output scale and sum post-op are handled by gemm itself (as
+    // alpha and beta). The sum may also be done by gemm if post-processing
+    // does not scale the results, otherwise the results are accumulated in
+    // a temporary buffer and the post-processing kernel does the sum.
+    do_pp_ = with_bias() || with_eltwise || per_n_scales;
+    dst_is_acc_ = IMPLICATION(do_pp_ && with_sum,
+            attr()->output_scales_.has_default_values());
+    gemm_alpha_ = do_pp_ ? 1.f : attr()->output_scales_.scales_[0];
+    gemm_beta_ = dst_is_acc_ && with_sum ? po.entry_[sum_idx].sum.scale : 0.f;
+
+    // the size of the accumulation buffer and the number of output channels
+    // of the post-processing kernel must be known at creation time
+    if (!dst_is_acc_ && has_runtime_dims_or_strides())
+        return status::unimplemented;
+    if (do_pp_ && N() == DNNL_RUNTIME_DIM_VAL) return status::unimplemented;
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void gemm_f32_matmul_t::pd_t::init_scratchpad() {
+    if (!dst_is_acc_) {
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.book(key_matmul_dst_in_acc_dt,
+                sizeof(acc_data_t) * batch() * M() * N());
+    }
+}
+
+status_t gemm_f32_matmul_t::execute_forward(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto weights_d
+            = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+
+    const gemm_matmul_helper_t helper(src_d, weights_d, dst_d);
+    if (!helper.shapes_consistent() || !helper.gemm_compatible())
+        return status::invalid_arguments;
+
+    const dim_t batch = helper.batch();
+    const dim_t M = helper.M(), N = helper.N(), K = helper.K();
+    if (batch == 0 || M == 0 || N == 0) return status::success;
+
+    // the memory objects might be sub-memories of bigger buffers
+    src += src_d.offset0();
+    weights += weights_d.offset0();
+    dst += dst_d.offset0();
+
+    const bool dst_is_acc = pd()->dst_is_acc_;
+    acc_data_t *acc = dst_is_acc
+            ? dst
+            : ctx.get_scratchpad_grantor().template get<acc_data_t>(
+                    key_matmul_dst_in_acc_dt);
+
+    // column-major gemm computes dst^T = weights^T * src^T
+    const char transa = helper.transA(), transb = helper.transB();
+    const int m = (int)N, n = (int)M, k = (int)K;
+    const int lda = (int)helper.lda(), ldb = (int)helper.ldb();
+    const int ldc = dst_is_acc ? (int)helper.ldc() : m;
+    const float alpha = pd()->gemm_alpha_, beta = pd()->gemm_beta_;
+
+    std::atomic<status_t> st(status::success);
+    auto ker = [&](dim_t b) {
+        dim_t src_off, wei_off, dst_off;
+        helper.batch_offsets(b, src_off, wei_off, dst_off);
+        acc_data_t *c = dst_is_acc ? acc + dst_off : acc + b * M * N;
+        status_t st_b = extended_sgemm(&transa, &transb, &m, &n, &k, &alpha,
+                weights + wei_off, &lda, src + src_off, &ldb, &beta, c, &ldc);
+        if (st_b != status::success) st = st_b;
+    };
+
+    // many small matrices are better processed in parallel over the batch
+    // (gemm falls back to a single thread in a parallel region)
+    const bool parallel_over_batch
+            = batch > 1 && batch >= dnnl_get_max_threads();
+    if (parallel_over_batch)
+        parallel_nd(batch, ker);
+    else
+        for (dim_t b = 0; b < batch; ++b)
+            ker(b);
+
+    if (st != status::success) return st;
+
+    if (pd()->do_pp_) {
+        const float *scales = pd()->attr()->output_scales_.scales_;
+        run_pp_kernel(pp_kernel_, helper, dst, acc, dst_is_acc, bias, scales);
+    }
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,216 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_UTILS_HPP
+#define CPU_MATMUL_UTILS_HPP
+
+#include <limits.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "memory_desc_wrapper.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+/** Describes how a (batched) row-major matrix multiplication
+ *      dst[..., M, N] = src[..., M, K] * wei[..., K, N]
+ * maps onto column-major gemm calls:
+ *      dst^T[N, M] = wei^T[N, K] * src^T[K, M],
+ * i.e. weights are passed as the gemm `A` matrix and source as the `B` one.
+ *
+ * The memory descriptors must be fully defined (no runtime dims or strides),
+ * so at execution time they should be taken from the memory objects. */
+struct gemm_matmul_helper_t {
+    gemm_matmul_helper_t(const memory_desc_wrapper &src_d,
+            const memory_desc_wrapper &wei_d, const memory_desc_wrapper &dst_d)
+        : src_d_(src_d), wei_d_(wei_d), dst_d_(dst_d) {}
+
+    int ndims() const { return dst_d_.ndims(); }
+    int batch_ndims() const { return ndims() - 2; }
+
+    dim_t batch() const {
+        return utils::array_product(dst_d_.dims(), batch_ndims());
+    }
+    dim_t M() const { return dst_d_.dims()[ndims() - 2]; }
+    dim_t N() const { return dst_d_.dims()[ndims() - 1]; }
+    dim_t K() const { return src_d_.dims()[ndims() - 1]; }
+
+    char transA() const { return trans(wei_d_); }
+    char transB() const { return trans(src_d_); }
+
+    dim_t lda() const { return ld(wei_d_); }
+    dim_t ldb() const { return ld(src_d_); }
+    dim_t ldc() const { return nstl::max(stride(dst_d_, ndims() - 2), N()); }
+
+    /** returns true if the actual shapes of the tensors are consistent */
+    bool shapes_consistent() const {
+        const int nd = ndims();
+        bool ok = true && src_d_.ndims() == nd && wei_d_.ndims() == nd
+                && src_d_.dims()[nd - 2] == M()
+                && wei_d_.dims()[nd - 1] == N()
+                && wei_d_.dims()[nd - 2] == K();
+        for (int d = 0; d < batch_ndims(); ++d) {
+            const dim_t dim = dst_d_.dims()[d];
+            ok = ok && utils::one_of(src_d_.dims()[d], 1, dim)
+                    && utils::one_of(wei_d_.dims()[d], 1, dim);
+        }
+        return ok;
+    }
+
+    /** returns true if the layouts of all tensors can be handled by gemm */
+    bool gemm_compatible() const {
+        bool ok = true && plain(src_d_) && plain(wei_d_) && plain(dst_d_)
+                && trans(src_d_) != 0 && trans(wei_d_) != 0
+                && stride(dst_d_, ndims() - 1) == 1
+                && IMPLICATION(M() > 1, stride(dst_d_, ndims() - 2) >= N());
+        if (!ok) return false;
+
+        const dim_t max_int = INT_MAX;
+        for (auto d : {M(), N(), K(), lda(), ldb(), ldc()})
+            ok = ok && d <= max_int;
+        return ok;
+    }
+
+    /** returns true if dst is a dense row-major tensor, so that it may be
+     * treated as a contiguous array of batch * M rows of N elements */
+    bool dst_is_dense_rows() const {
+        dim_t expected_stride = N();
+        for (int d = ndims() - 2; d >= 0; --d) {
+            if (dst_d_.dims()[d] == 1) continue;
+            if (stride(dst_d_, d) != expected_stride) return false;
+            expected_stride *= dst_d_.dims()[d];
+        }
+        return stride(dst_d_, ndims() - 1) == 1;
+    }
+
+    /** computes the offsets (in elements) of the matrices that correspond to
+     * the batch index @p b (dst batch dims are flattened in row-major order,
+     * broadcast batch dimensions of src and weights are not advanced) */
+    void batch_offsets(
+            dim_t b, dim_t &src_off, dim_t &wei_off, dim_t &dst_off) const {
+        src_off = wei_off = dst_off = 0;
+        for (int d = batch_ndims() - 1; d >= 0; --d) {
+            const dim_t dim = dst_d_.dims()[d];
+            const dim_t idx = b % dim;
+            b /= dim;
+            if (src_d_.dims()[d] != 1) src_off += idx * stride(src_d_, d);
+            if (wei_d_.dims()[d] != 1) wei_off += idx * stride(wei_d_, d);
+            dst_off += idx * stride(dst_d_, d);
+        }
+    }
+
+private:
+    const memory_desc_wrapper &src_d_;
+    const memory_desc_wrapper &wei_d_;
+    const memory_desc_wrapper &dst_d_;
+
+    static bool plain(const memory_desc_wrapper &mdw) {
+        return mdw.is_blocking_desc() && mdw.blocking_desc().inner_nblks == 0
+                && !mdw.has_runtime_dims_or_strides();
+    }
+
+    static dim_t stride(const memory_desc_wrapper &mdw, int d) {
+        return mdw.blocking_desc().strides[d];
+    }
+
+    /* for a matrix [..., R, C] returns 'N' if it is row-major, 'T' if it is
+     * column-major, and 0 otherwise */
+    static char trans(const memory_desc_wrapper &mdw) {
+        const int nd = mdw.ndims();
+        const dim_t R = mdw.dims()[nd - 2], C = mdw.dims()[nd - 1];
+        const dim_t sR = stride(mdw, nd - 2), sC = stride(mdw, nd - 1);
+        if (sC == 1 && (R == 1 || sR >= C)) return 'N';
+        if (sR == 1 && (C == 1 || sC >= R)) return 'T';
+        return 0;
+    }
+
+    static dim_t ld(const memory_desc_wrapper &mdw) {
+        const int nd = mdw.ndims();
+        const dim_t R = mdw.dims()[nd - 2], C = mdw.dims()[nd - 1];
+        return trans(mdw) == 'N' ? nstl::max(stride(mdw, nd - 2), C)
+                                 : nstl::max(stride(mdw, nd - 1), R);
+    }
+};
+
+/** applies the inner product post-processing kernel @p pp_kernel to the
+ * matrix multiplication results @p acc and stores them in @p dst.
+ * If @p dst_is_acc is true, results are accumulated directly in dst and are
+ * processed in place, otherwise @p acc is a dense array of batch * M * N
+ * elements */
+template <typename pp_kernel_t, typename dst_data_t, typename acc_data_t>
+void run_pp_kernel(pp_kernel_t *pp_kernel,
+        const gemm_matmul_helper_t &helper, dst_data_t *dst,
+        const acc_data_t *acc, bool dst_is_acc, const char *bias,
+        const float *scales) {
+    const dim_t batch = helper.batch(), M = helper.M(), N = helper.N();
+
+    if (helper.dst_is_dense_rows()) {
+        // dst and acc share the same (dense) layout, process all at once
+        const size_t work_amount = (size_t)batch * M * N;
+        const bool force_sequential = work_amount < 2000;
+        parallel(force_sequential ? 1 : 0, [&](int ithr, int nthr) {
+            size_t start {0}, end {0};
+            balance211(work_amount, nthr, ithr, start, end);
+            (*pp_kernel)(dst, acc, bias, scales, start, end);
+        });
+    } else {
+        // process dst row by row, as rows might not be contiguous
+        const dim_t ldc = helper.ldc();
+        parallel_nd(batch, M, [&](dim_t b, dim_t m) {
+            dim_t src_off, wei_off, dst_off;
+            helper.batch_offsets(b, src_off, wei_off, dst_off);
+            dst_data_t *d = dst + dst_off + m * ldc;
+            const acc_data_t *a = dst_is_acc ? (const acc_data_t *)d
+                                             : acc + (b * M + m) * N;
+            (*pp_kernel)(d, a, bias, scales, 0, N);
+        });
+    }
+}
+
+/** returns true if bias is a row vector [1, ..., 1, N], i.e. it is applied
+ * per output channel n and may be handled by the inner product
+ * post-processing kernel */
+inline bool bias_is_per_n(const memory_desc_t &bias_md) {
+    const int nd = bias_md.ndims;
+    for (int d = 0; d < nd - 1; ++d)
+        if (bias_md.dims[d] != 1) return false;
+    return bias_md.dims[nd - 1] != DNNL_RUNTIME_DIM_VAL;
+}
+
+/** returns true if the innermost strides of the memory descriptor are known
+ * at creation time, and it is a plain layout gemm may potentially handle */
+inline bool gemm_layout_supported(const memory_desc_t &md, bool is_dst) {
+    const memory_desc_wrapper mdw(md);
+    if (!mdw.is_blocking_desc() || mdw.blocking_desc().inner_nblks != 0)
+        return false;
+    const int nd = mdw.ndims();
+    const auto &strides = mdw.blocking_desc().strides;
+    if (is_dst) return strides[nd - 1] == 1;
+    return strides[nd - 1] == 1 || strides[nd - 2] == 1;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,129 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "type_helpers.hpp"
+
+#include "../simple_q10n.hpp"
+
+#include "matmul_utils.hpp"
+#include "ref_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+using math::get_bias;
+
+template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type,
+        data_type_t acc_type>
+status_t ref_matmul_t<src_type, wei_type, dst_type, acc_type>::execute_ref(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
+    auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto weights_d
+            = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+    const auto bias_d = ctx.memory_mdw(DNNL_ARG_BIAS, pd()->weights_md(1));
+
+    const gemm_matmul_helper_t helper(src_d, weights_d, dst_d);
+    if (!helper.shapes_consistent()) return status::invalid_arguments;
+
+    const int ndims = dst_d.ndims();
+    const int batch_ndims = ndims - 2;
+    if (bias) {
+        for (int d = 0; d < ndims; ++d)
+            if (!utils::one_of(bias_d.dims()[d], 1, dst_d.dims()[d]))
+                return status::invalid_arguments;
+    }
+
+    const dim_t batch = helper.batch();
+    const dim_t M = helper.M(), N = helper.N(), K = helper.K();
+    if (batch == 0 || M == 0 || N == 0) return status::success;
+
+    const auto &oscales = pd()->attr()->output_scales_;
+    const bool per_n_scales = oscales.mask_ != 0;
+    const auto &po = pd()->attr()->post_ops_;
+    const int sum_idx = po.find(primitive_kind::sum);
+    const float sum_scale = sum_idx >= 0 ? po.entry_[sum_idx].sum.scale : 0.f;
+    const data_type_t bias_dt = pd()->weights_md(1)->data_type;
+
+    parallel_nd(batch, M, N, [&](dim_t b, dim_t m, dim_t n) {
+        dims_t src_pos, wei_pos, dst_pos, bias_pos;
+
+        // unroll the flattened batch index, broadcasting where needed
+        dim_t b_rem = b;
+        for (int d = batch_ndims - 1; d >= 0; --d) {
+            const dim_t idx = b_rem % dst_d.dims()[d];
+            b_rem /= dst_d.dims()[d];
+            dst_pos[d] = idx;
+            src_pos[d] = src_d.dims()[d] == 1 ? 0 : idx;
+            wei_pos[d] = weights_d.dims()[d] == 1 ? 0 : idx;
+        }
+        dst_pos[ndims - 2] = src_pos[ndims - 2] = m;
+        dst_pos[ndims - 1] = wei_pos[ndims - 1] = n;
+
+        acc_data_t acc = 0;
+        for (dim_t k = 0; k < K; ++k) {
+            src_pos[ndims - 1] = wei_pos[ndims - 2] = k;
+            acc += (acc_data_t)src[src_d.off_v(src_pos)]
+                    * (acc_data_t)weights[weights_d.off_v(wei_pos)];
+        }
+
+        const dim_t dst_off = dst_d.off_v(dst_pos);
+        float d = (float)acc;
+        if (bias) {
+            for (int i = 0; i < ndims; ++i)
+                bias_pos[i] = bias_d.dims()[i] == 1 ? 0 : dst_pos[i];
+            d += get_bias(bias, bias_d.off_v(bias_pos), bias_dt);
+        }
+        d *= oscales.scales_[per_n_scales ? n : 0];
+        if (sum_idx >= 0) d += sum_scale * (float)dst[dst_off];
+        if (eltwise_) d = eltwise_->compute_scalar(d);
+        dst[dst_off] = qz_a1b0<float, dst_data_t>()(d);
+    });
+
+    return status::success;
+}
+
+using namespace data_type;
+template struct ref_matmul_t<f32>;
+template struct ref_matmul_t<bf16, bf16, f32, f32>;
+template struct ref_matmul_t<bf16, bf16, bf16, f32>;
+template struct ref_matmul_t<u8, s8, f32, s32>;
+template struct ref_matmul_t<u8, s8, s32, s32>;
+template struct ref_matmul_t<u8, s8, s8, s32>;
+template struct ref_matmul_t<u8, s8, u8, s32>;
+template struct ref_matmul_t<s8, s8, f32, s32>;
+template struct ref_matmul_t<s8, s8, s32, s32>;
+template struct ref_matmul_t<s8, s8, s8, s32>;
+template struct ref_matmul_t<s8, s8, u8, s32>;
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
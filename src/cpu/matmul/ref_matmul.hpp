@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_MATMUL_HPP
+#define CPU_REF_MATMUL_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "../ref_eltwise.hpp"
+
+#include "cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+template <impl::data_type_t src_type, impl::data_type_t wei_type = src_type,
+        impl::data_type_t dst_type = src_type,
+        impl::data_type_t acc_type = dst_type>
+struct ref_matmul_t : public primitive_impl_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_matmul_t);
+
+        status_t init() {
+            using namespace data_type;
+
+            bool ok = true && src_md()->data_type == src_type
+                    && weights_md()->data_type == wei_type
+                    && desc()->accum_data_type == acc_type
+                    && dst_md()->data_type == dst_type
+                    && IMPLICATION(with_bias(),
+                            utils::one_of(
+                                    weights_md(1)->data_type, f32, s32, s8, u8)
+                                    && IMPLICATION(src_type == f32
+                                                    || src_type == bf16,
+                                            weights_md(1)->data_type == f32))
+                    && output_scales_mask_ok() && post_ops_ok()
+                    && set_default_formats() == status::success;
+            return ok ? status::success : status::unimplemented;
+        }
+    };
+
+    ref_matmul_t(const pd_t *apd) : primitive_impl_t(apd) {
+        eltwise_ = nullptr;
+        const auto &po = pd()->attr()->post_ops_;
+        const int eltwise_idx = po.find(primitive_kind::eltwise);
+        if (eltwise_idx >= 0)
+            eltwise_ = new ref_eltwise_scalar_fwd_t(
+                    po.entry_[eltwise_idx].eltwise);
+    }
+    ~ref_matmul_t() { delete eltwise_; }
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<wei_type>::type wei_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+    typedef typename prec_traits<acc_type>::type acc_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_ref(ctx);
+    }
+
+private:
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    ref_eltwise_scalar_fwd_t *eltwise_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -46,7 +46,7 @@ struct nchw_pooling_fwd_t : public primitive_impl_t {
 
             bool ok = true
                     && IMPLICATION(
-                            d_type == data_type::bf16, mayiuse(avx512_core))
+                            d_type == data_type::bf16, mayiuse(avx2))
                     && set_default_params() == status::success && is_fwd()
                     && utils::one_of(desc()->alg_kind, alg_kind::pooling_max,
                             alg_kind::pooling_avg_include_padding,
@@ -108,7 +108,7 @@ struct nchw_pooling_bwd_t : public primitive_impl_t {
             using namespace alg_kind;
             bool ok = true
                     && IMPLICATION(
-                            d_type == data_type::bf16, mayiuse(avx512_core))
+                            d_type == data_type::bf16, mayiuse(avx2))
                     && set_default_params() == status::success && !is_fwd()
                     && utils::one_of(desc()->alg_kind, alg_kind::pooling_max,
                             alg_kind::pooling_avg_include_padding,
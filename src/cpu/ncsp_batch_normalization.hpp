@@ -45,6 +45,7 @@ struct ncsp_batch_normalization_fwd_t : public primitive_impl_t {
             using namespace format_tag;
 
             bool ok = true && is_fwd() && !has_zero_dim_memory()
+                    && !fuse_norm_add_relu()
                     && src_md()->data_type == d_type
                     && IMPLICATION(d_type == bf16, mayiuse(avx512_core))
                     && IMPLICATION(
@@ -119,6 +120,7 @@ struct ncsp_batch_normalization_bwd_t : public primitive_impl_t {
             using namespace format_tag;
 
             bool ok = true && is_bwd() && !has_zero_dim_memory()
+                    && !fuse_norm_add_relu()
                     && utils::everyone_is(d_type, src_md()->data_type,
                             diff_src_md()->data_type)
                     && IMPLICATION(d_type == bf16, mayiuse(avx512_core))
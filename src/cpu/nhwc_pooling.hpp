@@ -54,7 +54,7 @@ struct nhwc_pooling_fwd_t : public primitive_impl_t {
             using namespace alg_kind;
             bool ok = true
                     && IMPLICATION(
-                            d_type == data_type::bf16, mayiuse(avx512_core))
+                            d_type == data_type::bf16, mayiuse(avx2))
                     && set_default_params() == status::success && is_fwd()
                     && utils::one_of(desc()->alg_kind, pooling_max,
                             pooling_avg_include_padding,
@@ -191,7 +191,7 @@ struct nhwc_pooling_bwd_t : public primitive_impl_t {
             using namespace alg_kind;
             bool ok = true
                     && IMPLICATION(
-                            d_type == data_type::bf16, mayiuse(avx512_core))
+                            d_type == data_type::bf16, mayiuse(avx2))
                     && set_default_params() == status::success && !is_fwd()
                     && utils::one_of(desc()->alg_kind, pooling_max,
                             pooling_avg_include_padding,
@@ -51,6 +51,7 @@ struct nspc_batch_normalization_fwd_t : public primitive_impl_t {
                     /* the algorithm requires barriers while switching
                  * between parallelization over N and C dimensions */
                     && dnnl_thr_syncable() && is_fwd() && !has_zero_dim_memory()
+                    && !fuse_norm_add_relu()
                     && src_md()->data_type == d_type
                     && IMPLICATION(d_type == bf16, mayiuse(avx512_core))
                     && IMPLICATION(
@@ -125,6 +126,7 @@ struct nspc_batch_normalization_bwd_t : public primitive_impl_t {
                     /* the algorithm requires barriers while switching
                  * between parallelization over N and C dimensions */
                     && dnnl_thr_syncable() && is_bwd() && !has_zero_dim_memory()
+                    && !fuse_norm_add_relu()
                     && utils::everyone_is(d_type, src_md()->data_type,
                             diff_src_md()->data_type)
                     && IMPLICATION(d_type == bf16, mayiuse(avx512_core))
@@ -81,6 +81,8 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
                     CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE))
             : CTX_OUT_MEM(float *, DNNL_ARG_VARIANCE);
 
+    auto src_1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
     auto ws = CTX_OUT_MEM(uint8_t *, DNNL_ARG_WORKSPACE);
 
@@ -101,7 +103,8 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool save_stats = pd()->is_training();
     const bool is_training = pd()->is_training();
-    const bool fuse_norm_relu = pd()->fuse_norm_relu();
+    const bool fuse_norm_add_relu = pd()->fuse_norm_add_relu();
+    const bool fuse_norm_relu = pd()->fuse_norm_relu() || fuse_norm_add_relu;
     const bool calculate_stats = !pd()->stats_is_src();
 
     /* fast return */
@@ -161,6 +164,7 @@ void ref_batch_normalization_fwd_t<d_type>::execute_forward(
             auto d_off = data_offset(data_d, n, c, d, h, w);
             acc_data_t bn_res
                     = sm * (maybe_up_convert(src[d_off]) - v_mean) + sv;
+            if (fuse_norm_add_relu) bn_res += maybe_up_convert(src_1[d_off]);
             if (fuse_norm_relu) {
                 if (bn_res <= 0) {
                     bn_res = 0;
@@ -199,6 +203,7 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
     auto ws = CTX_IN_MEM(const uint8_t *, DNNL_ARG_WORKSPACE);
 
     auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+    auto diff_src_1 = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC_1);
     auto diff_scaleshift = CTX_OUT_MEM(acc_data_t *, DNNL_ARG_DIFF_SCALE_SHIFT);
 
     const memory_desc_wrapper data_d(pd()->src_md());
@@ -231,7 +236,8 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
     const float eps = pd()->desc()->batch_norm_epsilon;
     const bool use_scaleshift = pd()->use_scaleshift();
     const bool calculate_diff_stats = !pd()->use_global_stats();
-    const bool fuse_norm_relu = pd()->fuse_norm_relu();
+    const bool fuse_norm_add_relu = pd()->fuse_norm_add_relu();
+    const bool fuse_norm_relu = pd()->fuse_norm_relu() || fuse_norm_add_relu;
 
     const bool is_3d = data_d.ndims() == 5;
     const bool is_1d = data_d.ndims() == 3;
@@ -282,6 +288,7 @@ void ref_batch_normalization_bwd_t<d_type>::execute_backward(
                 dd = 0;
             else
                 dd = maybe_up_convert(diff_dst[dd_off]);
+            if (fuse_norm_add_relu) diff_src_1[dd_off] = dd;
             acc_data_t v_diff_src = dd;
             if (calculate_diff_stats) {
                 v_diff_src -= diff_beta / (D * W * H * N)
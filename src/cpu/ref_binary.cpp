@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "memory.hpp"
+#include "type_helpers.hpp"
+
+#include "ref_binary.hpp"
+#include "simple_q10n.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace alg_kind;
+
+ref_binary_scalar_t::ref_binary_scalar_t(alg_kind_t alg) : alg_(alg) {
+    assert(utils::one_of(alg_, binary_add, binary_mul, binary_max, binary_min));
+}
+
+ref_binary_scalar_t::ref_binary_scalar_t(
+        const post_ops_t::entry_t::binary_t &binary)
+    : ref_binary_scalar_t(binary.alg) {}
+
+float ref_binary_scalar_t::compute_scalar(float src0, float src1) const {
+    switch (alg_) {
+        case binary_add: return src0 + src1;
+        case binary_mul: return src0 * src1;
+        case binary_max: return nstl::max(src0, src1);
+        case binary_min: return nstl::min(src0, src1);
+        default: assert(!"unknown binary alg_kind");
+    }
+    return 0.f;
+}
+
+bool binary_post_op_src1_ok(const memory_desc_t &src1_md,
+        const memory_desc_t &dst_md, format_tag_t tag) {
+    const memory_desc_wrapper src1_d(src1_md);
+    const int ndims = dst_md.ndims;
+
+    bool ok = true && src1_d.data_type() == data_type::f32
+            && src1_d.ndims() == ndims && ndims >= 2 && src1_d.matches_tag(tag);
+    for (int d = 0; d < 2 && ok; d++)
+        ok = utils::one_of(src1_d.dims()[d], 1, dst_md.dims[d]);
+    if (!ok) return false;
+
+    bool sp_bcast = true, sp_same = true;
+    for (int d = 2; d < ndims; d++) {
+        sp_bcast = sp_bcast && src1_d.dims()[d] == 1;
+        sp_same = sp_same && src1_d.dims()[d] == dst_md.dims[d];
+    }
+    return sp_bcast || sp_same;
+}
+
+void binary_post_op_src1_strides(const memory_desc_t &src1_md,
+        dim_t &stride_mb, dim_t &stride_c, dim_t &stride_sp) {
+    const memory_desc_wrapper src1_d(src1_md);
+    const auto &strides = src1_d.blocking_desc().strides;
+    const int ndims = src1_d.ndims();
+
+    stride_mb = src1_d.dims()[0] == 1 ? 0 : strides[0];
+    stride_c = src1_d.dims()[1] == 1 ? 0 : strides[1];
+    stride_sp = utils::array_product(src1_d.dims() + 2, ndims - 2) == 1 ? 0 : 1;
+}
+
+template <data_type_t data_type>
+status_t ref_binary_t<data_type>::execute_ref(const exec_ctx_t &ctx) const {
+    auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
+    auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src0_d(pd()->src_md(0));
+    const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const int ndims = pd()->ndims();
+    const dim_t nelems = src0_d.nelems();
+
+    parallel_nd(nelems, [&](dim_t i) {
+        dims_t pos;
+        dim_t l = i;
+        for (int d = ndims - 1; d >= 0; --d) {
+            pos[d] = l % src0_d.dims()[d];
+            l /= src0_d.dims()[d];
+        }
+        const dim_t src0_off = src0_d.off_v(pos);
+        const dim_t dst_off = dst_d.off_v(pos);
+
+        // src1 is read at the origin of the dimensions it is broadcast along
+        for (int d = 0; d < ndims; ++d)
+            if (pd()->is_broadcast(d)) pos[d] = 0;
+        const dim_t src1_off = src1_d.off_v(pos);
+
+        float res = binary_.compute_scalar(
+                (float)src0[src0_off], (float)src1[src1_off]);
+        if (eltwise_) res = eltwise_->compute_scalar(res);
+        dst[dst_off] = qz_a1b0<float, data_t>()(res);
+    });
+
+    if (dst_d.nelems(true) != nelems) ctx.memory(DNNL_ARG_DST)->zero_pad();
+
+    return status::success;
+}
+
+using namespace data_type;
+
+template struct ref_binary_t<f32>;
+template struct ref_binary_t<bf16>;
+template struct ref_binary_t<s8>;
+template struct ref_binary_t<u8>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+#ifndef CPU_REF_BINARY_HPP
+#define CPU_REF_BINARY_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_binary_pd.hpp"
+#include "ref_eltwise.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_binary_scalar_t {
+public:
+    ref_binary_scalar_t(alg_kind_t alg);
+    ref_binary_scalar_t(const post_ops_t::entry_t::binary_t &binary);
+
+    float compute_scalar(float src0, float src1) const;
+
+    const alg_kind_t alg_;
+};
+
+/* The src1 of a binary post-op the implementations apply with
+ * ref_binary_scalar_t over a plain dst: an f32 tensor of the layout @p tag
+ * that is of the batch of dst or of a unit one, and likewise for the
+ * channels and for the spatial as a whole */
+bool binary_post_op_src1_ok(const memory_desc_t &src1_md,
+        const memory_desc_t &dst_md, format_tag_t tag);
+
+/* The strides of such a src1 over the batch, the channels and the flattened
+ * spatial, zeros along the dimensions it is broadcast along */
+void binary_post_op_src1_strides(const memory_desc_t &src1_md,
+        dim_t &stride_mb, dim_t &stride_c, dim_t &stride_sp);
+
+template <impl::data_type_t data_type>
+struct ref_binary_t : public primitive_impl_t {
+    struct pd_t : public cpu_binary_pd_t {
+        using cpu_binary_pd_t::cpu_binary_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_binary_t);
+
+        status_t init() {
+            bool ok = true
+                    && utils::everyone_is(data_type, src_md(0)->data_type,
+                            src_md(1)->data_type, dst_md()->data_type)
+                    && attr()->output_scales_.has_default_values()
+                    && post_ops_ok() && set_default_params() == status::success;
+            return ok ? status::success : status::unimplemented;
+        }
+    };
+
+    ref_binary_t(const pd_t *apd)
+        : primitive_impl_t(apd)
+        , binary_(apd->desc()->alg_kind)
+        , eltwise_(nullptr) {
+        const auto &po = pd()->attr()->post_ops_;
+        const int idx = po.find(primitive_kind::eltwise);
+        if (idx != -1)
+            eltwise_ = new ref_eltwise_scalar_fwd_t(po.entry_[idx].eltwise);
+    }
+    ~ref_binary_t() { delete eltwise_; }
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_ref(ctx);
+    }
+
+private:
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    ref_binary_scalar_t binary_;
+    ref_eltwise_scalar_fwd_t *eltwise_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -30,6 +30,46 @@ namespace cpu {
 using namespace alg_kind;
 using namespace math;
 
+namespace {
+// bf16 data is processed by blocks converted to f32 and back with the bulk
+// converters, which are much faster than the element-wise conversions
+constexpr ptrdiff_t bf16_cvt_block = 1024;
+
+template <typename ker_t>
+void for_bf16_blocks(ptrdiff_t nelems, const ker_t &ker) {
+    const ptrdiff_t nblocks = utils::div_up(nelems, bf16_cvt_block);
+    parallel(0, [&](const int ithr, const int nthr) {
+        ptrdiff_t start {0}, end {0};
+        balance211(nblocks, nthr, ithr, start, end);
+        for (ptrdiff_t b = start; b < end; ++b) {
+            const ptrdiff_t off = b * bf16_cvt_block;
+            ker(off, nstl::min(bf16_cvt_block, nelems - off));
+        }
+    });
+}
+
+template <typename T>
+T compute_eltwise_bwd(alg_kind_t alg_kind, T dd, T s, float alpha, float beta) {
+    switch (alg_kind) {
+        case eltwise_relu: return relu_bwd(dd, s, alpha);
+        case eltwise_tanh: return tanh_bwd(dd, s);
+        case eltwise_elu: return elu_bwd(dd, s, alpha);
+        case eltwise_square: return square_bwd(dd, s);
+        case eltwise_abs: return abs_bwd(dd, s);
+        case eltwise_sqrt: return sqrt_bwd(dd, s);
+        case eltwise_linear: return linear_bwd(dd, s, alpha, beta);
+        case eltwise_bounded_relu: return bounded_relu_bwd(dd, s, alpha);
+        case eltwise_soft_relu: return soft_relu_bwd(dd, s);
+        case eltwise_logistic: return logistic_bwd(dd, s);
+        case eltwise_exp: return exp_bwd(dd, s);
+        case eltwise_gelu: return gelu_bwd(dd, s);
+        case eltwise_swish: return swish_bwd(dd, s, alpha);
+        default: assert(!"unknown eltwise alg_kind");
+    }
+    return T(0);
+}
+} // namespace
+
 ref_eltwise_scalar_fwd_t::ref_eltwise_scalar_fwd_t(
         alg_kind_t alg, float alpha, float beta)
     : alg_(alg), alpha_(alpha), beta_(beta) {
@@ -154,12 +194,21 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_generic(
 }
 
 template <impl::data_type_t data_type>
-void ref_eltwise_fwd_t<data_type>::execute_forward_dense(
+status_t ref_eltwise_fwd_t<data_type>::execute_forward_dense(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
-    const memory_desc_wrapper data_d(pd()->src_md());
+    const auto data_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+
+    if (pd()->has_runtime_dims_or_strides()) {
+        const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+        const bool ok = true
+                && memory_desc_wrapper(pd()->src_md()).matches_runtime_md(
+                        data_d)
+                && data_d.is_dense() && dst_d == data_d;
+        if (!ok) return status::invalid_arguments;
+    }
 
     const ptrdiff_t nelems = static_cast<ptrdiff_t>(data_d.nelems(true));
     const auto alg_kind = pd()->desc()->alg_kind;
@@ -169,11 +218,25 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense(
     src += data_d.offset0();
     dst += data_d.offset0();
 
+    if (data_type == data_type::bf16) {
+        auto b_src = reinterpret_cast<const bfloat16_t *>(src);
+        auto b_dst = reinterpret_cast<bfloat16_t *>(dst);
+        ref_eltwise_scalar_fwd_t ker(alg_kind, alpha, beta);
+        for_bf16_blocks(nelems, [&](ptrdiff_t off, ptrdiff_t len) {
+            float buf[bf16_cvt_block];
+            cvt_bfloat16_to_float(buf, b_src + off, len);
+            for (ptrdiff_t e = 0; e < len; ++e)
+                buf[e] = ker.compute_scalar(buf[e]);
+            cvt_float_to_bfloat16(b_dst + off, buf, len);
+        });
+        return status::success;
+    }
+
     if (alg_kind == eltwise_relu) {
         // a fast path for relu as the most popular activation
         parallel_nd(
                 nelems, [&](ptrdiff_t e) { dst[e] = relu_fwd(src[e], alpha); });
-        return;
+        return status::success;
     }
 
     parallel_nd(nelems, [&](ptrdiff_t e) {
@@ -196,6 +259,8 @@ void ref_eltwise_fwd_t<data_type>::execute_forward_dense(
             default: assert(!"unknown eltwise alg_kind");
         }
     });
+
+    return status::success;
 }
 
 template <impl::data_type_t data_type>
@@ -269,29 +334,25 @@ void ref_eltwise_bwd_t<data_type>::execute_backward_dense(
     diff_dst += diff_data_d.offset0();
     diff_src += diff_data_d.offset0();
 
-    parallel_nd(nelems, [&](ptrdiff_t e) {
-        const data_t dd = diff_dst[e];
-        const data_t s = src[e];
-        data_t &ds = diff_src[e];
+    if (data_type == data_type::bf16) {
+        auto b_src = reinterpret_cast<const bfloat16_t *>(src);
+        auto b_diff_dst = reinterpret_cast<const bfloat16_t *>(diff_dst);
+        auto b_diff_src = reinterpret_cast<bfloat16_t *>(diff_src);
+        for_bf16_blocks(nelems, [&](ptrdiff_t off, ptrdiff_t len) {
+            float s_buf[bf16_cvt_block], dd_buf[bf16_cvt_block];
+            cvt_bfloat16_to_float(s_buf, b_src + off, len);
+            cvt_bfloat16_to_float(dd_buf, b_diff_dst + off, len);
+            for (ptrdiff_t e = 0; e < len; ++e)
+                dd_buf[e] = compute_eltwise_bwd(
+                        alg_kind, dd_buf[e], s_buf[e], alpha, beta);
+            cvt_float_to_bfloat16(b_diff_src + off, dd_buf, len);
+        });
+        return;
+    }
 
-        switch (alg_kind) {
-            case eltwise_relu: ds = relu_bwd(dd, s, alpha); break;
-            case eltwise_tanh: ds = tanh_bwd(dd, s); break;
-            case eltwise_elu: ds = elu_bwd(dd, s, alpha); break;
-            case eltwise_square: ds = square_bwd(dd, s); break;
-            case eltwise_abs: ds = abs_bwd(dd, s); break;
-            case eltwise_sqrt: ds = sqrt_bwd(dd, s); break;
-            case eltwise_linear: ds = linear_bwd(dd, s, alpha, beta); break;
-            case eltwise_bounded_relu:
-                ds = bounded_relu_bwd(dd, s, alpha);
-                break;
-            case eltwise_soft_relu: ds = soft_relu_bwd(dd, s); break;
-            case eltwise_logistic: ds = logistic_bwd(dd, s); break;
-            case eltwise_exp: ds = exp_bwd(dd, s); break;
-            case eltwise_gelu: ds = gelu_bwd(dd, s); break;
-            case eltwise_swish: ds = swish_bwd(dd, s, alpha); break;
-            default: assert(!"unknown eltwise alg_kind");
-        }
+    parallel_nd(nelems, [&](ptrdiff_t e) {
+        diff_src[e] = compute_eltwise_bwd(
+                alg_kind, diff_dst[e], src[e], alpha, beta);
     });
 }
 
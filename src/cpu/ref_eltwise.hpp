@@ -57,6 +57,9 @@ struct ref_eltwise_fwd_t : public primitive_impl_t {
 
             use_dense_ = false || src_d.is_dense()
                     || (src_d.is_dense(true) && is_zero_preserved());
+            // with run-time dimensions the data must be dense, which is
+            // checked at execution
+            if (has_runtime_dims_or_strides()) use_dense_ = src_d.is_plain();
 
             use_nCspBc_padded_ = !use_dense_
                     && src_d.blocking_desc().inner_nblks == 1
@@ -67,13 +70,15 @@ struct ref_eltwise_fwd_t : public primitive_impl_t {
             if (has_zero_dim_memory()) use_dense_ = use_nCspBc_padded_ = false;
 
             const bool use_generic = !use_dense_ && !use_nCspBc_padded_;
+            if (use_generic && has_runtime_dims_or_strides())
+                return status::unimplemented;
 
             bool ok = true && is_fwd()
                     && everyone_is(data_type, desc()->data_desc.data_type)
-                    /*bf16<->f32 cvt operators don't work on non-avx512_core*/
+                    /* bf16 relies on the bulk conversions of avx2 and up */
                     && IMPLICATION(
                             desc()->data_desc.data_type == data_type::bf16,
-                            mayiuse(avx512_core))
+                            mayiuse(avx2))
                     && IMPLICATION(use_generic, one_of(src_d.ndims(), 4, 5))
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
@@ -88,9 +93,9 @@ struct ref_eltwise_fwd_t : public primitive_impl_t {
     typedef typename prec_traits<data_type>::type data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        if (pd()->use_dense_)
-            execute_forward_dense(ctx);
-        else if (pd()->use_nCspBc_padded_)
+        if (pd()->use_dense_) return execute_forward_dense(ctx);
+
+        if (pd()->use_nCspBc_padded_)
             execute_forward_nCspBc_padded(ctx);
         else
             execute_forward_generic(ctx);
@@ -99,7 +104,7 @@ struct ref_eltwise_fwd_t : public primitive_impl_t {
 
 private:
     void execute_forward_nCspBc_padded(const exec_ctx_t &ctx) const;
-    void execute_forward_dense(const exec_ctx_t &ctx) const;
+    status_t execute_forward_dense(const exec_ctx_t &ctx) const;
     void execute_forward_generic(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 };
@@ -117,10 +122,10 @@ struct ref_eltwise_bwd_t : public primitive_impl_t {
             bool ok = true && !is_fwd()
                     && everyone_is(data_type, desc()->data_desc.data_type,
                             desc()->diff_data_desc.data_type)
-                    /*bf16<->f32 cvt operators don't work on non-avx512_core*/
+                    /* bf16 relies on the bulk conversions of avx2 and up */
                     && IMPLICATION(
                             desc()->data_desc.data_type == data_type::bf16,
-                            mayiuse(avx512_core))
+                            mayiuse(avx2))
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
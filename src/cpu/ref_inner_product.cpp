@@ -31,19 +31,27 @@ using math::saturate;
 
 template <data_type_t src_type, data_type_t wei_type, data_type_t dst_type,
         data_type_t acc_type>
-void ref_inner_product_fwd_t<src_type, wei_type, dst_type,
+status_t ref_inner_product_fwd_t<src_type, wei_type, dst_type,
         acc_type>::execute_forward(const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
     auto weights = CTX_IN_MEM(const wei_data_t *, DNNL_ARG_WEIGHTS);
     auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
     auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
 
-    const memory_desc_wrapper src_d(pd()->src_md());
-    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
     const memory_desc_wrapper bias_d(pd()->weights_md(1));
 
-    const int MB = pd()->MB();
+    if (pd()->has_runtime_dims_or_strides()) {
+        const bool ok = true
+                && memory_desc_wrapper(pd()->src_md()).matches_runtime_md(src_d)
+                && memory_desc_wrapper(pd()->dst_md()).matches_runtime_md(dst_d)
+                && src_d.dims()[0] == dst_d.dims()[0];
+        if (!ok) return status::invalid_arguments;
+    }
+
+    const int MB = src_d.dims()[0];
     const int OC = pd()->OC();
     const int IC = pd()->IC();
 
@@ -108,6 +116,8 @@ void ref_inner_product_fwd_t<src_type, wei_type, dst_type,
         if (do_relu && a < (acc_data_t)0) a *= nslope;
         dst[dst_d.off(mb, oc)] = saturate<dst_data_t>(a);
     });
+
+    return status::success;
 }
 
 using namespace data_type;
@@ -52,7 +52,9 @@ struct ref_inner_product_fwd_t : public primitive_impl_t {
                     && attr()->post_ops_.len_ <= 1
                     && IMPLICATION(attr()->post_ops_.len_ == 1,
                             attr()->post_ops_.entry_[0].is_relu(true, false))
-                    && set_default_params() == status::success;
+                    && set_default_params() == status::success
+                    && IMPLICATION(has_runtime_dims_or_strides(),
+                            memory_desc_wrapper(src_md()).is_plain());
             return ok ? status::success : status::unimplemented;
         }
     };
@@ -65,12 +67,11 @@ struct ref_inner_product_fwd_t : public primitive_impl_t {
     typedef typename prec_traits<acc_type>::type acc_data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 };
 
@@ -43,7 +43,7 @@ inline float maybe_up_convert<bfloat16_t>(bfloat16_t x) {
 using namespace data_type;
 
 template <impl::data_type_t d_type>
-void ref_layer_normalization_fwd_t<d_type>::execute_forward(
+status_t ref_layer_normalization_fwd_t<d_type>::execute_forward(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto scaleshift = CTX_IN_MEM(const float *, DNNL_ARG_SCALE_SHIFT);
@@ -57,12 +57,25 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
 
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
-    const memory_desc_wrapper src_d(pd()->src_md());
-    const memory_desc_wrapper dst_d(pd()->dst_md());
-    const memory_desc_wrapper stat_d(pd()->stat_md());
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+    const auto stat_d = ctx.memory_mdw(DNNL_ARG_MEAN, pd()->stat_md());
     const memory_desc_wrapper scaleshift_d(pd()->weights_md());
 
-    const dim_t N = pd()->across_axis();
+    if (pd()->has_runtime_dims_or_strides()) {
+        const memory_desc_wrapper pd_src_d(pd()->src_md());
+        const memory_desc_wrapper pd_stat_d(pd()->stat_md());
+        // the statistics are not passed if they are neither used nor saved
+        const bool ok = true && pd_src_d.matches_runtime_md(src_d)
+                && pd_src_d.matches_runtime_md(dst_d)
+                && IMPLICATION(!stat_d.is_zero(),
+                        pd_stat_d.matches_runtime_md(stat_d)
+                                && utils::array_cmp(stat_d.dims(),
+                                        src_d.dims(), stat_d.ndims()));
+        if (!ok) return status::invalid_arguments;
+    }
+
+    const dim_t N = utils::array_product(src_d.dims(), src_d.ndims() - 1);
     const dim_t C = pd()->norm_axis();
 
     const float eps = pd()->desc()->layer_norm_epsilon;
@@ -71,14 +84,14 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
     const bool calculate_stats = !pd()->stats_are_src();
 
     /* fast return */
-    if (this->pd()->has_zero_dim_memory()) {
+    if (src_d.has_zero_dim()) {
         if (calculate_stats && save_stats) {
             for (dim_t n = 0; n < N; n++) {
                 mean[n] = 0;
                 variance[n] = 0;
             }
         }
-        return;
+        return status::success;
     }
 
     parallel_nd(N, [&](dim_t n) {
@@ -119,6 +132,8 @@ void ref_layer_normalization_fwd_t<d_type>::execute_forward(
             }
         }
     });
+
+    return status::success;
 }
 
 template struct ref_layer_normalization_fwd_t<f32>;
@@ -49,6 +49,8 @@ struct ref_layer_normalization_fwd_t : public primitive_impl_t {
                     && stat_md()->data_type == f32
                     && IMPLICATION(
                             use_scaleshift(), weights_md()->data_type == f32)
+                    && IMPLICATION(has_runtime_dims_or_strides(),
+                            memory_desc_wrapper(src_md()).is_plain())
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
@@ -61,12 +63,11 @@ struct ref_layer_normalization_fwd_t : public primitive_impl_t {
     typedef typename prec_traits<d_type>::type data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_forward(ctx);
-        return status::success;
+        return execute_forward(ctx);
     }
 
 private:
-    void execute_forward(const exec_ctx_t &ctx) const;
+    status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
 };
 
@@ -40,7 +40,7 @@ struct ref_pooling_fwd_t : public primitive_impl_t {
         status_t init() {
             bool ok = true
                     && IMPLICATION(
-                            data_type == data_type::bf16, mayiuse(avx512_core))
+                            data_type == data_type::bf16, mayiuse(avx2))
                     && set_default_params() == status::success && is_fwd()
                     && utils::everyone_is(
                             data_type, src_md()->data_type, dst_md()->data_type)
@@ -81,7 +81,7 @@ struct ref_pooling_bwd_t : public primitive_impl_t {
         status_t init() {
             bool ok = true
                     && IMPLICATION(
-                            data_type == data_type::bf16, mayiuse(avx512_core))
+                            data_type == data_type::bf16, mayiuse(avx2))
                     && set_default_params() == status::success && !is_fwd()
                     && utils::everyone_is(data_type, diff_dst_md()->data_type,
                             diff_src_md()->data_type)
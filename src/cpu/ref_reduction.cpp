@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "memory.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+
+#include "ref_reduction.hpp"
+#include "simple_q10n.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace alg_kind;
+
+ref_reduction_scalar_t::ref_reduction_scalar_t(
+        alg_kind_t alg, float p, float eps)
+    : alg_(alg), p_(p), eps_(eps) {
+    assert(utils::one_of(alg_, reduction_max, reduction_min, reduction_sum,
+            reduction_mul, reduction_mean, reduction_norm_lp_max,
+            reduction_norm_lp_sum, reduction_norm_lp_power_p_max,
+            reduction_norm_lp_power_p_sum));
+}
+
+ref_reduction_scalar_t::ref_reduction_scalar_t(const reduction_desc_t &rd)
+    : ref_reduction_scalar_t(rd.alg_kind, rd.p, rd.eps) {}
+
+float ref_reduction_scalar_t::init() const {
+    switch (alg_) {
+        case reduction_max: return nstl::numeric_limits<float>::lowest();
+        case reduction_min: return nstl::numeric_limits<float>::max();
+        case reduction_mul: return 1.f;
+        default: return 0.f;
+    }
+}
+
+float ref_reduction_scalar_t::accumulate(float acc, float x) const {
+    switch (alg_) {
+        case reduction_max: return nstl::max(acc, x);
+        case reduction_min: return nstl::min(acc, x);
+        case reduction_mul: return acc * x;
+        case reduction_sum:
+        case reduction_mean: return acc + x;
+        default: return acc + powf(fabsf(x), p_);
+    }
+}
+
+float ref_reduction_scalar_t::combine(float acc0, float acc1) const {
+    switch (alg_) {
+        case reduction_max: return nstl::max(acc0, acc1);
+        case reduction_min: return nstl::min(acc0, acc1);
+        case reduction_mul: return acc0 * acc1;
+        default: return acc0 + acc1;
+    }
+}
+
+float ref_reduction_scalar_t::finalize(float acc, dim_t R) const {
+    switch (alg_) {
+        case reduction_mean: return acc / R;
+        case reduction_norm_lp_max: return powf(nstl::max(acc, eps_), 1.f / p_);
+        case reduction_norm_lp_sum: return powf(acc + eps_, 1.f / p_);
+        case reduction_norm_lp_power_p_max: return nstl::max(acc, eps_);
+        case reduction_norm_lp_power_p_sum: return acc + eps_;
+        default: return acc;
+    }
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+status_t ref_reduction_t<src_type, dst_type>::execute_ref(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const int ndims = pd()->ndims();
+    const dim_t dst_nelems = dst_d.nelems();
+
+    // The number of the points reduced to a point of dst
+    dim_t R = 1;
+    for (int d = 0; d < ndims; ++d)
+        if (pd()->is_reduced(d)) R *= src_d.dims()[d];
+
+    parallel_nd(dst_nelems, [&](dim_t i) {
+        dims_t pos;
+        dim_t l = i;
+        for (int d = ndims - 1; d >= 0; --d) {
+            pos[d] = l % dst_d.dims()[d];
+            l /= dst_d.dims()[d];
+        }
+        const dim_t dst_off = dst_d.off_v(pos);
+
+        float acc = reduction_.init();
+        for (dim_t r = 0; r < R; ++r) {
+            dim_t lr = r;
+            for (int d = ndims - 1; d >= 0; --d) {
+                if (!pd()->is_reduced(d)) continue;
+                pos[d] = lr % src_d.dims()[d];
+                lr /= src_d.dims()[d];
+            }
+            acc = reduction_.accumulate(acc, (float)src[src_d.off_v(pos)]);
+        }
+
+        dst[dst_off] = qz_a1b0<float, dst_data_t>()(
+                reduction_.finalize(acc, R));
+    });
+
+    if (dst_d.nelems(true) != dst_nelems) ctx.memory(DNNL_ARG_DST)->zero_pad();
+
+    return status::success;
+}
+
+using namespace data_type;
+
+template struct ref_reduction_t<f32, f32>;
+template struct ref_reduction_t<bf16, bf16>;
+template struct ref_reduction_t<bf16, f32>;
+template struct ref_reduction_t<s8, s8>;
+template struct ref_reduction_t<s8, f32>;
+template struct ref_reduction_t<u8, u8>;
+template struct ref_reduction_t<u8, f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
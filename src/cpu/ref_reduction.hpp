@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_REDUCTION_HPP
+#define CPU_REF_REDUCTION_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_reduction_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* The reduction of the values x_1, ..., x_R is computed in f32 as
+ * finalize(combine(..., combine(init, x_1), ..., x_R)), where combine is the
+ * accumulation of the algorithm (e.g. acc + |x|^p for the norms) */
+struct ref_reduction_scalar_t {
+public:
+    ref_reduction_scalar_t(alg_kind_t alg, float p, float eps);
+    ref_reduction_scalar_t(const reduction_desc_t &rd);
+
+    float init() const;
+    float accumulate(float acc, float x) const;
+    /** merges two partial accumulations */
+    float combine(float acc0, float acc1) const;
+    /** returns the result for the accumulation of @p R values */
+    float finalize(float acc, dim_t R) const;
+
+    const alg_kind_t alg_;
+    const float p_, eps_;
+};
+
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+struct ref_reduction_t : public primitive_impl_t {
+    struct pd_t : public cpu_reduction_pd_t {
+        using cpu_reduction_pd_t::cpu_reduction_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_reduction_t);
+
+        status_t init() {
+            bool ok = true && src_md()->data_type == src_type
+                    && dst_md()->data_type == dst_type
+                    && attr()->has_default_values()
+                    && set_default_params() == status::success;
+            return ok ? status::success : status::unimplemented;
+        }
+    };
+
+    ref_reduction_t(const pd_t *apd)
+        : primitive_impl_t(apd), reduction_(*apd->desc()) {}
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_ref(ctx);
+    }
+
+private:
+    status_t execute_ref(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    ref_reduction_scalar_t reduction_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,203 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <math.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "memory.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+
+#include "ref_resampling.hpp"
+#include "simple_q10n.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace alg_kind;
+
+void resampling_taps_t::init(alg_kind_t alg, dim_t I, dim_t O, bool is_fwd) {
+    // The forward taps: the point o of dst is mapped to the point
+    // (o + 0.5) * I / O - 0.5 of src
+    std::vector<dim_t> fwd_beg(O + 1), fwd_idx;
+    std::vector<float> fwd_wei;
+    for (dim_t o = 0; o < O; ++o) {
+        fwd_beg[o] = (dim_t)fwd_idx.size();
+        if (alg == resampling_nearest) {
+            const dim_t i = (dim_t)((o + 0.5f) * I / O);
+            fwd_idx.push_back(nstl::min(i, I - 1));
+            fwd_wei.push_back(1.f);
+            continue;
+        }
+
+        const float s = (o + 0.5f) * I / O - 0.5f;
+        const dim_t i0 = (dim_t)floorf(s);
+        const float w1 = s - i0;
+        const dim_t il = nstl::max((dim_t)0, nstl::min(i0, I - 1));
+        const dim_t ir = nstl::max((dim_t)0, nstl::min(i0 + 1, I - 1));
+        if (il == ir || w1 == 0.f) {
+            fwd_idx.push_back(il);
+            fwd_wei.push_back(1.f);
+        } else {
+            fwd_idx.push_back(il);
+            fwd_wei.push_back(1.f - w1);
+            fwd_idx.push_back(ir);
+            fwd_wei.push_back(w1);
+        }
+    }
+    fwd_beg[O] = (dim_t)fwd_idx.size();
+
+    if (is_fwd) {
+        beg_.swap(fwd_beg);
+        idx_.swap(fwd_idx);
+        wei_.swap(fwd_wei);
+        return;
+    }
+
+    // The backward taps: the point i of diff_src gathers the points o of
+    // diff_dst that have i as a tap
+    beg_.assign(I + 1, 0);
+    for (size_t k = 0; k < fwd_idx.size(); ++k)
+        beg_[fwd_idx[k] + 1]++;
+    for (dim_t i = 0; i < I; ++i)
+        beg_[i + 1] += beg_[i];
+
+    std::vector<dim_t> pos(beg_.begin(), beg_.end() - 1);
+    idx_.resize(fwd_idx.size());
+    wei_.resize(fwd_idx.size());
+    for (dim_t o = 0; o < O; ++o)
+        for (dim_t k = fwd_beg[o]; k < fwd_beg[o + 1]; ++k) {
+            const dim_t t = pos[fwd_idx[k]]++;
+            idx_[t] = o;
+            wei_[t] = fwd_wei[k];
+        }
+}
+
+dim_t resampling_taps_t::max_ntaps() const {
+    dim_t ntaps = 0;
+    for (size_t p = 0; p + 1 < beg_.size(); ++p)
+        ntaps = nstl::max(ntaps, beg_[p + 1] - beg_[p]);
+    return ntaps;
+}
+
+namespace {
+
+dim_t get_offset(const memory_desc_wrapper &data_d, dim_t n, dim_t c,
+        dim_t d, dim_t h, dim_t w) {
+    switch (data_d.ndims()) {
+        case 5: return data_d.off(n, c, d, h, w);
+        case 4: return data_d.off(n, c, h, w);
+        default: return data_d.off(n, c, w);
+    }
+}
+
+/* Computes the output points of the dimensions OD x OH x OW from the input
+ * along the taps */
+template <typename data_t>
+void resample(const data_t *in, const memory_desc_wrapper &in_d, data_t *out,
+        const memory_desc_wrapper &out_d, dim_t MB, dim_t C, dim_t OD,
+        dim_t OH, dim_t OW, const resampling_taps_t &taps_d,
+        const resampling_taps_t &taps_h, const resampling_taps_t &taps_w) {
+    parallel_nd(MB, C, OD, OH, OW,
+            [&](dim_t n, dim_t c, dim_t od, dim_t oh, dim_t ow) {
+                float acc = 0.f;
+                for (dim_t kd = taps_d.beg_[od]; kd < taps_d.beg_[od + 1];
+                        ++kd)
+                    for (dim_t kh = taps_h.beg_[oh]; kh < taps_h.beg_[oh + 1];
+                            ++kh) {
+                        const float wdh = taps_d.wei_[kd] * taps_h.wei_[kh];
+                        for (dim_t kw = taps_w.beg_[ow];
+                                kw < taps_w.beg_[ow + 1]; ++kw) {
+                            const dim_t in_off = get_offset(in_d, n, c,
+                                    taps_d.idx_[kd], taps_h.idx_[kh],
+                                    taps_w.idx_[kw]);
+                            acc += wdh * taps_w.wei_[kw] * (float)in[in_off];
+                        }
+                    }
+                out[get_offset(out_d, n, c, od, oh, ow)]
+                        = qz_a1b0<float, data_t>()(acc);
+            });
+}
+
+} // namespace
+
+template <data_type_t data_type>
+ref_resampling_fwd_t<data_type>::ref_resampling_fwd_t(const pd_t *apd)
+    : primitive_impl_t(apd) {
+    const auto alg = pd()->desc()->alg_kind;
+    taps_d_.init(alg, pd()->ID(), pd()->OD(), true);
+    taps_h_.init(alg, pd()->IH(), pd()->OH(), true);
+    taps_w_.init(alg, pd()->IW(), pd()->OW(), true);
+}
+
+template <data_type_t data_type>
+void ref_resampling_fwd_t<data_type>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    resample(src, src_d, dst, dst_d, pd()->MB(), pd()->C(), pd()->OD(),
+            pd()->OH(), pd()->OW(), taps_d_, taps_h_, taps_w_);
+
+    if (dst_d.nelems(true) != dst_d.nelems())
+        ctx.memory(DNNL_ARG_DST)->zero_pad();
+}
+
+template <data_type_t data_type>
+ref_resampling_bwd_t<data_type>::ref_resampling_bwd_t(const pd_t *apd)
+    : primitive_impl_t(apd) {
+    const auto alg = pd()->desc()->alg_kind;
+    taps_d_.init(alg, pd()->ID(), pd()->OD(), false);
+    taps_h_.init(alg, pd()->IH(), pd()->OH(), false);
+    taps_w_.init(alg, pd()->IW(), pd()->OW(), false);
+}
+
+template <data_type_t data_type>
+void ref_resampling_bwd_t<data_type>::execute_backward(
+        const exec_ctx_t &ctx) const {
+    auto diff_dst = CTX_IN_MEM(const data_t *, DNNL_ARG_DIFF_DST);
+    auto diff_src = CTX_OUT_MEM(data_t *, DNNL_ARG_DIFF_SRC);
+
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+
+    resample(diff_dst, diff_dst_d, diff_src, diff_src_d, pd()->MB(),
+            pd()->C(), pd()->ID(), pd()->IH(), pd()->IW(), taps_d_, taps_h_,
+            taps_w_);
+
+    if (diff_src_d.nelems(true) != diff_src_d.nelems())
+        ctx.memory(DNNL_ARG_DIFF_SRC)->zero_pad();
+}
+
+using namespace data_type;
+
+template struct ref_resampling_fwd_t<f32>;
+template struct ref_resampling_fwd_t<bf16>;
+template struct ref_resampling_bwd_t<f32>;
+template struct ref_resampling_bwd_t<bf16>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_REF_RESAMPLING_HPP
+#define CPU_REF_RESAMPLING_HPP
+
+#include <assert.h>
+#include <vector>
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_resampling_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* The taps of a resampled dimension: the point p of the output (dst for the
+ * forward, diff_src for the backward) is the sum of the points idx_[k] of the
+ * input (src, diff_dst) weighted by wei_[k] for beg_[p] <= k < beg_[p + 1].
+ * The taps of the backward are the transposed ones of the forward. */
+struct resampling_taps_t {
+    /** initializes the taps of the dimension of @p I points of src and
+     * @p O points of dst */
+    void init(alg_kind_t alg, dim_t I, dim_t O, bool is_fwd);
+
+    dim_t max_ntaps() const;
+
+    std::vector<dim_t> beg_, idx_;
+    std::vector<float> wei_;
+};
+
+template <impl::data_type_t data_type>
+struct ref_resampling_fwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_fwd_pd_t {
+        using cpu_resampling_fwd_pd_t::cpu_resampling_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_resampling_fwd_t);
+
+        status_t init() {
+            bool ok = true && is_fwd()
+                    && utils::everyone_is(data_type, src_md()->data_type,
+                            dst_md()->data_type)
+                    && attr()->has_default_values()
+                    && set_default_params() == status::success;
+            return ok ? status::success : status::unimplemented;
+        }
+    };
+
+    ref_resampling_fwd_t(const pd_t *apd);
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_forward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_forward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    resampling_taps_t taps_d_, taps_h_, taps_w_;
+};
+
+template <impl::data_type_t data_type>
+struct ref_resampling_bwd_t : public primitive_impl_t {
+    struct pd_t : public cpu_resampling_bwd_pd_t {
+        using cpu_resampling_bwd_pd_t::cpu_resampling_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_resampling_bwd_t);
+
+        status_t init() {
+            bool ok = true && !is_fwd()
+                    && utils::everyone_is(data_type, diff_src_md()->data_type,
+                            diff_dst_md()->data_type)
+                    && attr()->has_default_values()
+                    && set_default_params() == status::success;
+            return ok ? status::success : status::unimplemented;
+        }
+    };
+
+    ref_resampling_bwd_t(const pd_t *apd);
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override {
+        execute_backward(ctx);
+        return status::success;
+    }
+
+private:
+    void execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+
+    resampling_taps_t taps_d_, taps_h_, taps_w_;
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -29,14 +29,30 @@ namespace impl {
 namespace cpu {
 
 template <impl::data_type_t data_type>
-void ref_softmax_fwd_t<data_type>::execute_forward_dense(
+status_t ref_softmax_fwd_t<data_type>::execute_forward_dense(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
+    const auto data_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
     const auto ou_stride = pd()->outer_stride();
+    dim_t outer_size = outer_size_;
 
-    parallel_nd(outer_size_, [&](int ou) {
+    if (pd()->has_runtime_dims_or_strides()) {
+        const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+        const bool ok = true
+                && memory_desc_wrapper(pd()->src_md()).matches_runtime_md(
+                        data_d)
+                && data_d.is_dense() && dst_d == data_d;
+        if (!ok) return status::invalid_arguments;
+
+        outer_size = utils::array_product(data_d.dims(), pd()->axis());
+    }
+
+    src += data_d.offset0();
+    dst += data_d.offset0();
+
+    parallel_nd(outer_size, [&](dim_t ou) {
         const data_t *src_data = src + ou * ou_stride;
         data_t *dst_data = dst + ou * ou_stride;
         data_t scalar = 0;
@@ -47,6 +63,8 @@ void ref_softmax_fwd_t<data_type>::execute_forward_dense(
         _sum(channels_, dst_data, &scalar);
         _scal(channels_, data_t(1) / scalar, dst_data);
     });
+
+    return status::success;
 }
 
 template <impl::data_type_t data_type>
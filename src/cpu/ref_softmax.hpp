@@ -39,6 +39,8 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
 
         status_t init() {
             bool ok = true && is_fwd() && src_md()->data_type == data_type
+                    && IMPLICATION(has_runtime_dims_or_strides(),
+                            runtime_dims_supported())
                     && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
@@ -50,9 +52,9 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
     private:
         void init_scratchpad() {
             const dim_t in_s = inner_size();
-            const dim_t ou_s = outer_size();
 
             if (in_s > 1) {
+                const dim_t ou_s = outer_size();
                 auto scratchpad = scratchpad_registry().registrar();
                 scratchpad.book(memory_tracking::names::key_softmax_reduction,
                         sizeof(data_t) * 2 * in_s * ou_s);
@@ -61,7 +63,8 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
     };
 
     ref_softmax_fwd_t(const pd_t *apd) : primitive_impl_t(apd) {
-        outer_size_ = pd()->outer_size();
+        outer_size_ = pd()->has_runtime_dims_or_strides() ? 0
+                                                          : pd()->outer_size();
         channels_ = pd()->axis_size();
         inner_size_ = pd()->inner_size();
 
@@ -77,20 +80,21 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
         use_dense_ = true && inner_size_ == 1 && data_d.is_dense(true)
                 && data_d.only_padded_dim(axis)
                 && bd.strides[axis] == axis_blk_size;
+        // the outer size is taken from the memory at execution
+        if (pd()->has_runtime_dims_or_strides()) use_dense_ = true;
     }
 
     typedef typename prec_traits<data_type>::type data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        if (use_dense_)
-            execute_forward_dense(ctx);
-        else
-            execute_forward_generic(ctx);
+        if (use_dense_) return execute_forward_dense(ctx);
+
+        execute_forward_generic(ctx);
         return status::success;
     }
 
 private:
-    void execute_forward_dense(const exec_ctx_t &ctx) const;
+    status_t execute_forward_dense(const exec_ctx_t &ctx) const;
     void execute_forward_generic(const exec_ctx_t &ctx) const;
 
     void _max(int n, const data_t *x, data_t *max_data) const;
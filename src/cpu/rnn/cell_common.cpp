@@ -17,11 +17,15 @@
 /*
  * Common for RNN and LSTM cell execution
  */
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+
 #include "ref_rnn.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
+using namespace dnnl::impl::math;
 using namespace rnn_utils;
 
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type>
@@ -44,6 +48,59 @@ rnn_cell_execution_sig(
 template rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution);
 template rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution);
 
+/* Fused LSTM cell for small batches: each thread computes the four gates
+ * for its dic block and updates the states right away */
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution_small_batch) {
+    ws_gates_aoc_t ws_gates(rnn, ws_gates_);
+    bias_aoc_t bias(rnn, bias_[0]);
+    ws_states_aoc_t states_t_l(rnn, states_t_l_);
+    ws_states_aoc_t c_states_t_l(rnn, c_states_t_l_);
+    ws_states_aoc_t c_states_tm1_l(rnn, c_states_tm1_l_);
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        int dic_s {0}, dic_e {0};
+        small_batch_dic_range(rnn, ithr, nthr, dic_s, dic_e);
+        if (dic_s >= dic_e) return;
+
+        // the gemms run on a single thread inside the parallel region
+        for (int g = 0; g < rnn.n_gates; g++) {
+            const int off = g * rnn.dic + dic_s;
+            if (!rnn.merge_gemm_layer)
+                (this->*gemm_layer_func)('N', 'N', dic_e - dic_s, rnn.mb,
+                        rnn.slc, 1.0, w_layer_[0] + off, rnn.weights_layer_ld,
+                        states_t_lm1_, rnn.states_ws_ld, 0.0, ws_gates_ + off,
+                        rnn.gates_ws_ld);
+            (this->*gemm_iter_func)('N', 'N', dic_e - dic_s, rnn.mb, rnn.sic,
+                    1.0, w_iter_[0] + off, rnn.weights_iter_ld, states_tm1_l_,
+                    rnn.states_ws_ld, 1.0, ws_gates_ + off, rnn.gates_ws_ld);
+        }
+
+        for (int i = 0; i < rnn.mb; i++) {
+            PRAGMA_OMP_SIMD()
+            for (int j = dic_s; j < dic_e; j++) {
+                float G0 = logistic_fwd<float>(ws_gates(i, 0, j) + bias(0, j));
+                float G1 = logistic_fwd<float>(ws_gates(i, 1, j) + bias(1, j));
+                float G2 = tanh_fwd<float>(ws_gates(i, 2, j) + bias(2, j));
+                float G3 = logistic_fwd<float>(ws_gates(i, 3, j) + bias(3, j));
+                float tmp = G1 * c_states_tm1_l(i, j) + G0 * G2;
+                states_t_l(i, j) = G3 * tanh_fwd<float>(tmp);
+                c_states_t_l(i, j) = tmp;
+            }
+        }
+    });
+}
+
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_small_batch) {
+    assert(!"fused cell is not supported for int8");
+}
+
+template <>
+rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_small_batch) {
+    assert(!"fused cell is not supported on backward");
+}
+
 template <>
 rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution) {
     ws_diff_states_aoc_t diff_states_t_l(rnn, diff_states_t_l_);
@@ -74,6 +74,80 @@ rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru) {
     assert(!"GRU int8 is not supported");
 }
 
+/* Fused GRU cell for small batches. The gemm on r * h_{t-1} needs all of
+ * its dic, so the cell runs in two parallel regions, and r * h_{t-1} is kept
+ * in place of the r gate so that the second region does not overwrite it
+ * while other threads read it. */
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution_gru_small_batch) {
+    ws_gates_aoc_t ws_gates(rnn, ws_gates_);
+    bias_aoc_t bias(rnn, bias_[0]);
+    ws_states_aoc_t states_t_l(rnn, states_t_l_);
+    ws_states_aoc_t states_tm1_l(rnn, states_tm1_l_);
+
+    // 1. gemms Wx[0-2],x and Wh[0-1],h, activations of zt and rt
+    parallel(0, [&](const int ithr, const int nthr) {
+        int dic_s {0}, dic_e {0};
+        small_batch_dic_range(rnn, ithr, nthr, dic_s, dic_e);
+        if (dic_s >= dic_e) return;
+
+        for (int g = 0; g < rnn.n_gates; g++) {
+            const int off = g * rnn.dic + dic_s;
+            if (!rnn.merge_gemm_layer)
+                (this->*gemm_layer_func)('N', 'N', dic_e - dic_s, rnn.mb,
+                        rnn.slc, 1.0, w_layer_[0] + off, rnn.weights_layer_ld,
+                        states_t_lm1_, rnn.states_ws_ld, 0.0, ws_gates_ + off,
+                        rnn.gates_ws_ld);
+            if (g < rnn.n_gates - 1)
+                (this->*gemm_iter_func)('N', 'N', dic_e - dic_s, rnn.mb,
+                        rnn.sic, 1.0, w_iter_[0] + off, rnn.weights_iter_ld,
+                        states_tm1_l_, rnn.states_ws_ld, 1.0, ws_gates_ + off,
+                        rnn.gates_ws_ld);
+        }
+
+        for (int i = 0; i < rnn.mb; i++) {
+            PRAGMA_OMP_SIMD()
+            for (int j = dic_s; j < dic_e; j++) {
+                ws_gates(i, 0, j)
+                        = logistic_fwd<float>(ws_gates(i, 0, j) + bias(0, j));
+                float G1 = logistic_fwd<float>(ws_gates(i, 1, j) + bias(1, j));
+                ws_gates(i, 1, j) = states_tm1_l(i, j) * G1;
+            }
+        }
+    });
+
+    // 2. gemm Wh[2],(r * h_{t-1}), activation of h~t and ht
+    parallel(0, [&](const int ithr, const int nthr) {
+        int dic_s {0}, dic_e {0};
+        small_batch_dic_range(rnn, ithr, nthr, dic_s, dic_e);
+        if (dic_s >= dic_e) return;
+
+        (this->*gemm_iter_func)('N', 'N', dic_e - dic_s, rnn.mb, rnn.sic, 1.0,
+                w_iter_[1] + dic_s, rnn.weights_iter_ld, &(ws_gates(0, 1, 0)),
+                rnn.gates_ws_ld, 1.0, &(ws_gates(0, 2, dic_s)),
+                rnn.gates_ws_ld);
+
+        for (int i = 0; i < rnn.mb; i++) {
+            PRAGMA_OMP_SIMD()
+            for (int j = dic_s; j < dic_e; j++) {
+                float G0 = ws_gates(i, 0, j);
+                float G2 = tanh_fwd<float>(ws_gates(i, 2, j) + bias(2, j));
+                states_t_l(i, j) = states_tm1_l(i, j) * G0 + (1.0f - G0) * G2;
+            }
+        }
+    });
+}
+
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru_small_batch) {
+    assert(!"GRU int8 is not supported");
+}
+
+template <>
+rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_gru_small_batch) {
+    assert(!"fused cell is not supported on backward");
+}
+
 template <>
 rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_gru) {
     ws_gates_aoc_t ws_gates(rnn, ws_gates_);
@@ -125,6 +125,10 @@ rnn_grid_execution_sig(
     AOC<float, 4> ws_grid(
             ws_grid_, rnn.n_layer, rnn.n_dir, rnn.n_iter, (int)rnn.ws_per_cell);
 
+    // with sequence lengths the cells only compute the samples whose
+    // sequences have not ended yet
+    rnn_conf_t iter_rnn = rnn;
+
     // We run the grid of computation
     for (int dir = 0; dir < rnn.n_dir; dir++) {
         for (int j = 0; j < rnn.n_layer; j++) {
@@ -141,7 +145,12 @@ rnn_grid_execution_sig(
             for (int i = 0; i < rnn.n_iter; i++) {
                 int iter = (aprop == prop_kind::forward) ? i
                                                          : rnn.n_iter - i - 1;
-                (this->*cell_func)(rnn, &(ws_states(lay + 1, dir, iter + 1, 0)),
+                if (active_mb_ != nullptr) {
+                    iter_rnn.mb = active_mb_[iter];
+                    if (iter_rnn.mb == 0) break;
+                }
+                (this->*cell_func)(iter_rnn,
+                        &(ws_states(lay + 1, dir, iter + 1, 0)),
                         &(ws_c_states(lay + 1, dir, iter + 1, 0)),
                         &(ws_diff_states(lay, dir, 0, iter, 0)),
                         &(weights_input(lay, dir, 0)),
@@ -196,11 +205,12 @@ template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type>
 void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_init_layer(
         const rnn_conf_t &rnn, src_data_t *__restrict ws_states_,
         float *__restrict ws_diff_states_, const src_data_t *__restrict xt_,
-        const float *__restrict diff_dst_layer_) const {
+        const float *__restrict diff_dst_layer_,
+        const memory_desc_wrapper &xt_d,
+        const memory_desc_wrapper &diff_dst_layer_d) const {
 
     AOC<src_data_t, 4> ws_states(
             ws_states_, rnn.n_dir, rnn.n_iter + 1, rnn.mb, rnn.states_ws_ld);
-    auto xt_d = memory_desc_wrapper(pd()->src_md(0));
 
     parallel_nd(rnn.n_iter, rnn.mb, [&](int it, int b) {
         auto xxt = xt_ + xt_d.blk_off(it, b);
@@ -219,10 +229,10 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_init_layer(
 template <>
 void ref_rnn_bwd_f32_t::copy_init_layer(const rnn_conf_t &rnn,
         src_data_t *ws_states_, float *ws_diff_states_, const src_data_t *xt_,
-        const float *diff_dst_layer_) const {
+        const float *diff_dst_layer_, const memory_desc_wrapper &xt_d,
+        const memory_desc_wrapper &diff_dst_layer_d) const {
     AOC<float, 6> ws_diff_states(ws_diff_states_, rnn.n_layer + 1, rnn.n_dir,
             (rnn.n_states + 1), rnn.n_iter + 1, rnn.mb, rnn.states_ws_ld);
-    auto diff_dst_layer_d = memory_desc_wrapper(pd()->diff_dst_md(0));
 
     switch (rnn.exec_dir) {
         case bi_concat:
@@ -288,7 +298,11 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_init_iter(
         const input_data_t *__restrict firstit_states_,
         const float *__restrict firstit_c_states_,
         const float *__restrict diff_dst_iter_,
-        const float *__restrict diff_dst_iter_c_) const {
+        const float *__restrict diff_dst_iter_c_,
+        const memory_desc_wrapper &firstit_states_d,
+        const memory_desc_wrapper &firstit_c_states_d,
+        const memory_desc_wrapper &diff_dst_iter_d,
+        const memory_desc_wrapper &diff_dst_iter_c_d) const {
     AOC<src_data_t, 5> ws_states(ws_states_, rnn.n_layer + 1, rnn.n_dir,
             rnn.n_iter + 1, rnn.mb, rnn.states_ws_ld);
     AOC<float, 5> ws_c_states(ws_c_states_, rnn.n_layer + 1, rnn.n_dir,
@@ -307,8 +321,6 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_init_iter(
             return (src_data_t)f;
     };
 
-    auto firstit_states_d = memory_desc_wrapper(pd()->src_md(1));
-    auto firstit_c_states_d = memory_desc_wrapper(pd()->src_md(2));
     if (firstit_states_) {
         parallel_nd(
                 rnn.n_layer, rnn.n_dir, rnn.mb, [&](int lay, int dir, int b) {
@@ -345,11 +357,13 @@ template <typename input_data_t>
 void ref_rnn_bwd_f32_t::copy_init_iter(const rnn_conf_t &rnn,
         src_data_t *ws_states_, float *ws_c_states_, float *ws_diff_states_,
         const input_data_t *firstit_states_, const float *firstit_states_c_,
-        const float *diff_dst_iter_, const float *diff_dst_iter_c_) const {
+        const float *diff_dst_iter_, const float *diff_dst_iter_c_,
+        const memory_desc_wrapper &firstit_states_d,
+        const memory_desc_wrapper &firstit_c_states_d,
+        const memory_desc_wrapper &diff_dst_iter_d,
+        const memory_desc_wrapper &diff_dst_iter_c_d) const {
     AOC<float, 6> ws_diff_states(ws_diff_states_, rnn.n_layer + 1, rnn.n_dir,
             rnn.n_states + 1, rnn.n_iter + 1, rnn.mb, rnn.states_ws_ld);
-    auto diff_dst_iter_d = memory_desc_wrapper(pd()->diff_dst_md(1));
-    auto diff_dst_iter_c_d = memory_desc_wrapper(pd()->diff_dst_md(2));
     if (diff_dst_iter_) {
         parallel_nd(
                 rnn.n_layer, rnn.n_dir, rnn.mb, [&](int lay, int dir, int b) {
@@ -379,9 +393,10 @@ template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type>
 template <typename dst_data_t>
 void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_res_layer(
         const rnn_conf_t &rnn, dst_data_t *dst_layer_, float *diff_src_layer,
-        const src_data_t *ws_states_, const float *ws_diff_states_) const {
+        const src_data_t *ws_states_, const float *ws_diff_states_,
+        const int32_t *seq_lengths_, const memory_desc_wrapper &dst_layer_d,
+        const memory_desc_wrapper &diff_src_layer_d) const {
 
-    auto dst_layer_d = memory_desc_wrapper(pd()->dst_md(0));
     AOC<const src_data_t, 5> ws_states(ws_states_, rnn.n_layer + 1, rnn.n_dir,
             rnn.n_iter + 1, rnn.mb, rnn.states_ws_ld);
     float shift = (pd()->attr()->rnn_data_qparams_.shift_);
@@ -399,6 +414,15 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_res_layer(
     parallel_nd(rnn.n_iter, rnn.mb, [&](int it, int b) {
         int dir = 0;
 
+        // the iterations past the end of the sequence are zeroed
+        if (seq_lengths_ != nullptr && it >= seq_lengths_[b]) {
+            auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, 0)];
+            PRAGMA_OMP_SIMD()
+            for (int s = 0; s < rnn.dlc; s++)
+                dd[s] = 0;
+            return;
+        }
+
         if (rnn.exec_dir != r2l) {
             const auto *ss = &ws_states(rnn.n_layer, dir, it + 1, b, 0);
             auto *dd = &dst_layer_[dst_layer_d.blk_off(it, b, dir * rnn.dic)];
@@ -433,8 +457,9 @@ template <>
 template <typename dst_data_t>
 void ref_rnn_bwd_f32_t::copy_res_layer(const rnn_conf_t &rnn,
         dst_data_t *dst_layer_, float *diff_src_layer_,
-        const src_data_t *ws_states_, const float *ws_diff_states_) const {
-    auto diff_src_layer_d = memory_desc_wrapper(pd()->diff_src_md(0));
+        const src_data_t *ws_states_, const float *ws_diff_states_,
+        const int32_t *seq_lengths_, const memory_desc_wrapper &dst_layer_d,
+        const memory_desc_wrapper &diff_src_layer_d) const {
     AOC<const float, 6> ws_diff_states(ws_diff_states_, rnn.n_layer + 1,
             rnn.n_dir, rnn.n_states + 1, rnn.n_iter + 1, rnn.mb,
             rnn.states_ws_ld);
@@ -461,11 +486,13 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_res_iter(
         const rnn_conf_t &rnn, output_data_t *dst_iter_, float *dst_iter_c_,
         float *diff_src_iter_, float *diff_src_iter_c_,
         const src_data_t *ws_states_, float *ws_c_states_,
-        const float *ws_diff_states_) const {
+        const float *ws_diff_states_, const int32_t *seq_lengths_,
+        const memory_desc_wrapper &dst_iter_d,
+        const memory_desc_wrapper &dst_iter_c_d,
+        const memory_desc_wrapper &diff_src_iter_d,
+        const memory_desc_wrapper &diff_src_iter_c_d) const {
     if (dst_iter_ == nullptr) return;
 
-    auto dst_iter_d = memory_desc_wrapper(pd()->dst_md(1));
-    auto dst_iter_c_d = memory_desc_wrapper(pd()->dst_md(2));
 
     AOC<const src_data_t, 5> ws_states(ws_states_, rnn.n_layer + 1, rnn.n_dir,
             rnn.n_iter + 1, rnn.mb, rnn.states_ws_ld);
@@ -486,14 +513,16 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::copy_res_iter(
     };
 
     parallel_nd(rnn.n_layer, rnn.n_dir, rnn.mb, [&](int lay, int dir, int b) {
-        const auto *ss = &ws_states(lay + 1, dir, rnn.n_iter, b, 0);
+        // the last valid iteration of the sample
+        const int it = seq_lengths_ ? seq_lengths_[b] : rnn.n_iter;
+        const auto *ss = &ws_states(lay + 1, dir, it, b, 0);
         auto *dd = &dst_iter_[dst_iter_d.blk_off(lay, dir, b, 0)];
         PRAGMA_OMP_SIMD()
         for (int s = 0; s < rnn.dic; s++)
             dd[s] = maybe_deq(ss[s]);
 
         if (pd()->cell_kind() == alg_kind::vanilla_lstm) {
-            const auto *ss = &ws_c_states(lay + 1, dir, rnn.n_iter, b, 0);
+            const auto *ss = &ws_c_states(lay + 1, dir, it, b, 0);
             auto *dd = &dst_iter_c_[dst_iter_c_d.blk_off(lay, dir, b, 0)];
             PRAGMA_OMP_SIMD()
             for (int s = 0; s < rnn.dic; s++)
@@ -507,9 +536,11 @@ template <typename output_data_t>
 void ref_rnn_bwd_f32_t::copy_res_iter(const rnn_conf_t &rnn,
         output_data_t *dst_iter_, float *dst_iter_c_, float *diff_src_iter_,
         float *diff_src_iter_c_, const src_data_t *ws_states_,
-        float *ws_c_states_, const float *ws_diff_states_) const {
-    auto diff_src_iter_d = memory_desc_wrapper(pd()->diff_src_md(1));
-    auto diff_src_iter_c_d = memory_desc_wrapper(pd()->diff_src_md(2));
+        float *ws_c_states_, const float *ws_diff_states_,
+        const int32_t *seq_lengths_, const memory_desc_wrapper &dst_iter_d,
+        const memory_desc_wrapper &dst_iter_c_d,
+        const memory_desc_wrapper &diff_src_iter_d,
+        const memory_desc_wrapper &diff_src_iter_c_d) const {
     AOC<const float, 6> ws_diff_states(ws_diff_states_, rnn.n_layer + 1,
             rnn.n_dir, rnn.n_states + 1, rnn.n_iter + 1, rnn.mb,
             rnn.states_ws_ld);
@@ -619,9 +650,91 @@ rnn_weights_assign_sig(
 
 //********************* Execution function *********************//
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type>
-void _ref_rnn_common_t<aprop, src_type, weights_type>::execute_(
+status_t _ref_rnn_common_t<aprop, src_type, weights_type>::execute_(
         const exec_ctx_t &ctx) const {
-    const rnn_conf_t &rnn = this->pd()->rnn_;
+    const auto src_layer_d
+            = ctx.memory_mdw(DNNL_ARG_SRC_LAYER, pd()->src_md(0));
+    const auto src_iter_d = ctx.memory_mdw(DNNL_ARG_SRC_ITER, pd()->src_md(1));
+    const auto src_iter_c_d
+            = ctx.memory_mdw(DNNL_ARG_SRC_ITER_C, pd()->src_md(2));
+    const auto dst_layer_d
+            = ctx.memory_mdw(DNNL_ARG_DST_LAYER, pd()->dst_md(0));
+    const auto dst_iter_d = ctx.memory_mdw(DNNL_ARG_DST_ITER, pd()->dst_md(1));
+    const auto dst_iter_c_d
+            = ctx.memory_mdw(DNNL_ARG_DST_ITER_C, pd()->dst_md(2));
+    const memory_desc_wrapper diff_src_layer_d(pd()->diff_src_md(0));
+    const memory_desc_wrapper diff_src_iter_d(pd()->diff_src_md(1));
+    const memory_desc_wrapper diff_src_iter_c_d(pd()->diff_src_md(2));
+    const memory_desc_wrapper diff_dst_layer_d(pd()->diff_dst_md(0));
+    const memory_desc_wrapper diff_dst_iter_d(pd()->diff_dst_md(1));
+    const memory_desc_wrapper diff_dst_iter_c_d(pd()->diff_dst_md(2));
+
+    size_t ws_gates_offset = ws_gates_offset_;
+    size_t ws_states_offset = ws_states_offset_;
+    size_t ws_c_states_offset = ws_c_states_offset_;
+    size_t ws_diff_states_offset = ws_diff_states_offset_;
+    size_t ws_grid_comp_offset = ws_grid_comp_offset_;
+    size_t ws_cell_comp_offset = ws_cell_comp_offset_;
+    size_t ws_bias_offset = ws_bias_offset_;
+
+    // with run-time dimensions the configuration and the offsets in the
+    // space are completed with the actual number of iterations and minibatch
+    rnn_conf_t rnn = this->pd()->rnn_;
+
+    // the sequence lengths are within [0, T], one per sample
+    auto seq_lengths = CTX_IN_MEM(const int32_t *, DNNL_ARG_SEQ_LENGTHS);
+    if (rnn.with_seq_lengths) {
+        const dim_t T = src_layer_d.dims()[0];
+        const dim_t N = src_layer_d.dims()[1];
+        const memory_desc_wrapper seq_lengths_d(
+                ctx.input(DNNL_ARG_SEQ_LENGTHS)->md());
+        bool ok = seq_lengths_d.data_type() == data_type::s32
+                && seq_lengths_d.ndims() == 1 && seq_lengths_d.dims()[0] == N
+                && seq_lengths_d.is_plain() && seq_lengths_d.is_dense();
+        for (dim_t b = 0; ok && b < N; b++)
+            ok = seq_lengths[b] >= 0 && seq_lengths[b] <= T;
+        if (!ok) return status::invalid_arguments;
+    }
+
+    char *runtime_space = nullptr;
+    int *active_mb = nullptr;
+    if (rnn.has_runtime_dims) {
+        const dim_t T = src_layer_d.dims()[0];
+        const dim_t N = src_layer_d.dims()[1];
+        auto layer_ok = [&](const memory_desc_t *pd_md,
+                                const memory_desc_wrapper &d) {
+            return memory_desc_wrapper(pd_md).matches_runtime_md(d)
+                    && d.dims()[0] == T && d.dims()[1] == N;
+        };
+        auto iter_ok = [&](const memory_desc_t *pd_md,
+                               const memory_desc_wrapper &d) {
+            return d.is_zero()
+                    || (memory_desc_wrapper(pd_md).matches_runtime_md(d)
+                            && d.dims()[2] == N);
+        };
+        const bool ok = true && layer_ok(pd()->src_md(0), src_layer_d)
+                && layer_ok(pd()->dst_md(0), dst_layer_d)
+                && iter_ok(pd()->src_md(1), src_iter_d)
+                && iter_ok(pd()->src_md(2), src_iter_c_d)
+                && iter_ok(pd()->dst_md(1), dst_iter_d)
+                && iter_ok(pd()->dst_md(2), dst_iter_c_d);
+        if (!ok) return status::invalid_arguments;
+        if (T == 0 || N == 0) return status::success;
+
+        rnn_utils::set_runtime_dims(rnn, (int)T, (int)N);
+        size_t scratchpad_size, workspace_size;
+        rnn_utils::set_offsets(rnn, ws_gates_offset, ws_states_offset,
+                ws_c_states_offset, ws_diff_states_offset, ws_grid_comp_offset,
+                ws_cell_comp_offset, ws_bias_offset, scratchpad_size,
+                workspace_size);
+        const size_t active_mb_size
+                = rnn.with_seq_lengths ? sizeof(int) * rnn.n_iter : 0;
+        runtime_space = (char *)malloc(scratchpad_size + active_mb_size, 4096);
+        if (runtime_space == nullptr) return status::out_of_memory;
+        if (rnn.with_seq_lengths)
+            active_mb = (int *)(runtime_space + scratchpad_size);
+    }
+
     auto input = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC_LAYER);
     auto states = CTX_IN_MEM(const char *, DNNL_ARG_SRC_ITER);
     auto c_states = CTX_IN_MEM(const float *, DNNL_ARG_SRC_ITER_C);
@@ -661,9 +774,26 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::execute_(
             = scratchpad.template get<weights_data_t *>(key_rnn_ptrs_wei_iter);
     auto ptr_bias = scratchpad.template get<float *>(key_rnn_ptrs_bia);
 
+    // At each iteration the cells compute the samples up to the last one
+    // whose sequence has not ended yet. For the batches sorted by decreasing
+    // lengths these are exactly the active samples, otherwise the ended
+    // sequences in between are computed on and ignored.
+    if (rnn.with_seq_lengths) {
+        if (!rnn.has_runtime_dims)
+            active_mb = scratchpad.template get<int>(key_rnn_active_mb);
+        for (int it = 0; it < rnn.n_iter; it++)
+            active_mb[it] = 0;
+        for (int b = 0; b < rnn.mb; b++)
+            if (seq_lengths[b] > 0) active_mb[seq_lengths[b] - 1] = b + 1;
+        for (int it = rnn.n_iter - 2; it >= 0; it--)
+            active_mb[it] = nstl::max(active_mb[it], active_mb[it + 1]);
+    }
+
     // fetchihg buffers from the workspace
     // if no workspace was provided we use the scratchpad
-    char *scratch_ptr = scratchpad.template get<char>(key_rnn_space);
+    char *scratch_ptr = rnn.has_runtime_dims
+            ? runtime_space
+            : scratchpad.template get<char>(key_rnn_space);
     char *ws_ptr = nullptr;
     if (rnn.use_workspace)
         ws_ptr = rnn.is_fwd ? CTX_OUT_MEM(char *, DNNL_ARG_WORKSPACE)
@@ -671,12 +801,12 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::execute_(
                                     const char *, DNNL_ARG_WORKSPACE));
 
     char *base_ptr = rnn.use_workspace ? ws_ptr : scratch_ptr;
-    acc_data_t *ws_gates = (acc_data_t *)(base_ptr + ws_gates_offset_);
-    src_data_t *ws_states = (src_data_t *)(base_ptr + ws_states_offset_);
-    float *ws_c_states = (float *)(base_ptr + ws_c_states_offset_);
-    float *ws_diff_states = (float *)(base_ptr + ws_diff_states_offset_);
-    float *ws_grid = (float *)(base_ptr + ws_grid_comp_offset_);
-    acc_data_t *ws_cell = (acc_data_t *)(base_ptr + ws_cell_comp_offset_);
+    acc_data_t *ws_gates = (acc_data_t *)(base_ptr + ws_gates_offset);
+    src_data_t *ws_states = (src_data_t *)(base_ptr + ws_states_offset);
+    float *ws_c_states = (float *)(base_ptr + ws_c_states_offset);
+    float *ws_diff_states = (float *)(base_ptr + ws_diff_states_offset);
+    float *ws_grid = (float *)(base_ptr + ws_grid_comp_offset);
+    acc_data_t *ws_cell = (acc_data_t *)(base_ptr + ws_cell_comp_offset);
 
     auto diff_src_layer = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC_LAYER);
     auto diff_src_iter = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SRC_ITER);
@@ -687,7 +817,7 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::execute_(
     auto diff_bias = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_BIAS);
 
     // Fetching extra buffers from scratchpad
-    float *ws_bias = (float *)(scratch_ptr + ws_bias_offset_);
+    float *ws_bias = (float *)(scratch_ptr + ws_bias_offset);
 
     // initialize diff_states to 0
     if (aprop == prop_kind::backward) {
@@ -717,32 +847,36 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::execute_(
     (this->*bias_finalization_func)(rnn, ws_bias, w_iter_comp, w_layer_comp);
 
     // we first need to copy the initial states and input into ws
-    copy_init_layer(rnn, ws_states, ws_diff_states, input, diff_dst_layer);
+    copy_init_layer(rnn, ws_states, ws_diff_states, input, diff_dst_layer,
+            src_layer_d, diff_dst_layer_d);
     if (rnn.dt_conf == f32u8f32u8 || rnn.dt_conf == f32u8f32f32
             || rnn.dt_conf == all_f32)
         copy_init_iter(rnn, ws_states, ws_c_states, ws_diff_states,
                 (const float *)states, c_states, diff_dst_iter,
-                diff_dst_iter_c);
+                diff_dst_iter_c, src_iter_d, src_iter_c_d, diff_dst_iter_d,
+                diff_dst_iter_c_d);
     else if (rnn.dt_conf == u8u8u8u8 || rnn.dt_conf == u8u8u8f32)
         copy_init_iter(rnn, ws_states, ws_c_states, ws_diff_states,
                 (const uint8_t *)states, c_states, diff_dst_iter,
-                diff_dst_iter_c);
+                diff_dst_iter_c, src_iter_d, src_iter_c_d, diff_dst_iter_d,
+                diff_dst_iter_c_d);
     else
         assert(!"unimplemented");
 
     // run the execution on the grid
     (this->*grid_computation)(rnn, ptr_wei_layer, ptr_wei_iter, ptr_bias,
             ws_states, ws_c_states, ws_diff_states, ws_gates, ws_cell, ws_grid,
-            diff_weights_layer, diff_weights_iter, diff_bias);
+            diff_weights_layer, diff_weights_iter, diff_bias, active_mb);
 
     // Finally we copy the results to the result buffers
     if (rnn.dt_conf == u8u8u8f32 || rnn.dt_conf == f32u8f32f32
             || rnn.dt_conf == all_f32)
         copy_res_layer(rnn, (float *)dst_last_layer, diff_src_layer, ws_states,
-                ws_diff_states);
+                ws_diff_states, seq_lengths, dst_layer_d, diff_src_layer_d);
     else if (rnn.dt_conf == u8u8u8u8 || rnn.dt_conf == f32u8f32u8)
         copy_res_layer(rnn, (uint8_t *)dst_last_layer, diff_src_layer,
-                ws_states, ws_diff_states);
+                ws_states, ws_diff_states, seq_lengths, dst_layer_d,
+                diff_src_layer_d);
     else
         assert(!"unimplemented");
 
@@ -750,13 +884,18 @@ void _ref_rnn_common_t<aprop, src_type, weights_type>::execute_(
             || rnn.dt_conf == all_f32)
         copy_res_iter(rnn, (float *)dst_last_iter, dst_last_iter_c,
                 diff_src_iter, diff_src_iter_c, ws_states, ws_c_states,
-                ws_diff_states);
+                ws_diff_states, seq_lengths, dst_iter_d, dst_iter_c_d,
+                diff_src_iter_d, diff_src_iter_c_d);
     else if (rnn.dt_conf == u8u8u8u8 || rnn.dt_conf == u8u8u8f32)
         copy_res_iter(rnn, (uint8_t *)dst_last_iter, dst_last_iter_c,
                 diff_src_iter, diff_src_iter_c, ws_states, ws_c_states,
-                ws_diff_states);
+                ws_diff_states, seq_lengths, dst_iter_d, dst_iter_c_d,
+                diff_src_iter_d, diff_src_iter_c_d);
     else
         assert(!"unimplemented");
+
+    free(runtime_space);
+    return status::success;
 };
 
 /* Fix for MSVS warning C4661 */
@@ -778,6 +917,18 @@ template <>
 rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru_lbr);
 template <>
 rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_gru_lbr);
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution_small_batch);
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_small_batch);
+template <>
+rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_small_batch);
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_f32_t::cell_execution_gru_small_batch);
+template <>
+rnn_cell_execution_sig(ref_rnn_fwd_u8s8_t::cell_execution_gru_small_batch);
+template <>
+rnn_cell_execution_sig(ref_rnn_bwd_f32_t::cell_execution_gru_small_batch);
 
 template struct _ref_rnn_common_t<prop_kind::forward, data_type::f32,
         data_type::f32>;
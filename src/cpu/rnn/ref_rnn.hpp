@@ -40,7 +40,11 @@ template <prop_kind_t aprop, impl::data_type_t src_type,
 struct _ref_rnn_common_t : public primitive_impl_t {
     typedef typename prec_traits<src_type>::type src_data_t;
     typedef typename prec_traits<weights_type>::type weights_data_t;
-    typedef typename utils::conditional<src_type == data_type::u8, int32_t,
+    // Note: the C enumerator is used on purpose. Referring to the internal
+    // linkage constant data_type::u8 here makes some compilers (e.g. gcc 12)
+    // give internal linkage to the members that take acc_data_t, so their
+    // explicit instantiations in other translation units are not exported.
+    typedef typename utils::conditional<src_type == dnnl_u8, int32_t,
             float>::type acc_data_t;
 
     using class_name = _ref_rnn_common_t<aprop, src_type, weights_type>;
@@ -60,7 +64,7 @@ struct _ref_rnn_common_t : public primitive_impl_t {
     struct pd_t : public base_pd_t {
         using base_pd_t::base_pd_t;
 
-        DECLARE_COMMON_PD_T("ref:any", class_name, USE_GLOBAL_SCRATCHPAD);
+        DECLARE_COMMON_PD_T("ref:any", class_name);
 
         status_t init() {
             using namespace prop_kind;
@@ -97,6 +101,22 @@ struct _ref_rnn_common_t : public primitive_impl_t {
             if (rnn_.dt_conf == all_f32)
                 ok = ok && this->attr()->has_default_values();
 
+            // the fused cells do not implement the test mode activations
+            if (this->attr()->rnn_tparams_.test_mode_)
+                rnn_.fuse_small_batch_cell = false;
+
+            // run-time dimensions are supported for f32 inference only
+            ok = ok
+                    && IMPLICATION(rnn_.has_runtime_dims,
+                            rnn_.dt_conf == all_f32 && !rnn_.is_training);
+
+            // so are the sequence lengths, for the left-to-right direction
+            ok = ok
+                    && IMPLICATION(rnn_.with_seq_lengths,
+                            rnn_.dt_conf == all_f32 && !rnn_.is_training
+                                    && rnn_.exec_dir == l2r);
+            if (!ok) return status::unimplemented;
+
             // Set weights descriptors to desired format
             memory_desc_t new_weights_layer_md = *this->weights_md(0);
             CHECK(set_expected_desc(rnn_, new_weights_layer_md, false));
@@ -145,7 +165,12 @@ struct _ref_rnn_common_t : public primitive_impl_t {
         void init_scratchpad(size_t scratchpad_sz) {
             using namespace memory_tracking::names;
             auto scratchpad = this->scratchpad_registry().registrar();
-            scratchpad.book(key_rnn_space, sizeof(float) * scratchpad_sz, 4096);
+            // with run-time dimensions the space is allocated at execution
+            if (!rnn_.has_runtime_dims)
+                scratchpad.book(
+                        key_rnn_space, sizeof(float) * scratchpad_sz, 4096);
+            if (rnn_.with_seq_lengths && !rnn_.has_runtime_dims)
+                scratchpad.book(key_rnn_active_mb, sizeof(int) * rnn_.n_iter);
 
             int max_nparts = this->cell_kind() == alg_kind::vanilla_gru ? 2 : 1;
             int ptr_wei_sz = rnn_.n_layer * rnn_.n_dir * max_nparts;
@@ -185,13 +210,19 @@ struct _ref_rnn_common_t : public primitive_impl_t {
         rnn_postgemm_ = new rnn_postgemm_dispatcher<aprop, src_type>(
                 pd()->rnn_, pd());
         assert(rnn_postgemm_ != nullptr);
+        const bool fuse_cell = pd()->rnn_.fuse_small_batch_cell;
         switch (pd()->cell_kind()) {
             case alg_kind::vanilla_rnn:
-            case alg_kind::vanilla_lstm:
                 cell_func = &class_name::cell_execution;
                 break;
+            case alg_kind::vanilla_lstm:
+                cell_func = fuse_cell ? &class_name::cell_execution_small_batch
+                                      : &class_name::cell_execution;
+                break;
             case alg_kind::vanilla_gru:
-                cell_func = &class_name::cell_execution_gru;
+                cell_func = fuse_cell
+                        ? &class_name::cell_execution_gru_small_batch
+                        : &class_name::cell_execution_gru;
                 break;
             case alg_kind::lbr_gru:
                 cell_func = &class_name::cell_execution_gru_lbr;
@@ -213,16 +244,17 @@ struct _ref_rnn_common_t : public primitive_impl_t {
     // typedef typename prec_traits::type data_t;
 
     virtual status_t execute(const exec_ctx_t &ctx) const override {
-        execute_(ctx);
-        return status::success;
+        return execute_(ctx);
     }
 
 private:
-    void execute_(const exec_ctx_t &ctx) const;
+    status_t execute_(const exec_ctx_t &ctx) const;
     rnn_grid_execution_sig(linear_execution);
     rnn_cell_execution_sig(cell_execution);
     rnn_cell_execution_sig(cell_execution_gru);
     rnn_cell_execution_sig(cell_execution_gru_lbr);
+    rnn_cell_execution_sig(cell_execution_small_batch);
+    rnn_cell_execution_sig(cell_execution_gru_small_batch);
     rnn_gemm_sig(gemm);
     rnn_gemm_sig(packed_gemm);
     rnn_bias_prepare_sig(bias_prepare);
@@ -234,24 +266,36 @@ private:
 
     void copy_init_layer(const rnn_utils::rnn_conf_t &rnn,
             src_data_t *ws_states_, float *ws_diff_states_,
-            const src_data_t *xt_, const float *diff_dst_layer) const;
+            const src_data_t *xt_, const float *diff_dst_layer,
+            const memory_desc_wrapper &xt_d,
+            const memory_desc_wrapper &diff_dst_layer_d) const;
 
     template <typename input_data_t>
     void copy_init_iter(const rnn_utils::rnn_conf_t &rnn,
             src_data_t *ws_states_, float *ws_c_states_, float *ws_diff_states_,
             const input_data_t *firstit_states_, const float *firstit_c_states_,
-            const float *diff_dst_iter_, const float *diff_dst_iter_c_) const;
+            const float *diff_dst_iter_, const float *diff_dst_iter_c_,
+            const memory_desc_wrapper &firstit_states_d,
+            const memory_desc_wrapper &firstit_c_states_d,
+            const memory_desc_wrapper &diff_dst_iter_d,
+            const memory_desc_wrapper &diff_dst_iter_c_d) const;
 
     template <typename dst_data_t>
     void copy_res_layer(const rnn_utils::rnn_conf_t &rnn,
             dst_data_t *dst_layer_, float *diff_src_layer_,
-            const src_data_t *ws_states_, const float *ws_diff_states_) const;
+            const src_data_t *ws_states_, const float *ws_diff_states_,
+            const int32_t *seq_lengths_, const memory_desc_wrapper &dst_layer_d,
+            const memory_desc_wrapper &diff_src_layer_d) const;
 
     template <typename output_data_t>
     void copy_res_iter(const rnn_utils::rnn_conf_t &rnn,
             output_data_t *dst_iter_, float *dst_iter_c_, float *diff_src_iter_,
             float *diff_src_iter_c_, const src_data_t *ws_states_,
-            float *ws_c_states, const float *ws_diff_states_) const;
+            float *ws_c_states, const float *ws_diff_states_,
+            const int32_t *seq_lengths_, const memory_desc_wrapper &dst_iter_d,
+            const memory_desc_wrapper &dst_iter_c_d,
+            const memory_desc_wrapper &diff_src_iter_d,
+            const memory_desc_wrapper &diff_src_iter_c_d) const;
 
     void gates_reduction(const rnn_utils::rnn_conf_t &rnn,
             const acc_data_t *ws_gates_, float *diff_bias_) const;
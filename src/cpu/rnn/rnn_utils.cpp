@@ -91,13 +91,18 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             rnn.dt_conf = f32u8f32f32;
     }
 
+    /* The run-time dimensions are set to 0 for now, which also disables
+     * the packed gemms as the packing depends on them */
+    rnn.has_runtime_dims = src_layer_d.has_runtime_dims();
+    rnn.with_seq_lengths = rd.flags & dnnl_rnn_flags_use_seq_lengths;
+
     rnn.n_layer = weights_layer_d.dims()[0];
-    rnn.n_iter = src_layer_d.dims()[0];
+    rnn.n_iter = rnn.has_runtime_dims ? 0 : src_layer_d.dims()[0];
     rnn.n_dir = weights_layer_d.dims()[1];
     rnn.n_gates = weights_layer_d.dims()[3];
     rnn.n_states = rd.cell_kind == dnnl_vanilla_lstm ? 2 : 1;
     rnn.n_bias = rnn.n_gates + rnn.is_lbr;
-    rnn.mb = src_layer_d.dims()[1];
+    rnn.mb = rnn.has_runtime_dims ? 0 : src_layer_d.dims()[1];
     rnn.sic = weights_iter_d.dims()[2];
     rnn.slc = weights_layer_d.dims()[2];
     rnn.dic = weights_layer_d.dims()[4];
@@ -124,8 +129,10 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     /* Decide wich gemm implementation to use: packed/nonpacked jit/cblas
      * and if to mergre gemm across iterations */
     bool is_int8 = rnn.dt_conf != all_f32;
-    rnn.merge_gemm_layer
-            = ((rnn.is_fwd && rnn.mb < 128) || !rnn.is_fwd) || is_int8;
+    /* With sequence lengths the layer gemm is done per iteration, so that
+     * only the samples whose sequences have not ended yet are computed */
+    rnn.merge_gemm_layer = !rnn.with_seq_lengths
+            && (((rnn.is_fwd && rnn.mb < 128) || !rnn.is_fwd) || is_int8);
     bool is_gru = utils::one_of(
             rd.cell_kind, alg_kind::vanilla_gru, alg_kind::lbr_gru);
     rnn.merge_gemm_iter = !(rnn.is_fwd || is_gru);
@@ -142,15 +149,29 @@ void rnn_utils::init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             = (pack_sgemm_supported()
                       && (utils::one_of(weights_layer_d.format_kind(),
                                   format_kind::any, format_kind::rnn_packed)
-                              && is_inference && rnn.n_iter == 1))
+                              && is_inference && rnn.n_iter == 1
+                              && !rnn.has_runtime_dims
+                              && !rnn.with_seq_lengths))
             || is_int8;
     rnn.use_iter_packed_gemm
             = (pack_sgemm_supported()
                       && (utils::one_of(weights_iter_d.format_kind(),
                                   format_kind::any, format_kind::rnn_packed)
-                              && is_inference && rnn.mb >= 16))
+                              && is_inference && rnn.mb >= 16
+                              && !rnn.has_runtime_dims
+                              && !rnn.with_seq_lengths))
             || is_int8;
 
+    /* For the small batches of inference, a single parallel region per cell
+     * avoids forking threads in each gemm and again in the postgemm. The
+     * gemms are split over the gates rows, so no packed weights here */
+    rnn.fuse_small_batch_cell = is_inference && !is_int8
+            && !rnn.has_runtime_dims && rnn.mb <= fused_cell_max_mb
+            && utils::one_of(rd.cell_kind, alg_kind::vanilla_lstm,
+                    alg_kind::vanilla_gru)
+            && !rnn.use_iter_packed_gemm
+            && IMPLICATION(!rnn.merge_gemm_layer, !rnn.use_layer_packed_gemm);
+
     int sizeof_states_dt
             = rnn.dt_conf == all_f32 ? sizeof(float) : sizeof(uint8_t);
     rnn.states_ws_ld = get_good_ld(
@@ -232,19 +253,24 @@ void rnn_utils::set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
                 rnn.diff_weights_iter_nld);
     }
 
+    rnn.gates_ws_ld = get_good_ld(rnn.gates_ld, sizeof(float));
+    rnn.use_workspace = rnn.is_training;
+
+    set_ws_sizes(rnn);
+}
+
+void rnn_utils::set_ws_sizes(rnn_conf_t &rnn) {
     int sizeof_states_dt
             = rnn.dt_conf == all_f32 ? sizeof(float) : sizeof(uint8_t);
-    rnn.gates_ws_ld = get_good_ld(rnn.gates_ld, sizeof(float));
 
     /* Set workspace sizes to store:
      * states to copmute a pass
      * diff states to copmute bwd pass (training only)
      * intermediate results from the gates
      */
-    rnn.use_workspace = rnn.is_training;
     rnn.ws_states_size = (size_t)(rnn.n_layer + 1) * rnn.n_dir
             * (rnn.n_iter + 1) * rnn.mb * rnn.states_ws_ld * sizeof_states_dt;
-    bool is_lstm = rd.cell_kind == dnnl_vanilla_lstm;
+    bool is_lstm = rnn.n_states == 2;
     rnn.ws_c_states_size = is_lstm
             ? (size_t)(rnn.n_layer + 1) * rnn.n_dir * (rnn.n_iter + 1) * rnn.mb
                     * rnn.states_ws_ld * sizeof(float)
@@ -267,6 +293,15 @@ void rnn_utils::set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
             * sizeof(float);
 }
 
+void rnn_utils::set_runtime_dims(rnn_conf_t &rnn, int n_iter, int mb) {
+    assert(rnn.has_runtime_dims);
+    rnn.n_iter = n_iter;
+    rnn.mb = mb;
+    rnn.gates_nld = mb;
+    rnn.states_nld = mb;
+    set_ws_sizes(rnn);
+}
+
 int rnn_utils::get_good_ld(int dim, int sizeof_dt) {
     // we want matrices leading dimentions to be 64-byte aligned,
     // and not divisible by 256 to avoid 4K aliasing effects
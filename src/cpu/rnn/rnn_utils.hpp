@@ -18,6 +18,7 @@
 #define RNN_UTILS_HPP
 
 #include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
 #include "memory_desc_wrapper.hpp"
 #include "utils.hpp"
 
@@ -46,7 +47,8 @@
             src_data_t *ws_states_, float *ws_c_states_, \
             float *ws_diff_states_, acc_data_t *ws_gates_, \
             acc_data_t *ws_cell_, float *ws_grid_, float *diff_weights_layer_, \
-            float *diff_weights_iter_, float *diff_bias_) const
+            float *diff_weights_iter_, float *diff_bias_, \
+            const int *active_mb_) const
 
 #define rnn_gemm_sig(f) \
     void f(const char transA, const char transB, int m, int n, int k, \
@@ -109,14 +111,36 @@ struct rnn_conf_t {
     int weights_iter_compensation_size, weights_layer_compensation_size;
     bool is_fwd, is_training, is_lbr;
     bool use_workspace;
+    /* n_iter and mb are only known at execution */
+    bool has_runtime_dims;
+    /* the samples have their own sequence lengths given at execution */
+    bool with_seq_lengths;
 
     /* Size of workspace for each tensor in bytes */
     size_t ws_gates_size, ws_states_size, ws_c_states_size, ws_diff_states_size,
             ws_cell_comp_size, ws_grid_comp_size, ws_per_cell, ws_bias_size;
     bool merge_gemm_iter, merge_gemm_layer, use_jit_gemm, use_layer_packed_gemm,
             use_iter_packed_gemm;
+    /* the gemms and the elementwise part of a cell run together, see
+     * small_batch_dic_range() */
+    bool fuse_small_batch_cell;
 };
 
+/* The largest minibatch the fused cells are used for */
+const int fused_cell_max_mb = 8;
+
+/* The fused small batch cells split the work over dic only, in blocks of a
+ * cache line, and each thread runs the gemms of its block of the gates and
+ * then the elementwise part on it while the gates are still in cache */
+inline void small_batch_dic_range(
+        const rnn_conf_t &rnn, int ithr, int nthr, int &dic_s, int &dic_e) {
+    const int dic_blk = 16;
+    int start {0}, end {0};
+    balance211(utils::div_up(rnn.dic, dic_blk), nthr, ithr, start, end);
+    dic_s = start * dic_blk;
+    dic_e = nstl::min(rnn.dic, end * dic_blk);
+}
+
 bool is_ldigo(const memory_desc_wrapper &md);
 bool is_ldgoi(const memory_desc_wrapper &md);
 
@@ -135,6 +159,10 @@ void set_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
         const memory_desc_wrapper &diff_weights_layer_d,
         const memory_desc_wrapper &diff_weights_iter_d);
 
+void set_ws_sizes(rnn_conf_t &rnn);
+
+void set_runtime_dims(rnn_conf_t &rnn, int n_iter, int mb);
+
 void set_offsets(const rnn_conf_t &rnn, size_t &ws_gates_offset,
         size_t &ws_h_state_offset, size_t &ws_c_state_offset,
         size_t &ws_diff_states_offset, size_t &ws_grid_comp_offset,
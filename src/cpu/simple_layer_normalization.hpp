@@ -79,6 +79,7 @@ struct simple_layer_normalization_fwd_t : public primitive_impl_t {
             const memory_desc_wrapper stat_d(stat_md());
 
             bool ok = true && is_fwd() && !has_zero_dim_memory()
+                    && !has_runtime_dims_or_strides()
                     && utils::everyone_is(f32, src_md()->data_type,
                             stat_md()->data_type, dst_md()->data_type)
                     && IMPLICATION(
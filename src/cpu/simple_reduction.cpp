@@ -0,0 +1,317 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "math_utils.hpp"
+#include "memory.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+
+#include "simple_q10n.hpp"
+#include "simple_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace alg_kind;
+
+namespace {
+
+// The accumulations of the algorithms, for the vectorized loops. The finalize
+// step is the one of ref_reduction_scalar_t.
+struct op_max_t {
+    float init() const { return nstl::numeric_limits<float>::lowest(); }
+    float accumulate(float acc, float x) const { return nstl::max(acc, x); }
+    float combine(float a, float b) const { return nstl::max(a, b); }
+};
+
+struct op_min_t {
+    float init() const { return nstl::numeric_limits<float>::max(); }
+    float accumulate(float acc, float x) const { return nstl::min(acc, x); }
+    float combine(float a, float b) const { return nstl::min(a, b); }
+};
+
+struct op_sum_t {
+    float init() const { return 0.f; }
+    float accumulate(float acc, float x) const { return acc + x; }
+    float combine(float a, float b) const { return a + b; }
+};
+
+struct op_mul_t {
+    float init() const { return 1.f; }
+    float accumulate(float acc, float x) const { return acc * x; }
+    float combine(float a, float b) const { return a * b; }
+};
+
+struct op_norm_l1_t {
+    float init() const { return 0.f; }
+    float accumulate(float acc, float x) const { return acc + fabsf(x); }
+    float combine(float a, float b) const { return a + b; }
+};
+
+struct op_norm_l2_t {
+    float init() const { return 0.f; }
+    float accumulate(float acc, float x) const { return acc + x * x; }
+    float combine(float a, float b) const { return a + b; }
+};
+
+struct op_norm_lp_t {
+    op_norm_lp_t(float p) : p_(p) {}
+    float init() const { return 0.f; }
+    float accumulate(float acc, float x) const {
+        return acc + powf(fabsf(x), p_);
+    }
+    float combine(float a, float b) const { return a + b; }
+    float p_;
+};
+
+/* returns the accumulation of the @p n contiguous values of @p src */
+template <typename op_t, typename src_data_t>
+float reduce_contiguous(const op_t &op, const src_data_t *src, dim_t n) {
+    constexpr int nlanes = 16;
+    float acc[nlanes];
+    for (int l = 0; l < nlanes; ++l)
+        acc[l] = op.init();
+
+    dim_t r = 0;
+    for (; r + nlanes <= n; r += nlanes) {
+        PRAGMA_OMP_SIMD()
+        for (int l = 0; l < nlanes; ++l)
+            acc[l] = op.accumulate(acc[l], (float)src[r + l]);
+    }
+    for (; r < n; ++r)
+        acc[0] = op.accumulate(acc[0], (float)src[r]);
+
+    float res = acc[0];
+    for (int l = 1; l < nlanes; ++l)
+        res = op.combine(res, acc[l]);
+    return res;
+}
+
+/* accumulates the @p n rows of the @p len contiguous values of @p src, the
+ * rows being @p stride apart, to @p acc */
+template <typename op_t, typename src_data_t>
+void reduce_strided(const op_t &op, const src_data_t *src, dim_t n,
+        dim_t stride, dim_t len, float *acc) {
+    for (dim_t r = 0; r < n; ++r) {
+        const src_data_t *s = src + r * stride;
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < len; ++i)
+            acc[i] = op.accumulate(acc[i], (float)s[i]);
+    }
+}
+
+} // namespace
+
+template <data_type_t src_type, data_type_t dst_type>
+bool simple_reduction_t<src_type, dst_type>::pd_t::init_conf() {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+
+    bool ok = src_d.is_blocking_desc() && dst_d.is_blocking_desc()
+            && src_d.is_dense(true) && dst_d.is_dense(true);
+    if (!ok) return false;
+
+    const auto &sblk = src_d.blocking_desc();
+    const auto &dblk = dst_d.blocking_desc();
+    if (sblk.inner_nblks != dblk.inner_nblks) return false;
+    for (int b = 0; b < sblk.inner_nblks; ++b)
+        if (sblk.inner_blks[b] != dblk.inner_blks[b]
+                || sblk.inner_idxs[b] != dblk.inner_idxs[b])
+            return false;
+
+    // The reduced dimensions, ordered by their strides
+    int rdims[DNNL_MAX_NDIMS];
+    int nrdims = 0;
+    for (int d = 0; d < ndims(); ++d) {
+        if (!is_reduced(d)) continue;
+        for (int b = 0; b < sblk.inner_nblks; ++b)
+            if (sblk.inner_idxs[b] == d) return false;
+        if (src_d.padded_dims()[d] != src_d.dims()[d]) return false;
+
+        int k = nrdims++;
+        for (; k > 0 && sblk.strides[rdims[k - 1]] > sblk.strides[d]; --k)
+            rdims[k] = rdims[k - 1];
+        rdims[k] = d;
+    }
+
+    reduce_ = 1;
+    inner_ = 1;
+    for (int k = 0; k < nrdims; ++k) {
+        const int d = rdims[k];
+        if (k == 0)
+            inner_ = sblk.strides[d];
+        else if (sblk.strides[d] != inner_ * reduce_)
+            return false; // not a contiguous run
+        reduce_ *= src_d.dims()[d];
+    }
+    outer_ = src_d.nelems(true) / (reduce_ * inner_);
+
+    // dst is src with the run of the reduced dimensions removed
+    for (int d = 0; d < ndims(); ++d) {
+        if (is_reduced(d) || dst_d.padded_dims()[d] == 1) continue;
+        const dim_t s_stride = sblk.strides[d];
+        const dim_t expected = s_stride >= inner_ * reduce_
+                ? s_stride / reduce_
+                : s_stride;
+        if (dblk.strides[d] != expected) return false;
+    }
+
+    // The jobs are the (outer, inner block) pairs
+    const int nthr = dnnl_get_max_threads();
+    const dim_t max_inner_blk = 256;
+    inner_blk_ = nstl::min(inner_, max_inner_blk);
+    const dim_t njobs = outer_ * utils::div_up(inner_, inner_blk_);
+
+    // The reduced dimension is split when the jobs cannot keep the threads
+    // busy, each chunk being large enough to amortize the combination
+    const dim_t min_chunk_size = 4096;
+    nchunks_ = 1;
+    if (njobs < nthr) {
+        const dim_t max_nchunks = reduce_ * inner_blk_ / min_chunk_size;
+        nchunks_ = (int)nstl::max((dim_t)1,
+                nstl::min((dim_t)utils::div_up(nthr, njobs), max_nchunks));
+    }
+
+    return true;
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+status_t simple_reduction_t<src_type, dst_type>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto *rd = pd()->desc();
+    const float p = rd->p;
+    switch (rd->alg_kind) {
+        case reduction_max: execute_reduction(ctx, op_max_t()); break;
+        case reduction_min: execute_reduction(ctx, op_min_t()); break;
+        case reduction_mul: execute_reduction(ctx, op_mul_t()); break;
+        case reduction_sum:
+        case reduction_mean: execute_reduction(ctx, op_sum_t()); break;
+        default:
+            if (p == 1.f)
+                execute_reduction(ctx, op_norm_l1_t());
+            else if (p == 2.f)
+                execute_reduction(ctx, op_norm_l2_t());
+            else
+                execute_reduction(ctx, op_norm_lp_t(p));
+            break;
+    }
+    return status::success;
+}
+
+template <data_type_t src_type, data_type_t dst_type>
+template <typename op_t>
+void simple_reduction_t<src_type, dst_type>::execute_reduction(
+        const exec_ctx_t &ctx, const op_t &op) const {
+    auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(dst_data_t *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    src += src_d.offset0();
+    dst += dst_d.offset0();
+
+    const ref_reduction_scalar_t reduction(*pd()->desc());
+
+    const dim_t O = pd()->outer_;
+    const dim_t R = pd()->reduce_;
+    const dim_t I = pd()->inner_;
+    const dim_t I_blk = pd()->inner_blk_;
+    const dim_t nb_I = utils::div_up(I, I_blk);
+    const int nchunks = pd()->nchunks_;
+
+    // Accumulates the reduced points [r_start, r_end) of the job
+    // (o, ib) to acc
+    auto accumulate = [&](dim_t o, dim_t ib, dim_t r_start, dim_t r_end,
+                              float *acc) {
+        const dim_t i0 = ib * I_blk;
+        const dim_t len = nstl::min(I_blk, I - i0);
+        const src_data_t *s = src + (o * R + r_start) * I + i0;
+        if (I == 1) {
+            acc[0] = reduce_contiguous(op, s, r_end - r_start);
+        } else {
+            for (dim_t i = 0; i < len; ++i)
+                acc[i] = op.init();
+            reduce_strided(op, s, r_end - r_start, I, len, acc);
+        }
+    };
+
+    auto store = [&](dim_t o, dim_t ib, const float *acc) {
+        const dim_t i0 = ib * I_blk;
+        const dim_t len = nstl::min(I_blk, I - i0);
+        dst_data_t *d = dst + o * I + i0;
+        PRAGMA_OMP_SIMD()
+        for (dim_t i = 0; i < len; ++i)
+            d[i] = qz_a1b0<float, dst_data_t>()(
+                    reduction.finalize(acc[i], R));
+    };
+
+    if (nchunks == 1) {
+        parallel_nd(O, nb_I, [&](dim_t o, dim_t ib) {
+            float acc[256];
+            assert(I_blk <= 256);
+            accumulate(o, ib, 0, R, acc);
+            store(o, ib, acc);
+        });
+    } else {
+        // The partial accumulations of the chunks, chunk-major
+        float *partials = ctx.get_scratchpad_grantor().template get<float>(
+                memory_tracking::names::key_reduction_partials);
+
+        parallel_nd(nchunks, O, nb_I, [&](int c, dim_t o, dim_t ib) {
+            dim_t r_start {0}, r_end {0};
+            balance211(R, nchunks, c, r_start, r_end);
+            float *acc = partials + (c * O + o) * I + ib * I_blk;
+            accumulate(o, ib, r_start, r_end, acc);
+        });
+
+        parallel_nd(O, nb_I, [&](dim_t o, dim_t ib) {
+            const dim_t i0 = ib * I_blk;
+            const dim_t len = nstl::min(I_blk, I - i0);
+            float *acc = partials + o * I + i0;
+            for (int c = 1; c < nchunks; ++c) {
+                const float *part = partials + (c * O + o) * I + i0;
+                PRAGMA_OMP_SIMD()
+                for (dim_t i = 0; i < len; ++i)
+                    acc[i] = op.combine(acc[i], part[i]);
+            }
+            store(o, ib, acc);
+        });
+    }
+
+    if (dst_d.nelems(true) != dst_d.nelems())
+        ctx.memory(DNNL_ARG_DST)->zero_pad();
+}
+
+using namespace data_type;
+
+template struct simple_reduction_t<f32, f32>;
+template struct simple_reduction_t<bf16, bf16>;
+template struct simple_reduction_t<bf16, f32>;
+template struct simple_reduction_t<s8, s8>;
+template struct simple_reduction_t<s8, f32>;
+template struct simple_reduction_t<u8, u8>;
+template struct simple_reduction_t<u8, f32>;
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
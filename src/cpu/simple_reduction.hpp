@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_REDUCTION_HPP
+#define CPU_SIMPLE_REDUCTION_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "memory_tracking.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+#include "cpu_reduction_pd.hpp"
+#include "ref_reduction.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+/* Reduction of the dense tensors whose reduced dimensions are not blocked and
+ * form a contiguous run of the layout, so that src is seen as
+ * outer x reduce x inner and dst as outer x inner (dst has the layout of src).
+ *
+ * When inner is 1 the reduced values are contiguous and are accumulated in
+ * the vector lanes, otherwise the accumulators span the inner dimension. When
+ * there are fewer (outer, inner block) jobs than threads the reduced
+ * dimension is split into chunks whose partial accumulations are then
+ * combined, as in cpu_reducer_t. */
+template <impl::data_type_t src_type, impl::data_type_t dst_type>
+struct simple_reduction_t : public primitive_impl_t {
+    struct pd_t : public cpu_reduction_pd_t {
+        using cpu_reduction_pd_t::cpu_reduction_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_reduction_t);
+
+        status_t init() {
+            bool ok = true && src_md()->data_type == src_type
+                    && dst_md()->data_type == dst_type
+                    && attr()->has_default_values() && !has_zero_dim_memory()
+                    && set_default_params() == status::success && init_conf();
+            if (!ok) return status::unimplemented;
+
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        dim_t outer_, reduce_, inner_;
+        dim_t inner_blk_; // the number of the accumulators of a job
+        int nchunks_; // the number of the chunks of the reduced dimension
+
+    private:
+        bool init_conf();
+        void init_scratchpad() {
+            if (nchunks_ == 1) return;
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.book(memory_tracking::names::key_reduction_partials,
+                    sizeof(float) * nchunks_ * outer_ * inner_);
+        }
+    };
+
+    simple_reduction_t(const pd_t *apd) : primitive_impl_t(apd) {}
+
+    typedef typename prec_traits<src_type>::type src_data_t;
+    typedef typename prec_traits<dst_type>::type dst_data_t;
+
+    virtual status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    template <typename op_t>
+    void execute_reduction(const exec_ctx_t &ctx, const op_t &op) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_impl_t::pd(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -960,7 +960,9 @@ template <SIMPLE_REORDER_TEMPL_DECL>
 struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         typename utils::enable_if<tag_i == format_tag::any
                         && tag_o == format_tag::any
-                        && order_keep == fmt_order::any,
+                        && order_keep == fmt_order::any
+                        && type_i != data_type::bf16
+                        && type_o != data_type::bf16,
                 spec::direct_copy>::type> {
     static bool is_applicable(const memory_desc_wrapper &input_d,
             const memory_desc_wrapper &output_d, const primitive_attr_t *attr) {
@@ -1052,6 +1054,61 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
     }
 };
 
+/* f32 <-> bf16 direct copy: the data is converted with the bulk converters */
+template <SIMPLE_REORDER_TEMPL_DECL>
+struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
+        typename utils::enable_if<tag_i == format_tag::any
+                        && tag_o == format_tag::any
+                        && order_keep == fmt_order::any
+                        && (type_i == data_type::bf16
+                                || type_o == data_type::bf16),
+                spec::direct_copy>::type> {
+    static bool is_applicable(const memory_desc_wrapper &input_d,
+            const memory_desc_wrapper &output_d, const primitive_attr_t *attr) {
+        using namespace data_type;
+        return input_d.similar_to(output_d, true, false, 0)
+                && input_d.is_dense() && output_d.is_dense()
+                && utils::one_of(input_d.data_type(), f32, bf16)
+                && utils::one_of(output_d.data_type(), f32, bf16)
+                && input_d.data_type() != output_d.data_type()
+                && attr->has_default_values();
+    }
+
+    GET_SCRATCHPAD_SIZE_ZERO();
+
+    static void cvt(bfloat16_t *out, const float *inp, size_t size) {
+        cvt_float_to_bfloat16(out, inp, size);
+    }
+
+    static void cvt(float *out, const bfloat16_t *inp, size_t size) {
+        cvt_bfloat16_to_float(out, inp, size);
+    }
+
+    static status_t execute(const cpu_reorder_pd_t *pd,
+            const data_t<type_i> *input, data_t<type_o> *output,
+            const memory_tracking::grantor_t &scratchpad) {
+        DECLARE_COMMON_PARAMS();
+
+        input += input_d.blk_off(0);
+        output += output_d.blk_off(0);
+
+        const size_t nelems = input_d.nelems();
+
+        constexpr int block_size = 16;
+        const auto num_blocks = nelems / block_size;
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            size_t start {0}, end {0};
+            balance211(num_blocks, nthr, ithr, start, end);
+            start = start * block_size;
+            end = ithr == nthr - 1 ? nelems : end * block_size;
+            if (start < end) cvt(output + start, input + start, end - start);
+        });
+
+        return status::success;
+    }
+};
+
 template <SIMPLE_REORDER_TEMPL_DECL>
 struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         typename utils::enable_if<tag_i == format_tag::any
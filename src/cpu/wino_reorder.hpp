@@ -159,14 +159,15 @@ private:
                 {0.119514472455649f, -0.179271708683473f, 0.26890756302521f},
                 {0.f, 0.f, 1.f}};
 
+        // The layouts are shared by the implementations of different tile
+        // sizes, so the transform is determined by alpha
         float *__restrict g;
-        if (utils::one_of(wino_format_, dnnl_wino_wei_aaOIoi,
-                    dnnl_wino_wei_aaOio, dnnl_wino_wei_aaOBiOo))
+        if (w_alpha_ == 4)
             g = (float *)G_2x2_3x3;
-        else if (wino_format_ == dnnl_wino_wei_OBaaIBOIio)
+        else if (w_alpha_ == 6)
             g = (float *)G_4x4_3x3;
         else {
-            assert(!"Unknown winograd weights target layout");
+            assert(!"Unknown winograd weights tile size");
             return;
         }
 
@@ -90,6 +90,7 @@ struct gemm_inner_product_fwd_t : public primitive_impl_t {
 
             bool ok = true && set_default_params() == status::success
                     && is_fwd() && !has_zero_dim_memory()
+                    && !has_runtime_dims_or_strides()
                     && utils::one_of(true,
                             expect_data_types(f16, f16, f16, f16, f16),
                             expect_data_types(f32, f32, f32, f32, f32))
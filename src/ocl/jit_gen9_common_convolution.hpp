@@ -73,6 +73,8 @@ struct jit_gen9_common_convolution_fwd_t : public primitive_impl_t {
                                     && compute_engine->mayiuse(
                                             compute::device_ext_t::
                                                     intel_subgroups_short))
+                    && attr()->post_ops_.find(primitive_kind::convolution)
+                            == -1
                     && !has_zero_dim_memory();
             if (!ok) return status::unimplemented;
 
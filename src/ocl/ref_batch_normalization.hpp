@@ -50,7 +50,7 @@ struct ref_batch_normalization_fwd_t : public primitive_impl_t {
             auto src_data_t = src_md()->data_type;
             auto dst_data_t = dst_md()->data_type;
 
-            bool ok = true && is_fwd()
+            bool ok = true && is_fwd() && !fuse_norm_add_relu()
                     && (utils::everyone_is(f16, src_data_t, dst_data_t)
                             || utils::everyone_is(bf16, src_data_t, dst_data_t)
                             || utils::everyone_is(f32, src_data_t, dst_data_t))
@@ -146,7 +146,7 @@ struct ref_batch_normalization_bwd_t : public primitive_impl_t {
 
         status_t init() {
             using namespace data_type;
-            bool ok = true && is_bwd()
+            bool ok = true && is_bwd() && !fuse_norm_add_relu()
                     && (utils::everyone_is(f32, src_md()->data_type,
                                 diff_src_md()->data_type)
                             || utils::everyone_is(bf16, src_md()->data_type,
@@ -44,6 +44,7 @@ struct ref_eltwise_fwd_t : public primitive_impl_t {
                     && utils::one_of(desc()->prop_kind,
                             prop_kind::forward_training,
                             prop_kind::forward_inference)
+                    && !has_runtime_dims_or_strides()
                     && utils::one_of(desc()->alg_kind, alg_kind::eltwise_relu,
                             alg_kind::eltwise_linear,
                             alg_kind::eltwise_bounded_relu,
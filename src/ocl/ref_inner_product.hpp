@@ -53,6 +53,7 @@ struct ref_inner_product_fwd_t : public primitive_impl_t {
             bool ok = true
                     && utils::one_of(desc()->prop_kind, forward_training,
                             forward_inference)
+                    && !has_runtime_dims_or_strides()
                     && set_default_params() == status::success
                     && utils::one_of(true,
                             expect_data_types(
@@ -42,7 +42,7 @@ struct ref_layer_normalization_fwd_t : public primitive_impl_t {
             auto src_data_t = src_md()->data_type;
             auto dst_data_t = dst_md()->data_type;
 
-            bool ok = is_fwd()
+            bool ok = is_fwd() && !has_runtime_dims_or_strides()
                     && (utils::everyone_is(f16, src_data_t, dst_data_t)
                             || utils::everyone_is(bf16, src_data_t, dst_data_t)
                             || utils::everyone_is(f32, src_data_t, dst_data_t))
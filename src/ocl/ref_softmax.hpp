@@ -48,6 +48,7 @@ struct ref_softmax_fwd_t : public primitive_impl_t {
                     && utils::one_of(desc()->prop_kind,
                             prop_kind::forward_inference,
                             prop_kind::forward_training)
+                    && !has_runtime_dims_or_strides()
                     && utils::one_of(desc()->data_desc.data_type,
                             data_type::f32, data_type::f16, data_type::bf16)
                     && IMPLICATION(
@@ -113,6 +113,9 @@ struct _ref_rnn_common_t : public primitive_impl_t {
             bool ok = true
                     && one_of(cell_kind, alg_kind::vanilla_rnn,
                             alg_kind::vanilla_lstm)
+                    && !memory_desc_wrapper(this->src_md(0))
+                                .has_runtime_dims_or_strides()
+                    && !this->with_seq_lengths()
                     && IMPLICATION(aprop == prop_kind::forward,
                             one_of(this->desc()->prop_kind, forward_training,
                                     forward_inference))
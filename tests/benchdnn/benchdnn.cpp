@@ -32,6 +32,7 @@
 #include "conv/conv.hpp"
 #include "conv/deconv.hpp"
 #include "eltwise/eltwise.hpp"
+#include "gemm_tune/gemm_tune.hpp"
 #include "ip/ip.hpp"
 #include "lnorm/lnorm.hpp"
 #include "lrn/lrn.hpp"
@@ -92,6 +93,8 @@ int main(int argc, char **argv) {
             prim = CONCAT;
         else if (!strcmp("--lrn", argv[0]))
             prim = LRN;
+        else if (!strcmp("--gemm_tune", argv[0]))
+            prim = GEMM_TUNE;
         else
             break;
     }
@@ -115,6 +118,7 @@ int main(int argc, char **argv) {
         case ELTWISE: eltwise::bench(argc, argv); break;
         case CONCAT: concat::bench(argc, argv); break;
         case LRN: lrn::bench(argc, argv); break;
+        case GEMM_TUNE: gemm_tune::bench(argc, argv); break;
         default: fprintf(stderr, "err: unknown driver\n");
     }
 
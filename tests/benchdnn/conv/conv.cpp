@@ -91,7 +91,7 @@ inline bool post_ops_require_integral_check(const prb_t *p) {
 
 inline double get_eps(const prb_t *p, const data_kind_t kind) {
     // Winograd specifics
-    if (p->alg & WINO && p->dir & FLAG_WEI) {
+    if (p->alg == WINO && p->dir & FLAG_WEI) {
         /*This is an empirical equation derived by observing growth error
           with increasing 'k' dimension in gemm of winograd*/
         return p->cfg[kind].eps
@@ -109,11 +109,12 @@ inline void get_result(const prb_t *p, const data_kind_t kind, res_t *r,
         const diff_norm_t diff_norm) {
     const float eps = get_eps(p, kind);
 
-    /* Ignoring element-wise errors for Winograd and in some cases of post-ops,
-     * since large relative error in few elements (which are anyways close
-     * to zero) results in false positive failures */
+    /* Ignoring element-wise errors for Winograd, FFT and in some cases of
+     * post-ops, since large relative error in few elements (which are anyways
+     * close to zero) results in false positive failures */
 
-    bool wino_test = (p->alg & WINO) && diff_norm.rel_diff(norm_t::L2) <= eps;
+    bool wino_test = (p->alg == WINO || p->alg == FFT)
+            && diff_norm.rel_diff(norm_t::L2) <= eps;
     if (wino_test) r->errors = 0;
 
     bool post_ops_test = post_ops_require_integral_check(p)
@@ -125,8 +126,8 @@ inline void get_result(const prb_t *p, const data_kind_t kind, res_t *r,
 
 inline int compare_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
         dnn_mem_t &mem_fp, res_t *r, bool final_compare = false) {
-    const bool dont_complain
-            = false || (p->alg & WINO) || post_ops_require_integral_check(p);
+    const bool dont_complain = false || p->alg == WINO || p->alg == FFT
+            || post_ops_require_integral_check(p);
 
     const auto nelems = mem_dt.nelems();
 
@@ -487,6 +488,7 @@ inline int init_pd(const prb_t *p, dnnl_convolution_desc_t &cd,
     dnnl_alg_kind_t alg = dnnl_convolution_direct;
     if (p->alg == WINO) alg = dnnl_convolution_winograd;
     if (p->alg == AUTO) alg = dnnl_convolution_auto;
+    if (p->alg == FFT) alg = dnnl_convolution_fft;
 
     switch (p->dir) {
         case FWD_D:
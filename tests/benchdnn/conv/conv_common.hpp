@@ -37,7 +37,7 @@ extern bool allow_unimpl; /* true means do not treat unimplemented as error */
 
 namespace conv {
 
-enum alg_t { DIRECT, WINO, AUTO };
+enum alg_t { DIRECT, WINO, AUTO, FFT };
 alg_t str2alg(const char *str);
 const char *alg2str(alg_t alg);
 alg_t alg_kind2alg(dnnl_alg_kind_t alg);
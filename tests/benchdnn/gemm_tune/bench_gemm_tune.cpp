@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sstream>
+
+#include "dnnl.h"
+
+#include "src/common/dnnl_thread.hpp"
+
+#include "dnnl_common.hpp"
+#include "parser.hpp"
+
+#include "gemm_tune/gemm_tune.hpp"
+
+namespace gemm_tune {
+
+std::vector<std::string> dt {"f32"};
+std::vector<std::string> trans {"NN"};
+const char *profile = "dnnl_gemm_profile.txt";
+
+void reset_parameters() {
+    dt = {"f32"};
+    trans = {"NN"};
+}
+
+static std::string str2trans(const char *str) {
+    const std::string s = str;
+    const std::string valid = "NnTt";
+    if (s.size() != 2 || valid.find(s[0]) == std::string::npos
+            || valid.find(s[1]) == std::string::npos)
+        SAFE_V(FAIL);
+    return std::string {(char)toupper(s[0]), (char)toupper(s[1])};
+}
+
+static int64_t m, n, k;
+
+static void parse_mnk(const char *str) {
+    long long lm, ln, lk;
+    if (sscanf(str, "%lldx%lldx%lld", &lm, &ln, &lk) != 3 || lm <= 0
+            || ln <= 0 || lk <= 0) {
+        fprintf(stderr, "driver: can't parse problem `%s`\n", str);
+        exit(2);
+    }
+    m = lm;
+    n = ln;
+    k = lk;
+}
+
+void check_correctness() {
+    for_(const auto &i_dt : dt)
+    for (const auto &i_trans : trans) {
+        const prb_t p(i_dt, i_trans, m, n, k, dnnl_get_max_threads());
+        std::stringstream ss;
+        ss << p;
+        const std::string cpp_pstr = ss.str();
+        const char *pstr = cpp_pstr.c_str();
+        print(1, "run: %s\n", pstr);
+
+        res_t res {};
+        int status = doit(&p, &res);
+
+        bool want_perf_report = false;
+        parse_result(res, want_perf_report, false, status, pstr);
+
+        benchdnn_stat.tests++;
+    }
+}
+
+int bench(int argc, char **argv) {
+    driver_name = "gemm_tune";
+    using namespace parser;
+    for (; argc > 0; --argc, ++argv) {
+        const bool parsed_options = false || parse_bench_settings(argv[0])
+                || parse_batch(bench, argv[0])
+                || parse_vector_option(
+                        dt, [](const char *s) { return std::string(s); },
+                        argv[0], "dt")
+                || parse_vector_option(trans, str2trans, argv[0], "trans")
+                || parse_single_value_option(profile,
+                        [](const char *s) { return s; }, argv[0], "profile")
+                || parse_reset(reset_parameters, argv[0]);
+        if (!parsed_options) {
+            catch_unknown_options(argv[0]);
+
+            parse_mnk(argv[0]);
+            check_correctness();
+        }
+    }
+
+    return parse_last_argument();
+}
+
+} // namespace gemm_tune
@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dnnl.h"
+
+#include "dnnl_common.hpp"
+
+#include "gemm_tune/gemm_tune.hpp"
+
+namespace gemm_tune {
+
+// The tuned entries of all the problems, in the order they were tuned
+static std::vector<std::string> entries;
+
+static int64_t lda(const prb_t *p) {
+    return p->transa == 'N' ? p->m : p->k;
+}
+static int64_t ldb(const prb_t *p) {
+    return p->transb == 'N' ? p->k : p->n;
+}
+
+// The problems are column-major while the API is row-major: the latter
+// computes C**T = op(B)**T * op(A)**T, which is the same GEMM for the driver.
+static dnnl_status_t call_gemm(
+        const prb_t *p, const float *a, const float *b, float *c) {
+    return dnnl_sgemm(p->transb, p->transa, p->n, p->m, p->k, 1.f, b, ldb(p),
+            a, lda(p), 0.f, c, p->m);
+}
+
+static dnnl_status_t call_gemm(
+        const prb_t *p, const int8_t *a, const uint8_t *b, int32_t *c) {
+    const int32_t co = 0;
+    return dnnl_gemm_u8s8s32(p->transb, p->transa, 'F', p->n, p->m, p->k, 1.f,
+            b, ldb(p), 0, a, lda(p), 0, 0.f, c, p->m, &co);
+}
+
+static dnnl_status_t call_gemm(
+        const prb_t *p, const int8_t *a, const int8_t *b, int32_t *c) {
+    const int32_t co = 0;
+    return dnnl_gemm_s8s8s32(p->transb, p->transa, 'F', p->n, p->m, p->k, 1.f,
+            b, ldb(p), 0, a, lda(p), 0, 0.f, c, p->m, &co);
+}
+
+// Makes the library use the threading for the problem, or its default one
+// if t is NULL
+static int set_threading(const prb_t *p, const threading_t *t) {
+    if (t == NULL) {
+        DNN_SAFE(dnnl_set_gemm_profile(NULL), WARN);
+        return OK;
+    }
+
+    const std::string path = std::string(profile) + ".tmp";
+    FILE *f = fopen(path.c_str(), "w");
+    if (!f) return FAIL;
+    fprintf(f, "%s\n", entry2str(p, *t).c_str());
+    fclose(f);
+
+    dnnl_status_t st = dnnl_set_gemm_profile(path.c_str());
+    remove(path.c_str());
+    DNN_SAFE(st, WARN);
+    return OK;
+}
+
+// Runs the problem with the threading and checks that the result matches
+// the reference one, if any. The inputs are small integers, so that the
+// result is exact whatever the order of the summation is.
+template <typename a_t, typename b_t, typename c_t>
+static int measure(const prb_t *p, const threading_t *t, const a_t *a,
+        const b_t *b, c_t *c, const c_t *c_ref, benchdnn_timer_t &timer,
+        res_t *r) {
+    SAFE(set_threading(p, t), WARN);
+
+    // the first run warms up the caches and generates the kernels
+    DNN_SAFE(call_gemm(p, a, b, c), WARN);
+
+    if (c_ref) {
+        for (int64_t i = 0; i < p->m * p->n; i++) {
+            if (c[i] == c_ref[i]) continue;
+            r->errors++;
+            if (r->errors < 10 || verbose >= 10)
+                print(0, "[%lld] %s ref:%g got:%g\n", (long long)i,
+                        entry2str(p, *t).c_str(), (double)c_ref[i],
+                        (double)c[i]);
+        }
+        if (r->errors) return r->state = FAILED, FAIL;
+    }
+
+    const int times = fix_times_per_prb ? fix_times_per_prb : min_times_per_prb;
+    timer.reset();
+    for (int i = 0; i < times; i++) {
+        DNN_SAFE(call_gemm(p, a, b, c), WARN);
+        timer.stamp();
+    }
+    return OK;
+}
+
+static std::vector<threading_t> partition_candidates(const prb_t *p) {
+    std::vector<threading_t> v;
+    const int nthr = p->nthr;
+    auto add = [&](int nthrs_m, int nthrs_n, int nthrs_k, const char *partition,
+                       const char *copy) {
+        v.push_back({nthrs_m, nthrs_n, nthrs_k, partition, copy, -1, -1, -1});
+    };
+
+    add(nthr, 1, 1, "row_1d", "nonshared");
+    if (nthr == 1) {
+        // the partition does not matter, only the copy does
+        if (p->dt == "f32") add(1, 1, 1, "mnk_3d", "no_copy");
+        return v;
+    }
+
+    add(1, nthr, 1, "col_1d", "nonshared");
+    add(1, nthr, 1, "col_1d", "shared_a");
+    for (int nm = 2; nm < nthr; nm++)
+        if (nthr % nm == 0) add(nm, nthr / nm, 1, "col_major_2d", "nonshared");
+
+    for (int nk = 1; nk <= 4; nk++) {
+        if (nthr % nk) continue;
+        for (int nm = 1; nm <= nthr / nk; nm++) {
+            if ((nthr / nk) % nm) continue;
+            const int nn = nthr / nk / nm;
+            add(nm, nn, nk, "mnk_3d", "nonshared");
+            if (p->dt == "f32") add(nm, nn, nk, "mnk_3d", "no_copy");
+        }
+    }
+    return v;
+}
+
+template <typename a_t, typename b_t, typename c_t>
+static int tune(const prb_t *p, res_t *r) {
+    const int64_t a_size = lda(p) * (p->transa == 'N' ? p->k : p->m);
+    const int64_t b_size = ldb(p) * (p->transb == 'N' ? p->n : p->k);
+    const int64_t c_size = p->m * p->n;
+
+    auto a = (a_t *)zmalloc(sizeof(a_t) * a_size, 64);
+    auto b = (b_t *)zmalloc(sizeof(b_t) * b_size, 64);
+    auto c = (c_t *)zmalloc(sizeof(c_t) * c_size, 64);
+    auto c_ref = (c_t *)zmalloc(sizeof(c_t) * c_size, 64);
+    auto cleanup = [&]() {
+        zfree(a);
+        zfree(b);
+        zfree(c);
+        zfree(c_ref);
+        dnnl_set_gemm_profile(NULL);
+    };
+    if (!a || !b || !c || !c_ref) SAFE_CLEAN(FAIL, WARN, cleanup);
+
+    // u8 values are kept non-negative, the others are in [-1, 1]
+    const int shift = std::is_unsigned<b_t>::value;
+    for (int64_t i = 0; i < a_size; i++)
+        a[i] = (a_t)((i * 7) % 3 - 1);
+    for (int64_t i = 0; i < b_size; i++)
+        b[i] = (b_t)((i * 5) % 3 - 1 + shift);
+
+    benchdnn_timer_t timer;
+    SAFE_CLEAN(measure(p, (const threading_t *)NULL, a, b, c_ref,
+                       (const c_t *)NULL, timer, r),
+            WARN, cleanup);
+    const double default_ms = timer.ms();
+    double best_ms = default_ms;
+    threading_t best = {0, 0, 0, NULL, NULL, -1, -1, -1};
+    r->timer = timer;
+
+    auto try_threading = [&](const threading_t &t) {
+        SAFE(measure(p, &t, a, b, c, c_ref, timer, r), WARN);
+        print(2, "%s: %g ms\n", entry2str(p, t).c_str(), timer.ms());
+        if (timer.ms() < best_ms) {
+            best_ms = timer.ms();
+            best = t;
+            r->timer = timer;
+        }
+        return OK;
+    };
+
+    for (const auto &t : partition_candidates(p))
+        SAFE_CLEAN(try_threading(t), WARN, cleanup);
+
+    // Refine the block sizes of the best partition one dimension at a time.
+    // The no-copy kernels do their own blocking.
+    const std::string no_copy = "no_copy";
+    if (best.partition && best.copy != no_copy) {
+        const int blocks[] = {64, 128, 192, 256, 384, 512, 768, 1024, 2048,
+                3072, 4096};
+        const int64_t sizes[] = {p->k, p->m, p->n};
+        auto block = [](threading_t &t, int d) -> int & {
+            return d == 0 ? t.block_k : d == 1 ? t.block_m : t.block_n;
+        };
+        for (int d = 0; d < 3; d++) {
+            threading_t t = best;
+            for (int blk : blocks) {
+                if (blk >= 2 * sizes[d]) break;
+                block(t, d) = blk;
+                SAFE_CLEAN(try_threading(t), WARN, cleanup);
+            }
+        }
+    }
+
+    if (best.partition) {
+        entries.push_back(entry2str(p, best));
+        print(0, "tuned: %s default:%g ms best:%g ms\n",
+                entries.back().c_str(), default_ms, best_ms);
+    } else
+        print(0, "tuned: the default threading is the best, %g ms\n",
+                default_ms);
+
+    cleanup();
+    return OK;
+}
+
+static int write_profile() {
+    FILE *f = fopen(profile, "w");
+    if (!f) return FAIL;
+    fprintf(f, "# DNNL GEMM tuning profile, see the gemm_tune driver of "
+               "benchdnn\n");
+    for (const auto &e : entries)
+        fprintf(f, "%s\n", e.c_str());
+    fclose(f);
+    return OK;
+}
+
+int doit(const prb_t *p, res_t *r) {
+    if (p->dt == "f32")
+        SAFE((tune<float, float, float>(p, r)), WARN);
+    else if (p->dt == "s8u8")
+        SAFE((tune<int8_t, uint8_t, int32_t>(p, r)), WARN);
+    else if (p->dt == "s8s8")
+        SAFE((tune<int8_t, int8_t, int32_t>(p, r)), WARN);
+    else
+        return r->state = UNIMPLEMENTED, OK;
+
+    r->state = PASSED;
+    return write_profile();
+}
+
+} // namespace gemm_tune
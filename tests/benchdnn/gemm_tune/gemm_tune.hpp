@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GEMM_TUNE_HPP
+#define GEMM_TUNE_HPP
+
+#include <stdint.h>
+
+#include <iostream>
+#include <string>
+
+#include "common.hpp"
+
+namespace gemm_tune {
+
+// A column-major GEMM problem, as seen by the GEMM driver of the library:
+// C(m x n) = op(A)(m x k) * op(B)(k x n)
+struct prb_t {
+    prb_t(const std::string &dt, const std::string &trans, int64_t m,
+            int64_t n, int64_t k, int nthr)
+        : dt(dt)
+        , transa(trans[0])
+        , transb(trans[1])
+        , m(m)
+        , n(n)
+        , k(k)
+        , nthr(nthr) {}
+
+    std::string dt; // f32, s8u8 or s8s8: the types of A and B
+    char transa, transb;
+    int64_t m, n, k;
+    int nthr;
+
+    BENCHDNN_DISALLOW_COPY_AND_ASSIGN(prb_t);
+};
+std::ostream &operator<<(std::ostream &s, const prb_t &p);
+
+// A threading of the GEMM driver, in the terms of the tuning profile
+struct threading_t {
+    int nthrs_m, nthrs_n, nthrs_k;
+    const char *partition;
+    const char *copy;
+    int block_m, block_n, block_k;
+};
+
+// Returns the profile line of the problem solved with the threading
+std::string entry2str(const prb_t *p, const threading_t &t);
+
+// The file the tuned entries are written to
+extern const char *profile;
+
+int doit(const prb_t *p, res_t *res);
+int bench(int argc, char **argv);
+
+} // namespace gemm_tune
+
+#endif
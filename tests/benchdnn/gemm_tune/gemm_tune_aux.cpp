@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+
+#include "dnn_types.hpp"
+#include "gemm_tune/gemm_tune.hpp"
+
+namespace gemm_tune {
+
+std::ostream &operator<<(std::ostream &s, const prb_t &p) {
+    dump_global_params(s);
+
+    if (p.dt != "f32") s << "--dt=" << p.dt << " ";
+    if (p.transa != 'N' || p.transb != 'N')
+        s << "--trans=" << p.transa << p.transb << " ";
+
+    s << p.m << "x" << p.n << "x" << p.k;
+
+    return s;
+}
+
+std::string entry2str(const prb_t *p, const threading_t &t) {
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+            "%s %c %c %lld %lld %lld %d %d %d %d %s %s %d %d %d",
+            p->dt.c_str(), p->transa, p->transb, (long long)p->m,
+            (long long)p->n, (long long)p->k, p->nthr, t.nthrs_m, t.nthrs_n,
+            t.nthrs_k, t.partition, t.copy, t.block_m, t.block_n, t.block_k);
+    return buf;
+}
+
+} // namespace gemm_tune
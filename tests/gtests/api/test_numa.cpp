@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace dnnl {
+
+TEST(numa_test, SetPolicy) {
+    ASSERT_EQ(dnnl_set_numa_policy((dnnl_numa_policy_t)-1),
+            dnnl_invalid_arguments);
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+    const memory::dim N = 1000;
+    memory::desc md({N}, memory::data_type::f32, memory::format_tag::x);
+
+    for (auto policy :
+            {dnnl_numa_interleave, dnnl_numa_local, dnnl_numa_first_touch}) {
+        DNNL_CHECK(dnnl_set_numa_policy(policy));
+        memory src(md, eng), dst(md, eng);
+        float *s = src.map_data<float>();
+        std::iota(s, s + N, 1.f);
+        src.unmap_data(s);
+
+        reorder(src, dst).execute(strm, src, dst);
+        strm.wait();
+
+        float *d = dst.map_data<float>();
+        for (memory::dim i = 0; i < N; i++)
+            ASSERT_EQ(d[i], (float)(i + 1));
+        dst.unmap_data(d);
+    }
+}
+
+TEST(numa_test, ReplicatedWeights) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc src_md({2, 16, 10, 10}, dt::f32, tag::nchw);
+    memory::desc user_wei_md({32, 16, 3, 3}, dt::f32, tag::oihw);
+    memory::desc any_wei_md({32, 16, 3, 3}, dt::f32, tag::any);
+    memory::desc dst_md({2, 32, 10, 10}, dt::f32, tag::nchw);
+    auto conv_pd = convolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    src_md, any_wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}},
+            eng);
+    convolution_forward conv(conv_pd);
+
+    memory src(src_md, eng), user_wei(user_wei_md, eng);
+    fill_data<float>(src_md.get_size() / sizeof(float), src);
+    fill_data<float>(user_wei_md.get_size() / sizeof(float), user_wei);
+
+    // The weights are reordered to a plain and to a replicated memory
+    memory wei(conv_pd.weights_desc(), eng);
+    memory rep_wei(
+            conv_pd.weights_desc(), eng, DNNL_MEMORY_ALLOCATE_REPLICATED);
+    reorder(user_wei, wei).execute(strm, user_wei, wei);
+    reorder(user_wei, rep_wei).execute(strm, user_wei, rep_wei);
+
+    memory dst(dst_md, eng), rep_dst(dst_md, eng);
+    conv.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    conv.execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, rep_wei},
+                    {DNNL_ARG_DST, rep_dst}});
+    strm.wait();
+
+    auto d = map_memory<float>(dst);
+    auto r = map_memory<float>(rep_dst);
+    const size_t n = dst_md.get_size() / sizeof(float);
+    for (size_t i = 0; i < n; i++)
+        ASSERT_EQ(d[i], r[i]);
+}
+
+} // namespace dnnl
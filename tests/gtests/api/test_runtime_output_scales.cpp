@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.h"
+
+#include <vector>
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+TEST(runtime_output_scales_test, Attributes) {
+    dnnl_primitive_attr_t attr;
+    DNNL_CHECK(dnnl_primitive_attr_create(&attr));
+
+    // A runtime value stands for all the scales
+    const float rt_scales[2] = {DNNL_RUNTIME_F32_VAL, DNNL_RUNTIME_F32_VAL};
+    ASSERT_EQ(dnnl_primitive_attr_set_output_scales(attr, 2, 1 << 1, rt_scales),
+            dnnl_invalid_arguments);
+    DNNL_CHECK(
+            dnnl_primitive_attr_set_output_scales(attr, 1, 1 << 1, rt_scales));
+
+    // The post-ops scales are the creation-time ones
+    dnnl_post_ops_t ops;
+    DNNL_CHECK(dnnl_post_ops_create(&ops));
+    ASSERT_EQ(dnnl_post_ops_append_sum(ops, DNNL_RUNTIME_F32_VAL),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_post_ops_append_eltwise(
+                      ops, DNNL_RUNTIME_F32_VAL, dnnl_eltwise_relu, 0.f, 0.f),
+            dnnl_invalid_arguments);
+    DNNL_CHECK(dnnl_post_ops_destroy(ops));
+
+    DNNL_CHECK(dnnl_primitive_attr_destroy(attr));
+}
+
+TEST(runtime_output_scales_test, Reorder) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    memory::desc src_md({2, 16, 5, 5}, dt::f32, tag::nchw);
+    memory::desc dst_md({2, 16, 5, 5}, dt::s8, tag::nhwc);
+    memory src(src_md, eng), dst(dst_md, eng), rt_dst(dst_md, eng);
+    fill_data<float>(src_md.get_size() / sizeof(float), src);
+
+    std::vector<float> scales(16);
+    for (size_t c = 0; c < scales.size(); c++)
+        scales[c] = 0.5f + c;
+
+    primitive_attr attr, rt_attr;
+    attr.set_output_scales(1 << 1, scales);
+    rt_attr.set_output_scales(1 << 1, {DNNL_RUNTIME_F32_VAL});
+
+    memory::desc scales_md({16}, dt::f32, tag::x);
+    memory scales_mem(scales_md, eng, scales.data());
+
+    reorder(reorder::primitive_desc(src, dst, attr)).execute(strm, src, dst);
+    reorder rt_reorder(reorder::primitive_desc(src, rt_dst, rt_attr));
+    rt_reorder.execute(strm,
+            {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, rt_dst},
+                    {DNNL_ARG_ATTR_OUTPUT_SCALES, scales_mem}});
+    strm.wait();
+
+    auto d = map_memory<int8_t>(dst);
+    auto r = map_memory<int8_t>(rt_dst);
+    const size_t n = dst_md.get_size();
+    for (size_t i = 0; i < n; i++)
+        ASSERT_EQ(d[i], r[i]);
+
+    // The scales are required and checked at the execution
+    memory::desc bad_scales_md({8}, dt::f32, tag::x);
+    memory bad_scales(bad_scales_md, eng);
+    EXPECT_ANY_THROW(rt_reorder.execute(
+            strm, {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, rt_dst}}));
+    EXPECT_ANY_THROW(rt_reorder.execute(strm,
+            {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, rt_dst},
+                    {DNNL_ARG_ATTR_OUTPUT_SCALES, bad_scales}}));
+}
+
+TEST(runtime_output_scales_test, Convolution) {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    const memory::dim OC = 32;
+    memory::desc src_md({2, 16, 8, 8}, dt::u8, tag::nhwc);
+    memory::desc user_wei_md({OC, 16, 3, 3}, dt::s8, tag::oihw);
+    memory::desc any_wei_md({OC, 16, 3, 3}, dt::s8, tag::any);
+    memory::desc dst_md({2, OC, 8, 8}, dt::s32, tag::nhwc);
+    convolution_forward::desc cd(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, any_wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+
+    std::vector<float> scales(OC);
+    for (memory::dim oc = 0; oc < OC; oc++)
+        scales[oc] = 0.25f * (oc % 5 + 1);
+
+    primitive_attr attr, rt_attr;
+    attr.set_output_scales(1 << 1, scales);
+    rt_attr.set_output_scales(1 << 1, {DNNL_RUNTIME_F32_VAL});
+
+    convolution_forward::primitive_desc conv_pd(cd, attr, eng);
+    convolution_forward::primitive_desc rt_conv_pd(cd, rt_attr, eng);
+    ASSERT_TRUE(rt_conv_pd.weights_desc() == conv_pd.weights_desc());
+
+    memory src(src_md, eng), user_wei(user_wei_md, eng);
+    fill_data<uint8_t>(src_md.get_size(), src);
+    fill_data<int8_t>(user_wei_md.get_size(), user_wei);
+    memory wei(conv_pd.weights_desc(), eng);
+    reorder(user_wei, wei).execute(strm, user_wei, wei);
+
+    memory::desc scales_md({OC}, dt::f32, tag::x);
+    memory scales_mem(scales_md, eng, scales.data());
+
+    memory dst(dst_md, eng), rt_dst(dst_md, eng);
+    convolution_forward(conv_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    convolution_forward(rt_conv_pd)
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                            {DNNL_ARG_DST, rt_dst},
+                            {DNNL_ARG_ATTR_OUTPUT_SCALES, scales_mem}});
+    strm.wait();
+
+    auto d = map_memory<int32_t>(dst);
+    auto r = map_memory<int32_t>(rt_dst);
+    const size_t n = dst_md.get_size() / sizeof(int32_t);
+    for (size_t i = 0; i < n; i++)
+        ASSERT_EQ(d[i], r[i]);
+}
+
+} // namespace dnnl
@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <thread>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -46,4 +49,66 @@ TEST(stream_test_cpp, Wait) {
     s.wait();
 }
 
+// The scratchpad belongs to the stream, so a primitive can be executed on
+// several streams at once
+TEST(stream_test_cpp, ConcurrentExecution) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(engine::kind::cpu, 0);
+    memory::desc src_md({2, 8, 12, 12}, dt::f32, tag::nchw);
+    memory::desc wei_md({16, 8, 3, 3}, dt::f32, tag::oihw);
+    memory::desc dst_md({2, 16, 12, 12}, dt::f32, tag::nchw);
+    auto conv_pd = convolution_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::convolution_direct,
+                    src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}},
+            eng);
+    convolution_forward conv(conv_pd);
+
+    memory wei(wei_md, eng);
+    auto w = map_memory<float>(wei);
+    for (size_t i = 0; i < wei_md.get_size() / sizeof(float); i++)
+        w[i] = (float)((i * 7) % 5) - 2.f;
+
+    const int nthreads = 4;
+    const size_t nsrc = src_md.get_size() / sizeof(float);
+    const size_t ndst = dst_md.get_size() / sizeof(float);
+    std::vector<memory> src, dst, ref;
+    for (int t = 0; t < nthreads; t++) {
+        src.emplace_back(src_md, eng);
+        dst.emplace_back(dst_md, eng);
+        ref.emplace_back(dst_md, eng);
+        auto s = map_memory<float>(src[t]);
+        for (size_t i = 0; i < nsrc; i++)
+            s[i] = (float)((i * (t + 3)) % 11) - 5.f;
+    }
+
+    stream main_stream(eng);
+    for (int t = 0; t < nthreads; t++)
+        conv.execute(main_stream,
+                {{DNNL_ARG_SRC, src[t]}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, ref[t]}});
+    main_stream.wait();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nthreads; t++)
+        threads.emplace_back([&, t]() {
+            stream s(eng);
+            for (int i = 0; i < 20; i++)
+                conv.execute(s,
+                        {{DNNL_ARG_SRC, src[t]}, {DNNL_ARG_WEIGHTS, wei},
+                                {DNNL_ARG_DST, dst[t]}});
+            s.wait();
+        });
+    for (auto &th : threads)
+        th.join();
+
+    for (int t = 0; t < nthreads; t++) {
+        auto d = map_memory<float>(dst[t]);
+        auto r = map_memory<float>(ref[t]);
+        for (size_t i = 0; i < ndst; i++)
+            ASSERT_NEAR(d[i], r[i], 1e-4f * (1.f + std::abs(r[i])));
+    }
+}
+
 } // namespace dnnl
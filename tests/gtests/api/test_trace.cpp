@@ -0,0 +1,109 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.h"
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace dnnl {
+
+namespace {
+// The event strings are only valid during the callback
+std::vector<dnnl_trace_event_t> events;
+std::vector<std::string> infos, impl_names;
+
+void collect(const dnnl_trace_event_t *event, void *user_data) {
+    (*(int *)user_data)++;
+    events.push_back(*event);
+    infos.push_back(event->info);
+    impl_names.push_back(event->impl_name);
+}
+} // namespace
+
+TEST(trace_test_c, VisitNullCallback) {
+    ASSERT_EQ(dnnl_trace_visit(nullptr, nullptr), dnnl_invalid_arguments);
+}
+
+TEST(trace_test_cpp, CreateAndExecute) {
+    engine eng(engine::kind::cpu, 0);
+    stream s(eng);
+
+    memory::desc md({2, 16}, memory::data_type::f32, memory::format_tag::nc);
+    memory src(md, eng), dst(md, eng);
+    auto relu_d = eltwise_forward::desc(prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, 0.f);
+    auto relu_pd = eltwise_forward::primitive_desc(relu_d, eng);
+
+    DNNL_CHECK(dnnl_trace_clear());
+    DNNL_CHECK(dnnl_set_trace(1));
+
+    eltwise_forward relu(relu_pd);
+    for (int i = 0; i < 2; i++)
+        relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    s.wait();
+    eltwise_forward relu_again(relu_pd); // the primitive cache has it
+
+    DNNL_CHECK(dnnl_set_trace(0));
+    relu.execute(s, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+
+    events.clear();
+    infos.clear();
+    impl_names.clear();
+    int count = 0;
+    DNNL_CHECK(dnnl_trace_visit(collect, &count));
+    ASSERT_EQ(count, 4);
+    ASSERT_EQ(events.size(), 4U);
+
+    const dnnl_trace_event_kind_t kinds[] = {dnnl_trace_event_create,
+            dnnl_trace_event_exec, dnnl_trace_event_exec,
+            dnnl_trace_event_create};
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(events[i].kind, kinds[i]);
+        ASSERT_EQ(events[i].engine_kind, dnnl_cpu);
+        ASSERT_EQ(events[i].thread_id, events[0].thread_id);
+        ASSERT_LE(events[i].start_us, events[i].end_us);
+        ASSERT_EQ(events[i].flops, 0); // eltwise is memory-bound
+        ASSERT_EQ(events[i].bytes, 2 * 2 * 16 * (dnnl_dim_t)sizeof(float));
+        ASSERT_EQ(impl_names[i], relu_pd.impl_info_str());
+        ASSERT_EQ(infos[i].find("eltwise,"), 0U);
+    }
+    ASSERT_EQ(events[3].cache_hit, 1);
+
+    const char *path = "test_trace.json";
+    DNNL_CHECK(dnnl_trace_dump(path));
+    FILE *f = fopen(path, "r");
+    ASSERT_NE(f, nullptr);
+    std::string json;
+    char buf[256];
+    while (fgets(buf, sizeof(buf), f))
+        json += buf;
+    fclose(f);
+    remove(path);
+    ASSERT_EQ(json.find("{\"traceEvents\":["), 0U);
+    ASSERT_NE(json.find("\"cache\":\"hit\""), std::string::npos);
+
+    DNNL_CHECK(dnnl_trace_clear());
+    count = 0;
+    DNNL_CHECK(dnnl_trace_visit(collect, &count));
+    ASSERT_EQ(count, 0);
+}
+
+} // namespace dnnl
@@ -132,6 +132,13 @@ protected:
             Backward(prop_kind::backward, bf::use_scale_shift);
             Backward(prop_kind::backward,
                     bf::use_scale_shift | bf::use_global_stats);
+
+            // The fused addition is implemented on the CPU only
+            if (get_test_engine_kind() == engine::kind::cpu) {
+                ForwardBackwardAddRelu(prop_kind::backward_data);
+                ForwardBackwardAddRelu(
+                        prop_kind::backward, bf::use_scale_shift);
+            }
         } else if (isS8(data_type)) {
             Forward(inference, bf::use_global_stats);
             Forward(inference, bf::use_global_stats | bf::use_scale_shift);
@@ -211,6 +218,134 @@ protected:
         check_zero_tail<data_t>(0, diff_src->get());
     }
 
+    // Checks the fused addition and ReLU against the batch normalization
+    // without it, followed by the addition and ReLU computed here
+    void ForwardBackwardAddRelu(
+            prop_kind pk, normalization_flags flags = (normalization_flags)0u) {
+        bool useScaleShift
+                = (bool)(flags & normalization_flags::use_scale_shift);
+        const auto fused_flags
+                = flags | normalization_flags::fuse_norm_add_relu;
+        const auto training = prop_kind::forward_training;
+
+        auto fused_fwd_pd = batch_normalization_forward::primitive_desc(
+                batch_normalization_forward::desc(
+                        training, *data_d, p.epsilon, fused_flags),
+                eng);
+        auto plain_fwd_pd = batch_normalization_forward::primitive_desc(
+                batch_normalization_forward::desc(
+                        training, *data_d, p.epsilon, flags),
+                eng);
+
+        test_memory src_1(*data_d, eng), fused_dst(*data_d, eng);
+        memory ws(fused_fwd_pd.workspace_desc(), eng);
+        weights = memory(fused_fwd_pd.weights_desc(), eng);
+        mean = memory(fused_fwd_pd.mean_desc(), eng);
+        variance = memory(fused_fwd_pd.variance_desc(), eng);
+        memory plain_mean(plain_fwd_pd.mean_desc(), eng);
+        memory plain_variance(plain_fwd_pd.variance_desc(), eng);
+
+        fill<data_t>(src->get());
+        fill<data_t>(src_1.get());
+        if (useScaleShift) fill<float>(weights);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src->get()},
+                {DNNL_ARG_SRC_1, src_1.get()},
+                {DNNL_ARG_DST, fused_dst.get()}, {DNNL_ARG_MEAN, mean},
+                {DNNL_ARG_VARIANCE, variance}, {DNNL_ARG_WORKSPACE, ws}};
+        if (useScaleShift) args.insert({DNNL_ARG_SCALE_SHIFT, weights});
+        batch_normalization_forward(fused_fwd_pd).execute(strm, args);
+
+        args[DNNL_ARG_DST] = dst->get();
+        args[DNNL_ARG_MEAN] = plain_mean;
+        args[DNNL_ARG_VARIANCE] = plain_variance;
+        args.erase(DNNL_ARG_SRC_1);
+        args.erase(DNNL_ARG_WORKSPACE);
+        batch_normalization_forward(plain_fwd_pd).execute(strm, args);
+        strm.wait();
+
+        const test_bnorm_sizes_t &bp = p.sizes;
+        const memory::dim nelems = bp.mb * bp.c * bp.d * bp.h * bp.w;
+        const float eps
+                = static_cast<float>(1.e-4 * bp.mb * bp.d * bp.h * bp.w);
+        const dnnl::impl::memory_desc_wrapper data_mdw(data_d->data);
+        const dnnl::impl::memory_desc_wrapper diff_mdw(diff_d->data);
+
+        auto check = [&](float out, float ref) {
+            float norm_max = std::max(std::abs(out), std::abs(ref));
+            if (norm_max < 1e-2) norm_max = 1.f;
+            ASSERT_NEAR((out - ref) / norm_max, 0., eps);
+        };
+
+        test_memory masked_diff_dst(*diff_d, eng);
+        {
+            auto s1 = map_memory<const data_t>(src_1.get());
+            auto fd = map_memory<const data_t>(fused_dst.get());
+            auto pdst = map_memory<const data_t>(dst->get());
+            auto dd = map_memory<data_t>(diff_dst->get());
+            auto mdd = map_memory<data_t>(masked_diff_dst.get());
+            for (memory::dim i = 0; i < nelems; i++) {
+                const auto d_off = data_mdw.off_l(i, false);
+                const auto dd_off = diff_mdw.off_l(i, false);
+                float ref = std::max(pdst[d_off] + s1[d_off], 0.f);
+                check(fd[d_off], ref);
+                dd[dd_off] = data_t(i % 7) - data_t(3);
+                mdd[dd_off] = fd[d_off] > 0 ? dd[dd_off] : data_t(0);
+            }
+        }
+
+        auto fused_bwd_pd = batch_normalization_backward::primitive_desc(
+                batch_normalization_backward::desc(
+                        pk, *diff_d, *data_d, p.epsilon, fused_flags),
+                eng, fused_fwd_pd);
+        auto plain_bwd_pd = batch_normalization_backward::primitive_desc(
+                batch_normalization_backward::desc(
+                        pk, *diff_d, *data_d, p.epsilon, flags),
+                eng, plain_fwd_pd);
+
+        test_memory diff_src_1(*diff_d, eng), fused_diff_src(*diff_d, eng);
+        diff_weights = memory(fused_bwd_pd.diff_weights_desc(), eng);
+        memory fused_diff_weights(fused_bwd_pd.diff_weights_desc(), eng);
+
+        args = {{DNNL_ARG_SRC, src->get()},
+                {DNNL_ARG_DIFF_DST, diff_dst->get()}, {DNNL_ARG_MEAN, mean},
+                {DNNL_ARG_VARIANCE, variance}, {DNNL_ARG_WORKSPACE, ws},
+                {DNNL_ARG_DIFF_SRC, fused_diff_src.get()},
+                {DNNL_ARG_DIFF_SRC_1, diff_src_1.get()}};
+        if (useScaleShift) {
+            args.insert({DNNL_ARG_SCALE_SHIFT, weights});
+            if (pk == prop_kind::backward)
+                args.insert({DNNL_ARG_DIFF_SCALE_SHIFT, fused_diff_weights});
+        }
+        batch_normalization_backward(fused_bwd_pd).execute(strm, args);
+
+        args[DNNL_ARG_DIFF_DST] = masked_diff_dst.get();
+        args[DNNL_ARG_DIFF_SRC] = diff_src->get();
+        if (args.count(DNNL_ARG_DIFF_SCALE_SHIFT))
+            args[DNNL_ARG_DIFF_SCALE_SHIFT] = diff_weights;
+        args.erase(DNNL_ARG_DIFF_SRC_1);
+        args.erase(DNNL_ARG_WORKSPACE);
+        batch_normalization_backward(plain_bwd_pd).execute(strm, args);
+        strm.wait();
+
+        auto fds = map_memory<const data_t>(fused_diff_src.get());
+        auto pds = map_memory<const data_t>(diff_src->get());
+        auto ds1 = map_memory<const data_t>(diff_src_1.get());
+        auto mdd = map_memory<const data_t>(masked_diff_dst.get());
+        for (memory::dim i = 0; i < nelems; i++) {
+            const auto dd_off = diff_mdw.off_l(i, false);
+            ASSERT_EQ(ds1[dd_off], mdd[dd_off]);
+            check(fds[dd_off], pds[dd_off]);
+        }
+
+        if (pk == prop_kind::backward && useScaleShift) {
+            auto fdw = map_memory<const float>(fused_diff_weights);
+            auto pdw = map_memory<const float>(diff_weights);
+            for (memory::dim c = 0; c < 2 * bp.c; c++)
+                check(fdw[c], pdw[c]);
+        }
+    }
+
     inline bool isF32(memory::data_type data_type) {
         return data_type == dnnl::memory::data_type::f32;
     }
@@ -0,0 +1,324 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <type_traits>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu_isa_traits.hpp"
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct binary_test_params {
+    algorithm alg;
+    memory::dims src0_dims;
+    memory::dims src1_dims;
+    tag src0_tag;
+    tag src1_tag;
+    bool with_relu;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+void check_binary(const binary_test_params &p, const memory &src0,
+        const memory &src1, const memory &dst) {
+    auto src0_ptr = map_memory<data_t>(src0);
+    auto src1_ptr = map_memory<data_t>(src1);
+    auto dst_ptr = map_memory<data_t>(dst);
+
+    const memory::desc src0_md = src0.get_desc();
+    const memory::desc src1_md = src1.get_desc();
+    const memory::desc dst_md = dst.get_desc();
+    const dnnl::impl::memory_desc_wrapper src0_mdw(src0_md.data);
+    const dnnl::impl::memory_desc_wrapper src1_mdw(src1_md.data);
+    const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.data);
+
+    const int ndims = (int)p.src0_dims.size();
+    memory::dim nelems = 1;
+    for (int d = 0; d < ndims; ++d)
+        nelems *= p.src0_dims[d];
+
+    const bool is_bf16 = data_traits<data_t>::data_type == dt::bf16;
+
+    dnnl::impl::parallel_nd(nelems, [&](memory::dim i) {
+        dnnl::impl::dims_t pos, pos1;
+        memory::dim rem = i;
+        for (int d = ndims - 1; d >= 0; --d) {
+            pos[d] = rem % p.src0_dims[d];
+            pos1[d] = p.src1_dims[d] == 1 ? 0 : pos[d];
+            rem /= p.src0_dims[d];
+        }
+
+        const float s0 = (float)src0_ptr[src0_mdw.off_v(pos)];
+        const float s1 = (float)src1_ptr[src1_mdw.off_v(pos1)];
+        float res = 0.f;
+        switch (p.alg) {
+            case algorithm::binary_add: res = s0 + s1; break;
+            case algorithm::binary_mul: res = s0 * s1; break;
+            case algorithm::binary_max: res = std::max(s0, s1); break;
+            case algorithm::binary_min: res = std::min(s0, s1); break;
+            default: ASSERT_TRUE(!"unknown binary algorithm");
+        }
+        if (p.with_relu && res < 0) res = 0;
+
+        const float out = (float)dst_ptr[dst_mdw.off_v(pos)];
+        float expected = res;
+        if (is_bf16)
+            expected = (float)bfloat16_t(res);
+        else if (std::is_integral<data_t>::value)
+            expected = (float)out_round<data_t>(saturate<data_t>(res));
+        const float eps = is_bf16 ? 1e-2f : 1e-6f;
+        ASSERT_NEAR(expected, out, eps * (1.f + std::fabs(expected)));
+    });
+}
+
+template <typename data_t>
+class binary_test : public ::testing::TestWithParam<binary_test_params> {
+protected:
+    virtual void SetUp() {
+        SKIP_IF(data_traits<data_t>::data_type == dt::bf16
+                        && get_test_engine_kind() == engine::kind::cpu
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "ISA does not support bf16 data type.");
+        auto p = ::testing::TestWithParam<binary_test_params>::GetParam();
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<binary_test_params>::GetParam();
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        const auto data_dt = data_traits<data_t>::data_type;
+        memory::desc src0_md(p.src0_dims, data_dt, p.src0_tag);
+        memory::desc src1_md(p.src1_dims, data_dt, p.src1_tag);
+        memory::desc dst_md(p.src0_dims, data_dt, tag::any);
+
+        primitive_attr attr;
+        if (p.with_relu) {
+            post_ops ops;
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+            attr.set_post_ops(ops);
+        }
+
+        auto binary_d = binary::desc(p.alg, src0_md, src1_md, dst_md);
+        auto binary_pd = binary::primitive_desc(binary_d, attr, eng);
+
+        // dst takes the layout of src0
+        ASSERT_TRUE(binary_pd.dst_desc() == src0_md);
+        ASSERT_TRUE(binary_pd.src0_desc() == src0_md);
+        ASSERT_TRUE(binary_pd.src1_desc() == src1_md);
+
+        auto src0 = memory(src0_md, eng);
+        auto src1 = memory(src1_md, eng);
+        auto dst = memory(binary_pd.dst_desc(), eng);
+
+        fill_data<data_t>(src0_md.get_size() / sizeof(data_t), src0);
+        fill_data<data_t>(src1_md.get_size() / sizeof(data_t), src1);
+        check_zero_tail<data_t>(1, src0);
+        check_zero_tail<data_t>(1, src1);
+
+        binary(binary_pd).execute(strm,
+                {{DNNL_ARG_SRC_0, src0}, {DNNL_ARG_SRC_1, src1},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        check_binary<data_t>(p, src0, src1, dst);
+        check_zero_tail<data_t>(0, dst);
+    }
+};
+
+using binary_test_f32 = binary_test<float>;
+using binary_test_bf16 = binary_test<bfloat16_t>;
+using binary_test_s8 = binary_test<int8_t>;
+using binary_test_u8 = binary_test<uint8_t>;
+
+#define PARAMS(...) binary_test_params {__VA_ARGS__, false, dnnl_success}
+#define EXPECT_FAIL(...) \
+    binary_test_params { __VA_ARGS__, true, dnnl_invalid_arguments }
+
+TEST_P(binary_test_f32, TestsBinary) {}
+INSTANTIATE_TEST_SUITE_P(TestBinaryF32, binary_test_f32,
+        ::testing::Values(
+                EXPECT_FAIL(algorithm::binary_add, {2, 16, 4, 4},
+                        {2, 8, 4, 4}, tag::nchw, tag::nchw, false),
+                EXPECT_FAIL(algorithm::binary_add, {2, 16, 4, 4},
+                        {2, 16, 4}, tag::nchw, tag::ncw, false),
+                EXPECT_FAIL(algorithm::binary_add, {2, 16, 4, 4},
+                        {2, 16, 4, 4}, tag::nchw, tag::any, false),
+                PARAMS(algorithm::binary_add, {2, 16, 5, 5}, {2, 16, 5, 5},
+                        tag::nchw, tag::nchw, false),
+                PARAMS(algorithm::binary_mul, {2, 17, 5, 5}, {2, 17, 5, 5},
+                        tag::nChw16c, tag::nChw16c, true),
+                PARAMS(algorithm::binary_max, {2, 16, 5, 5}, {2, 16, 5, 5},
+                        tag::nhwc, tag::nchw, false),
+                PARAMS(algorithm::binary_min, {3, 19, 3, 7}, {1, 1, 1, 1},
+                        tag::nchw, tag::nchw, false),
+                PARAMS(algorithm::binary_add, {3, 19, 3, 7}, {1, 19, 1, 1},
+                        tag::nchw, tag::nchw, true),
+                PARAMS(algorithm::binary_mul, {3, 19, 3, 7}, {3, 19, 1, 1},
+                        tag::nhwc, tag::nchw, false),
+                PARAMS(algorithm::binary_add, {3, 19, 3, 7}, {1, 19, 1, 1},
+                        tag::nChw16c, tag::nchw, true),
+                PARAMS(algorithm::binary_max, {3, 21, 2, 3, 7},
+                        {3, 1, 1, 1, 1}, tag::nCdhw8c, tag::ncdhw, false),
+                PARAMS(algorithm::binary_add, {7, 33}, {1, 33}, tag::nc,
+                        tag::nc, true),
+                PARAMS(algorithm::binary_add, {3, 19, 3, 7}, {1, 19, 3, 1},
+                        tag::nchw, tag::nchw, false),
+                PARAMS(algorithm::binary_mul, {37}, {1}, tag::x, tag::x,
+                        false)));
+
+TEST_P(binary_test_bf16, TestsBinary) {}
+INSTANTIATE_TEST_SUITE_P(TestBinaryBf16, binary_test_bf16,
+        ::testing::Values(PARAMS(algorithm::binary_add, {2, 17, 5, 5},
+                                  {2, 17, 5, 5}, tag::nChw16c, tag::nChw16c,
+                                  false),
+                PARAMS(algorithm::binary_mul, {3, 19, 3, 7}, {1, 19, 1, 1},
+                        tag::nhwc, tag::nchw, true),
+                PARAMS(algorithm::binary_max, {3, 19, 3, 7}, {3, 19, 1, 1},
+                        tag::nchw, tag::nchw, false)));
+
+TEST_P(binary_test_s8, TestsBinary) {}
+INSTANTIATE_TEST_SUITE_P(TestBinaryS8, binary_test_s8,
+        ::testing::Values(PARAMS(algorithm::binary_add, {2, 16, 5, 5},
+                                  {2, 16, 5, 5}, tag::nhwc, tag::nhwc, false),
+                PARAMS(algorithm::binary_mul, {3, 19, 3, 7}, {1, 19, 1, 1},
+                        tag::nChw16c, tag::nchw, false),
+                PARAMS(algorithm::binary_min, {3, 19, 3, 7}, {1, 1, 1, 1},
+                        tag::nchw, tag::nchw, true)));
+
+TEST_P(binary_test_u8, TestsBinary) {}
+INSTANTIATE_TEST_SUITE_P(TestBinaryU8, binary_test_u8,
+        ::testing::Values(PARAMS(algorithm::binary_add, {2, 16, 5, 5},
+                                  {2, 16, 5, 5}, tag::nchw, tag::nchw, false),
+                PARAMS(algorithm::binary_max, {3, 19, 3, 7}, {3, 19, 1, 1},
+                        tag::nhwc, tag::nchw, false)));
+
+// The binary post-op is the binary primitive over the dst of the operation
+TEST(binary_post_op_test, Convolution) {
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    memory::desc src_md({2, 8, 7, 7}, dt::f32, tag::nchw);
+    memory::desc wei_md({16, 8, 3, 3}, dt::f32, tag::oihw);
+    memory::desc dst_md({2, 16, 7, 7}, dt::f32, tag::nchw);
+    memory::desc src1_md({1, 16, 1, 1}, dt::f32, tag::nchw);
+    auto cd = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+
+    post_ops ops;
+    ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+    ops.append_binary(algorithm::binary_mul, src1_md);
+    primitive_attr attr, relu_attr;
+    attr.set_post_ops(ops);
+    post_ops relu_ops;
+    relu_ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+    relu_attr.set_post_ops(relu_ops);
+
+    auto pd = convolution_forward::primitive_desc(cd, attr, eng);
+    auto relu_pd = convolution_forward::primitive_desc(cd, relu_attr, eng);
+    auto binary_pd = binary::primitive_desc(
+            binary::desc(algorithm::binary_mul, dst_md, src1_md, dst_md),
+            eng);
+
+    memory src(src_md, eng), wei(wei_md, eng), src1(src1_md, eng);
+    memory dst(dst_md, eng), ref_dst(dst_md, eng);
+    fill_data<float>(src_md.get_size() / sizeof(float), src);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei);
+    fill_data<float>(src1_md.get_size() / sizeof(float), src1);
+
+    convolution_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1, src1}});
+    convolution_forward(relu_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, ref_dst}});
+    binary(binary_pd).execute(strm,
+            {{DNNL_ARG_SRC_0, ref_dst}, {DNNL_ARG_SRC_1, src1},
+                    {DNNL_ARG_DST, ref_dst}});
+    strm.wait();
+
+    auto d = map_memory<float>(dst);
+    auto r = map_memory<float>(ref_dst);
+    const size_t n = dst_md.get_size() / sizeof(float);
+    for (size_t i = 0; i < n; i++)
+        ASSERT_NEAR(r[i], d[i], 1e-5f * (1.f + std::fabs(r[i])));
+
+    // The post-op src1 is a required argument
+    EXPECT_ANY_THROW(convolution_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}}));
+}
+
+TEST(binary_post_op_test, InnerProduct) {
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    memory::desc src_md({5, 32}, dt::f32, tag::nc);
+    memory::desc wei_md({24, 32}, dt::f32, tag::oi);
+    memory::desc dst_md({5, 24}, dt::f32, tag::nc);
+    memory::desc src1_md({5, 24}, dt::f32, tag::nc);
+    auto ipd = inner_product_forward::desc(
+            prop_kind::forward_inference, src_md, wei_md, dst_md);
+
+    post_ops ops;
+    ops.append_binary(algorithm::binary_add, src1_md);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+
+    auto pd = inner_product_forward::primitive_desc(ipd, attr, eng);
+    auto plain_pd = inner_product_forward::primitive_desc(ipd, eng);
+    auto binary_pd = binary::primitive_desc(
+            binary::desc(algorithm::binary_add, dst_md, src1_md, dst_md),
+            eng);
+
+    memory src(src_md, eng), wei(wei_md, eng), src1(src1_md, eng);
+    memory dst(dst_md, eng), ref_dst(dst_md, eng);
+    fill_data<float>(src_md.get_size() / sizeof(float), src);
+    fill_data<float>(wei_md.get_size() / sizeof(float), wei);
+    fill_data<float>(src1_md.get_size() / sizeof(float), src1);
+
+    inner_product_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_POST_OP_BINARY | DNNL_ARG_SRC_1, src1}});
+    inner_product_forward(plain_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, ref_dst}});
+    binary(binary_pd).execute(strm,
+            {{DNNL_ARG_SRC_0, ref_dst}, {DNNL_ARG_SRC_1, src1},
+                    {DNNL_ARG_DST, ref_dst}});
+    strm.wait();
+
+    auto d = map_memory<float>(dst);
+    auto r = map_memory<float>(ref_dst);
+    const size_t n = dst_md.get_size() / sizeof(float);
+    for (size_t i = 0; i < n; i++)
+        ASSERT_NEAR(r[i], d[i], 1e-5f * (1.f + std::fabs(r[i])));
+}
+
+} // namespace dnnl
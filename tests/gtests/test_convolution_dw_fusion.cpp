@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct dw_fusion_params_t {
+    memory::dim mb, ic, oc, h, w;
+    memory::dim k, stride, padding;
+    bool with_relu_before, with_relu_after;
+};
+
+// The 1x1 convolution with a fused depthwise convolution is compared with the
+// two convolutions executed one after another.
+class convolution_dw_fusion_test
+    : public ::testing::TestWithParam<dw_fusion_params_t> {
+protected:
+    engine eng;
+    stream strm;
+
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "The depthwise convolution post-op is supported on CPU only");
+        eng = engine(get_test_engine_kind(), 0);
+        strm = stream(eng);
+        auto p = GetParam();
+        catch_expected_failures([=]() { Test(p); }, false, dnnl_success);
+    }
+
+    memory make_memory(const memory::desc &md) {
+        auto mem = memory(md, eng);
+        fill_data<float>(md.get_size() / sizeof(float), mem);
+        return mem;
+    }
+
+    memory reorder_to(memory from, const memory::desc &md) {
+        if (from.get_desc() == md) return from;
+        auto to = memory(md, eng);
+        reorder(from, to).execute(strm, from, to);
+        strm.wait();
+        return to;
+    }
+
+    void Test(const dw_fusion_params_t &p) {
+        const memory::dim dw_h = (p.h + 2 * p.padding - p.k) / p.stride + 1;
+        const memory::dim dw_w = (p.w + 2 * p.padding - p.k) / p.stride + 1;
+
+        memory::desc src_md({p.mb, p.ic, p.h, p.w}, dt::f32, tag::nchw);
+        memory::desc wei_md({p.oc, p.ic, 1, 1}, dt::f32, tag::oihw);
+        memory::desc bia_md({p.oc}, dt::f32, tag::x);
+        memory::desc mid_md({p.mb, p.oc, p.h, p.w}, dt::f32, tag::nchw);
+        memory::desc dw_wei_md({p.oc, 1, 1, p.k, p.k}, dt::f32, tag::goihw);
+        memory::desc dst_md({p.mb, p.oc, dw_h, dw_w}, dt::f32, tag::nchw);
+
+        auto src = make_memory(src_md);
+        auto wei = make_memory(wei_md);
+        auto bia = make_memory(bia_md);
+        auto dw_wei = make_memory(dw_wei_md);
+        auto dw_bia = make_memory(bia_md);
+
+        const memory::dims dw_strides = {p.stride, p.stride};
+        const memory::dims dw_padding = {p.padding, p.padding};
+
+        // the reference: two convolutions
+        post_ops ref_ops;
+        if (p.with_relu_before)
+            ref_ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr ref_attr;
+        ref_attr.set_post_ops(ref_ops);
+        auto conv_pd = convolution_forward::primitive_desc(
+                {prop_kind::forward_inference, algorithm::convolution_direct,
+                        src_md, wei_md, bia_md, mid_md, {1, 1}, {0, 0},
+                        {0, 0}},
+                ref_attr, eng);
+
+        post_ops ref_dw_ops;
+        if (p.with_relu_after)
+            ref_dw_ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr ref_dw_attr;
+        ref_dw_attr.set_post_ops(ref_dw_ops);
+        auto dw_pd = convolution_forward::primitive_desc(
+                {prop_kind::forward_inference, algorithm::convolution_direct,
+                        mid_md, dw_wei_md, bia_md, dst_md, dw_strides,
+                        dw_padding, dw_padding},
+                ref_dw_attr, eng);
+
+        auto mid = memory(mid_md, eng);
+        auto ref_dst = memory(dst_md, eng);
+        convolution_forward(conv_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, mid}});
+        convolution_forward(dw_pd).execute(strm,
+                {{DNNL_ARG_SRC, mid}, {DNNL_ARG_WEIGHTS, dw_wei},
+                        {DNNL_ARG_BIAS, dw_bia}, {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+
+        // the fused primitive
+        post_ops ops;
+        if (p.with_relu_before)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        ops.append_dw_conv(p.k, p.stride, p.padding);
+        if (p.with_relu_after)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        auto any_md = [](const memory::desc &md) {
+            memory::dims dims(md.data.dims, md.data.dims + md.data.ndims);
+            return memory::desc(dims, dt::f32, tag::any);
+        };
+        auto fused_pd = convolution_forward::primitive_desc(
+                {prop_kind::forward_inference, algorithm::convolution_direct,
+                        any_md(src_md), any_md(wei_md), bia_md, any_md(mid_md),
+                        {1, 1}, {0, 0}, {0, 0}},
+                attr, eng);
+
+        // the destination is the one of the depthwise convolution
+        auto f_dst_md = fused_pd.dst_desc();
+        ASSERT_EQ(f_dst_md.data.dims[2], dw_h);
+        ASSERT_EQ(f_dst_md.data.dims[3], dw_w);
+
+        auto f_dst = memory(f_dst_md, eng);
+        convolution_forward(fused_pd).execute(strm,
+                {{DNNL_ARG_SRC, reorder_to(src, fused_pd.src_desc())},
+                        {DNNL_ARG_WEIGHTS,
+                                reorder_to(wei, fused_pd.weights_desc())},
+                        {DNNL_ARG_BIAS, bia},
+                        {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_WEIGHTS,
+                                reorder_to(dw_wei,
+                                        fused_pd.query_md(
+                                                query::weights_md, 2))},
+                        {DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_BIAS,
+                                reorder_to(dw_bia,
+                                        fused_pd.query_md(
+                                                query::weights_md, 3))},
+                        {DNNL_ARG_DST, f_dst}});
+        strm.wait();
+
+        compare_data<float>(ref_dst, reorder_to(f_dst, dst_md));
+    }
+};
+
+TEST_P(convolution_dw_fusion_test, TestsDwFusion) {}
+
+INSTANTIATE_TEST_SUITE_P(TestDwFusion, convolution_dw_fusion_test,
+        ::testing::Values(dw_fusion_params_t {2, 16, 32, 10, 10, 3, 1, 1,
+                                  false, false},
+                dw_fusion_params_t {1, 24, 16, 9, 13, 3, 1, 1, true, true},
+                dw_fusion_params_t {2, 8, 16, 12, 7, 3, 2, 1, true, false},
+                dw_fusion_params_t {1, 16, 8, 11, 11, 5, 1, 2, false, true},
+                dw_fusion_params_t {1, 32, 24, 6, 17, 3, 1, 0, true, true}));
+
+TEST(convolution_dw_fusion_attr_test, PostOpsParams) {
+    post_ops ops;
+    ops.append_dw_conv(3, 2, 1);
+    ASSERT_EQ(ops.kind(0), primitive::kind::convolution);
+
+    memory::dim k, s, p;
+    ops.get_params_dw_conv(0, k, s, p);
+    ASSERT_EQ(k, 3);
+    ASSERT_EQ(s, 2);
+    ASSERT_EQ(p, 1);
+
+    // only a single depthwise convolution can be fused
+    EXPECT_ANY_THROW(ops.append_dw_conv(3, 1, 1));
+    // the padding must be smaller than the kernel
+    post_ops bad_ops;
+    EXPECT_ANY_THROW(bad_ops.append_dw_conv(3, 1, 3));
+}
+
+} // namespace dnnl
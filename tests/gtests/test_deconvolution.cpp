@@ -427,6 +427,13 @@ CPU_INST_TEST_CASE(SimpleSmall_NCHW,
 
 );
 
+CPU_INST_TEST_CASE(Strided_NCHW,
+        PARAMS(nchw, oihw, x, nchw, 2, 1, 6, 4, 4, 4, 7, 7, 3, 3, 1, 1, 2, 2),
+        PARAMS(nchw, oihw, x, nchw, 2, 1, 6, 5, 3, 4, 10, 6, 4, 4, 1, 1, 2, 2),
+        PARAMS(nchw, goihw, x, nchw, 2, 2, 6, 4, 4, 4, 8, 8, 4, 4, 1, 1, 2, 2),
+        PARAMS(nchw, oihw, x, nchw, 1, 1, 8, 3, 4, 8, 7, 11, 2, 3, 0, 0, 3,
+                3));
+
 CPU_INST_TEST_CASE(SimpleSmall_Blocked,
         PARAMS(FMT_DATA_BLOCKED, FMT_WEIGHTS_BLOCKED, FMT_BIAS,
                 FMT_DATA_BLOCKED, 2, 1, 32, 12, 12, 32, 13, 13, 3, 3, 0, 0, 1,
@@ -19,6 +19,9 @@
 
 #include "dnnl.hpp"
 
+#include <algorithm>
+#include <string>
+
 namespace dnnl {
 
 class attr_test : public ::testing::Test {
@@ -63,6 +66,53 @@ TEST_F(attr_test, TestScratchpadModeEx) {
     }
 }
 
+TEST_F(attr_test, TestImplSelectionMode) {
+    dnnl::primitive_attr attr;
+    ASSERT_EQ(impl_selection_mode::first, attr.get_impl_selection_mode());
+    for (auto m : {impl_selection_mode::fastest, impl_selection_mode::first}) {
+        attr.set_impl_selection_mode(m);
+        ASSERT_EQ(m, attr.get_impl_selection_mode());
+    }
+}
+
+TEST_F(attr_test, TestImplSelectionModeEx) {
+    engine eng(get_test_engine_kind(), 0);
+
+    memory::desc src_md({2, 8, 7, 7}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    memory::desc wei_md({8, 8, 3, 3}, memory::data_type::f32,
+            memory::format_tag::oihw);
+    memory::desc dst_md({2, 8, 7, 7}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto conv_d = convolution_forward::desc(prop_kind::forward_inference,
+            algorithm::convolution_direct, src_md, wei_md, dst_md, {1, 1},
+            {1, 1}, {1, 1});
+
+    // The implementations that support the problem, in the list order
+    std::vector<std::string> impls;
+    auto conv_pd = convolution_forward::primitive_desc(conv_d, eng);
+    do {
+        impls.push_back(conv_pd.impl_info_str());
+    } while (conv_pd.next_impl());
+
+    dnnl::primitive_attr attr;
+    attr.set_impl_selection_mode(impl_selection_mode::fastest);
+    auto fastest_pd = convolution_forward::primitive_desc(conv_d, attr, eng);
+    std::string fastest = fastest_pd.impl_info_str();
+    ASSERT_NE(std::find(impls.begin(), impls.end(), fastest), impls.end());
+
+    // The winner is remembered and the others are still reachable
+    auto again_pd = convolution_forward::primitive_desc(conv_d, attr, eng);
+    ASSERT_EQ(fastest, std::string(again_pd.impl_info_str()));
+    std::vector<std::string> again_impls;
+    do {
+        again_impls.push_back(again_pd.impl_info_str());
+    } while (again_pd.next_impl());
+    std::sort(impls.begin(), impls.end());
+    std::sort(again_impls.begin(), again_impls.end());
+    ASSERT_EQ(impls, again_impls);
+}
+
 TEST_F(attr_test, TestIntOutputScales) {
     dnnl::primitive_attr attr;
 
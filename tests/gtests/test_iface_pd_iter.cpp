@@ -87,4 +87,27 @@ TEST(pd_next_impl, TestEltwiseImpl) {
     }
 }
 
+TEST(pd_work_estimates, TestInnerProduct) {
+    auto eng = engine(get_test_engine_kind(), 0);
+    const memory::dim mb = 2, ic = 16, oc = 8;
+    const auto f32 = memory::data_type::f32;
+    memory::desc src_md({mb, ic}, f32, memory::format_tag::nc);
+    memory::desc wei_md({oc, ic}, f32, memory::format_tag::oi);
+    memory::desc bia_md({oc}, f32, memory::format_tag::x);
+    memory::desc dst_md({mb, oc}, f32, memory::format_tag::nc);
+
+    inner_product_forward::desc ipd(
+            prop_kind::forward_inference, src_md, wei_md, bia_md, dst_md);
+    inner_product_forward::primitive_desc ippd(ipd, eng);
+
+    const memory::dim scratchpad
+            = ippd.query_s64(query::memory_consumption_s64);
+    const memory::dim sz = sizeof(float);
+    ASSERT_EQ(ippd.query_s64(query::flops_s64), 2 * mb * oc * ic);
+    ASSERT_EQ(ippd.query_s64(query::bytes_read_s64),
+            (mb * ic + oc * ic + oc) * sz + scratchpad);
+    ASSERT_EQ(ippd.query_s64(query::bytes_written_s64),
+            mb * oc * sz + scratchpad);
+}
+
 } // namespace dnnl
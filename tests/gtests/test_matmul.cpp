@@ -0,0 +1,404 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu_isa_traits.hpp"
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+
+struct matmul_test_params {
+    memory::dims src_dims;
+    memory::dims weights_dims;
+    memory::dims bias_dims; // empty if no bias
+    memory::dims dst_dims;
+    tag src_tag;
+    tag weights_tag;
+    tag dst_tag;
+    bool per_n_scales;
+    float sum_scale; // 0 if no sum post-op
+    bool with_relu;
+    bool runtime_dims;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t, typename wei_data_t, typename dst_data_t>
+void compute_ref_matmul(const matmul_test_params &p, const memory &src,
+        const memory &weights, const memory &bias, const memory &dst_orig,
+        const memory &dst, const std::vector<float> &scales) {
+    auto src_ptr = map_memory<src_data_t>(src);
+    auto weights_ptr = map_memory<wei_data_t>(weights);
+    auto dst_orig_ptr = map_memory<dst_data_t>(dst_orig);
+    auto dst_ptr = map_memory<dst_data_t>(dst);
+
+    const memory::desc src_md = src.get_desc();
+    const memory::desc weights_md = weights.get_desc();
+    const memory::desc dst_md = dst.get_desc();
+    const dnnl::impl::memory_desc_wrapper src_mdw(src_md.data);
+    const dnnl::impl::memory_desc_wrapper weights_mdw(weights_md.data);
+    const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.data);
+
+    const int ndims = (int)p.dst_dims.size();
+    const memory::dim M = p.dst_dims[ndims - 2];
+    const memory::dim N = p.dst_dims[ndims - 1];
+    const memory::dim K = p.src_dims[ndims - 1];
+    memory::dim batch = 1;
+    for (int d = 0; d < ndims - 2; ++d)
+        batch *= p.dst_dims[d];
+
+    const bool with_bias = !p.bias_dims.empty();
+    float *bias_ptr = with_bias ? map_memory<float>(bias) : nullptr;
+    const memory::desc bias_md = bias.get_desc();
+    const dnnl::impl::memory_desc_wrapper bias_mdw(bias_md.data);
+
+    dnnl::impl::parallel_nd(batch, M, N,
+            [&](memory::dim b, memory::dim m, memory::dim n) {
+                dnnl::impl::dims_t src_pos, wei_pos, dst_pos, bias_pos;
+                memory::dim b_rem = b;
+                for (int d = ndims - 3; d >= 0; --d) {
+                    const memory::dim idx = b_rem % p.dst_dims[d];
+                    b_rem /= p.dst_dims[d];
+                    dst_pos[d] = idx;
+                    src_pos[d] = p.src_dims[d] == 1 ? 0 : idx;
+                    wei_pos[d] = p.weights_dims[d] == 1 ? 0 : idx;
+                }
+                dst_pos[ndims - 2] = src_pos[ndims - 2] = m;
+                dst_pos[ndims - 1] = wei_pos[ndims - 1] = n;
+
+                float acc = 0;
+                for (memory::dim k = 0; k < K; ++k) {
+                    src_pos[ndims - 1] = wei_pos[ndims - 2] = k;
+                    acc += (float)src_ptr[src_mdw.off_v(src_pos)]
+                            * (float)weights_ptr[weights_mdw.off_v(wei_pos)];
+                }
+                if (with_bias) {
+                    for (int d = 0; d < ndims; ++d)
+                        bias_pos[d] = p.bias_dims[d] == 1 ? 0 : dst_pos[d];
+                    acc += bias_ptr[bias_mdw.off_v(bias_pos)];
+                }
+                acc *= scales[p.per_n_scales ? n : 0];
+
+                const memory::dim dst_off = dst_mdw.off_v(dst_pos);
+                if (p.sum_scale != 0)
+                    acc += p.sum_scale * (float)dst_orig_ptr[dst_off];
+                if (p.with_relu && acc < 0) acc = 0;
+
+                const bool dst_is_bf16 = data_traits<dst_data_t>::data_type
+                        == memory::data_type::bf16;
+                const float out = (float)dst_ptr[dst_off];
+                const float expected = dst_is_bf16
+                        ? (float)bfloat16_t(acc)
+                        : (float)out_round<dst_data_t>(acc);
+                const float eps = dst_is_bf16 ? 1e-2f : 1e-4f * K;
+                ASSERT_NEAR(expected, out, eps * (1.f + std::fabs(expected)));
+            });
+}
+
+template <typename src_data_t, typename wei_data_t, typename dst_data_t>
+class matmul_test : public ::testing::TestWithParam<matmul_test_params> {
+protected:
+    virtual void SetUp() {
+        SKIP_IF(data_traits<src_data_t>::data_type == memory::data_type::bf16
+                        && get_test_engine_kind() == engine::kind::cpu
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "ISA does not support bf16 data type.");
+        auto p = ::testing::TestWithParam<matmul_test_params>::GetParam();
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<matmul_test_params>::GetParam();
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        const auto src_dt = data_traits<src_data_t>::data_type;
+        const auto wei_dt = data_traits<wei_data_t>::data_type;
+        const auto dst_dt = data_traits<dst_data_t>::data_type;
+        const bool with_bias = !p.bias_dims.empty();
+
+        auto rt_dims = [&](const memory::dims &dims) {
+            return p.runtime_dims
+                    ? memory::dims(dims.size(), DNNL_RUNTIME_DIM_VAL)
+                    : dims;
+        };
+
+        // memory descriptors used to create the primitive
+        memory::desc src_md(rt_dims(p.src_dims), src_dt, p.src_tag);
+        memory::desc weights_md(
+                rt_dims(p.weights_dims), wei_dt, p.weights_tag);
+        memory::desc dst_md(rt_dims(p.dst_dims), dst_dt, p.dst_tag);
+        memory::desc bias_md;
+        if (with_bias)
+            bias_md = memory::desc(rt_dims(p.bias_dims),
+                    memory::data_type::f32,
+                    p.bias_dims.size() == 2 ? tag::ab : tag::abc);
+
+        const memory::dim N = p.dst_dims.back();
+        std::vector<float> scales(p.per_n_scales ? N : 1);
+        for (size_t i = 0; i < scales.size(); ++i)
+            scales[i] = 0.5f + 0.25f * (i % 4);
+
+        primitive_attr attr;
+        attr.set_output_scales(p.per_n_scales ? 1 << (p.dst_dims.size() - 1)
+                                              : 0,
+                scales);
+        post_ops ops;
+        if (p.sum_scale != 0) ops.append_sum(p.sum_scale);
+        if (p.with_relu)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        attr.set_post_ops(ops);
+
+        auto matmul_d = with_bias
+                ? matmul::desc(src_md, weights_md, bias_md, dst_md)
+                : matmul::desc(src_md, weights_md, dst_md);
+        auto matmul_pd = matmul::primitive_desc(matmul_d, attr, eng);
+
+        // memory descriptors used to create the memory objects
+        if (p.runtime_dims) {
+            src_md = memory::desc(p.src_dims, src_dt, p.src_tag);
+            weights_md = memory::desc(p.weights_dims, wei_dt, p.weights_tag);
+            dst_md = memory::desc(p.dst_dims, dst_dt, p.dst_tag);
+            if (with_bias)
+                bias_md = memory::desc(p.bias_dims, memory::data_type::f32,
+                        p.bias_dims.size() == 2 ? tag::ab : tag::abc);
+        } else {
+            ASSERT_TRUE(matmul_pd.src_desc() == src_md);
+            ASSERT_TRUE(matmul_pd.weights_desc() == weights_md);
+            ASSERT_TRUE(matmul_pd.dst_desc() == dst_md);
+            if (with_bias) {
+                ASSERT_TRUE(matmul_pd.bias_desc() == bias_md);
+            }
+        }
+
+        auto src = memory(src_md, eng);
+        auto weights = memory(weights_md, eng);
+        auto bias = memory(bias_md, eng);
+        auto dst = memory(dst_md, eng);
+        auto dst_orig = memory(dst_md, eng);
+
+        fill_data<src_data_t>(src_md.get_size() / sizeof(src_data_t), src);
+        fill_data<wei_data_t>(
+                weights_md.get_size() / sizeof(wei_data_t), weights);
+        if (with_bias)
+            fill_data<float>(bias_md.get_size() / sizeof(float), bias);
+        fill_data<dst_data_t>(dst_md.get_size() / sizeof(dst_data_t), dst);
+        {
+            auto dst_ptr = map_memory<dst_data_t>(dst);
+            auto dst_orig_ptr = map_memory<dst_data_t>(dst_orig);
+            for (size_t i = 0; i < dst_md.get_size() / sizeof(dst_data_t);
+                    ++i)
+                dst_orig_ptr[i] = dst_ptr[i];
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, weights}, {DNNL_ARG_DST, dst}};
+        if (with_bias) args.insert({DNNL_ARG_BIAS, bias});
+        matmul(matmul_pd).execute(strm, args);
+        strm.wait();
+
+        compute_ref_matmul<src_data_t, wei_data_t, dst_data_t>(
+                p, src, weights, bias, dst_orig, dst, scales);
+    }
+};
+
+using matmul_test_f32 = matmul_test<float, float, float>;
+using matmul_test_bf16bf16f32 = matmul_test<bfloat16_t, bfloat16_t, float>;
+using matmul_test_bf16 = matmul_test<bfloat16_t, bfloat16_t, bfloat16_t>;
+using matmul_test_u8s8f32 = matmul_test<uint8_t, int8_t, float>;
+using matmul_test_s8s8s32 = matmul_test<int8_t, int8_t, int32_t>;
+
+#define PARAMS(...) matmul_test_params {__VA_ARGS__}
+#define EXPECT_FAIL(...) \
+    matmul_test_params { __VA_ARGS__, true, dnnl_invalid_arguments }
+
+TEST_P(matmul_test_f32, TestsMatMul) {}
+INSTANTIATE_TEST_SUITE_P(TestMatMulF32, matmul_test_f32,
+        ::testing::Values(
+                EXPECT_FAIL({2, 3}, {4, 5}, {}, {2, 5}, tag::ab, tag::ab,
+                        tag::ab, false, 0.f, false, false),
+                EXPECT_FAIL({2, 3}, {3, 5}, {}, {2, 5, 1}, tag::ab, tag::ab,
+                        tag::abc, false, 0.f, false, false),
+                EXPECT_FAIL({2, 2, 3}, {3, 3, 5}, {}, {3, 2, 5}, tag::abc,
+                        tag::abc, tag::abc, false, 0.f, false, false),
+                PARAMS({1, 1}, {1, 1}, {}, {1, 1}, tag::ab, tag::ab, tag::ab,
+                        false, 0.f, false, false),
+                PARAMS({7, 13}, {13, 19}, {}, {7, 19}, tag::ab, tag::ab,
+                        tag::ab, false, 0.f, false, false),
+                PARAMS({7, 13}, {13, 19}, {1, 19}, {7, 19}, tag::ba, tag::ba,
+                        tag::ab, true, 0.f, true, false),
+                PARAMS({7, 13}, {13, 19}, {7, 1}, {7, 19}, tag::ab, tag::ab,
+                        tag::ab, false, 1.5f, false, false),
+                PARAMS({2, 7, 13}, {2, 13, 19}, {1, 1, 19}, {2, 7, 19},
+                        tag::abc, tag::acb, tag::abc, false, 1.f, true,
+                        false),
+                PARAMS({4, 7, 13}, {1, 13, 19}, {4, 7, 19}, {4, 7, 19},
+                        tag::acb, tag::abc, tag::abc, true, 0.f, false,
+                        false),
+                PARAMS({1, 7, 13}, {5, 13, 19}, {}, {5, 7, 19}, tag::abc,
+                        tag::abc, tag::abc, false, 0.5f, true, false),
+                PARAMS({2, 1, 7, 13}, {1, 3, 13, 19}, {}, {2, 3, 7, 19},
+                        tag::abcd, tag::abcd, tag::abcd, false, 0.f, false,
+                        false),
+                PARAMS({3, 7, 13}, {3, 13, 19}, {}, {3, 7, 19}, tag::abc,
+                        tag::abc, tag::abc, false, 0.f, false, true),
+                PARAMS({3, 7, 13}, {1, 13, 19}, {1, 1, 19}, {3, 7, 19},
+                        tag::abc, tag::acb, tag::abc, false, 2.f, true,
+                        true)));
+
+TEST_P(matmul_test_bf16bf16f32, TestsMatMul) {}
+INSTANTIATE_TEST_SUITE_P(TestMatMulBf16Bf16F32, matmul_test_bf16bf16f32,
+        ::testing::Values(
+                PARAMS({7, 13}, {13, 19}, {}, {7, 19}, tag::ab, tag::ab,
+                        tag::ab, false, 0.f, false, false),
+                PARAMS({7, 13}, {13, 19}, {1, 19}, {7, 19}, tag::ba, tag::ab,
+                        tag::ab, true, 0.f, true, false),
+                PARAMS({2, 7, 13}, {1, 13, 19}, {2, 7, 1}, {2, 7, 19},
+                        tag::abc, tag::acb, tag::abc, false, 1.f, false,
+                        false),
+                PARAMS({2, 7, 13}, {2, 13, 19}, {}, {2, 7, 19}, tag::abc,
+                        tag::abc, tag::abc, false, 0.5f, true, true)));
+
+TEST_P(matmul_test_bf16, TestsMatMul) {}
+INSTANTIATE_TEST_SUITE_P(TestMatMulBf16, matmul_test_bf16,
+        ::testing::Values(
+                PARAMS({7, 13}, {13, 19}, {}, {7, 19}, tag::ab, tag::ab,
+                        tag::ab, false, 0.f, false, false),
+                PARAMS({3, 7, 13}, {3, 13, 19}, {1, 1, 19}, {3, 7, 19},
+                        tag::abc, tag::abc, tag::abc, true, 0.f, true, false),
+                PARAMS({7, 13}, {13, 19}, {7, 19}, {7, 19}, tag::ab, tag::ab,
+                        tag::ab, false, 0.f, false, false),
+                PARAMS({3, 7, 13}, {1, 13, 19}, {}, {3, 7, 19}, tag::abc,
+                        tag::abc, tag::abc, false, 0.f, false, true)));
+
+TEST_P(matmul_test_u8s8f32, TestsMatMul) {}
+INSTANTIATE_TEST_SUITE_P(TestMatMulU8S8F32, matmul_test_u8s8f32,
+        ::testing::Values(
+                PARAMS({7, 13}, {13, 19}, {}, {7, 19}, tag::ab, tag::ab,
+                        tag::ab, false, 0.f, false, false),
+                PARAMS({7, 13}, {13, 19}, {1, 19}, {7, 19}, tag::ab, tag::ba,
+                        tag::ab, true, 0.f, true, false),
+                PARAMS({2, 7, 13}, {1, 13, 19}, {2, 1, 19}, {2, 7, 19},
+                        tag::abc, tag::abc, tag::abc, false, 1.f, false,
+                        false),
+                PARAMS({2, 7, 13}, {2, 13, 19}, {}, {2, 7, 19}, tag::abc,
+                        tag::abc, tag::abc, false, 0.f, true, true)));
+
+TEST_P(matmul_test_s8s8s32, TestsMatMul) {}
+INSTANTIATE_TEST_SUITE_P(TestMatMulS8S8S32, matmul_test_s8s8s32,
+        ::testing::Values(
+                PARAMS({7, 13}, {13, 19}, {}, {7, 19}, tag::ab, tag::ab,
+                        tag::ab, false, 0.f, false, false),
+                PARAMS({3, 7, 13}, {3, 13, 19}, {1, 1, 19}, {3, 7, 19},
+                        tag::abc, tag::abc, tag::abc, true, 0.f, true,
+                        false),
+                PARAMS({3, 7, 13}, {1, 13, 19}, {}, {3, 7, 19}, tag::abc,
+                        tag::abc, tag::abc, false, 0.f, false, true)));
+
+// A single primitive created with a runtime M serves several shapes, while
+// the memory with an inconsistent K is rejected at execution.
+TEST(matmul_test_runtime_dims, TestsMatMulRuntimeM) {
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    const auto dt = memory::data_type::f32;
+    const memory::dim K = 13, N = 19;
+    const memory::dim RT = DNNL_RUNTIME_DIM_VAL;
+
+    memory::desc src_rt_md({RT, K}, dt, tag::ab);
+    memory::desc weights_md({K, N}, dt, tag::ab);
+    memory::desc bias_md({1, N}, dt, tag::ab);
+    memory::desc dst_rt_md({RT, N}, dt, tag::ab);
+
+    auto matmul_pd = matmul::primitive_desc(
+            matmul::desc(src_rt_md, weights_md, bias_md, dst_rt_md), eng);
+    auto prim = matmul(matmul_pd);
+
+    auto weights = memory(weights_md, eng);
+    auto bias = memory(bias_md, eng);
+    fill_data<float>(K * N, weights);
+    fill_data<float>(N, bias);
+
+    for (memory::dim M : {3, 17, 1}) {
+        matmul_test_params p {{M, K}, {K, N}, {1, N}, {M, N}, tag::ab, tag::ab,
+                tag::ab, false, 0.f, false, true, false, dnnl_success};
+
+        auto src = memory({p.src_dims, dt, tag::ab}, eng);
+        auto dst = memory({p.dst_dims, dt, tag::ab}, eng);
+        fill_data<float>(M * K, src);
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, weights},
+                        {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        compute_ref_matmul<float, float, float>(
+                p, src, weights, bias, dst, dst, {1.f});
+    }
+
+    // K is known at creation, so the source with K + 1 columns is rejected
+    const memory::dim M = 5;
+    auto src_bad = memory({{M, K + 1}, dt, tag::ab}, eng);
+    auto dst = memory({{M, N}, dt, tag::ab}, eng);
+    dnnl_status_t status = dnnl_success;
+    try {
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, src_bad}, {DNNL_ARG_WEIGHTS, weights},
+                        {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+    } catch (error &e) { status = e.status; }
+    ASSERT_EQ(status, dnnl_invalid_arguments);
+}
+
+// The source is a sub-memory of a bigger buffer, i.e. has a non-zero offset.
+TEST(matmul_test_submemory, TestsMatMulSubmemory) {
+    auto eng = engine(get_test_engine_kind(), 0);
+    auto strm = stream(eng);
+
+    const auto dt = memory::data_type::f32;
+    const memory::dim M = 2, K = 3, N = 5;
+
+    memory::desc src_full_md({2 * M, K}, dt, tag::ab);
+    memory::desc src_md = src_full_md.submemory_desc({M, K}, {M, 0});
+    memory::desc weights_md({K, N}, dt, tag::ab);
+    memory::desc dst_md({M, N}, dt, tag::ab);
+
+    auto src_full = memory(src_full_md, eng);
+    fill_data<float>(2 * M * K, src_full);
+    auto src = memory(src_md, eng, src_full.get_data_handle());
+    auto weights = memory(weights_md, eng);
+    fill_data<float>(K * N, weights);
+    auto dst = memory(dst_md, eng);
+
+    auto matmul_pd = matmul::primitive_desc(
+            matmul::desc(src_md, weights_md, dst_md), eng);
+    matmul(matmul_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, weights},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+
+    matmul_test_params p {{M, K}, {K, N}, {}, {M, N}, tag::ab, tag::ab,
+            tag::ab, false, 0.f, false, false, false, dnnl_success};
+    compute_ref_matmul<float, float, float>(
+            p, src, weights, memory(), dst, dst, {1.f});
+}
+
+} // namespace dnnl
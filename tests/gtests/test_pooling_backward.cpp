@@ -445,6 +445,31 @@ INSTANTIATE_TEST_SUITE_P(TestPooling_nChw8c_padded, pooling_bwd_test_float,
                         EXPAND_SIZES_2D(
                                 4, 28, 60, 60, 31, 31, 4, 2, 1, 1, 2, 2)}));
 
+CPU_INSTANTIATE_TEST_SUITE_P(TestPooling_nhwc, pooling_bwd_test_float,
+        ::testing::Values(
+                pool_bwd_test_params_float {algorithm::pooling_max,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(4, 17, 6, 6, 7, 7, 2, 2, 1, 1, 1, 1)},
+                pool_bwd_test_params_float {
+                        algorithm::pooling_avg_exclude_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                4, 23, 60, 60, 31, 31, 3, 4, 1, 1, 2, 2)},
+                pool_bwd_test_params_float {
+                        algorithm::pooling_avg_include_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                4, 14, 60, 60, 31, 31, 3, 2, 1, 1, 2, 2)},
+                pool_bwd_test_params_float {algorithm::pooling_max,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                2, 32, 13, 13, 13, 13, 3, 3, 1, 1, 1, 1)},
+                pool_bwd_test_params_float {
+                        algorithm::pooling_avg_exclude_padding,
+                        memory::format_tag::nhwc, memory::format_tag::nhwc,
+                        EXPAND_SIZES_2D(
+                                2, 48, 13, 13, 7, 7, 3, 3, 1, 1, 2, 2)}));
+
 CPU_INSTANTIATE_TEST_SUITE_P(TestPoolingBackwardMaxKernelSlipsToPadding,
         pooling_bwd_test_float,
         ::testing::Values(
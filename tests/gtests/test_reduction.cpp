@@ -0,0 +1,246 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <type_traits>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu_isa_traits.hpp"
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct reduction_test_params {
+    algorithm alg;
+    memory::dims src_dims;
+    memory::dims dst_dims;
+    tag src_tag;
+    tag dst_tag;
+    float p;
+    float eps;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename src_data_t, typename dst_data_t>
+void check_reduction(const reduction_test_params &p, const memory &src,
+        const memory &dst) {
+    auto src_ptr = map_memory<src_data_t>(src);
+    auto dst_ptr = map_memory<dst_data_t>(dst);
+
+    const memory::desc src_md = src.get_desc();
+    const memory::desc dst_md = dst.get_desc();
+    const dnnl::impl::memory_desc_wrapper src_mdw(src_md.data);
+    const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.data);
+
+    const int ndims = (int)p.src_dims.size();
+    memory::dim dst_nelems = 1, R = 1;
+    for (int d = 0; d < ndims; ++d) {
+        dst_nelems *= p.dst_dims[d];
+        if (p.dst_dims[d] != p.src_dims[d]) R *= p.src_dims[d];
+    }
+
+    const bool is_bf16 = data_traits<dst_data_t>::data_type == dt::bf16
+            || data_traits<src_data_t>::data_type == dt::bf16;
+
+    dnnl::impl::parallel_nd(dst_nelems, [&](memory::dim i) {
+        dnnl::impl::dims_t pos;
+        memory::dim rem = i;
+        for (int d = ndims - 1; d >= 0; --d) {
+            pos[d] = rem % p.dst_dims[d];
+            rem /= p.dst_dims[d];
+        }
+        const float out = (float)dst_ptr[dst_mdw.off_v(pos)];
+
+        double acc = 0;
+        switch (p.alg) {
+            case algorithm::reduction_max: acc = -INFINITY; break;
+            case algorithm::reduction_min: acc = INFINITY; break;
+            case algorithm::reduction_mul: acc = 1; break;
+            default: break;
+        }
+        for (memory::dim r = 0; r < R; ++r) {
+            memory::dim rem_r = r;
+            for (int d = ndims - 1; d >= 0; --d) {
+                if (p.dst_dims[d] == p.src_dims[d]) continue;
+                pos[d] = rem_r % p.src_dims[d];
+                rem_r /= p.src_dims[d];
+            }
+            const double s = (float)src_ptr[src_mdw.off_v(pos)];
+            switch (p.alg) {
+                case algorithm::reduction_max: acc = std::max(acc, s); break;
+                case algorithm::reduction_min: acc = std::min(acc, s); break;
+                case algorithm::reduction_mul: acc *= s; break;
+                case algorithm::reduction_sum:
+                case algorithm::reduction_mean: acc += s; break;
+                default: acc += std::pow(std::fabs(s), p.p); break;
+            }
+        }
+
+        double res = acc;
+        switch (p.alg) {
+            case algorithm::reduction_mean: res = acc / R; break;
+            case algorithm::reduction_norm_lp_max:
+                res = std::pow(std::max(acc, (double)p.eps), 1. / p.p);
+                break;
+            case algorithm::reduction_norm_lp_sum:
+                res = std::pow(acc + p.eps, 1. / p.p);
+                break;
+            case algorithm::reduction_norm_lp_power_p_max:
+                res = std::max(acc, (double)p.eps);
+                break;
+            case algorithm::reduction_norm_lp_power_p_sum:
+                res = acc + p.eps;
+                break;
+            default: break;
+        }
+
+        float expected = (float)res;
+        if (std::is_integral<dst_data_t>::value)
+            expected = (float)out_round<dst_data_t>(
+                    saturate<dst_data_t>(expected));
+        // Allow one unit of the rounding of the accumulation order
+        const float eps = is_bf16 ? 2e-2f
+                                  : std::is_integral<dst_data_t>::value ? 1.f
+                                                                        : 1e-4f;
+        ASSERT_NEAR(expected, out, eps * (1.f + std::fabs(expected)));
+    });
+}
+
+template <typename src_data_t, typename dst_data_t>
+class reduction_test
+    : public ::testing::TestWithParam<reduction_test_params> {
+protected:
+    virtual void SetUp() {
+        auto p = ::testing::TestWithParam<reduction_test_params>::GetParam();
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<reduction_test_params>::GetParam();
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        const auto src_dt = data_traits<src_data_t>::data_type;
+        const auto dst_dt = data_traits<dst_data_t>::data_type;
+        memory::desc src_md(p.src_dims, src_dt, p.src_tag);
+        memory::desc dst_md(p.dst_dims, dst_dt, p.dst_tag);
+
+        auto reduction_d = reduction::desc(p.alg, src_md, dst_md, p.p, p.eps);
+        auto reduction_pd = reduction::primitive_desc(reduction_d, eng);
+        ASSERT_TRUE(reduction_pd.src_desc() == src_md);
+
+        auto src = memory(src_md, eng);
+        auto dst = memory(reduction_pd.dst_desc(), eng);
+
+        fill_data<src_data_t>(src_md.get_size() / sizeof(src_data_t), src,
+                1., !std::is_unsigned<src_data_t>::value);
+        check_zero_tail<src_data_t>(1, src);
+
+        reduction(reduction_pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        check_reduction<src_data_t, dst_data_t>(p, src, dst);
+        check_zero_tail<dst_data_t>(0, dst);
+    }
+};
+
+using reduction_test_f32 = reduction_test<float, float>;
+using reduction_test_bf16 = reduction_test<bfloat16_t, float>;
+using reduction_test_s8 = reduction_test<int8_t, int8_t>;
+using reduction_test_u8f32 = reduction_test<uint8_t, float>;
+
+#define PARAMS(...) \
+    reduction_test_params { __VA_ARGS__, false, dnnl_success }
+#define EXPECT_FAIL(...) \
+    reduction_test_params { __VA_ARGS__, true, dnnl_invalid_arguments }
+
+TEST_P(reduction_test_f32, TestsReduction) {}
+INSTANTIATE_TEST_SUITE_P(TestReductionF32, reduction_test_f32,
+        ::testing::Values(
+                EXPECT_FAIL(algorithm::reduction_sum, {2, 16, 4, 4},
+                        {2, 8, 1, 1}, tag::nchw, tag::nchw, 0.f, 0.f),
+                EXPECT_FAIL(algorithm::reduction_sum, {2, 16, 4, 4},
+                        {2, 16, 1}, tag::nchw, tag::ncw, 0.f, 0.f),
+                EXPECT_FAIL(algorithm::reduction_norm_lp_sum, {2, 16, 4, 4},
+                        {2, 16, 1, 1}, tag::nchw, tag::any, 0.5f, 0.f),
+                PARAMS(algorithm::reduction_sum, {2, 16, 5, 5}, {2, 16, 1, 1},
+                        tag::nchw, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_mean, {2, 19, 5, 5}, {2, 1, 5, 5},
+                        tag::nchw, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_max, {2, 19, 5, 5}, {2, 1, 5, 5},
+                        tag::nhwc, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_min, {3, 17, 5, 7}, {3, 17, 1, 1},
+                        tag::nChw16c, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_sum, {3, 17, 5, 7}, {3, 1, 5, 7},
+                        tag::nChw16c, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_mul, {3, 4, 2, 3}, {1, 4, 1, 3},
+                        tag::nchw, tag::nchw, 0.f, 0.f),
+                PARAMS(algorithm::reduction_norm_lp_max, {2, 16, 5, 5},
+                        {2, 16, 1, 1}, tag::nchw, tag::any, 2.f, 1e-3f),
+                PARAMS(algorithm::reduction_norm_lp_sum, {2, 16, 5, 5},
+                        {1, 16, 1, 1}, tag::nhwc, tag::nchw, 1.f, 1e-3f),
+                PARAMS(algorithm::reduction_norm_lp_power_p_sum,
+                        {2, 16, 5, 5}, {2, 1, 1, 1}, tag::nchw, tag::any,
+                        3.f, 0.f),
+                PARAMS(algorithm::reduction_norm_lp_power_p_max, {7, 33},
+                        {7, 1}, tag::nc, tag::any, 2.f, 1e-1f),
+                PARAMS(algorithm::reduction_mean, {3, 21, 2, 3, 7},
+                        {3, 21, 1, 1, 1}, tag::nCdhw8c, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_sum, {1, 1, 256, 256},
+                        {1, 1, 1, 1}, tag::nchw, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_max, {2, 300, 64}, {2, 1, 64},
+                        tag::ncw, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_sum, {37}, {37}, tag::x, tag::x,
+                        0.f, 0.f)));
+
+TEST_P(reduction_test_bf16, TestsReduction) {}
+INSTANTIATE_TEST_SUITE_P(TestReductionBf16, reduction_test_bf16,
+        ::testing::Values(PARAMS(algorithm::reduction_sum, {2, 16, 5, 5},
+                                  {2, 16, 1, 1}, tag::nchw, tag::nchw, 0.f,
+                                  0.f),
+                PARAMS(algorithm::reduction_max, {3, 19, 3, 7}, {3, 1, 3, 7},
+                        tag::nhwc, tag::nhwc, 0.f, 0.f),
+                PARAMS(algorithm::reduction_norm_lp_sum, {3, 17, 3, 7},
+                        {3, 17, 1, 1}, tag::nChw16c, tag::nChw16c, 2.f,
+                        0.f)));
+
+TEST_P(reduction_test_s8, TestsReduction) {}
+INSTANTIATE_TEST_SUITE_P(TestReductionS8, reduction_test_s8,
+        ::testing::Values(PARAMS(algorithm::reduction_max, {2, 16, 5, 5},
+                                  {2, 16, 1, 1}, tag::nhwc, tag::any, 0.f,
+                                  0.f),
+                PARAMS(algorithm::reduction_sum, {3, 19, 3, 7}, {3, 1, 3, 7},
+                        tag::nchw, tag::any, 0.f, 0.f),
+                PARAMS(algorithm::reduction_mean, {3, 19, 3, 7},
+                        {1, 19, 1, 1}, tag::nChw16c, tag::any, 0.f, 0.f)));
+
+TEST_P(reduction_test_u8f32, TestsReduction) {}
+INSTANTIATE_TEST_SUITE_P(TestReductionU8F32, reduction_test_u8f32,
+        ::testing::Values(PARAMS(algorithm::reduction_mean, {2, 16, 5, 5},
+                                  {2, 16, 1, 1}, tag::nchw, tag::any, 0.f,
+                                  0.f),
+                PARAMS(algorithm::reduction_norm_lp_max, {3, 19, 3, 7},
+                        {3, 1, 3, 7}, tag::nhwc, tag::any, 2.f, 0.f)));
+
+} // namespace dnnl
@@ -0,0 +1,300 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "cpu_isa_traits.hpp"
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+struct resampling_test_params {
+    algorithm alg;
+    memory::dims src_dims;
+    memory::dims dst_dims;
+    tag src_tag;
+    tag dst_tag;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+// The weights of the points of src for the point o of dst along a dimension
+void compute_taps(algorithm alg, memory::dim I, memory::dim O, memory::dim o,
+        std::vector<memory::dim> &idx, std::vector<float> &wei) {
+    idx.clear();
+    wei.clear();
+    if (alg == algorithm::resampling_nearest) {
+        idx.push_back(std::min(
+                (memory::dim)std::floor((o + 0.5f) * I / O), I - 1));
+        wei.push_back(1.f);
+        return;
+    }
+
+    const float s = std::max((o + 0.5f) * I / O - 0.5f, 0.f);
+    const memory::dim il = std::min((memory::dim)std::floor(s), I - 1);
+    const memory::dim ir = std::min(il + 1, I - 1);
+    const float w1 = s - il;
+    idx.push_back(il);
+    wei.push_back(1.f - w1);
+    idx.push_back(ir);
+    wei.push_back(w1);
+}
+
+template <typename data_t>
+class resampling_test
+    : public ::testing::TestWithParam<resampling_test_params> {
+protected:
+    virtual void SetUp() {
+        auto p = ::testing::TestWithParam<resampling_test_params>::GetParam();
+        catch_expected_failures(
+                [=]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    // Calls f(src_pos, dst_pos, weight) for each pair of points of src and
+    // dst of a nonzero weight
+    template <typename F>
+    void for_each_tap(const resampling_test_params &p, F f) {
+        const int ndims = (int)p.src_dims.size();
+        memory::dim dst_nelems = 1;
+        for (int d = 0; d < ndims; ++d)
+            dst_nelems *= p.dst_dims[d];
+
+        std::vector<memory::dim> idx[3];
+        std::vector<float> wei[3];
+        for (memory::dim i = 0; i < dst_nelems; ++i) {
+            dnnl::impl::dims_t dst_pos, src_pos;
+            memory::dim rem = i;
+            for (int d = ndims - 1; d >= 0; --d) {
+                dst_pos[d] = rem % p.dst_dims[d];
+                rem /= p.dst_dims[d];
+            }
+            src_pos[0] = dst_pos[0];
+            src_pos[1] = dst_pos[1];
+
+            // Pad the spatial dimensions to 3 with the unit ones
+            for (int s = 0; s < 3; ++s) {
+                const int d = ndims - 3 + s;
+                if (d < 2)
+                    compute_taps(p.alg, 1, 1, 0, idx[s], wei[s]);
+                else
+                    compute_taps(p.alg, p.src_dims[d], p.dst_dims[d],
+                            dst_pos[d], idx[s], wei[s]);
+            }
+
+            for (size_t kd = 0; kd < idx[0].size(); ++kd)
+                for (size_t kh = 0; kh < idx[1].size(); ++kh)
+                    for (size_t kw = 0; kw < idx[2].size(); ++kw) {
+                        const float w = wei[0][kd] * wei[1][kh] * wei[2][kw];
+                        if (w == 0.f) continue;
+                        const memory::dim pos[3]
+                                = {idx[0][kd], idx[1][kh], idx[2][kw]};
+                        for (int s = 0; s < 3; ++s)
+                            if (ndims - 3 + s >= 2)
+                                src_pos[ndims - 3 + s] = pos[s];
+                        f(src_pos, dst_pos, w);
+                    }
+        }
+    }
+
+    float eps() const {
+        return data_traits<data_t>::data_type == dt::bf16 ? 2e-2f : 1e-5f;
+    }
+
+    // Compares the points of a tensor, leaving the padding out
+    void check_points(const memory::dims &dims,
+            const dnnl::impl::memory_desc_wrapper &mdw, const data_t *ptr,
+            const std::vector<float> &ref) {
+        const int ndims = (int)dims.size();
+        memory::dim nelems = 1;
+        for (int d = 0; d < ndims; ++d)
+            nelems *= dims[d];
+        for (memory::dim i = 0; i < nelems; ++i) {
+            dnnl::impl::dims_t pos;
+            memory::dim rem = i;
+            for (int d = ndims - 1; d >= 0; --d) {
+                pos[d] = rem % dims[d];
+                rem /= dims[d];
+            }
+            const auto off = mdw.off_v(pos);
+            ASSERT_NEAR(ref[off], (float)ptr[off],
+                    eps() * (1.f + std::fabs(ref[off])));
+        }
+    }
+
+    void check_fwd(const resampling_test_params &p, const memory &src,
+            const memory &dst) {
+        auto src_ptr = map_memory<data_t>(src);
+        auto dst_ptr = map_memory<data_t>(dst);
+        const memory::desc src_md = src.get_desc();
+        const memory::desc dst_md = dst.get_desc();
+        const dnnl::impl::memory_desc_wrapper src_mdw(src_md.data);
+        const dnnl::impl::memory_desc_wrapper dst_mdw(dst_md.data);
+
+        const size_t nelems = dst_md.get_size() / sizeof(data_t);
+        std::vector<float> ref(nelems, 0.f);
+        for_each_tap(p,
+                [&](const dnnl::impl::dims_t &src_pos,
+                        const dnnl::impl::dims_t &dst_pos, float w) {
+                    ref[dst_mdw.off_v(dst_pos)]
+                            += w * (float)src_ptr[src_mdw.off_v(src_pos)];
+                });
+
+        check_points(p.dst_dims, dst_mdw, dst_ptr, ref);
+    }
+
+    void check_bwd(const resampling_test_params &p, const memory &diff_src,
+            const memory &diff_dst) {
+        auto diff_src_ptr = map_memory<data_t>(diff_src);
+        auto diff_dst_ptr = map_memory<data_t>(diff_dst);
+        const memory::desc diff_src_md = diff_src.get_desc();
+        const memory::desc diff_dst_md = diff_dst.get_desc();
+        const dnnl::impl::memory_desc_wrapper diff_src_mdw(diff_src_md.data);
+        const dnnl::impl::memory_desc_wrapper diff_dst_mdw(diff_dst_md.data);
+
+        const size_t nelems = diff_src_md.get_size() / sizeof(data_t);
+        std::vector<float> ref(nelems, 0.f);
+        for_each_tap(p,
+                [&](const dnnl::impl::dims_t &src_pos,
+                        const dnnl::impl::dims_t &dst_pos, float w) {
+                    ref[diff_src_mdw.off_v(src_pos)] += w
+                            * (float)diff_dst_ptr[diff_dst_mdw.off_v(dst_pos)];
+                });
+
+        check_points(p.src_dims, diff_src_mdw, diff_src_ptr, ref);
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<resampling_test_params>::GetParam();
+        SKIP_IF(data_traits<data_t>::data_type == dt::bf16
+                        && !impl::cpu::mayiuse(impl::cpu::avx512_core),
+                "current ISA doesn't support bfloat16 data type");
+        auto eng = engine(get_test_engine_kind(), 0);
+        auto strm = stream(eng);
+
+        const auto data_dt = data_traits<data_t>::data_type;
+        memory::desc src_md(p.src_dims, data_dt, p.src_tag);
+        memory::desc dst_md(p.dst_dims, data_dt, p.dst_tag);
+
+        auto fwd_d = resampling_forward::desc(
+                prop_kind::forward_training, p.alg, src_md, dst_md);
+        auto fwd_pd = resampling_forward::primitive_desc(fwd_d, eng);
+        ASSERT_TRUE(fwd_pd.src_desc() == src_md);
+
+        auto src = memory(src_md, eng);
+        auto dst = memory(fwd_pd.dst_desc(), eng);
+        fill_data<data_t>(src_md.get_size() / sizeof(data_t), src);
+        check_zero_tail<data_t>(1, src);
+
+        resampling_forward(fwd_pd).execute(
+                strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        strm.wait();
+
+        check_fwd(p, src, dst);
+        check_zero_tail<data_t>(0, dst);
+
+        auto bwd_d = resampling_backward::desc(
+                p.alg, src_md, fwd_pd.dst_desc());
+        auto bwd_pd = resampling_backward::primitive_desc(bwd_d, eng, fwd_pd);
+
+        auto diff_dst = memory(bwd_pd.diff_dst_desc(), eng);
+        auto diff_src = memory(bwd_pd.diff_src_desc(), eng);
+        fill_data<data_t>(
+                bwd_pd.diff_dst_desc().get_size() / sizeof(data_t), diff_dst);
+        check_zero_tail<data_t>(1, diff_dst);
+
+        resampling_backward(bwd_pd).execute(strm,
+                {{DNNL_ARG_DIFF_DST, diff_dst},
+                        {DNNL_ARG_DIFF_SRC, diff_src}});
+        strm.wait();
+
+        check_bwd(p, diff_src, diff_dst);
+        check_zero_tail<data_t>(0, diff_src);
+    }
+};
+
+TEST(resampling_test_factors, TestsResampling) {
+    auto eng = engine(get_test_engine_kind(), 0);
+    memory::desc src_md({2, 16, 5, 7}, dt::f32, tag::nchw);
+
+    // The destination is of the scaled dimensions rounded down
+    auto fwd_d = resampling_forward::desc(prop_kind::forward_inference,
+            algorithm::resampling_linear, {2.5f, 0.5f}, src_md);
+    auto fwd_pd = resampling_forward::primitive_desc(fwd_d, eng);
+    ASSERT_EQ(fwd_pd.dst_desc().data.dims[2], 12);
+    ASSERT_EQ(fwd_pd.dst_desc().data.dims[3], 3);
+
+    // The factors must agree with the dimensions
+    memory::desc dst_md({2, 16, 10, 7}, dt::f32, tag::nchw);
+    EXPECT_ANY_THROW(resampling_forward::desc(prop_kind::forward_inference,
+            algorithm::resampling_linear, {3.f, 1.f}, src_md, dst_md));
+}
+
+using resampling_test_f32 = resampling_test<float>;
+using resampling_test_bf16 = resampling_test<bfloat16_t>;
+
+#define PARAMS(...) \
+    resampling_test_params { __VA_ARGS__, false, dnnl_success }
+#define EXPECT_FAIL(...) \
+    resampling_test_params { __VA_ARGS__, true, dnnl_invalid_arguments }
+
+TEST_P(resampling_test_f32, TestsResampling) {}
+INSTANTIATE_TEST_SUITE_P(TestResamplingF32, resampling_test_f32,
+        ::testing::Values(
+                EXPECT_FAIL(algorithm::resampling_linear, {2, 16, 4, 4},
+                        {2, 8, 8, 8}, tag::nchw, tag::nchw),
+                EXPECT_FAIL(algorithm::resampling_linear, {2, 16},
+                        {2, 16}, tag::nc, tag::nc),
+                PARAMS(algorithm::resampling_nearest, {2, 16, 5, 5},
+                        {2, 16, 10, 10}, tag::nchw, tag::any),
+                PARAMS(algorithm::resampling_linear, {2, 16, 5, 5},
+                        {2, 16, 10, 10}, tag::nchw, tag::any),
+                PARAMS(algorithm::resampling_linear, {2, 19, 7, 9},
+                        {2, 19, 3, 4}, tag::nhwc, tag::any),
+                PARAMS(algorithm::resampling_nearest, {2, 19, 7, 9},
+                        {2, 19, 13, 5}, tag::nhwc, tag::nhwc),
+                PARAMS(algorithm::resampling_linear, {3, 17, 5, 7},
+                        {3, 17, 11, 14}, tag::nChw16c, tag::any),
+                PARAMS(algorithm::resampling_linear, {3, 21, 6, 7},
+                        {3, 21, 4, 7}, tag::nChw8c, tag::any),
+                PARAMS(algorithm::resampling_linear, {2, 67, 9},
+                        {2, 67, 20}, tag::nwc, tag::any),
+                PARAMS(algorithm::resampling_nearest, {2, 16, 9},
+                        {2, 16, 4}, tag::ncw, tag::any),
+                PARAMS(algorithm::resampling_linear, {2, 32, 3, 4, 5},
+                        {2, 32, 6, 8, 10}, tag::nCdhw16c, tag::any),
+                PARAMS(algorithm::resampling_nearest, {1, 5, 3, 4, 5},
+                        {1, 5, 5, 3, 7}, tag::ndhwc, tag::any),
+                PARAMS(algorithm::resampling_linear, {1, 3, 3, 4, 5},
+                        {1, 3, 5, 3, 7}, tag::ncdhw, tag::ncdhw)));
+
+TEST_P(resampling_test_bf16, TestsResampling) {}
+INSTANTIATE_TEST_SUITE_P(TestResamplingBf16, resampling_test_bf16,
+        ::testing::Values(PARAMS(algorithm::resampling_linear, {2, 16, 5, 5},
+                                  {2, 16, 10, 10}, tag::nChw16c, tag::any),
+                PARAMS(algorithm::resampling_nearest, {2, 19, 7, 9},
+                        {2, 19, 3, 4}, tag::nhwc, tag::nhwc),
+                PARAMS(algorithm::resampling_linear, {2, 19, 7, 9},
+                        {2, 19, 3, 4}, tag::nchw, tag::nchw)));
+
+} // namespace dnnl
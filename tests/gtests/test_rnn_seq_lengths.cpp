@@ -0,0 +1,249 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+// The RNN primitives created with per-sample sequence lengths are compared
+// with the primitives executed on every sample alone, for its own length.
+class rnn_seq_lengths_test : public ::testing::Test {
+protected:
+    const memory::dim L = 2, D = 1, C = 8;
+    const rnn_direction dir = rnn_direction::unidirectional_left2right;
+
+    engine eng;
+    stream strm;
+
+    void SetUp() override {
+        eng = engine(get_test_engine_kind(), 0);
+        strm = stream(eng);
+    }
+
+    memory make_memory(const memory::desc &md) {
+        auto mem = memory(md, eng);
+        fill_data<float>(md.get_size() / sizeof(float), mem);
+        return mem;
+    }
+
+    memory::desc layer_md(memory::dim T, memory::dim N) {
+        return {{T, N, C}, dt::f32, tag::tnc};
+    }
+    memory::desc iter_md(memory::dim N) {
+        return {{L, D, N, C}, dt::f32, tag::ldnc};
+    }
+
+    // Creates the primitive for a (T, N) problem, with or without sequence
+    // lengths, and executes it with the arguments given.
+    typedef std::function<primitive(memory::dim, memory::dim, rnn_flags)>
+            make_prim_t;
+
+    void test(int G, bool with_c, const make_prim_t &make_prim,
+            const std::vector<int> &lengths) {
+        const memory::dim T = 5, N = (memory::dim)lengths.size();
+
+        memory::desc wei_layer_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+        memory::desc wei_iter_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+        memory::desc bia_md({L, D, G, C}, dt::f32, tag::ldgo);
+        auto wei_layer = make_memory(wei_layer_md);
+        auto wei_iter = make_memory(wei_iter_md);
+        auto bia = make_memory(bia_md);
+
+        auto src_layer = make_memory(layer_md(T, N));
+        auto src_iter = make_memory(iter_md(N));
+        auto src_iter_c = make_memory(iter_md(N));
+        auto dst_layer = memory(layer_md(T, N), eng);
+        auto dst_iter = memory(iter_md(N), eng);
+        auto dst_iter_c = memory(iter_md(N), eng);
+
+        auto seq_lengths = memory({{N}, dt::s32, tag::x}, eng);
+        {
+            auto p = map_memory<int32_t>(seq_lengths);
+            for (memory::dim b = 0; b < N; b++)
+                p[b] = lengths[b];
+        }
+
+        std::unordered_map<int, memory> args = {
+                {DNNL_ARG_SRC_LAYER, src_layer}, {DNNL_ARG_SRC_ITER, src_iter},
+                {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                {DNNL_ARG_WEIGHTS_ITER, wei_iter}, {DNNL_ARG_BIAS, bia},
+                {DNNL_ARG_DST_LAYER, dst_layer}, {DNNL_ARG_DST_ITER, dst_iter},
+                {DNNL_ARG_SEQ_LENGTHS, seq_lengths}};
+        if (with_c) {
+            args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+        }
+        make_prim(T, N, rnn_flags::use_seq_lengths).execute(strm, args);
+        strm.wait();
+
+        // the expected results, gathered from the per-sample executions
+        auto ref_dst_layer = memory(layer_md(T, N), eng);
+        auto ref_dst_iter = memory(iter_md(N), eng);
+        auto ref_dst_iter_c = memory(iter_md(N), eng);
+        {
+            auto r_layer = map_memory<float>(ref_dst_layer);
+            for (memory::dim i = 0; i < T * N * C; i++)
+                r_layer[i] = 0.f;
+        }
+
+        for (memory::dim b = 0; b < N; b++) {
+            const memory::dim len = lengths[b];
+            auto s_src_layer = memory(layer_md(len, 1), eng);
+            auto s_src_iter = memory(iter_md(1), eng);
+            auto s_src_iter_c = memory(iter_md(1), eng);
+            auto s_dst_layer = memory(layer_md(len, 1), eng);
+            auto s_dst_iter = memory(iter_md(1), eng);
+            auto s_dst_iter_c = memory(iter_md(1), eng);
+
+            auto copy_sample = [&](const memory &from, memory &to,
+                                       memory::dim outer, memory::dim n,
+                                       memory::dim from_N, memory::dim to_N,
+                                       memory::dim to_n) {
+                auto f = map_memory<float>(from);
+                auto t = map_memory<float>(to);
+                for (memory::dim o = 0; o < outer; o++)
+                    for (memory::dim c = 0; c < C; c++)
+                        t[(o * to_N + to_n) * C + c]
+                                = f[(o * from_N + n) * C + c];
+            };
+
+            if (len == 0) {
+                // nothing is computed: the states are passed through
+                copy_sample(src_iter, ref_dst_iter, L * D, b, N, N, b);
+                copy_sample(src_iter_c, ref_dst_iter_c, L * D, b, N, N, b);
+                continue;
+            }
+
+            copy_sample(src_layer, s_src_layer, len, b, N, 1, 0);
+            copy_sample(src_iter, s_src_iter, L * D, b, N, 1, 0);
+            copy_sample(src_iter_c, s_src_iter_c, L * D, b, N, 1, 0);
+
+            std::unordered_map<int, memory> s_args = {
+                    {DNNL_ARG_SRC_LAYER, s_src_layer},
+                    {DNNL_ARG_SRC_ITER, s_src_iter},
+                    {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                    {DNNL_ARG_WEIGHTS_ITER, wei_iter}, {DNNL_ARG_BIAS, bia},
+                    {DNNL_ARG_DST_LAYER, s_dst_layer},
+                    {DNNL_ARG_DST_ITER, s_dst_iter}};
+            if (with_c) {
+                s_args.insert({DNNL_ARG_SRC_ITER_C, s_src_iter_c});
+                s_args.insert({DNNL_ARG_DST_ITER_C, s_dst_iter_c});
+            }
+            make_prim(len, 1, rnn_flags::undef).execute(strm, s_args);
+            strm.wait();
+
+            copy_sample(s_dst_layer, ref_dst_layer, len, 0, 1, N, b);
+            copy_sample(s_dst_iter, ref_dst_iter, L * D, 0, 1, N, b);
+            copy_sample(s_dst_iter_c, ref_dst_iter_c, L * D, 0, 1, N, b);
+        }
+
+        compare_data<float>(ref_dst_layer, dst_layer);
+        compare_data<float>(ref_dst_iter, dst_iter);
+        if (with_c) compare_data<float>(ref_dst_iter_c, dst_iter_c);
+    }
+};
+
+TEST_F(rnn_seq_lengths_test, Lstm) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sequence lengths are supported on CPU only");
+    const memory::dim G = 4;
+    memory::desc wei_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+    memory::desc bia_md({L, D, G, C}, dt::f32, tag::ldgo);
+    auto make_prim = [&](memory::dim T, memory::dim N, rnn_flags flags) {
+        auto l_md = layer_md(T, N);
+        auto i_md = iter_md(N);
+        return primitive(lstm_forward(
+                {{prop_kind::forward_inference, dir, l_md, i_md, i_md, wei_md,
+                         wei_md, bia_md, l_md, i_md, i_md, flags},
+                        eng}));
+    };
+
+    // sorted by decreasing lengths, unsorted and with an empty sequence
+    test(G, true, make_prim, {5, 4, 4, 2, 1});
+    test(G, true, make_prim, {2, 5, 1, 3});
+    test(G, true, make_prim, {3, 0, 5});
+}
+
+TEST_F(rnn_seq_lengths_test, Gru) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sequence lengths are supported on CPU only");
+    const memory::dim G = 3;
+    memory::desc wei_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+    memory::desc bia_md({L, D, G, C}, dt::f32, tag::ldgo);
+    auto make_prim = [&](memory::dim T, memory::dim N, rnn_flags flags) {
+        auto l_md = layer_md(T, N);
+        auto i_md = iter_md(N);
+        return primitive(gru_forward(
+                {{prop_kind::forward_inference, dir, l_md, i_md, wei_md,
+                         wei_md, bia_md, l_md, i_md, flags},
+                        eng}));
+    };
+
+    test(G, false, make_prim, {5, 3, 3, 1});
+    test(G, false, make_prim, {1, 0, 5, 2});
+}
+
+TEST_F(rnn_seq_lengths_test, InvalidArguments) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Sequence lengths are supported on CPU only");
+    const memory::dim T = 3, N = 2, G = 1;
+    memory::desc wei_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+    memory::desc bia_md({L, D, G, C}, dt::f32, tag::ldgo);
+    auto prim = vanilla_rnn_forward(
+            {{prop_kind::forward_inference, algorithm::eltwise_tanh, dir,
+                     layer_md(T, N), iter_md(N), wei_md, wei_md, bia_md,
+                     layer_md(T, N), iter_md(N), rnn_flags::use_seq_lengths},
+                    eng});
+
+    auto seq_lengths = memory({{N}, dt::s32, tag::x}, eng);
+    {
+        auto p = map_memory<int32_t>(seq_lengths);
+        p[0] = 2;
+        p[1] = (int32_t)T + 1;
+    }
+    std::unordered_map<int, memory> args
+            = {{DNNL_ARG_SRC_LAYER, make_memory(layer_md(T, N))},
+                    {DNNL_ARG_SRC_ITER, make_memory(iter_md(N))},
+                    {DNNL_ARG_WEIGHTS_LAYER, make_memory(wei_md)},
+                    {DNNL_ARG_WEIGHTS_ITER, make_memory(wei_md)},
+                    {DNNL_ARG_BIAS, make_memory(bia_md)},
+                    {DNNL_ARG_DST_LAYER, memory(layer_md(T, N), eng)},
+                    {DNNL_ARG_DST_ITER, memory(iter_md(N), eng)},
+                    {DNNL_ARG_SEQ_LENGTHS, seq_lengths}};
+
+    // the lengths may not exceed the number of iterations
+    EXPECT_ANY_THROW(prim.execute(strm, args));
+
+    // the sequence lengths are a mandatory argument once requested
+    args.erase(DNNL_ARG_SEQ_LENGTHS);
+    EXPECT_ANY_THROW(prim.execute(strm, args));
+
+    // only the left-to-right direction is supported
+    EXPECT_ANY_THROW(vanilla_rnn_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::eltwise_tanh,
+                    rnn_direction::unidirectional_right2left, layer_md(T, N),
+                    iter_md(N), wei_md, wei_md, bia_md, layer_md(T, N),
+                    iter_md(N), rnn_flags::use_seq_lengths},
+            eng));
+}
+
+} // namespace dnnl
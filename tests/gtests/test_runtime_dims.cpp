@@ -0,0 +1,300 @@
+/*******************************************************************************
+* Copyright 2019 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "dnnl.hpp"
+
+namespace dnnl {
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+static const memory::dim RT = DNNL_RUNTIME_DIM_VAL;
+
+// The primitives created with run-time dimensions are executed for several
+// actual shapes, and their results are compared with the ones of the
+// primitives created for these very shapes.
+class runtime_dims_test : public ::testing::Test {
+protected:
+    engine eng;
+    stream strm;
+
+    void SetUp() override {
+        eng = engine(get_test_engine_kind(), 0);
+        strm = stream(eng);
+    }
+
+    memory make_memory(const memory::desc &md) {
+        auto mem = memory(md, eng);
+        fill_data<float>(md.get_size() / sizeof(float), mem);
+        return mem;
+    }
+
+    dnnl_status_t execute_status(
+            const primitive &p, const std::unordered_map<int, memory> &args) {
+        try {
+            p.execute(strm, args);
+            strm.wait();
+        } catch (error &e) { return e.status; }
+        return dnnl_success;
+    }
+};
+
+TEST_F(runtime_dims_test, Eltwise) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Run-time dimensions are supported on CPU only");
+    auto rt_pd = eltwise_forward::primitive_desc(
+            {prop_kind::forward_inference, algorithm::eltwise_tanh,
+                    {{RT, 16, 3, 5}, dt::f32, tag::nchw}, 0.f, 0.f},
+            eng);
+    auto rt_prim = eltwise_forward(rt_pd);
+
+    for (memory::dim mb : {2, 7, 1}) {
+        memory::desc md({mb, 16, 3, 5}, dt::f32, tag::nchw);
+        auto src = make_memory(md);
+        auto dst = memory(md, eng), ref_dst = memory(md, eng);
+
+        rt_prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        eltwise_forward({{prop_kind::forward_inference,
+                                 algorithm::eltwise_tanh, md, 0.f, 0.f},
+                                eng})
+                .execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+        compare_data<float>(ref_dst, dst);
+    }
+
+    // the channels are known at creation
+    memory::desc bad_md({2, 8, 3, 5}, dt::f32, tag::nchw);
+    auto src = make_memory(bad_md);
+    auto dst = memory(bad_md, eng);
+    ASSERT_EQ(execute_status(
+                      rt_prim, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}}),
+            dnnl_invalid_arguments);
+}
+
+TEST_F(runtime_dims_test, Softmax) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Run-time dimensions are supported on CPU only");
+    auto rt_pd = softmax_forward::primitive_desc(
+            {prop_kind::forward_inference, {{RT, 19}, dt::f32, tag::nc}, 1},
+            eng);
+    auto rt_prim = softmax_forward(rt_pd);
+
+    for (memory::dim mb : {3, 64}) {
+        memory::desc md({mb, 19}, dt::f32, tag::nc);
+        auto src = make_memory(md);
+        auto dst = memory(md, eng), ref_dst = memory(md, eng);
+
+        rt_prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        softmax_forward({{prop_kind::forward_inference, md, 1}, eng})
+                .execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+        compare_data<float>(ref_dst, dst);
+    }
+}
+
+TEST_F(runtime_dims_test, LayerNormalization) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Run-time dimensions are supported on CPU only");
+    const auto flags = normalization_flags(0);
+    auto rt_pd = layer_normalization_forward::primitive_desc(
+            {prop_kind::forward_inference,
+                    {{RT, RT, 32}, dt::f32, tag::tnc}, 1e-5f, flags},
+            eng);
+    auto rt_prim = layer_normalization_forward(rt_pd);
+
+    for (memory::dims dims : {memory::dims {4, 2, 32}, {1, 9, 32}}) {
+        memory::desc md(dims, dt::f32, tag::tnc);
+        auto src = make_memory(md);
+        auto dst = memory(md, eng), ref_dst = memory(md, eng);
+
+        rt_prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+        layer_normalization_forward(
+                {{prop_kind::forward_inference, md, 1e-5f, flags}, eng})
+                .execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+        compare_data<float>(ref_dst, dst);
+    }
+}
+
+TEST_F(runtime_dims_test, InnerProduct) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Run-time dimensions are supported on CPU only");
+    memory::desc wei_md({10, 8, 3, 3}, dt::f32, tag::oihw);
+    memory::desc bia_md({10}, dt::f32, tag::x);
+    auto rt_pd = inner_product_forward::primitive_desc(
+            {prop_kind::forward_inference, {{RT, 8, 3, 3}, dt::f32, tag::nchw},
+                    wei_md, bia_md, {{RT, 10}, dt::f32, tag::nc}},
+            eng);
+    auto rt_prim = inner_product_forward(rt_pd);
+
+    // the weights are reordered to the layout the primitive expects
+    auto user_wei = make_memory(wei_md);
+    auto wei = memory(rt_pd.weights_desc(), eng);
+    reorder(user_wei, wei).execute(strm, user_wei, wei);
+    auto bia = make_memory(bia_md);
+
+    for (memory::dim mb : {5, 1, 33}) {
+        memory::desc src_md({mb, 8, 3, 3}, dt::f32, tag::nchw);
+        memory::desc dst_md({mb, 10}, dt::f32, tag::nc);
+        auto src = make_memory(src_md);
+        auto dst = memory(dst_md, eng), ref_dst = memory(dst_md, eng);
+
+        rt_prim.execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}});
+
+        auto ref_pd = inner_product_forward::primitive_desc(
+                {prop_kind::forward_inference, src_md, wei_md, bia_md, dst_md},
+                eng);
+        auto ref_wei = memory(ref_pd.weights_desc(), eng);
+        reorder(user_wei, ref_wei).execute(strm, user_wei, ref_wei);
+        inner_product_forward(ref_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, ref_wei},
+                        {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+        compare_data<float>(ref_dst, dst);
+    }
+
+    // the source and destination minibatches must match
+    auto src = make_memory({{4, 8, 3, 3}, dt::f32, tag::nchw});
+    auto dst = memory({{3, 10}, dt::f32, tag::nc}, eng);
+    ASSERT_EQ(execute_status(rt_prim,
+                      {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                              {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst}}),
+            dnnl_invalid_arguments);
+}
+
+TEST_F(runtime_dims_test, Lstm) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Run-time dimensions are supported on CPU only");
+    const memory::dim L = 2, D = 1, G = 4, C = 16;
+    const auto dir = rnn_direction::unidirectional_left2right;
+
+    memory::desc wei_layer_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+    memory::desc wei_iter_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+    memory::desc bia_md({L, D, G, C}, dt::f32, tag::ldgo);
+    auto wei_layer = make_memory(wei_layer_md);
+    auto wei_iter = make_memory(wei_iter_md);
+    auto bia = make_memory(bia_md);
+
+    auto lstm_desc = [&](memory::dim T, memory::dim N) {
+        memory::desc layer_md({T, N, C}, dt::f32, tag::tnc);
+        memory::desc iter_md({L, D, N, C}, dt::f32, tag::ldnc);
+        return lstm_forward::desc(prop_kind::forward_inference, dir, layer_md,
+                iter_md, iter_md, wei_layer_md, wei_iter_md, bia_md, layer_md,
+                iter_md, iter_md);
+    };
+    auto rt_prim = lstm_forward({lstm_desc(RT, RT), eng});
+
+    for (memory::dims tn : {memory::dims {3, 2}, {1, 5}, {7, 1}}) {
+        const memory::dim T = tn[0], N = tn[1];
+        memory::desc layer_md({T, N, C}, dt::f32, tag::tnc);
+        memory::desc iter_md({L, D, N, C}, dt::f32, tag::ldnc);
+        auto src_layer = make_memory(layer_md);
+        auto src_iter = make_memory(iter_md);
+        auto src_iter_c = make_memory(iter_md);
+
+        auto execute = [&](const primitive &p, memory &dst_layer,
+                               memory &dst_iter, memory &dst_iter_c) {
+            p.execute(strm,
+                    {{DNNL_ARG_SRC_LAYER, src_layer},
+                            {DNNL_ARG_SRC_ITER, src_iter},
+                            {DNNL_ARG_SRC_ITER_C, src_iter_c},
+                            {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                            {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                            {DNNL_ARG_BIAS, bia},
+                            {DNNL_ARG_DST_LAYER, dst_layer},
+                            {DNNL_ARG_DST_ITER, dst_iter},
+                            {DNNL_ARG_DST_ITER_C, dst_iter_c}});
+            strm.wait();
+        };
+
+        auto dst_layer = memory(layer_md, eng);
+        auto dst_iter = memory(iter_md, eng);
+        auto dst_iter_c = memory(iter_md, eng);
+        execute(rt_prim, dst_layer, dst_iter, dst_iter_c);
+
+        auto ref_dst_layer = memory(layer_md, eng);
+        auto ref_dst_iter = memory(iter_md, eng);
+        auto ref_dst_iter_c = memory(iter_md, eng);
+        execute(lstm_forward({lstm_desc(T, N), eng}), ref_dst_layer,
+                ref_dst_iter, ref_dst_iter_c);
+
+        compare_data<float>(ref_dst_layer, dst_layer);
+        compare_data<float>(ref_dst_iter, dst_iter);
+        compare_data<float>(ref_dst_iter_c, dst_iter_c);
+    }
+}
+
+// The small batches of the static GRU below run the fused cell
+TEST_F(runtime_dims_test, Gru) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Run-time dimensions are supported on CPU only");
+    const memory::dim L = 1, D = 1, G = 3, C = 40;
+    const auto dir = rnn_direction::unidirectional_left2right;
+
+    memory::desc wei_md({L, D, C, G, C}, dt::f32, tag::ldigo);
+    memory::desc bia_md({L, D, G, C}, dt::f32, tag::ldgo);
+    auto wei_layer = make_memory(wei_md);
+    auto wei_iter = make_memory(wei_md);
+    auto bia = make_memory(bia_md);
+
+    auto gru_desc = [&](memory::dim T, memory::dim N) {
+        memory::desc layer_md({T, N, C}, dt::f32, tag::tnc);
+        memory::desc iter_md({L, D, N, C}, dt::f32, tag::ldnc);
+        return gru_forward::desc(prop_kind::forward_inference, dir, layer_md,
+                iter_md, wei_md, wei_md, bia_md, layer_md, iter_md);
+    };
+    auto rt_prim = gru_forward({gru_desc(RT, RT), eng});
+
+    for (memory::dims tn : {memory::dims {4, 3}, {2, 8}, {3, 1}}) {
+        const memory::dim T = tn[0], N = tn[1];
+        memory::desc layer_md({T, N, C}, dt::f32, tag::tnc);
+        memory::desc iter_md({L, D, N, C}, dt::f32, tag::ldnc);
+        auto src_layer = make_memory(layer_md);
+        auto src_iter = make_memory(iter_md);
+
+        auto execute = [&](const primitive &p, memory &dst_layer,
+                               memory &dst_iter) {
+            p.execute(strm,
+                    {{DNNL_ARG_SRC_LAYER, src_layer},
+                            {DNNL_ARG_SRC_ITER, src_iter},
+                            {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                            {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                            {DNNL_ARG_BIAS, bia},
+                            {DNNL_ARG_DST_LAYER, dst_layer},
+                            {DNNL_ARG_DST_ITER, dst_iter}});
+            strm.wait();
+        };
+
+        auto dst_layer = memory(layer_md, eng);
+        auto dst_iter = memory(iter_md, eng);
+        execute(rt_prim, dst_layer, dst_iter);
+
+        auto ref_dst_layer = memory(layer_md, eng);
+        auto ref_dst_iter = memory(iter_md, eng);
+        execute(gru_forward({gru_desc(T, N), eng}), ref_dst_layer,
+                ref_dst_iter);
+
+        compare_data<float>(ref_dst_layer, dst_layer);
+        compare_data<float>(ref_dst_iter, dst_iter);
+    }
+}
+
+} // namespace dnnl